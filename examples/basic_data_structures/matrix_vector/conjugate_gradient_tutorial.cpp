@@ -0,0 +1,165 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/matrix_vector/conjugate_gradient_tutorial.cpp
+ *    \author agent
+ *    \date 2026
+ *
+ *    This tutorial example explains how to solve sparse
+ *    symmetric linear systems with the conjugate gradient
+ *    methods, using different preconditioners or only a
+ *    function that evaluates the matrix-vector product.
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/sparse_solver/sparse_solver.hpp>
+
+
+/* >>> start tutorial code >>> */
+
+const int N = 60;    // grid points per direction
+
+
+// THE PRODUCT WITH THE 2D LAPLACIAN (PLUS IDENTITY):
+// --------------------------------------------------
+void laplacian( double *x, double *f, void *userData ){
+
+    int i, j, k;
+
+    for( i = 0; i < N; i++ ){
+        for( j = 0; j < N; j++ ){
+            k    = i*N+j;
+            f[k] = 5.0*x[k];
+            if( i > 0   ) f[k] -= x[k-N];
+            if( j > 0   ) f[k] -= x[k-1];
+            if( j < N-1 ) f[k] -= x[k+1];
+            if( i < N-1 ) f[k] -= x[k+N];
+        }
+    }
+}
+
+
+int main( ){
+
+    USING_NAMESPACE_ACADO
+
+    const int n = N*N;
+    int i, j, k, run1;
+
+
+    // SETUP THE MATRIX IN SPARSE FORMAT (ROW-WISE):
+    // ---------------------------------------------
+    int    *indices = new int   [5*n];
+    double *values  = new double[5*n];
+    int     nDense  = 0;
+
+    for( i = 0; i < N; i++ ){
+        for( j = 0; j < N; j++ ){
+            k = i*N+j;
+            if( i > 0   ){ indices[nDense] = k*n+k-N; values[nDense++] = -1.0; }
+            if( j > 0   ){ indices[nDense] = k*n+k-1; values[nDense++] = -1.0; }
+                           indices[nDense] = k*n+k  ; values[nDense++] =  5.0;
+            if( j < N-1 ){ indices[nDense] = k*n+k+1; values[nDense++] = -1.0; }
+            if( i < N-1 ){ indices[nDense] = k*n+k+N; values[nDense++] = -1.0; }
+        }
+    }
+
+    double *b    = new double[n];
+    double *x    = new double[n];
+    double *res  = new double[n];
+    double *diag = new double[n];
+
+    for( run1 = 0; run1 < n; run1++ ){
+        b   [run1] = 1.0;
+        diag[run1] = 5.0;
+    }
+
+
+    // SOLVE WITH DIFFERENT PRECONDITIONERS:
+    // -------------------------------------
+    const int nSolvers = 4;
+    const char* name[nSolvers] = { "diagonal              ",
+                                   "block-Jacobi (N)      ",
+                                   "incomplete Cholesky   ",
+                                   "matrix-free (diagonal)" };
+
+    for( run1 = 0; run1 < nSolvers; run1++ ){
+
+        ConjugateGradientMethod *solver;
+
+        double t = -acadoGetTime();
+
+        if( run1 < 3 ){
+            SymmetricConjugateGradientMethod *symmetricSolver = new SymmetricConjugateGradientMethod;
+
+            symmetricSolver->setDimension      ( n       );
+            symmetricSolver->setNumberOfEntries( nDense  );
+            symmetricSolver->setIndices        ( indices );
+
+            if( run1 == 1 ) symmetricSolver->setPreconditioner( PT_BLOCK_JACOBI, N );
+            if( run1 == 2 ) symmetricSolver->setPreconditioner( PT_INCOMPLETE_CHOLESKY );
+
+            symmetricSolver->setMatrix( values );
+            solver = symmetricSolver;
+        }
+        else{
+            MatrixFreeConjugateGradientMethod *matrixFreeSolver = new MatrixFreeConjugateGradientMethod;
+
+            matrixFreeSolver->setDimension( n         );
+            matrixFreeSolver->setOperator ( laplacian );
+            matrixFreeSolver->setMatrix   ( diag      );
+            solver = matrixFreeSolver;
+        }
+
+        solver->setTolerance( 1e-10 );
+        solver->solve( b );
+        solver->getX ( x );
+
+        t += acadoGetTime();
+
+        laplacian( x, res, 0 );
+
+        double error = 0.0;
+        for( k = 0; k < n; k++ )
+            error = acadoMax( error, fabs( res[k]-b[k] ) );
+
+        printf("%s:  TIME = %.6e   ,  error = %.6e \n", name[run1], t, error );
+
+        delete solver;
+    }
+
+    delete[] diag;
+    delete[] res;
+    delete[] x;
+    delete[] b;
+    delete[] values;
+    delete[] indices;
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
@@ -0,0 +1,156 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/integrator/backward_checkpointing.cpp
+ *    \author agent
+ *    \date 2026
+ *
+ *    Compares the runtime of backward sensitivities of a long horizon
+ *    integration with and without checkpointing. For each memory budget
+ *    (MAX_NUM_STORED_INTEGRATOR_STEPS) only the intermediate values of
+ *    that many steps are kept in memory, at the cost of one additional
+ *    forward sweep.
+ *
+ *    The budgets are run in order of increasing memory use, such that the
+ *    growth of the peak resident set size of the process measures the
+ *    memory actually needed by each run (POSIX systems only). The column
+ *    "theor. stored" is the number of steps the budget allows to store.
+ */
+
+
+#include <acado_integrators.hpp>
+
+#if defined(LINUX)
+#include <sys/resource.h>
+#endif
+
+
+/* returns the peak resident set size of the process in kB, or -1 */
+long getPeakMemory( ){
+
+#if defined(LINUX)
+    struct rusage usage;
+    if( getrusage( RUSAGE_SELF,&usage ) == 0 )
+        return usage.ru_maxrss;
+#endif
+    return -1;
+}
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    USING_NAMESPACE_ACADO
+
+    const int nm = 20;  // the number of masses of the chain
+
+    // Define a Right-Hand-Side:
+    // -------------------------
+    DifferentialState    x(nm), v(nm);
+    DifferentialEquation f;
+
+    int i;
+    for( i = 0; i < nm; i++ ){
+
+        IntermediateState a;
+        a = -2.0*x(i) - 0.1*x(i)*x(i)*x(i) - 0.01*v(i);
+
+        if( i > 0    ) a = a + x(i-1);
+        if( i < nm-1 ) a = a + x(i+1);
+
+        f << dot(x(i)) == v(i);
+        f << dot(v(i)) == a;
+    }
+
+
+    // Define an initial value:
+    // ------------------------
+    Vector x0( 2*nm );
+    x0.setZero();
+    x0(0) = 1.0;
+
+    double t_start =   0.0;
+    double t_end   = 200.0;
+
+    Vector seed( 2*nm );
+    seed.setZero();
+    seed(nm-1) = 1.0;
+
+
+    // Run the benchmark for several memory budgets:
+    // ---------------------------------------------
+    int budget[5] = { 5, 20, 100, 1000, 0 };
+
+    long peakMemory = getPeakMemory();
+
+    acadoPrintf("\n  budget  | steps | checkpoints | theor. stored | peak RSS growth [kB] | time [s] \n");
+    acadoPrintf("-----------------------------------------------------------------------------------\n");
+
+    for( i = 0; i < 5; i++ ){
+
+        IntegratorRK45 integrator( f );
+        integrator.set( INTEGRATOR_PRINTLEVEL, NONE );
+        integrator.set( INTEGRATOR_TOLERANCE, 1.0e-8 );
+        integrator.set( MAX_NUM_INTEGRATOR_STEPS, 100000 );
+        integrator.set( MAX_NUM_STORED_INTEGRATOR_STEPS, budget[i] );
+
+        RealClock clock;
+        clock.start();
+
+        integrator.freezeAll();
+        integrator.integrate( t_start, t_end, x0 );
+
+        integrator.setBackwardSeed( 1, seed );
+        integrator.integrateSensitivities();
+
+        clock.stop();
+
+        Vector Dx( 2*nm );
+        integrator.getBackwardSensitivities( Dx,emptyVector,emptyVector,emptyVector,1 );
+
+        int nSteps = integrator.getNumberOfSteps();
+        int nCheckpoints = 0;
+        int nStored      = nSteps;
+
+        if( budget[i] > 0 ){
+            nCheckpoints = (nSteps + budget[i] - 1)/budget[i];
+            nStored      = acadoMin( nSteps, budget[i] );
+        }
+
+        long currentPeak = getPeakMemory();
+
+        if( currentPeak >= 0 )
+            acadoPrintf("  %6d  | %5d | %11d | %13d | %20ld | %.3e  (dx/dx0(0) = %.6e)\n",
+                        budget[i], nSteps, nCheckpoints, nStored, currentPeak-peakMemory, clock.getTime(), Dx(0) );
+        else
+            acadoPrintf("  %6d  | %5d | %11d | %13d | %20s | %.3e  (dx/dx0(0) = %.6e)\n",
+                        budget[i], nSteps, nCheckpoints, nStored, "n/a", clock.getTime(), Dx(0) );
+    }
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
@@ -0,0 +1,148 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/integrator/convergence_order.cpp
+ *    \author agent
+ *    \date 2026
+ *
+ *    Checks the convergence order of the explicit Runge-Kutta integrators
+ *    against a known solution. The system
+ *
+ *        dx/dt = -y + x*( 1 - x^2 - y^2 )
+ *        dy/dt =  x + y*( 1 - x^2 - y^2 )
+ *
+ *    has the solution x = cos(t), y = sin(t) for x(0) = 1, y(0) = 0. Each
+ *    integrator is run with fixed step sizes h (the tolerances are set such
+ *    that no step is rejected and the step size is bounded by h); halving
+ *    h reduces the error by 2^p for a scheme of order p. The step size is
+ *    halved until the error approaches the rounding errors. As the leading
+ *    error terms of some schemes are very small (e.g. Dormand-Prince), the
+ *    observed order may exceed the order of the scheme, i.e. the check
+ *    only requires the observed order to reach it.
+ */
+
+
+#include <acado_integrators.hpp>
+
+
+/* returns the error at t_end when integrating with the fixed step size h */
+double getError( ACADO::Integrator *integrator, double t_end, double h ){
+
+    USING_NAMESPACE_ACADO
+
+    integrator->set( INTEGRATOR_PRINTLEVEL      , NONE    );
+    integrator->set( INTEGRATOR_TOLERANCE       , 1.0e+10 );
+    integrator->set( ABSOLUTE_TOLERANCE         , 1.0e+10 );
+    integrator->set( INITIAL_INTEGRATOR_STEPSIZE, h       );
+    integrator->set( MAX_INTEGRATOR_STEPSIZE    , h       );
+    integrator->set( MIN_INTEGRATOR_STEPSIZE    , h       );
+    integrator->set( MAX_NUM_INTEGRATOR_STEPS   , 100000  );
+
+    double x_start[2] = { 1.0, 0.0 };
+
+    integrator->integrate( 0.0, t_end, x_start );
+
+    Vector xEnd;
+    integrator->getX( xEnd );
+
+    return sqrt( (xEnd(0)-cos(t_end))*(xEnd(0)-cos(t_end)) +
+                 (xEnd(1)-sin(t_end))*(xEnd(1)-sin(t_end)) );
+}
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    USING_NAMESPACE_ACADO
+
+
+    // Define a Right-Hand-Side:
+    // -------------------------
+    DifferentialState    x, y;
+    DifferentialEquation f;
+
+    f << dot(x) == -y + x*( 1.0 - x*x - y*y );
+    f << dot(y) ==  x + y*( 1.0 - x*x - y*y );
+
+
+    // Define the integrators and their expected orders:
+    // -------------------------------------------------
+    const int nInt = 4;
+
+    Integrator *integrator[nInt];
+    integrator[0] = new IntegratorRK45   ( f );
+    integrator[1] = new IntegratorDOPRI5 ( f );
+    integrator[2] = new IntegratorVERNER6( f );
+    integrator[3] = new IntegratorRK78   ( f );
+
+    const char *name[nInt]  = { "RK45", "DOPRI5", "VERNER6", "RK78" };
+    const int   order[nInt] = { 4, 5, 6, 8 };
+
+    double t_end = 2.0;
+
+
+    // Halve the step size and estimate the order:
+    // -------------------------------------------
+    int i, j;
+    int nFailed = 0;
+
+    acadoPrintf("\n  scheme  | order | h = 1, 1/2, 1/4, ...: error (observed order) \n");
+    acadoPrintf("----------------------------------------------------------------------------\n");
+
+    for( i = 0; i < nInt; i++ ){
+
+        double h          = 1.0;
+        double error      = getError( integrator[i], t_end, h );
+        double lastOrder  = 0.0;
+
+        acadoPrintf("  %-7s | %5d | %.2e", name[i], order[i], error );
+
+        for( j = 0; j < 6; j++ ){
+
+            h = 0.5*h;
+
+            double newError = getError( integrator[i], t_end, h );
+            if( newError < 1.0e-12 ) break;
+
+            lastOrder = log( error/newError )/log( 2.0 );
+            error     = newError;
+
+            acadoPrintf("  %.2e (%.2f)", error, lastOrder );
+        }
+
+        if( lastOrder < order[i] - 0.3 ){
+            acadoPrintf("  <-- order mismatch");
+            nFailed++;
+        }
+        acadoPrintf("\n");
+
+        delete integrator[i];
+    }
+
+    return nFailed;
+}
+/* <<< end tutorial code <<< */
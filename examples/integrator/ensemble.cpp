@@ -0,0 +1,132 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/integrator/ensemble.cpp
+ *    \author agent
+ *    \date 2026
+ *
+ *    Monte Carlo simulation of a Van der Pol oscillator with uncertain
+ *    initial states and damping. All samples are integrated in lockstep
+ *    by an IntegratorEnsemble (with 1, 2 and 4 threads to measure the
+ *    scaling) and, for comparison, one after another by an IntegratorRK45.
+ */
+
+
+#include <acado_integrators.hpp>
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    USING_NAMESPACE_ACADO
+
+    const int K = 1000;  // the number of samples
+
+    // Define a Right-Hand-Side:
+    // -------------------------
+    DifferentialState    x, v;
+    Parameter            mu;
+    DifferentialEquation f;
+
+    f << dot(x) == v;
+    f << dot(v) == mu*(1.0-x*x)*v - x;
+
+
+    // Draw the samples:
+    // -----------------
+    Matrix x0( K, 2 ), p( K, 1 );
+
+    int i;
+    srand( 42 );
+    for( i = 0; i < K; i++ ){
+        x0(i,0) = 2.0 + 0.2*( (double) rand()/RAND_MAX - 0.5 );
+        x0(i,1) = 0.0 + 0.2*( (double) rand()/RAND_MAX - 0.5 );
+        p (i,0) = 1.0 + 0.5*( (double) rand()/RAND_MAX - 0.5 );
+    }
+
+    double t_start =  0.0;
+    double t_end   = 20.0;
+
+
+    // Integrate all samples in lockstep with 1, 2 and 4 threads:
+    // -----------------------------------------------------------
+    Matrix xEnd, xEnd1;
+    double mean = 0.0;
+
+    int nThreads;
+    for( nThreads = 1; nThreads <= 4; nThreads *= 2 ){
+
+        acadoSetNumThreads( nThreads );
+
+        IntegratorEnsemble ensemble( f, INT_RK45 );
+        ensemble.set( INTEGRATOR_TOLERANCE, 1.0e-6 );
+
+        RealClock clock;
+        clock.start();
+        ensemble.integrate( t_start, t_end, x0, p );
+        clock.stop();
+
+        ensemble.getX( xEnd );
+        if( nThreads == 1 ) xEnd1 = xEnd;
+
+        mean = 0.0;
+        for( i = 0; i < K; i++ )
+            mean += xEnd(i,0)/K;
+
+        acadoPrintf("ensemble, %d thread(s): time = %.3e s,  mean x(t_end) = %.6e,  max. deviation from 1 thread = %.1e\n",
+                    nThreads, clock.getTime(), mean, (xEnd-xEnd1).absolute().getMax() );
+    }
+    acadoSetNumThreads( 0 );
+
+
+    // Integrate the samples one after another:
+    // ----------------------------------------
+    IntegratorRK45 integrator( f );
+    integrator.set( INTEGRATOR_TOLERANCE, 1.0e-6 );
+
+    RealClock clock2;
+    clock2.start();
+
+    mean = 0.0;
+    for( i = 0; i < K; i++ ){
+
+        Vector xs(2), ps(1), xe;
+        xs(0) = x0(i,0);
+        xs(1) = x0(i,1);
+        ps(0) = p (i,0);
+
+        integrator.integrate( t_start, t_end, xs, emptyVector, ps );
+        integrator.getX( xe );
+        mean += xe(0)/K;
+    }
+    clock2.stop();
+
+    acadoPrintf("sequential            : time = %.3e s,  mean x(t_end) = %.6e\n", clock2.getTime(), mean );
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
@@ -0,0 +1,107 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+ /**
+  *    \file   examples/ocp/limited_memory_bfgs.cpp
+  *    \author agent
+  *    \date   2026
+  *
+  *    Time-optimal rocket problem with a horizon of N = 50 intervals, solved
+  *    with dense (block) BFGS updates and with their limited-memory
+  *    counterparts, which pass the Hessian in compact form to the QP.
+  */
+
+#include <acado_optimal_control.hpp>
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    USING_NAMESPACE_ACADO
+
+
+    DifferentialState        s,v,m      ;     // the differential states
+    Control                  u          ;     // the control input u
+    Parameter                T          ;     // the time horizon T
+    DifferentialEquation     f( 0.0, T );     // the differential equation
+
+//  -------------------------------------
+    OCP ocp( 0.0, T, 50 );                    // time horizon of the OCP: [0,T]
+    ocp.minimizeMayerTerm( T );               // the time T should be optimized
+
+    f << dot(s) == v;                         // an implementation
+    f << dot(v) == (u-0.2*v*v)/m;             // of the model equations
+    f << dot(m) == -0.01*u*u;                 // for the rocket.
+
+    ocp.subjectTo( f                   );     // minimize T s.t. the model,
+    ocp.subjectTo( AT_START, s ==  0.0 );     // the initial values for s,
+    ocp.subjectTo( AT_START, v ==  0.0 );     // v,
+    ocp.subjectTo( AT_START, m ==  1.0 );     // and m,
+
+    ocp.subjectTo( AT_END  , s == 10.0 );     // the terminal constraints for s
+    ocp.subjectTo( AT_END  , v ==  0.0 );     // and v,
+
+    ocp.subjectTo( -0.1 <= v <=  1.7   );     // as well as the bounds on v
+    ocp.subjectTo( -1.1 <= u <=  1.1   );     // the control input u,
+    ocp.subjectTo(  5.0 <= T <= 15.0   );     // and the time horizon T.
+//  -------------------------------------
+
+
+    // SOLVE THE OCP WITH DIFFERENT HESSIAN APPROXIMATIONS:
+    // ---------------------------------------------------
+    const int nRuns = 4;
+    const int hessianApproximation[nRuns] = { FULL_BFGS_UPDATE, BLOCK_BFGS_UPDATE,
+                                              LIMITED_MEMORY_BFGS_UPDATE, BLOCK_LIMITED_MEMORY_BFGS_UPDATE };
+    const char* name[nRuns] = { "full BFGS         ", "block BFGS        ",
+                                "L-BFGS            ", "block L-BFGS      " };
+
+    int run1;
+    for( run1 = 0; run1 < nRuns; run1++ ){
+
+        OptimizationAlgorithm algorithm(ocp);
+
+        algorithm.set( HESSIAN_APPROXIMATION, hessianApproximation[run1] );
+        algorithm.set( BFGS_MEMORY_SIZE, 10 );
+        algorithm.set( MAX_NUM_ITERATIONS, 500 );
+        algorithm.set( PRINTLEVEL, NONE );
+        algorithm.set( PRINT_COPYRIGHT, BT_FALSE );
+
+        RealClock clock;
+        clock.start();
+        returnValue returnvalue = algorithm.solve();
+        clock.stop();
+
+        acadoPrintf("%s: ", name[run1] );
+
+        if( returnvalue != SUCCESSFUL_RETURN )
+            acadoPrintf("failed\n" );
+        else
+            acadoPrintf("time = %.3e s,  objective = %.10e\n",
+                        clock.getTime(), algorithm.getObjectiveValue() );
+    }
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
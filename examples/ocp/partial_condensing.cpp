@@ -0,0 +1,128 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+ /**
+  *    \file   examples/ocp/partial_condensing.cpp
+  *    \author agent
+  *    \date   2026
+  *
+  *    Overhead crane with a horizon of N = 80 intervals, solved once
+  *    with full condensing and once for each of several block sizes of
+  *    the partial condensing in the Riccati-based CP solver.
+  */
+
+#include <acado_optimal_control.hpp>
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    USING_NAMESPACE_ACADO
+
+    // INTRODUCE THE VARIABLES:
+    // -------------------------
+    DifferentialState   x    ;  // the trolley position
+    DifferentialState   v    ;  // the trolley velocity
+    DifferentialState   phi  ;  // the excitation angle
+    DifferentialState   omega;  // the angular velocity
+    Control             ax   ;  // the acc. of the trolley
+
+    const double g = 9.81;  // the gravitational constant
+    const double b = 0.20;  // the friction coefficient
+
+
+    // DEFINE A DIFFERENTIAL EQUATION:
+    // -------------------------------
+    DifferentialEquation f;
+
+    f << dot(  x    ) ==  v                                 ;
+    f << dot(  v    ) ==  ax                                ;
+    f << dot( phi   ) ==  omega                             ;
+    f << dot( omega ) == -g*sin(phi) - ax*cos(phi) - b*omega;
+
+
+    // DEFINE AN OPTIMAL CONTROL PROBLEM:
+    // ----------------------------------
+    Function h;
+    h << x << v << phi << omega << ax;
+
+    Matrix Q = eye(5);
+    Vector r(5);
+    r.setZero();
+
+    OCP ocp( 0.0, 8.0, 80 );
+    ocp.minimizeLSQ( Q, h, r );
+    ocp.subjectTo( f );
+
+    ocp.subjectTo( AT_START, x     == 1.0 );
+    ocp.subjectTo( AT_START, v     == 0.0 );
+    ocp.subjectTo( AT_START, phi   == 0.0 );
+    ocp.subjectTo( AT_START, omega == 0.0 );
+
+    ocp.subjectTo( -1.0 <= ax <= 1.0 );
+    ocp.subjectTo( -0.5 <= v  <= 0.5 );
+
+
+    // SOLVE THE OCP FOR DIFFERENT BLOCK SIZES:
+    // (a block size of 0 denotes full condensing)
+    // -------------------------------------------
+    const int nSizes = 7;
+    const int blockSize[nSizes] = { 0, 1, 2, 4, 8, 16, 80 };
+
+    int run1;
+    for( run1 = 0; run1 < nSizes; run1++ ){
+
+        OptimizationAlgorithm algorithm(ocp);
+
+        algorithm.set( HESSIAN_APPROXIMATION, GAUSS_NEWTON );
+        algorithm.set( KKT_TOLERANCE, 1e-8 );
+        algorithm.set( PRINTLEVEL, NONE );
+        algorithm.set( PRINT_COPYRIGHT, BT_FALSE );
+
+        if( blockSize[run1] > 0 ){
+            algorithm.set( USE_CONDENSING, BT_FALSE );
+            algorithm.set( CONDENSING_BLOCK_SIZE, blockSize[run1] );
+        }
+
+        RealClock clock;
+        clock.start();
+        returnValue returnvalue = algorithm.solve();
+        clock.stop();
+
+        if( blockSize[run1] > 0 )
+            acadoPrintf("block size %2d   : ", blockSize[run1] );
+        else
+            acadoPrintf("full condensing : " );
+
+        if( returnvalue != SUCCESSFUL_RETURN )
+            acadoPrintf("failed\n" );
+        else
+            acadoPrintf("time = %.3e s,  objective = %.10e\n",
+                        clock.getTime(), algorithm.getObjectiveValue() );
+    }
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
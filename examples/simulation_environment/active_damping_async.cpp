@@ -0,0 +1,279 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+ /**
+ *    \file   examples/simulation_environment/active_damping_async.cpp
+ *    \author agent
+ *    \date   2026
+ *
+ *    Active damping example run with asynchronous preparation steps:
+ *    while the process is simulated, the next real-time iteration is
+ *    prepared on a background thread. The feedback controls are compared
+ *    with those of synchronous preparation steps and the missed-deadline
+ *    counter is checked in two scenarios:
+ *
+ *    1) the process simulation leaves time for the preparation,
+ *    2) each feedback step directly follows the preparation step, thus
+ *       every feedback step has to wait.
+ *
+ *    Finally, the values logged by the NLP solver on the background thread
+ *    are compared with those logged during synchronous preparation steps.
+ */
+
+
+#include <acado_toolkit.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+/* runs nSteps feedback/preparation cycles and stores the feedback controls */
+returnValue runLoop(	RealTimeAlgorithm& alg,
+						Process& process,
+						double samplingTime,
+						int nSteps,
+						BooleanType simulateDuringPreparation,
+						Matrix& controls
+						)
+{
+	Vector x0(4);
+	x0.setZero();
+
+	Vector uCon;
+	VariablesGrid ySim;
+
+	double currentTime = 0.0;
+
+	if ( alg.init( currentTime,x0 ) != SUCCESSFUL_RETURN )
+		return RET_CONTROLLAW_INIT_FAILED;
+
+	alg.getU( uCon );
+
+	process.init( currentTime,x0,uCon );
+	process.getY( ySim );
+
+	controls.init( nSteps,uCon.getDim( ) );
+
+	for( int run1 = 0; run1 < nSteps; run1++ )
+	{
+		if ( alg.feedbackStep( currentTime,ySim.getLastVector( ) ) != SUCCESSFUL_RETURN )
+			return RET_CONTROLLAW_STEP_FAILED;
+
+		alg.getU( uCon );
+
+		for( uint run2 = 0; run2 < uCon.getDim( ); run2++ )
+			controls( run1,run2 ) = uCon( run2 );
+
+		// with asynchronous preparation, this call returns immediately
+		if ( alg.preparationStep( ) != SUCCESSFUL_RETURN )
+			return RET_CONTROLLAW_STEP_FAILED;
+
+		if ( simulateDuringPreparation == BT_TRUE )
+		{
+			// the process runs while the next iteration is prepared
+			process.step( currentTime,currentTime+samplingTime,uCon );
+			process.getY( ySim );
+		}
+		else
+		{
+			// the feedback step is due at once and has to wait for the preparation
+			if ( alg.waitForPreparation( ) != SUCCESSFUL_RETURN )
+				return RET_CONTROLLAW_STEP_FAILED;
+
+			process.step( currentTime,currentTime+samplingTime,uCon );
+			process.getY( ySim );
+		}
+
+		currentTime += samplingTime;
+	}
+
+	return alg.waitForPreparation( );
+}
+
+
+/* returns the deviation of the values of a logged item of two algorithms (INFTY if their number differs) */
+double getLogDeviation(	const RealTimeAlgorithm& alg1,
+						const RealTimeAlgorithm& alg2,
+						LogName name
+						)
+{
+	MatrixVariablesGrid values1, values2;
+
+	alg1.getAll( name,values1 );
+	alg2.getAll( name,values2 );
+
+	if ( ( values1.getNumPoints( ) == 0 ) || ( values1.getNumPoints( ) != values2.getNumPoints( ) ) )
+		return INFTY;
+
+	double maxDeviation = 0.0;
+
+	for( uint run1 = 0; run1 < values1.getNumPoints( ); run1++ )
+		maxDeviation = acadoMax( maxDeviation, fabs( values1.getMatrix(run1)(0,0) - values2.getMatrix(run1)(0,0) ) );
+
+	return maxDeviation;
+}
+
+
+int main( )
+{
+    // INTRODUCE THE VARIABLES:
+    // -------------------------
+	DifferentialState xB; //Body Position
+	DifferentialState xW; //Wheel Position
+	DifferentialState vB; //Body Velocity
+	DifferentialState vW; //Wheel Velocity
+
+	Disturbance R;
+	Control F;
+
+	double mB = 350.0;
+	double mW = 50.0;
+	double kS = 20000.0;
+	double kT = 200000.0;
+
+
+    // DEFINE A DIFFERENTIAL EQUATION:
+    // -------------------------------
+    DifferentialEquation f;
+
+	f << dot(xB) == vB;
+	f << dot(xW) == vW;
+	f << dot(vB) == ( -kS*xB + kS*xW + F ) / mB;
+	f << dot(vW) == (  kS*xB - (kT+kS)*xW + kT*R - F ) / mW;
+
+
+    // DEFINE LEAST SQUARE FUNCTION:
+    // -----------------------------
+    Function h;
+
+    h << xB;
+    h << xW;
+	h << vB;
+    h << vW;
+	h << F;
+
+    Matrix Q = zeros(5,5);
+	Q(0,0) = 10.0;
+	Q(1,1) = 10.0;
+	Q(2,2) = 1.0;
+	Q(3,3) = 1.0;
+	Q(4,4) = 1.0e-8;
+
+    Vector r(5);
+    r.setAll( 0.0 );
+
+
+    // DEFINE AN OPTIMAL CONTROL PROBLEM:
+    // ----------------------------------
+    OCP ocp( 0.0, 1.0, 20 );
+
+    ocp.minimizeLSQ( Q, h, r );
+
+	ocp.subjectTo( f );
+
+	ocp.subjectTo( -200.0 <= F <= 200.0 );
+	ocp.subjectTo( R == 0.0 );
+
+
+    // SETTING UP THE (SIMULATED) PROCESS:
+    // -----------------------------------
+	OutputFcn identity;
+	DynamicSystem dynamicSystem( f,identity );
+
+	Process process( dynamicSystem,INT_RK45 );
+
+	VariablesGrid disturbance = readFromFile( "road.txt" );
+	process.setProcessDisturbance( disturbance );
+
+
+    // RUN THE CONTROL LOOPS:
+    // ----------------------
+	const double samplingTime = 0.025;
+	const int    nSteps       = 40;
+
+	Matrix uSync, uAsync, uAsyncWaiting;
+
+	RealTimeAlgorithm algSync( ocp,samplingTime );
+	algSync.set( INTEGRATOR_TYPE, INT_RK78 );
+	algSync.set( USE_IMMEDIATE_FEEDBACK,YES );
+	algSync.set( PRINTLEVEL,NONE );
+
+	RealTimeAlgorithm algAsync( algSync );
+	algAsync.set( USE_ASYNC_PREPARATION,YES );
+
+	RealTimeAlgorithm algAsyncWaiting( algAsync );
+
+	if ( runLoop( algSync,process,samplingTime,nSteps,BT_TRUE,uSync ) != SUCCESSFUL_RETURN )
+		return 1;
+
+	if ( runLoop( algAsync,process,samplingTime,nSteps,BT_TRUE,uAsync ) != SUCCESSFUL_RETURN )
+		return 1;
+
+	if ( runLoop( algAsyncWaiting,process,samplingTime,nSteps,BT_FALSE,uAsyncWaiting ) != SUCCESSFUL_RETURN )
+		return 1;
+
+
+    // CHECK THE RESULTS:
+    // ------------------
+	double maxDeviation = 0.0;
+
+	for( int run1 = 0; run1 < nSteps; run1++ )
+	{
+		maxDeviation = acadoMax( maxDeviation, fabs( uAsync(run1,0) - uSync(run1,0) ) );
+		maxDeviation = acadoMax( maxDeviation, fabs( uAsyncWaiting(run1,0) - uSync(run1,0) ) );
+	}
+
+	acadoPrintf( "max. deviation of feedback controls from synchronous preparation:  %.3e\n", maxDeviation );
+	acadoPrintf( "missed deadlines with process simulation during preparation:        %d of %d\n", algAsync.getNumMissedDeadlines( ),nSteps );
+	acadoPrintf( "missed deadlines without time for preparation:                      %d of %d\n", algAsyncWaiting.getNumMissedDeadlines( ),nSteps );
+	acadoPrintf( "missed deadlines with synchronous preparation:                      %d of %d\n", algSync.getNumMissedDeadlines( ),nSteps );
+
+	double maxLogDeviation = acadoMax( getLogDeviation( algSync,algAsync,LOG_OBJECTIVE_VALUE ),
+									   getLogDeviation( algSync,algAsyncWaiting,LOG_OBJECTIVE_VALUE ) );
+
+	acadoPrintf( "max. deviation of logged objective values:                          %.3e\n", maxLogDeviation );
+
+	// asynchronous preparation must not change the feedback controls and the logs, synchronous
+	// preparation never misses a deadline and each immediate wait misses one
+	if ( ( maxDeviation > 1.0e-10 ) ||
+		 ( maxLogDeviation > 1.0e-8 ) ||
+		 ( algSync.getNumMissedDeadlines( ) != 0 ) ||
+		 ( algAsyncWaiting.getNumMissedDeadlines( ) != nSteps ) ||
+		 ( algAsync.getNumMissedDeadlines( ) > nSteps ) )
+	{
+		acadoPrintf( "FAILED\n" );
+		return 1;
+	}
+
+	acadoPrintf( "OK\n" );
+
+    return 0;
+}
+
+
+
+/*
+ *    end of file
+ */
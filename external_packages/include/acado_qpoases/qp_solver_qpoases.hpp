@@ -177,6 +177,17 @@ class QPsolver_qpOASES : public DenseQPsolver
         virtual returnValue getVarianceCovariance( Matrix &H, Matrix &var );
 
 
+        /** Builds a guess for the working set of the next QP from the \n
+         *  working set of the last one; it is used at the next hotstart \n
+         *  if the QP matrices have not changed.                        \n
+         *
+         *  \return SUCCESSFUL_RETURN
+         */
+        virtual returnValue shiftWorkingSet(	const int* const boundMap,		/**< Map of new to old bounds.      */
+												const int* const constraintMap	/**< Map of new to old constraints. */
+												);
+
+
 
     //
     // PROTECTED MEMBER FUNCTIONS:
@@ -192,6 +203,21 @@ class QPsolver_qpOASES : public DenseQPsolver
 		returnValue updateQPstatus(	qpOASES::returnValue returnvalue
 									);
 
+        /** Returns whether the given QP matrices differ from the ones \n
+         *  the current factorisation is based on.                      \n
+         */
+		BooleanType haveMatricesChanged(	const double* const H,	/**< Hessian matrix.    */
+											const double* const A	/**< Constraint matrix. */
+											) const;
+
+        /** Keeps a copy of the QP matrices the current factorisation is based on. */
+		returnValue storeMatrices(	const double* const H,	/**< Hessian matrix.    */
+									const double* const A	/**< Constraint matrix. */
+									);
+
+        /** Deletes the working set guess and the stored QP matrices. */
+		returnValue clearHotstartData( );
+
 
 
     //
@@ -199,6 +225,12 @@ class QPsolver_qpOASES : public DenseQPsolver
     //
     protected:
 		qpOASES::SQProblem* qp;
+
+		double* lastH;									/**< Hessian matrix of the last QP.      */
+		double* lastA;									/**< Constraint matrix of the last QP.   */
+
+		qpOASES::Bounds*      guessedBounds;			/**< Guessed working set of bounds.      */
+		qpOASES::Constraints* guessedConstraints;		/**< Guessed working set of constraints. */
 };
 
 
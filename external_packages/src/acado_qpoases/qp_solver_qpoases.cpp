@@ -43,12 +43,22 @@ BEGIN_NAMESPACE_ACADO
 QPsolver_qpOASES::QPsolver_qpOASES( ) : DenseQPsolver( )
 {
 	qp = 0;
+
+	lastH = 0;
+	lastA = 0;
+	guessedBounds      = 0;
+	guessedConstraints = 0;
 }
 
 
 QPsolver_qpOASES::QPsolver_qpOASES( UserInteraction* _userInteraction ) : DenseQPsolver( _userInteraction )
 {
 	qp = 0;
+
+	lastH = 0;
+	lastA = 0;
+	guessedBounds      = 0;
+	guessedConstraints = 0;
 }
 
 
@@ -58,11 +68,27 @@ QPsolver_qpOASES::QPsolver_qpOASES( const QPsolver_qpOASES& rhs ) : DenseQPsolve
 		qp = new qpOASES::SQProblem( *(rhs.qp) );
 	else
 		qp = 0;
+
+	lastH = 0;
+	lastA = 0;
+	guessedBounds      = 0;
+	guessedConstraints = 0;
+
+	if ( ( rhs.qp != 0 ) && ( rhs.lastH != 0 ) )
+		storeMatrices( rhs.lastH,rhs.lastA );
+
+	if ( rhs.guessedBounds != 0 )
+		guessedBounds = new qpOASES::Bounds( *(rhs.guessedBounds) );
+
+	if ( rhs.guessedConstraints != 0 )
+		guessedConstraints = new qpOASES::Constraints( *(rhs.guessedConstraints) );
 }
 
 
 QPsolver_qpOASES::~QPsolver_qpOASES( )
 {
+	clearHotstartData( );
+
 	if ( qp != 0 )
 		delete qp;
 }
@@ -74,6 +100,8 @@ QPsolver_qpOASES& QPsolver_qpOASES::operator=( const QPsolver_qpOASES& rhs )
     {
 		DenseQPsolver::operator=( rhs );
 
+		clearHotstartData( );
+
 		if ( qp != 0 )
 			delete qp;
 
@@ -83,6 +111,14 @@ QPsolver_qpOASES& QPsolver_qpOASES::operator=( const QPsolver_qpOASES& rhs )
 		else
 			qp = 0;
 
+		if ( ( rhs.qp != 0 ) && ( rhs.lastH != 0 ) )
+			storeMatrices( rhs.lastH,rhs.lastA );
+
+		if ( rhs.guessedBounds != 0 )
+			guessedBounds = new qpOASES::Bounds( *(rhs.guessedBounds) );
+
+		if ( rhs.guessedConstraints != 0 )
+			guessedConstraints = new qpOASES::Constraints( *(rhs.guessedConstraints) );
     }
 
     return *this;
@@ -123,13 +159,22 @@ returnValue QPsolver_qpOASES::solve(	const double* const H,
 	/* call to qpOASES, using hotstart if possible and desired */
 	numberOfSteps = maxIter;
 	qpOASES::returnValue returnvalue;
+	BooleanType wasSolved = isSolved( );
 	qpStatus = QPS_SOLVING;
 
+	/* limit the computation time if a time budget is given */
+	double maxTime = -1.0;
+	get( MAX_QP_SOLVER_TIME,maxTime );
+
+	double cputime = maxTime;
+	double* const maxCputime = ( maxTime > 0.0 ) ? &cputime : 0;
+
 	//printf( "nV: %d,  nC: %d \n",qp->getNV(),qp->getNC() );
 
 	if ( qp->isInitialised( ) == qpOASES::BT_FALSE )
 	{
-		returnvalue = qp->init( H,g,A,lb,ub,lbA,ubA,numberOfSteps,0 );
+		returnvalue = qp->init( H,g,A,lb,ub,lbA,ubA,numberOfSteps,maxCputime );
+		storeMatrices( H,A );
 	}
 	else
 	{
@@ -138,17 +183,52 @@ returnValue QPsolver_qpOASES::solve(	const double* const H,
 
 		if ( performHotstart == 1 )
 		{
-			 returnvalue = qp->hotstart( H,g,A,lb,ub,lbA,ubA,numberOfSteps,0 );
+			if ( ( wasSolved == BT_TRUE ) && ( haveMatricesChanged( H,A ) == BT_FALSE ) )
+			{
+				/* QP matrices are unchanged, thus only the vectors are passed
+				 * in order to keep the current factorisation */
+				if ( guessedBounds != 0 )
+					returnvalue = qp->hotstart( g,lb,ub,lbA,ubA,numberOfSteps,maxCputime,guessedBounds,guessedConstraints );
+				else
+					returnvalue = qp->hotstart( g,lb,ub,lbA,ubA,numberOfSteps,maxCputime );
+			}
+			else
+			{
+				/* QP matrices have changed, thus the working set of the last QP
+				 * is used for a refactorisation */
+				returnvalue = qp->hotstart( H,g,A,lb,ub,lbA,ubA,numberOfSteps,maxCputime );
+				storeMatrices( H,A );
+			}
+
+			/* a misleading working set guess must not spoil the QP solution */
+			if ( ( guessedBounds != 0 ) &&
+				 ( returnvalue != qpOASES::SUCCESSFUL_RETURN ) && ( returnvalue != qpOASES::RET_MAX_NWSR_REACHED ) )
+			{
+				numberOfSteps = maxIter;
+				cputime = maxTime;
+				qp->reset( );
+				returnvalue = qp->init( H,g,A,lb,ub,lbA,ubA,numberOfSteps,maxCputime );
+				storeMatrices( H,A );
+			}
 		}
 		else
 		{
 			/* if no hotstart is desired, reset QP and use cold start */
 			qp->reset( );
-			returnvalue = qp->init( H,g,A,lb,ub,lbA,ubA,numberOfSteps,0 );
+			returnvalue = qp->init( H,g,A,lb,ub,lbA,ubA,numberOfSteps,maxCputime );
+			storeMatrices( H,A );
 		}
 	}
 	setLast( LOG_NUM_QP_ITERATIONS, numberOfSteps );
 
+	/* the working set guess is only used once */
+	if ( guessedBounds != 0 )
+		delete guessedBounds;
+	if ( guessedConstraints != 0 )
+		delete guessedConstraints;
+	guessedBounds      = 0;
+	guessedConstraints = 0;
+
 //	acadoPrintf( "nEC: %d\n", qp->getNEC( ) );
 
 	/* update QP status and determine return value */
@@ -340,6 +420,62 @@ returnValue QPsolver_qpOASES::getVarianceCovariance( Matrix &H, Matrix &var ){
 
 
 
+returnValue QPsolver_qpOASES::shiftWorkingSet(	const int* const boundMap,
+												const int* const constraintMap
+												)
+{
+	if ( ( qp == 0 ) || ( qp->isInitialised( ) == qpOASES::BT_FALSE ) || ( isSolved( ) == BT_FALSE ) )
+		return SUCCESSFUL_RETURN;
+
+	int run1;
+	int nV = qp->getNV( );
+	int nC = qp->getNC( );
+
+	qpOASES::Bounds      lastBounds;
+	qpOASES::Constraints lastConstraints;
+
+	qp->getBounds( lastBounds );
+	qp->getConstraints( lastConstraints );
+
+	if ( guessedBounds != 0 )
+		delete guessedBounds;
+	if ( guessedConstraints != 0 )
+		delete guessedConstraints;
+
+	guessedBounds      = new qpOASES::Bounds( nV );
+	guessedConstraints = new qpOASES::Constraints( nC );
+
+	for( run1 = 0; run1 < nV; run1++ )
+	{
+		qpOASES::SubjectToStatus status = qpOASES::ST_INACTIVE;
+
+		if ( ( boundMap[run1] >= 0 ) && ( boundMap[run1] < nV ) )
+			status = lastBounds.getStatus( boundMap[run1] );
+
+		if ( ( status != qpOASES::ST_LOWER ) && ( status != qpOASES::ST_UPPER ) )
+			status = qpOASES::ST_INACTIVE;
+
+		guessedBounds->setupBound( run1,status );
+	}
+
+	for( run1 = 0; run1 < nC; run1++ )
+	{
+		qpOASES::SubjectToStatus status = qpOASES::ST_INACTIVE;
+
+		if ( ( constraintMap[run1] >= 0 ) && ( constraintMap[run1] < nC ) )
+			status = lastConstraints.getStatus( constraintMap[run1] );
+
+		if ( ( status != qpOASES::ST_LOWER ) && ( status != qpOASES::ST_UPPER ) )
+			status = qpOASES::ST_INACTIVE;
+
+		guessedConstraints->setupConstraint( run1,status );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
@@ -352,6 +488,7 @@ returnValue QPsolver_qpOASES::setupQPobject( uint nV, uint nC )
 
 	/* create new qpOASES QP object... */
 	qp = new qpOASES::SQProblem( nV,nC );
+	clearHotstartData( );
 	
 	/* ... and define its printLevel */
 	int printLevel = 0;
@@ -408,6 +545,87 @@ returnValue QPsolver_qpOASES::updateQPstatus( qpOASES::returnValue returnvalue )
 }
 
 
+BooleanType QPsolver_qpOASES::haveMatricesChanged(	const double* const H,
+													const double* const A
+													) const
+{
+	if ( ( lastH == 0 ) || ( lastA == 0 ) )
+		return BT_TRUE;
+
+	int run1;
+	int nV = qp->getNV( );
+	int nC = qp->getNC( );
+
+	if ( ( H == 0 ) || ( ( A == 0 ) && ( nC > 0 ) ) )
+		return BT_TRUE;
+
+	for( run1 = 0; run1 < nV*nV; run1++ )
+		if ( H[run1] != lastH[run1] )
+			return BT_TRUE;
+
+	for( run1 = 0; run1 < nC*nV; run1++ )
+		if ( A[run1] != lastA[run1] )
+			return BT_TRUE;
+
+	return BT_FALSE;
+}
+
+
+returnValue QPsolver_qpOASES::storeMatrices(	const double* const H,
+												const double* const A
+												)
+{
+	int run1;
+	int nV = qp->getNV( );
+	int nC = qp->getNC( );
+
+	if ( ( H == 0 ) || ( ( A == 0 ) && ( nC > 0 ) ) )
+	{
+		if ( lastH != 0 )
+			delete[] lastH;
+		if ( lastA != 0 )
+			delete[] lastA;
+		lastH = 0;
+		lastA = 0;
+		return SUCCESSFUL_RETURN;
+	}
+
+	if ( lastH == 0 )
+		lastH = new double[nV*nV];
+
+	if ( lastA == 0 )
+		lastA = new double[nC*nV+1];
+
+	for( run1 = 0; run1 < nV*nV; run1++ )
+		lastH[run1] = H[run1];
+
+	for( run1 = 0; run1 < nC*nV; run1++ )
+		lastA[run1] = A[run1];
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue QPsolver_qpOASES::clearHotstartData( )
+{
+	if ( lastH != 0 )
+		delete[] lastH;
+	if ( lastA != 0 )
+		delete[] lastA;
+	if ( guessedBounds != 0 )
+		delete guessedBounds;
+	if ( guessedConstraints != 0 )
+		delete guessedConstraints;
+
+	lastH = 0;
+	lastA = 0;
+	guessedBounds      = 0;
+	guessedConstraints = 0;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
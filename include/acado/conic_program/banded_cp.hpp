@@ -83,6 +83,15 @@ class BandedCP{
         inline BooleanType isSDP() const;
 
 
+        /** Returns whether or not the Hessian has a low-rank part */
+        inline BooleanType hasLowRankHessian() const;
+
+        /** Returns the full Hessian, i.e. hessian + W*M*W^T with the \n
+         *  low-rank part added explicitly.                          \n
+         *  \return SUCCESSFUL_RETURN */
+        returnValue getHessian( BlockMatrix& H ) const;
+
+
 
     //
     // PUBLIC DATA MEMBERS:
@@ -100,6 +109,8 @@ class BandedCP{
     // -----------------------------------------------------------------------------------
 
     BlockMatrix                   hessian;    /**< the Hessian matrix                  */
+    BlockMatrix      hessianLowRankFactor;    /**< low-rank factor W of the Hessian    */
+    BlockMatrix      hessianLowRankWeight;    /**< weight M of the low-rank part       */
     BlockMatrix         objectiveGradient;    /**< the gradient of the objective       */
 
     BlockMatrix        lowerBoundResiduum;    /**< lower residuum of the bounds        */
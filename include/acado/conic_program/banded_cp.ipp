@@ -59,6 +59,13 @@ inline BooleanType BandedCP::isSDP() const{
 }
 
 
+inline BooleanType BandedCP::hasLowRankHessian() const{
+
+    if( hessianLowRankFactor.isEmpty() == BT_TRUE ) return BT_FALSE;
+    return BT_TRUE;
+}
+
+
 
 
 CLOSE_NAMESPACE_ACADO
@@ -135,12 +135,46 @@ class BandedCPsolver: public AlgorithmicBase
 		virtual returnValue unfreezeCondensing( );
 
 
+        /** Sets the barrier parameter of a single primal-dual Newton step  \n
+         *  on the barrier problem, which is taken by solve instead of      \n
+         *  solving the CP to optimality (if supported by the solver).      \n
+         *                                                                  \n
+         *  \return SUCCESSFUL_RETURN                                       \n
+         *          RET_BARRIER_STEP_NOT_AVAILABLE                          \n
+         *          RET_NOT_IMPLEMENTED_IN_BASE_CLASS                       \n
+         */
+		virtual returnValue setBarrierParameter(	double barrierParameter_
+													);
+
+
+        /** Shifts the working set of the last solution by one stage along  \n
+         *  the horizon, in step with the shift of the OCP iterate, such    \n
+         *  that the next CP can be warm-started from it. Solvers without   \n
+         *  an active-set warm start do nothing.                            \n
+         *                                                                  \n
+         *  \param cp  the banded conic program that has been solved last   \n
+         *                                                                  \n
+         *  \return SUCCESSFUL_RETURN                                        \n
+         */
+		virtual returnValue shiftWorkingSet(	const BandedCP& cp
+												);
+
+
 
 	protected:
 
 		virtual returnValue setupOptions( );
 		virtual returnValue setupLogging( );
 
+
+        /** Checks whether the Hessian is positive definite and projects \n
+         *  the Hessian based on a heuristic damping factor. If this     \n
+         *  damping factor is smaller than 0, the routine does nothing.  \n
+         *                                                               \n
+         *  \return SUCCESSFUL_RETURN.                                   \n
+         */
+        returnValue projectHessian( Matrix &H_, double dampingFactor );
+
 };
 
 
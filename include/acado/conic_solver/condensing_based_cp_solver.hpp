@@ -147,12 +147,27 @@ class CondensingBasedCPsolver: public BandedCPsolver {
 		virtual returnValue unfreezeCondensing( );
 
 
+		virtual returnValue shiftWorkingSet(	const BandedCP& cp
+												);
+
+
 
     //
     // PROTECTED MEMBER FUNCTIONS:
     //
     protected:
 
+        /** Determines the stage of a constraint block from the nonzero blocks \n
+         *  of its gradient. The stage is set to -1 if the block couples      \n
+         *  several stages.                                                    \n
+         *  \return SUCCESSFUL_RETURN                                           \n
+         */
+        returnValue getConstraintBlockStage(	const BandedCP& cp,	/**< Banded CP.              */
+												uint block,			/**< Index of the block.     */
+												int& stage			/**< OUTPUT: stage of block. */
+												) const;
+
+
         /** Initializes QP objects.
 		 *  \return SUCCESSFUL_RETURN \n
 		 *          RET_QP_INIT_FAILED */
@@ -176,14 +191,36 @@ class CondensingBasedCPsolver: public BandedCPsolver {
         virtual returnValue solveQPsubproblem( );
 
 
+        /** Projects the dense Hessian onto the positive definite cone and    \n
+         *  applies Levenberg-Marquardt regularisation, if desired.           \n
+         *  \return SUCCESSFUL_RETURN                                         \n
+         *          RET_ILLFORMED_HESSIAN_MATRIX                              */
+        returnValue regularizeHessian( );
+
+
+        /** Solves the dense QP for the predicted initial value and computes  \n
+         *  the derivative of its primal-dual solution with respect to the    \n
+         *  initial value while keeping the active set fixed (tangential      \n
+         *  predictor). The predictor is left unprepared if the QP cannot be  \n
+         *  solved or its active set is degenerate.                           \n
+         *  \return SUCCESSFUL_RETURN                                         */
+        returnValue prepareTangentialPredictor( );
+
+
+        /** Obtains the solution of the dense QP for the current real-time    \n
+         *  parameters from the tangential predictor.                         \n
+         *  \return BT_TRUE  iff the predicted solution has been stored, i.e. \n
+         *                   the active set does not change,                  \n
+         *          BT_FALSE if the full QP needs to be solved                */
+        BooleanType applyTangentialPredictor( );
+
+
+        /** Returns whether the given bound (idx < nV) or constraint          \n
+         *  (idx >= nV) is active in the solution the tangential predictor is \n
+         *  based on. Components of the initial value are always active.      */
+        BooleanType isActiveInPredictor(	uint idx
+											) const;
 
-        /** Checks whether the Hessian is positive definite and projects \n
-         *  the Hessian based on a heuristic damping factor. If this     \n
-         *  damping factor is smaller than 0, the routine does nothing.  \n
-         *                                                               \n
-         *  \return SUCCESSFUL_RETURN.                                   \n
-         */
-        returnValue projectHessian( Matrix &H_, double dampingFactor );
 
 
 		// --------
@@ -218,6 +255,13 @@ class CondensingBasedCPsolver: public BandedCPsolver {
 		returnValue computeCondensingOperator(	BandedCP& cp
 												);
 
+		/** Stores the sensitivities of the given stage, which are used by \n
+		 *  the condensing operator, if they differ from the stored ones.  \n
+		 *  \return BT_TRUE iff the sensitivities have changed            */
+		BooleanType updateDynGradient(	const BandedCP& cp,
+										uint stage
+										);
+
 
         virtual returnValue getRelaxedQPdimensions(	InfeasibleQPhandling infeasibleQPhandling,
 													uint& _nV,	/**< OUTPUT: Number of relaxed QP variables. */
@@ -266,6 +310,8 @@ class CondensingBasedCPsolver: public BandedCPsolver {
         BlockMatrix   T;    /**< the condensing operator */
         BlockMatrix   d;    /**< the condensing offset   */
 
+        BlockMatrix   dynGradient;    /**< the sensitivities the condensing operator is based on */
+
 		BlockMatrix  hT;
         // ------------------------------------------------
 
@@ -289,6 +335,16 @@ class CondensingBasedCPsolver: public BandedCPsolver {
 
 		Vector deltaX;
 		Vector deltaP;
+
+
+        // THE TANGENTIAL PREDICTOR:
+        // ----------------------------------------------------------------------
+		BooleanType isPredictorPrepared;  /**< Flag indicating whether the predictor is up to date          */
+		Vector predictorPrimal;           /**< Primal solution of the QP for the predicted initial value    */
+		Vector predictorDual;             /**< Merged dual solution of the QP for the predicted initial value */
+		Matrix predictorPrimalSens;       /**< Derivative of the primal solution w.r.t. the initial value   */
+		Matrix predictorDualSens;         /**< Derivative of the dual solution w.r.t. the initial value     */
+        // ----------------------------------------------------------------------
 };
 
 
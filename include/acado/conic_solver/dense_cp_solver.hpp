@@ -112,6 +112,19 @@ class DenseCPsolver : public AlgorithmicBase
         virtual uint getNumberOfIterations( ) const = 0;
 
 
+        /** Shifts the working set of the last solution in order to provide a \n
+         *  guess for the next CP. Entry i of each map holds the index of the \n
+         *  old bound (constraint) whose status is to be taken over by bound  \n
+         *  (constraint) i, or -1 if it shall be guessed inactive. Solvers    \n
+         *  which cannot make use of such a guess ignore it.                  \n
+         *                                                                    \n
+         *  \return SUCCESSFUL_RETURN                                          \n
+         */
+        virtual returnValue shiftWorkingSet(	const int* const boundMap,		/**< Map of new to old bounds.      */
+												const int* const constraintMap	/**< Map of new to old constraints. */
+												);
+
+
 		
     //
     // PROTECTED MEMBER FUNCTIONS:
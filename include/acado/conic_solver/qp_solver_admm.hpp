@@ -0,0 +1,275 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+/**
+ *    \file include/acado/conic_solver/qp_solver_admm.hpp
+ *    \author agent
+ *    \date   2026
+ */
+
+
+#ifndef ACADO_TOOLKIT_QP_SOLVER_ADMM_HPP
+#define ACADO_TOOLKIT_QP_SOLVER_ADMM_HPP
+
+
+#include <acado/conic_solver/dense_qp_solver.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Solves dense QPs by the alternating direction method of multipliers.
+ *
+ *	\ingroup NumericalAlgorithms
+ *
+ *  The class QPsolver_ADMM solves convex quadratic programming (QP) problems
+ *
+ *      min  1/2 x'Hx + g'x   s.t.   lb <= x <= ub,  lbA <= Ax <= ubA
+ *
+ *  by the alternating direction method of multipliers (ADMM), i.e. by a
+ *  first-order method whose iterations only require a matrix-vector
+ *  product and a solve with a Cholesky factor. The factorization of the
+ *  regularized KKT matrix H + sigma*I + C'*diag(rho)*C (with C = [I;A]) is
+ *  kept as long as the QP matrices and the step sizes do not change.
+ *  The step sizes are adapted to the ratio of the primal and dual
+ *  residuals from time to time.
+ *
+ *  If HOTSTART_QP is set, each solve starts from the primal and dual
+ *  solution of the last one. If MAX_QP_SOLVER_TIME is positive, the
+ *  iterations are stopped as soon as this time budget has been used
+ *  up; like an exhausted iteration limit, this yields the status
+ *  RET_QP_SOLUTION_REACHED_LIMIT and the QP is not considered solved.
+ *
+ *	\author agent
+ */
+class QPsolver_ADMM : public DenseQPsolver
+{
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor. */
+        QPsolver_ADMM( );
+
+        QPsolver_ADMM(	UserInteraction* _userInteraction
+						);
+
+        /** Copy constructor (deep copy). */
+        QPsolver_ADMM( const QPsolver_ADMM& rhs );
+
+        /** Destructor. */
+        virtual ~QPsolver_ADMM( );
+
+        /** Assignment operator (deep copy). */
+        QPsolver_ADMM& operator=( const QPsolver_ADMM& rhs );
+
+
+        virtual DenseCPsolver* clone( ) const;
+
+        virtual DenseQPsolver* cloneDenseQPsolver( ) const;
+
+
+        /** Solves the QP. */
+        virtual returnValue solve( DenseCP *cp_  );
+
+        /** Solves QP using at most <maxIter> iterations. */
+        virtual returnValue solve(	const double* const H,		/**< Hessian matrix of neighbouring QP to be solved. */
+									const double* const A,		/**< Constraint matrix of neighbouring QP to be solved. */
+									const double* const g,		/**< Gradient of neighbouring QP to be solved. */
+									const double* const lb,		/**< Lower bounds of neighbouring QP to be solved. */
+									const double* const ub,		/**< Upper bounds of neighbouring QP to be solved. */
+									const double* const lbA,	/**< Lower constraints' bounds of neighbouring QP to be solved. */
+									const double* const ubA,	/**< Upper constraints' bounds of neighbouring QP to be solved. */
+									uint maxIter				/**< Maximum number of iterations. */
+									);
+
+        /** Solves QP using at most <maxIter> iterations. */
+        virtual returnValue solve(  const Matrix *H,    /**< Hessian matrix of neighbouring QP to be solved. */
+                                    const Matrix *A,    /**< Constraint matrix of neighbouring QP to be solved. */
+                                    const Vector *g,    /**< Gradient of neighbouring QP to be solved. */
+                                    const Vector *lb,   /**< Lower bounds of neighbouring QP to be solved. */
+                                    const Vector *ub,   /**< Upper bounds of neighbouring QP to be solved. */
+                                    const Vector *lbA,  /**< Lower constraints' bounds of neighbouring QP to be solved. */
+                                    const Vector *ubA,  /**< Upper constraints' bounds of neighbouring QP to be solved. */
+                                    uint maxIter        /**< Maximum number of iterations. */
+									);
+
+
+        /** Performs exactly one QP iteration. */
+        virtual returnValue step(	const double* const H,		/**< Hessian matrix of neighbouring QP to be solved. */
+									const double* const A,		/**< Constraint matrix of neighbouring QP to be solved. */
+									const double* const g,		/**< Gradient of neighbouring QP to be solved. */
+									const double* const lb,		/**< Lower bounds of neighbouring QP to be solved. */
+									const double* const ub,		/**< Upper bounds of neighbouring QP to be solved. */
+									const double* const lbA,	/**< Lower constraints' bounds of neighbouring QP to be solved. */
+									const double* const ubA		/**< Upper constraints' bounds of neighbouring QP to be solved. */
+									);
+
+        /** Performs exactly one QP iteration. */
+        virtual returnValue step(	const Matrix *H,    /**< Hessian matrix of neighbouring QP to be solved. */
+                                    const Matrix *A,    /**< Constraint matrix of neighbouring QP to be solved. */
+                                    const Vector *g,    /**< Gradient of neighbouring QP to be solved. */
+                                    const Vector *lb,   /**< Lower bounds of neighbouring QP to be solved. */
+                                    const Vector *ub,   /**< Upper bounds of neighbouring QP to be solved. */
+                                    const Vector *lbA,  /**< Lower constraints' bounds of neighbouring QP to be solved. */
+                                    const Vector *ubA   /**< Upper constraints' bounds of neighbouring QP to be solved. */
+									);
+
+
+		/** Returns primal solution vector if QP has been solved.
+		 * \return SUCCESSFUL_RETURN \n
+		 *         RET_QP_NOT_SOLVED */
+		virtual returnValue getPrimalSolution(	Vector& xOpt	/**< OUTPUT: primal solution vector. */
+												) const;
+
+		/** Returns dual solution vector if QP has been solved.
+		 * \return SUCCESSFUL_RETURN \n
+		 *         RET_QP_NOT_SOLVED */
+		virtual returnValue getDualSolution(	Vector& yOpt	/**< OUTPUT: dual solution vector. */
+												) const;
+
+		/** Returns optimal objective function value.
+		 *	\return finite value: Optimal objective function value (QP has been solved) \n
+		 			+INFTY:	      QP has not been solved or is infeasible */
+		virtual double getObjVal( ) const;
+
+
+		virtual uint getNumberOfVariables( ) const;
+		virtual uint getNumberOfConstraints( ) const;
+
+
+        /** Variance-covariance estimates are not available for this solver.
+         *
+         *  \return RET_NOT_IMPLEMENTED_YET
+         */
+        virtual returnValue getVarianceCovariance( Matrix &var );
+
+        /** Variance-covariance estimates are not available for this solver.
+         *
+         *  \return RET_NOT_IMPLEMENTED_YET
+         */
+        virtual returnValue getVarianceCovariance( Matrix &H, Matrix &var );
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+		virtual returnValue setupOptions( );
+
+        /** Setups QP object.
+		 *  \return SUCCESSFUL_RETURN \n
+		 *          RET_QP_INIT_FAILED */
+        virtual returnValue setupQPobject(	uint nV,	/**< Number of QP variables. */
+											uint nC		/**< Number of QP constraints (without bounds). */
+											);
+
+
+        /** Returns whether the factorization has been computed for the \n
+         *  given QP matrices.                                           \n
+         */
+		BooleanType isFactorizationValid(	const double* const H,	/**< Hessian matrix.    */
+											const double* const A	/**< Constraint matrix. */
+											) const;
+
+        /** Computes the Cholesky factor of H + sigma*I + C'*diag(rho)*C \n
+         *  and keeps a copy of the QP matrices it is based on.          \n
+         *                                                                \n
+         *  \return SUCCESSFUL_RETURN                                     \n
+         *          RET_QP_SOLUTION_FAILED (matrix is not positive definite) \n
+         */
+		returnValue factorize(	const double* const H,	/**< Hessian matrix.    */
+								const double* const A	/**< Constraint matrix. */
+								);
+
+        /** Solves the factorized linear system in place. */
+		void solveFactorized( double* const b ) const;
+
+
+        /** Determines the step size of each row of C from the type of its \n
+         *  bounds (equality, inequality or unbounded).                    \n
+         *                                                                  \n
+         *  \return BT_TRUE iff a step size has changed                     \n
+         */
+		BooleanType setupStepSizes(	const double* const l,		/**< Lower bounds of C*x (dimension nV+nC). */
+									const double* const u		/**< Upper bounds of C*x (dimension nV+nC). */
+									);
+
+        /** Computes C*v. */
+		void multiplyC(	const double* const A,		/**< Constraint matrix. */
+						const double* const v,		/**< Vector of dimension nV.     */
+						double* const Cv			/**< OUTPUT: vector of dimension nV+nC. */
+						) const;
+
+        /** Computes C'*w. */
+		void multiplyCtransposed(	const double* const A,		/**< Constraint matrix. */
+									const double* const w,		/**< Vector of dimension nV+nC.  */
+									double* const Ctw			/**< OUTPUT: vector of dimension nV. */
+									) const;
+
+
+        /** Deletes (or copies) the internal memory. */
+		void clearMemory( );
+		void copyMemory( const QPsolver_ADMM& rhs );
+
+
+
+    //
+    // DATA MEMBERS:
+    //
+    protected:
+
+		uint nV;					/**< Number of QP variables.                              */
+		uint nC;					/**< Number of QP constraints (without bounds).           */
+
+		double* x;					/**< Primal iterate.                                      */
+		double* z;					/**< Projected values of the bounds and constraints.      */
+		double* y;					/**< Dual iterate (ADMM sign convention).                 */
+
+		double* rho;				/**< Step size of each bound and constraint.              */
+		double  rhoBar;				/**< Step size of the inequalities.                       */
+
+		double* L;					/**< Cholesky factor of the regularized KKT matrix.       */
+		double* lastH;				/**< Hessian matrix the factorization is based on.        */
+		double* lastA;				/**< Constraint matrix the factorization is based on.     */
+
+		double  objVal;				/**< Objective function value of the last solution.      */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_QP_SOLVER_ADMM_HPP
+
+/*
+ *	end of file
+ */
@@ -0,0 +1,391 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/conic_solver/riccati_based_cp_solver.hpp
+ *    \author agent
+ *
+ */
+
+
+#ifndef ACADO_TOOLKIT_RICCATI_BASED_CP_SOLVER_HPP
+#define ACADO_TOOLKIT_RICCATI_BASED_CP_SOLVER_HPP
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/matrix_vector/matrix_vector.hpp>
+#include <acado/conic_solver/banded_cp_solver.hpp>
+#include <acado/conic_solver/condensing_based_cp_solver.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Solves banded conic programs arising in optimal control without condensing.
+ *
+ *	\ingroup NumericalAlgorithm
+ *
+ *  The class Riccati based CP solver solves the band structured QP
+ *  directly in its multi-stage form by a primal-dual interior point
+ *  method. The linear system of each interior point iteration is
+ *  solved by a Riccati recursion, such that the computational costs
+ *  grow only linearly with the number of grid points.
+ *
+ *  Every grid point forms one stage with the variables (x,p,u,w).
+ *  The parameters are propagated as constant states and the controls
+ *  and disturbances of the last grid point, which are identified with
+ *  those of the last interval, are states of the last stage.
+ *
+ *  Optionally, the stages can be partially condensed: blocks of
+ *  CONDENSING_BLOCK_SIZE consecutive stages are condensed into one
+ *  stage, such that the interior point method works on a shorter
+ *  horizon with more controls per stage.
+ *
+ *  Banded CPs that do not fit into this multi-stage form (algebraic
+ *  states, Hessians or constraints coupling different grid points)
+ *  are solved by condensing instead.
+ *
+ *  \author agent
+ */
+
+class RiccatiBasedCPsolver: public BandedCPsolver {
+
+
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor. */
+        RiccatiBasedCPsolver( );
+
+        RiccatiBasedCPsolver(	UserInteraction* _userInteraction,
+								uint nConstraints_,
+								const Vector& blockDims_
+								);
+
+        /** Copy constructor (deep copy). */
+        RiccatiBasedCPsolver( const RiccatiBasedCPsolver& rhs );
+
+        /** Destructor. */
+        virtual ~RiccatiBasedCPsolver( );
+
+        /** Assignment operator (deep copy). */
+        RiccatiBasedCPsolver& operator=( const RiccatiBasedCPsolver& rhs );
+
+
+        /** Assignment operator (deep copy). */
+        virtual BandedCPsolver* clone() const;
+
+
+        /** initializes the banded conic solver */
+        virtual returnValue init( const OCPiterate &iter_ );
+
+
+        /** Sets up the multi-stage QP from the given banded conic program. */
+        virtual returnValue prepareSolve(	BandedCP& cp
+											);
+
+		/** Solves a given banded conic program in feedback mode:                   \n
+         *                                                                          \n
+         *  \param cp     the banded conic program to be solved                     \n
+         *                                                                          \n
+         *  \return SUCCESSFUL_RETURN   (if successful)                             \n
+         *          RET_QP_SOLUTION_FAILED                                          \n
+         */
+        virtual returnValue solve(	BandedCP& cp
+									);
+
+        /** Writes the solution of the multi-stage QP back to the banded CP. */
+        virtual returnValue finalizeSolve(	BandedCP& cp
+											);
+
+
+		inline uint getNX( ) const;
+		inline uint getNXA( ) const;
+		inline uint getNP( ) const;
+		inline uint getNU( ) const;
+		inline uint getNW( ) const;
+
+		inline uint getNC( ) const;
+
+		inline uint getNumPoints( ) const;
+
+
+		virtual returnValue getParameters        ( Vector        &p_  ) const;
+		virtual returnValue getFirstControl      ( Vector        &u0_ ) const;
+
+
+        /** Returns the variance-covariance matrix (only available if the \n
+         *  problem has been passed to the condensing fallback).           \n
+         */
+        virtual returnValue getVarianceCovariance( Matrix &var );
+
+
+		virtual returnValue setRealTimeParameters(	const Vector& DeltaX,
+													const Vector& DeltaP = emptyConstVector
+													);
+
+		inline BooleanType areRealTimeParametersDefined( ) const;
+
+
+		virtual returnValue freezeCondensing( );
+
+		virtual returnValue unfreezeCondensing( );
+
+
+		virtual returnValue shiftWorkingSet(	const BandedCP& cp
+												);
+
+
+        /** Sets the barrier parameter. If it is positive, each call of \n
+         *  solve performs a single primal-dual Newton step towards the  \n
+         *  central path point of this parameter, starting from the      \n
+         *  multipliers of the last call, instead of solving the CP to   \n
+         *  optimality. A zero value (default) disables this mode.       \n
+         *  CPs that are passed to the condensing fallback are always    \n
+         *  solved to optimality, which is reported by the return value. \n
+         *                                                               \n
+         *  \return SUCCESSFUL_RETURN                                    \n
+         *          RET_BARRIER_STEP_NOT_AVAILABLE                       \n
+         *          RET_INVALID_ARGUMENTS                                \n
+         */
+        virtual returnValue setBarrierParameter(	double barrierParameter_
+													);
+
+        /** Returns the barrier parameter. */
+        inline double getBarrierParameter( ) const;
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+        /** Returns the stage dimension nx+np+nu+nw. */
+        inline uint getNZ( ) const;
+
+        /** Returns the offset of the variable block with index \n
+         *  colIdx (of the banded CP) within its stage.         \n
+         */
+        inline uint getStageOffset( uint colIdx ) const;
+
+        /** Returns the number of states of the given block, i.e. of the \n
+         *  first stage within the block.                                 \n
+         */
+        inline uint getNumBlockStates( uint block ) const;
+
+        /** Returns the index of the first stage within the given block. \n
+         */
+        inline uint getFirstBlockStage( uint block ) const;
+
+        /** Returns the index of the last stage within the given block. \n
+         *  (the terminal stage always forms a block on its own)         \n
+         */
+        inline uint getLastBlockStage( uint block ) const;
+
+
+        /** Determines the stages to which the variable block colIdx of  \n
+         *  the banded CP can be assigned. The first stage is preferred,  \n
+         *  a negative value means that the block has no (further)        \n
+         *  alternative. For parameters, first = -2 means "any stage".   \n
+         */
+        void getStageCandidates( uint colIdx, int &first, int &second ) const;
+
+        /** Intersects the stage candidates (first,second) with those of \n
+         *  the variable block colIdx.                                    \n
+         *                                                                \n
+         *  \return BT_FALSE if the intersection is empty.               \n
+         */
+        BooleanType intersectStageCandidates( uint colIdx, int &first, int &second ) const;
+
+
+        /** Determines whether the banded CP can be solved in multi-stage  \n
+         *  form and assigns the constraint rows to the stages.           \n
+         */
+        BooleanType setupStageStructure( const BandedCP& cp );
+
+        /** Copies the data of the banded CP into the stage matrices.        \n
+         *  \return BT_TRUE  if the Hessian is stage-wise separable,          \n
+         *          BT_FALSE otherwise.                                        \n
+         */
+        BooleanType setupStageData( const BandedCP& cp );
+
+
+        /** Condenses blocks of consecutive stages into the stages of the \n
+         *  (shorter) multi-stage QP that is solved by the interior point  \n
+         *  method.                                                        \n
+         */
+        returnValue condenseStages( );
+
+        /** Recovers the stage-wise primal and dual solution from the    \n
+         *  solution of the partially condensed multi-stage QP.          \n
+         */
+        returnValue expandStages( );
+
+
+        /** Allocates (or deletes) the memory for the stage data. */
+        void allocateStageMemory( );
+        void deleteStageMemory( );
+        void copyStageMemory( const RiccatiBasedCPsolver& rhs );
+
+
+        /** Solves the multi-stage QP by a primal-dual interior point method. \n
+         *  The iterations stop after MAX_NUM_QP_ITERATIONS iterations or,   \n
+         *  if MAX_QP_SOLVER_TIME is positive, once this time has elapsed.    \n
+         *                                                                    \n
+         *  \return SUCCESSFUL_RETURN                                         \n
+         *          RET_QP_SOLUTION_REACHED_LIMIT (time budget exceeded)      \n
+         *          RET_QP_SOLUTION_FAILED                                    \n
+         */
+        returnValue solveMultiStageQP( );
+
+        /** Computes the Riccati factorization for the given stage Hessians \n
+         *  (which already contain the current barrier weights).            \n
+         */
+        returnValue factorizeKKTsystem( const Matrix *Ht );
+
+        /** Solves the factorized KKT system for the given right hand side. */
+        returnValue solveKKTsystem( const Vector *q, const Vector *c,
+                                    Vector *dz, Vector *dlambda );
+
+        /** Computes the Cholesky factor of a symmetric matrix in place. \n
+         *  If the matrix is not sufficiently positive definite, it is   \n
+         *  regularized by a multiple of the identity.                   \n
+         */
+        returnValue factorizeCholesky( Matrix &A ) const;
+
+        /** Solves (L*L^T) x = b with the Cholesky factor L. */
+        void solveCholesky( const Matrix &L, Vector &b ) const;
+
+
+        /** Returns the value of row idx of the block inequalities at z. */
+        inline double getInequalityValue( uint block, uint idx, const Vector &z_ ) const;
+
+        /** Returns whether row idx of the block inequalities is an equality. \n
+         *  Equalities are not treated by slacks but by a regularized         \n
+         *  multiplier update, which keeps the Riccati recursion well        \n
+         *  conditioned (e.g. for fixed initial or terminal states).          \n
+         */
+        inline BooleanType isEquality( uint block, uint idx ) const;
+
+
+        /** Initializes the condensing based solver that is used if the \n
+         *  banded CP does not fit into the multi-stage form.            \n
+         */
+        returnValue initializeCondensing( );
+
+
+
+    //
+    // DATA MEMBERS:
+    //
+    protected:
+
+        OCPiterate iter;
+        Vector blockDims;
+        uint nConstraints;
+
+        CondensingBasedCPsolver *condensing;    /**< fallback for unsupported structures */
+
+
+        // STAGE DATA OF THE BANDED CP:
+        // -------------------------------------------------------------------------------
+        Matrix     *H;          /**< stage Hessians                                        */
+        Vector     *g;          /**< stage gradients                                       */
+        Matrix     *F;          /**< stage dynamics s_{k+1} = F_k z_k + c_k                */
+        Vector     *c;          /**< stage dynamics offsets                                */
+        Matrix     *C;          /**< stage constraint matrices                             */
+        Vector   *lbI;          /**< stage lower bounds of the bounds and the constraints   */
+        Vector   *ubI;          /**< stage upper bounds of the bounds and the constraints   */
+
+        int       *nStageConstraints;   /**< number of constraint rows per stage            */
+        int       *constraintStage;     /**< stage of each constraint row of the banded CP  */
+        int       *constraintRow;       /**< index of each constraint row within its stage  */
+
+        Vector     *z;          /**< primal solution per stage                             */
+        Vector     *lambda;     /**< multipliers of the stage dynamics                     */
+        Vector     *yL, *yU;    /**< multipliers of the stage bounds and constraints       */
+        // -------------------------------------------------------------------------------
+
+
+        // PARTIAL CONDENSING:
+        // -------------------------------------------------------------------------------
+        int         blockSize;  /**< number of stages per block                            */
+        uint        nBlocks;    /**< number of blocks (= stages of the condensed QP)       */
+
+        Matrix     *T;          /**< condensing operators z_k = T_k Z_b + d_k              */
+        Vector     *d;          /**< condensing offsets                                    */
+        int       **blockSlot;  /**< index of each stage inequality within its block      */
+        // -------------------------------------------------------------------------------
+
+
+        // PARTIALLY CONDENSED MULTI-STAGE QP:
+        // -------------------------------------------------------------------------------
+        Matrix     *Hb;         /**< block Hessians                                        */
+        Vector     *gb;         /**< block gradients                                       */
+        Matrix     *Fb;         /**< block dynamics                                        */
+        Vector     *cb;         /**< block dynamics offsets                                */
+        Matrix     *Cb;         /**< block inequality matrices                             */
+        Vector   *lbIb;         /**< block lower bounds of the bounds and inequalities      */
+        Vector   *ubIb;         /**< block upper bounds of the bounds and inequalities      */
+        // -------------------------------------------------------------------------------
+
+
+        // INTERIOR POINT ITERATES AND RICCATI FACTORIZATION:
+        // -------------------------------------------------------------------------------
+        Vector     *zb;         /**< primal solution per block                             */
+        Vector     *lambdab;    /**< multipliers of the block dynamics                     */
+        Vector     *tL, *tU;    /**< slacks of the lower and upper bounds                  */
+        Vector     *yLb, *yUb;  /**< multipliers of the lower and upper bounds             */
+
+        Matrix     *P;          /**< cost-to-go Hessians                                   */
+        Matrix     *K;          /**< feedback gains                                        */
+        Matrix     *L;          /**< Cholesky factors of the control Hessians              */
+        Matrix      L0;         /**< Cholesky factor of the first cost-to-go Hessian        */
+        // -------------------------------------------------------------------------------
+
+        int  nIterations;       /**< number of interior point iterations of the last solve */
+        double barrierParameter;/**< barrier parameter of single Newton steps (if positive) */
+
+		Vector deltaX;
+		Vector deltaP;
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/conic_solver/riccati_based_cp_solver.ipp>
+
+
+#endif  // ACADO_TOOLKIT_RICCATI_BASED_CP_SOLVER_HPP
+
+/*
+ *  end of file
+ */
@@ -0,0 +1,172 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/conic_solver/riccati_based_cp_solver.ipp
+ *    \author agent
+ */
+
+
+//
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+inline uint RiccatiBasedCPsolver::getNX( ) const
+{
+	return iter.getNX();
+}
+
+
+inline uint RiccatiBasedCPsolver::getNXA( ) const
+{
+	return iter.getNXA();
+}
+
+
+inline uint RiccatiBasedCPsolver::getNP( ) const
+{
+	return iter.getNP();
+}
+
+inline uint RiccatiBasedCPsolver::getNU( ) const
+{
+	return iter.getNU();
+}
+
+
+inline uint RiccatiBasedCPsolver::getNW( ) const
+{
+	return iter.getNW();
+}
+
+
+inline uint RiccatiBasedCPsolver::getNC( ) const
+{
+	return nConstraints;
+}
+
+
+inline uint RiccatiBasedCPsolver::getNumPoints( ) const
+{
+	return iter.getNumPoints();
+}
+
+
+inline double RiccatiBasedCPsolver::getBarrierParameter( ) const
+{
+	return barrierParameter;
+}
+
+
+inline BooleanType RiccatiBasedCPsolver::areRealTimeParametersDefined( ) const
+{
+	if ( ( deltaX.isEmpty( ) == BT_TRUE ) && ( deltaP.isEmpty( ) == BT_TRUE ) )
+		return BT_FALSE;
+	else
+		return BT_TRUE;
+}
+
+
+inline uint RiccatiBasedCPsolver::getNZ( ) const
+{
+	return getNX() + getNP() + getNU() + getNW();
+}
+
+
+inline uint RiccatiBasedCPsolver::getStageOffset( uint colIdx ) const
+{
+	switch( colIdx / getNumPoints() )
+	{
+		case 0:  return 0;
+		case 2:  return getNX();
+		case 3:  return getNX() + getNP();
+		case 4:  return getNX() + getNP() + getNU();
+		default: return 0;
+	}
+}
+
+
+inline uint RiccatiBasedCPsolver::getNumBlockStates( uint block ) const
+{
+	if( block < nBlocks-1 )
+		return getNX() + getNP();
+
+	return getNZ();
+}
+
+
+inline uint RiccatiBasedCPsolver::getFirstBlockStage( uint block ) const
+{
+	if( block < nBlocks-1 )
+		return block*blockSize;
+
+	return getNumPoints()-1;
+}
+
+
+inline uint RiccatiBasedCPsolver::getLastBlockStage( uint block ) const
+{
+	if( block == nBlocks-1 )
+		return getNumPoints()-1;
+
+	if( (block+1)*blockSize > getNumPoints()-1 )
+		return getNumPoints()-2;
+
+	return (block+1)*blockSize - 1;
+}
+
+
+inline double RiccatiBasedCPsolver::getInequalityValue( uint block, uint idx, const Vector &z_ ) const
+{
+	if( idx < z_.getDim() )
+		return z_(idx);
+
+	double value = 0.0;
+	for( uint run1 = 0; run1 < z_.getDim(); run1++ )
+		value += Cb[block]( idx-z_.getDim(), run1 )*z_(run1);
+
+	return value;
+}
+
+
+inline BooleanType RiccatiBasedCPsolver::isEquality( uint block, uint idx ) const
+{
+	if( ( lbIb[block](idx) > -0.5*INFTY ) && ( ubIb[block](idx) - lbIb[block](idx) <= 10.0*EPS*( 1.0 + fabs( lbIb[block](idx) ) ) ) )
+		return BT_TRUE;
+
+	return BT_FALSE;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -149,6 +149,35 @@ class AlgebraicConsistencyConstraint : public ConstraintElement{
         inline returnValue computeForwardSensitivityBlock( int offset1, int offset2, int offset3, int stageIdx, Matrix *seed );
 
 
+        /** Returns the index of the stage the grid point idx belongs to. \n
+          * (The break point between two stages belongs to the first one.) \n
+          */
+        inline int getStageIndex( int idx ) const;
+
+
+        /** Returns whether idx is the last grid point of its stage.      \n
+          */
+        inline BooleanType isLastPointOfStage( int idx ) const;
+
+
+        /** Returns whether the grid points of all stages can be          \n
+          * evaluated concurrently.                                       \n
+          */
+        inline BooleanType areStagesParallelizable( ) const;
+
+
+        /** Evaluates the constraint at the grid point idx using the      \n
+          * given evaluation points (one per stage) and stores the        \n
+          * residuum.                                                     \n
+          *                                                               \n
+          * \return SUCCESSFUL_RETURN                                     \n
+          */
+        returnValue evaluatePoint( int              idx,      /**< index of the grid point        */
+                                   const OCPiterate& iter,    /**< the current iterate            */
+                                   EvaluationPoint  *zThread  /**< the evaluation points to use   */
+                                 );
+
+
 
 
     //
@@ -144,6 +144,41 @@ inline returnValue AlgebraicConsistencyConstraint::computeForwardSensitivityBloc
 
 
 
+inline int AlgebraicConsistencyConstraint::getStageIndex( int idx ) const{
+
+    int stageIdx = 0;
+
+    while( ( stageIdx < numberOfStages-1 ) && ( idx > breakPoints[stageIdx+1] ) )
+        stageIdx++;
+
+    return stageIdx;
+}
+
+
+inline BooleanType AlgebraicConsistencyConstraint::isLastPointOfStage( int idx ) const{
+
+    if( idx >= (int) grid.getLastIndex() )
+        return BT_TRUE;
+
+    if( getStageIndex( idx+1 ) != getStageIndex( idx ) )
+        return BT_TRUE;
+
+    return BT_FALSE;
+}
+
+
+inline BooleanType AlgebraicConsistencyConstraint::areStagesParallelizable( ) const{
+
+    int run1;
+
+    for( run1 = 0; run1 < numberOfStages; run1++ )
+        if( isParallelizable( run1 ) == BT_FALSE )
+            return BT_FALSE;
+
+    return BT_TRUE;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
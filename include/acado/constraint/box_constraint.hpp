@@ -98,6 +98,17 @@ class BoxConstraint{
     virtual returnValue getBounds( const OCPiterate& iter );
 
 
+    /** Intersects the bounds of one component of the given variables at  \n
+     *  one grid point with the bounds lb_ and ub_.                         \n
+     *                                                                      \n
+     *  \return SUCCESSFUL_RETURN                                          \n
+     *          RET_INCONSISTENT_BOUNDS                                     \n
+     */
+    returnValue addBound( VariablesGrid* const variables,
+                          uint pointIdx, uint component,
+                          double lb_, double ub_ ) const;
+
+
 
 
 
@@ -481,6 +481,9 @@ class Constraint : public BoxConstraint{
          */
         virtual returnValue getBounds( const OCPiterate& iter );
 
+        /** Returns whether the point constraints can be evaluated concurrently. */
+        BooleanType arePointConstraintsParallelizable( ) const;
+
         /** Protected version of the destructor. */
         void deleteAll();
 
@@ -219,6 +219,23 @@ class ConstraintElement{
         inline BooleanType isAffine() const;
 
 
+        /** Returns whether the grid points of the function fcn[idx] can be     \n
+         *  evaluated concurrently, which is the case for symbolic functions    \n
+         *  as they keep separate buffers for each grid point. Functions with   \n
+         *  intermediate states are excluded, as the expressions of             \n
+         *  intermediate states (and their buffers) are shared between          \n
+         *  functions.                                                          \n
+         */
+        inline BooleanType isParallelizable( int idx ) const;
+
+
+        /** Returns whether the element can be evaluated concurrently with     \n
+         *  other elements, i.e. whether isParallelizable( idx ) holds for     \n
+         *  all of its functions.                                              \n
+         */
+        inline BooleanType isParallelizable( ) const;
+
+
 // ==========================================================================
 //
 //                          PROTECTED MEMBER FUNCTIONS:
@@ -231,6 +248,36 @@ class ConstraintElement{
 														);
 
 
+        /** Evaluates the Jacobian D (dim x ny) of the function fcn[idx] and the \n
+         *  Hessian H (ny x ny) of bseed^T*fcn[idx] w.r.t. all variables         \n
+         *  (x,xa,p,u,w) at the buffer position "number". Variables of the same  \n
+         *  color (see HessianColoring) share one forward/backward sweep.        \n
+         *                                                                       \n
+         *  \return SUCCESSFUL_RETURN                                            \n
+         */
+		returnValue evaluateSecondOrderDerivatives(	int     idx,      /**< index of the function */
+													int     number,   /**< the buffer position   */
+													double *bseed,    /**< the backward seed     */
+													Matrix &D,        /**< the Jacobian (output) */
+													Matrix &H         /**< the Hessian  (output) */
+													);
+
+
+        /** Stores the blocks of the Jacobian D into the row dRow of dBackward \n
+         *  and adds the blocks of -H to the Hessian, where all variables       \n
+         *  belong to the given stage.                                          \n
+         *                                                                      \n
+         *  \return SUCCESSFUL_RETURN                                           \n
+         */
+		returnValue addSecondOrderDerivatives(	int                dRow,     /**< block row of dBackward */
+												int                stage,    /**< the stage              */
+												int                N,        /**< number of grid points  */
+												const Matrix      &D,        /**< the Jacobian           */
+												const Matrix      &H,        /**< the Hessian            */
+												BlockMatrix       &hessian   /**< the Hessian (output)   */
+												);
+
+
 
     //
     // DATA MEMBERS:
@@ -256,6 +303,8 @@ class ConstraintElement{
         int            **y_index;   /**< index lists             */
         int             *t_index;   /**< time indices            */
 
+        HessianColoring *hessianColoring; /**< colorings for sparse 2nd order derivatives */
+
 
         // DIMENSIONS:
         // ----------------------
@@ -122,6 +122,26 @@ inline BooleanType ConstraintElement::isAffine() const{
 }
 
 
+inline BooleanType ConstraintElement::isParallelizable( int idx ) const{
+
+    if( ( fcn[idx].isSymbolic() == BT_FALSE ) || ( fcn[idx].getN() != 0 ) )
+        return BT_FALSE;
+
+    return BT_TRUE;
+}
+
+
+inline BooleanType ConstraintElement::isParallelizable( ) const{
+
+    for( int run1 = 0; run1 < nFcn; run1++ )
+         if( fcn[run1].getDim() != 0 )
+             if( isParallelizable( run1 ) == BT_FALSE )
+                 return BT_FALSE;
+
+    return BT_TRUE;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
@@ -130,6 +130,31 @@ class PathConstraint : public ConstraintElement{
 
 	protected:
 
+        /** Evaluates the constraint at the grid point idx using the     \n
+          * given evaluation point and stores the residuum.            \n
+          *                                                            \n
+          * \return SUCESSFUL_RETURN                                   \n
+          */
+        returnValue evaluatePoint(	int              idx,      /**< index of the grid point */
+									const OCPiterate &iter,    /**< the iterate             */
+									EvaluationPoint  &zThread, /**< the evaluation point    */
+									double           *result   /**< buffer of length nc     */
+									);
+
+
+        /** Makes sure that threadBuffer provides a buffer of length nc for   \n
+          * each thread of the shared thread pool.                          \n
+          */
+        void allocateThreadBuffer( int nc );
+
+
+    //
+    // DATA MEMBERS:
+    //
+    protected:
+
+        double *threadBuffer    ;   /**< result and seed buffers of all threads */
+        int     threadBufferSize;   /**< allocated length of threadBuffer       */
 };
 
 
@@ -238,6 +238,12 @@ class DynamicDiscretization : public AlgorithmicBase
 		inline int getNumberOfIntervals( ) const;
 
 
+		/**< Returns the time that has been spent for expanding and condensing \n
+		 *   lifted intermediate variables during the last evaluation and      \n
+		 *   sensitivity generation (zero if no lifting is used).             */
+		inline double getLiftingTime( ) const;
+
+
 
 		virtual BooleanType isAffine( ) const = 0;
 
@@ -245,6 +251,24 @@ class DynamicDiscretization : public AlgorithmicBase
         virtual returnValue unfreeze( ) = 0;
 
 
+		/** Shifts the warm start information of the integrators (cf. option    \n
+		 *  WARM_START_INTEGRATOR) by one interval, consistent with a shift of   \n
+		 *  the OCPiterate in real-time mode.                                    \n
+		 *                                                                       \n
+		 *  \return SUCCESSFUL_RETURN                                            \n
+		 */
+		virtual returnValue shiftMesh( );
+
+
+		/** Passes an absolute deadline (as returned by acadoGetTime) to the    \n
+		 *  integrators; integrations that are still running at this point in   \n
+		 *  time are cancelled. A non-positive value removes the deadline.       \n
+		 *                                                                       \n
+		 *  \return SUCCESSFUL_RETURN                                            \n
+		 */
+		virtual returnValue setDeadline( double deadline_ );
+
+
 	//
 	// PROTECTED MEMBER FUNCTIONS:
 	//
@@ -269,6 +293,7 @@ class DynamicDiscretization : public AlgorithmicBase
 		int           N               ;  /**< total number of grid points                  */
 		PrintLevel    printLevel      ;  /**< the print level                              */
 		BooleanType   freezeTraj      ;  /**< whether the trajectory should be frozen      */
+		double        liftingTime     ;  /**< time spent for lifting (expand + condense)   */
 
 
 		// DIMENSIONS:
@@ -44,6 +44,12 @@ inline int DynamicDiscretization::getNumberOfIntervals() const{
 }
 
 
+inline double DynamicDiscretization::getLiftingTime() const{
+
+    return liftingTime;
+}
+
+
 
 // PROTECTED INLINE ROUTINES:
 // --------------------------
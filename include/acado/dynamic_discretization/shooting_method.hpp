@@ -122,7 +122,13 @@ class ShootingMethod : public DynamicDiscretization
 		virtual returnValue evaluateSensitivities( );
 
 
-		/** Evaluates the sensitivities.                                      \n
+		/** Evaluates the sensitivities by a lifted Newton scheme. The states  \n
+		*  at NUM_LIFTED_NODES equidistant intermediate nodes of each shooting \n
+		*  interval are kept as implicit variables: their Jacobians are        \n
+		*  condensed into the sensitivities of the interval and the condensed  \n
+		*  matching defects are added to the residuum. In the next call of     \n
+		*  evaluate() the intermediate nodes are expanded by the linearization \n
+		*  instead of being re-simulated.                                      \n
 		*                                                                    \n
 		*  \return SUCCESSFUL_RETURN                                         \n
 		*          RET_NOT_FROZEN                                            \n
@@ -142,6 +148,16 @@ class ShootingMethod : public DynamicDiscretization
 
         virtual returnValue unfreeze( );
 
+        /** Shifts the warm start step sizes of the integrators by one         \n
+         *  interval. The last interval keeps its own step size.               \n
+         *                                                                      \n
+         *  \return SUCCESSFUL_RETURN                                           \n
+         */
+        virtual returnValue shiftMesh( );
+
+        /** Passes the deadline to all integrators. */
+        virtual returnValue setDeadline( double deadline_ );
+
 
 		virtual BooleanType isAffine( ) const;
 
@@ -187,7 +203,76 @@ class ShootingMethod : public DynamicDiscretization
                                                             Matrix  &ddW   );
 
 
-            returnValue update( Matrix &G, const Matrix &A, const Matrix &B );
+            /** Integrates the interval idx of an INT_AUTO stage. The explicit   \n
+             *  RK45 integrator is used until it detects stiffness (in          \n
+             *  MAX_NUM_STIFF_INTEGRATOR_STEPS consecutive steps) or fails; the  \n
+             *  interval then switches to the BDF integrator. This choice        \n
+             *  persists across evaluations until the start point of the         \n
+             *  interval has changed by more than the relative tolerance         \n
+             *  AUTO_INTEGRATOR_SWITCH_TOLERANCE.                                \n
+             *                                                                   \n
+             *  \return SUCCESSFUL_RETURN                                        \n
+             *          RET_UNABLE_TO_INTEGRATE_SYSTEM                           \n
+             */
+            returnValue integrateAuto( int idx, const Grid &t_, const Vector &x,
+                                       const Vector &xa, const Vector &p,
+                                       const Vector &u, const Vector &w );
+
+            /** Exchanges the active and the alternative integrator of the      \n
+             *  interval idx and applies the current options to the new one.    \n
+             */
+            returnValue switchAutoIntegrator( int idx );
+
+
+            /** Sets all pointers to the lifted variables to zero. */
+            void initializeLiftedVariables( );
+
+            /** Allocates the memory for the lifted variables of all intervals. */
+            returnValue allocateLiftedVariables( );
+
+            /** Deletes the memory for the lifted variables of all intervals. */
+            void deleteLiftedVariables( );
+
+            /** Integrates the interval idx from the given start point through   \n
+             *  its lifted intermediate nodes. On output, xEnd contains the      \n
+             *  state at the end of the interval including the linearized       \n
+             *  propagation of the matching defects at the intermediate nodes.   \n
+             *                                                                   \n
+             *  \return SUCCESSFUL_RETURN                                        \n
+             *          RET_UNABLE_TO_INTEGRATE_SYSTEM                           \n
+             */
+            returnValue integrateLifted( int idx, const Vector &x, const Vector &p,
+                                         const Vector &u, const Vector &w, Vector &xEnd );
+
+            /** Prepends the trajectories of the lifted sub-intervals of the     \n
+             *  interval idx to the given trajectory of the last sub-interval.   \n
+             */
+            returnValue prependLiftedTrajectory( int idx, BooleanType intermediateStates,
+                                                 VariablesGrid &trajectory ) const;
+
+            /** Computes the dense Jacobian of the last integration of the       \n
+             *  given integrator w.r.t. (x,p,u,w) by unit forward seeds.         \n
+             */
+            returnValue differentiateLifted( Integrator *integrator_, Matrix &J );
+
+
+            /** Returns whether the interval idx of a discrete-time stage can    \n
+             *  be evaluated directly by IntegratorDiscretizedODE::evaluateMap,  \n
+             *  i.e. without algebraic states, transition or intermediate       \n
+             *  evaluation points.                                              \n
+             */
+            BooleanType isMapEvaluable( int idx, const Grid &evaluationGrid ) const;
+
+            /** Returns whether the trajectories computed by evaluate() are      \n
+             *  logged at all. If not, logTrajectory() is skipped.               \n
+             */
+            BooleanType isTrajectoryLogged( ) const;
+
+            /** Returns the blocks of the Jacobian of the last direct map        \n
+             *  evaluation of the interval idx w.r.t. (x,p,u,w).                 \n
+             */
+            returnValue getMapJacobian( int idx, Matrix &Jx, Matrix &Jp,
+                                        Matrix &Ju, Matrix &Jw );
 
 
 			/**< Writes the continous integrator output to the logging object, if this     \n
@@ -212,6 +297,25 @@ class ShootingMethod : public DynamicDiscretization
 
             Integrator **integrator;
             Matrix       breakPoints;
+
+            Integrator **autoIntegrator     ;  /**< the inactive alternative integrator of INT_AUTO intervals */
+            Vector      *autoPoint          ;  /**< the (x,p,u,w) at which an interval switched to BDF        */
+
+            int         *mapSteps           ;  /**< steps of the last direct evaluation of a discrete-time    \n
+                                                *   interval (0: integrated, -1: continuous-time interval)    */
+
+            int          nLifted            ;  /**< number of lifted intermediate nodes per interval          */
+            Integrator **liftedIntegrator   ;  /**< integrators of the sub-intervals ending at lifted nodes    */
+            BooleanType *isLiftable         ;  /**< whether an interval admits lifting of intermediate nodes   */
+            Vector      *liftedNodes        ;  /**< the lifted intermediate states                             */
+            Vector      *liftedNodesRef     ;  /**< the lifted states at the last linearization point          */
+            Vector      *liftedDefects      ;  /**< the matching defects at the lifted nodes                   */
+            Vector      *liftedOffsets      ;  /**< the condensed defects at the lifted nodes                  */
+            Matrix      *liftedJacobians    ;  /**< the state Jacobians of the sub-intervals                   */
+            Matrix      *liftedSens         ;  /**< the condensed sensitivities of the lifted nodes            */
+            Vector      *liftedPoint        ;  /**< the current (x,p,u,w) of each interval                     */
+            Vector      *liftedPointRef     ;  /**< the last linearization point (x,p,u,w) of each interval    */
+            Vector      *liftedCorrection   ;  /**< the condensed defects added to the residuum                */
 };
 
 
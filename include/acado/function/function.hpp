@@ -41,6 +41,7 @@
 
 #include <acado/function/evaluation_point.hpp>
 #include <acado/function/function_.hpp>
+#include <acado/function/hessian_coloring.hpp>
 #include <acado/function/c_function.hpp>
 #include <acado/function/differential_equation.hpp>
 #include <acado/function/transition.hpp>
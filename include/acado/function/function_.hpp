@@ -217,6 +217,37 @@ public:
 
 
 
+    /** Evaluates the function for several lanes at once, e.g.     \n
+     *  for an ensemble of trajectories. The value of the variable  \n
+     *  with index i in lane j is stored in x[i*ld+j] and the k-th  \n
+     *  component of the result of lane j in _result[k*ld+j]. The   \n
+     *  binary operators keep one lane buffer each, such that       \n
+     *  concurrent evaluations need separate copies of the function.\n
+     *  \return SUCCESFUL_RETURN                                    \n
+     *          RET_NOT_IMPLEMENTED_YET (non-symbolic functions)    \n
+     * */
+    returnValue evaluateBatch( int     nLanes    /**< number of lanes                   */,
+                               int     ld        /**< leading dimension of x and result */,
+                               double *x         /**< the input variables               */,
+                               double *_result   /**< the results                       */  );
+
+
+
+    /** Evaluates the function at the given evaluation point and  \n
+     *  writes the result into the array _result. In contrast to  \n
+     *  the evaluate routine returning a Vector, no internal      \n
+     *  result buffer is used, i.e. different storage positions   \n
+     *  may be evaluated concurrently (with different evaluation  \n
+     *  points) if the function is symbolic.                      \n
+     *  \return SUCCESFUL_RETURN                   \n
+     *          RET_NAN                            \n
+     * */
+    returnValue evaluate( int                    number  /**< storage position     */,
+                          const EvaluationPoint &x       /**< the evaluation point */,
+                          double                *_result /**< the result           */  );
+
+
+
     /** Substitutes var(index) with the double sub.               \n
      *  \return The substituted expression.                       \n
      *
@@ -279,6 +310,20 @@ public:
 
 
 
+    /** Determines the structural sparsity patterns of the        \n
+     *  Jacobian (dim x nVars) and of the Hessians (nVars x nVars)\n
+     *  of the function with respect to the given variables.      \n
+     *  \return SUCCESSFUL_RETURN                                 \n
+     *
+     */
+     returnValue getSparsityPattern( int           nVars          /**< number of variables   */,
+                                     VariableType *varType        /**< the variable types    */,
+                                     int          *component      /**< the components        */,
+                                     BooleanType  *jacobianPattern /**< Jacobian pattern (output) */,
+                                     BooleanType  *hessianPattern  /**< Hessian pattern (output)  */ );
+
+
+
     /** Checks whether the function is nondecreasing.             \n
      *  \return BT_FALSE if the expression is not nondecreasing   \n
      *          BT_TRUE  otherwise                                \n
@@ -194,6 +194,20 @@ public:
                                   double *result    /**< the result           */  );
 
 
+    /** Evaluates the expression for several lanes at once. The   \n
+     *  value of the variable with index i in lane j is stored    \n
+     *  in x[i*ld+j] and the k-th component of the result of lane \n
+     *  j in result[k*ld+j]. The intermediate states of all lanes \n
+     *  are stored in x.                                          \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NOT_IMPLEMENTED_YET (non-symbolic functions)  \n
+     * */
+    virtual returnValue evaluateBatch( int     nLanes    /**< number of lanes            */,
+                                       int     ld        /**< leading dimension of x and result */,
+                                       double *x         /**< the input variables        */,
+                                       double *result    /**< the results                */  );
+
+
 
     /** Returns the derivative of the expression with respect     \n
      *  to the variable var(index).                               \n
@@ -260,6 +274,23 @@ public:
      virtual BooleanType isRationalIn( const Expression     &variable );
 
 
+    /** Determines the structural sparsity patterns of the        \n
+     *  Jacobian and of the Hessians of all components with       \n
+     *  respect to the variables (varType[i],component[i]).       \n
+     *  Both patterns are stored row-wise; the Jacobian pattern   \n
+     *  has the dimension dim x nVars, the Hessian pattern the    \n
+     *  dimension nVars x nVars. The patterns are conservative,   \n
+     *  i.e. an entry might be marked although it is zero.        \n
+     *  \return SUCCESSFUL_RETURN                                 \n
+     *
+     */
+     virtual returnValue getSparsityPattern( int           nVars          /**< number of variables   */,
+                                             VariableType *varType        /**< the variable types    */,
+                                             int          *component      /**< the components        */,
+                                             BooleanType  *jacobianPattern /**< Jacobian pattern (output) */,
+                                             BooleanType  *hessianPattern  /**< Hessian pattern (output)  */ );
+
+
     /** Returns the monotonicity of the expression.               \n
      *  \return MT_NONDECREASING                                  \n
      *          MT_NONINCREASING                                  \n
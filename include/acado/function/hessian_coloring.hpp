@@ -0,0 +1,184 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file include/acado/function/hessian_coloring.hpp
+ *    \author agent
+ *    \date 2026
+ */
+
+
+#ifndef ACADO_TOOLKIT_HESSIAN_COLORING_HPP
+#define ACADO_TOOLKIT_HESSIAN_COLORING_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/matrix_vector/matrix_vector.hpp>
+#include <acado/function/function_.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Evaluates sparse first and second order derivatives of a Function by means of a column coloring.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class HessianColoring evaluates the Jacobian of a function f as well as
+ *	the Hessian of the weighted sum bseed^T*f with respect to a given list of
+ *	variables.
+ *
+ *	Instead of performing one forward sweep followed by one second order backward
+ *	sweep per variable, the variables are grouped into colors such that no two
+ *	variables of the same color share a structurally nonzero row of the stacked
+ *	matrix [ Jacobian; Hessian ]. Then, one pair of sweeps per color suffices and
+ *	all entries can be read off directly from the compressed derivatives.
+ *
+ *	The sparsity patterns are obtained from the symbolic expression tree (see
+ *	Function::getSparsityPattern) and the coloring is computed only once, when
+ *	calling init(). A greedy (distance-2) column coloring is used.
+ *
+ *	\author agent
+ */
+class HessianColoring{
+
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor. */
+        HessianColoring( );
+
+        /** Copy constructor (deep copy). */
+        HessianColoring( const HessianColoring& rhs );
+
+        /** Destructor. */
+        virtual ~HessianColoring( );
+
+        /** Assignment operator (deep copy). */
+        HessianColoring& operator=( const HessianColoring& rhs );
+
+
+        /** Determines the sparsity patterns of the function f with respect to   \n
+         *  the variables (varType[i],component[i]), whose indices within f are  \n
+         *  given by varIndex[i], and computes the coloring.                    \n
+         *                                                                       \n
+         *  \return SUCCESSFUL_RETURN                                            \n
+         */
+        returnValue init(	Function     &f,            /**< the function           */
+							int           nVars_,       /**< number of variables    */
+							const int    *varIndex_,    /**< indices of the variables within f */
+							VariableType *varType,      /**< types of the variables */
+							int          *component     /**< components of the variables */
+							);
+
+
+        /** Same as above for the variables of an optimal control problem in the \n
+         *  order (x,xa,p,u,w) as used within the constraints and objectives.   \n
+         *                                                                       \n
+         *  \return SUCCESSFUL_RETURN                                            \n
+         */
+        returnValue init(	Function     &f,            /**< the function                 */
+							int           nx,           /**< number of diff. states       */
+							int           na,           /**< number of alg. states        */
+							int           np,           /**< number of parameters         */
+							int           nu,           /**< number of controls           */
+							int           nw,           /**< number of disturbances       */
+							const int    *varIndex_     /**< indices of the variables within f */
+							);
+
+
+        /** Evaluates the Jacobian D (dim x nVars) of f and the Hessian H          \n
+         *  (nVars x nVars) of bseed^T*f at the point that has been stored in    \n
+         *  the buffer position "number" of f.                                   \n
+         *                                                                       \n
+         *  \return SUCCESSFUL_RETURN                                            \n
+         *          RET_MEMBER_NOT_INITIALISED                                  \n
+         */
+        returnValue evaluate(	Function &f,        /**< the function           */
+								int       number,   /**< the buffer position    */
+								double   *bseed,    /**< the backward seed      */
+								Matrix   &D,        /**< the Jacobian (output)  */
+								Matrix   &H         /**< the Hessian  (output)  */
+								);
+
+
+		/** Returns the number of colors, i.e. the number of forward/backward sweep pairs \n
+		 *  needed per evaluation. */
+		inline int getNumColors( ) const;
+
+		/** Returns whether the coloring has been computed. */
+		inline BooleanType isInitialized( ) const;
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+        /** Computes a greedy column coloring of the stacked pattern [J;H]. */
+        returnValue computeColoring( );
+
+        /** Checks whether the columns idx1 and idx2 share a structurally nonzero row. */
+        BooleanType isOverlapping(	int idx1,
+									int idx2
+									) const;
+
+        void clear( );
+
+        void copy( const HessianColoring& rhs );
+
+
+
+    //
+    // PROTECTED DATA MEMBERS:
+    //
+    protected:
+
+        int          nVars;             /**< Number of variables.                          */
+        int          nOut;              /**< Dimension of the function.                    */
+        int          nColors;           /**< Number of colors.                             */
+
+        int         *varIndex;          /**< Indices of the variables within the function. */
+        int         *color;             /**< Color of each variable.                       */
+        BooleanType *jacobianPattern;   /**< Sparsity pattern of the Jacobian (row-wise).  */
+        BooleanType *hessianPattern;    /**< Sparsity pattern of the Hessian (row-wise).   */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/function/hessian_coloring.ipp>
+
+
+#endif  // ACADO_TOOLKIT_HESSIAN_COLORING_HPP
+
+/*
+ *  end of file
+ */
@@ -77,6 +77,11 @@
       USE_PIPES = YES
 
 
+   ## OPENMP    ( YES or NO )
+   ## -----------------------
+      OPENMP    = YES
+
+
 
 ## ======================================================================= ##
 ##                                                                         ##
@@ -167,6 +172,10 @@
       ifeq (${INLINE}, YES)
           CPP_GLOBAL_FLAGS     += -finline-functions
       endif
+      ifeq (${OPENMP}, YES)
+          CPP_GLOBAL_FLAGS     += -fopenmp
+          OPENMP_LIBS           = -fopenmp
+      endif
 
 
    endif
@@ -204,6 +213,10 @@
                                 -nologo -D__NO_COPYRIGHT__ -EHsc     \
                                 -Dsnprintf=_snprintf -Dusleep=Sleep
 
+      ifeq (${OPENMP}, YES)
+          CPP_GLOBAL_FLAGS     += -openmp
+      endif
+
    endif
 
 
@@ -294,6 +307,10 @@
            XML_LIBS           = ${lib}acado_xml${a} ${lib}tinyxml${a}
       endif
 
+      ifeq (${SYSTEM}, LINUX)
+           THREAD_LIBS        = -lpthread
+      endif
+
 
 
 ## ======================================================================= ##
@@ -307,27 +324,34 @@
                                ${XML_LIBS}          \
                                ${GNUPLOT_LIBS}      \
                                ${L_INTEGRATOR}      \
-                               ${CSPARSE_LIBS}
+                               ${CSPARSE_LIBS}      \
+                               ${OPENMP_LIBS}
 
       CODE_GENERATION_LIBS = -L${LIBS_DIR}          \
                                ${XML_LIBS}          \
                                ${GNUPLOT_LIBS}      \
                                ${L_OPTIMAL_CONTROL} \
-                               ${CSPARSE_LIBS}
+                               ${CSPARSE_LIBS}      \
+                               ${THREAD_LIBS}       \
+                               ${OPENMP_LIBS}
 
       OPTIMAL_CONTROL_LIBS = -L${LIBS_DIR}          \
                                ${XML_LIBS}          \
                                ${GNUPLOT_LIBS}      \
                                ${L_OPTIMAL_CONTROL} \
                                ${QPOASES_LIBS}      \
-                               ${CSPARSE_LIBS}
+                               ${CSPARSE_LIBS}      \
+                               ${THREAD_LIBS}       \
+                               ${OPENMP_LIBS}
 
       TOOLKIT_LIBS         = -L${LIBS_DIR}          \
                                ${XML_LIBS}          \
                                ${GNUPLOT_LIBS}      \
                                ${L_TOOLKIT}         \
                                ${QPOASES_LIBS}      \
-                               ${CSPARSE_LIBS}
+                               ${CSPARSE_LIBS}      \
+                               ${THREAD_LIBS}       \
+                               ${OPENMP_LIBS}
 
 
 
@@ -416,6 +416,23 @@ class Integrator : public AlgorithmicBase
 		virtual int getNumberOfRejectedSteps() const = 0;
 
 
+		/**  Returns the number of steps of the last integration whose step size     \n
+		*   was limited by stability rather than by accuracy. Integrators which do  \n
+		*   not estimate stiffness return 0.                                         \n
+		*   \return The number of stiff steps.                                      \n
+		*/
+		virtual int getNumberOfStiffSteps() const;
+
+
+		/**  Lets explicit integrators stop with RET_STIFFNESS_DETECTED as soon as   \n
+		*   the given number of (almost) consecutive steps has been limited by      \n
+		*   stability. The default 0 never stops; integrators which do not          \n
+		*   estimate stiffness ignore this setting.                                  \n
+		*   \return SUCCESSFUL_RETURN                                               \n
+		*/
+		virtual returnValue setMaxNumStiffSteps( int maxNumStiffSteps_ );
+
+
 
 		/**  Returns if integrator is able to handle implicit switches.                  \n
 		*   \return BT_TRUE:  if integrator can handle implicit switches.               \n
@@ -445,6 +462,36 @@ class Integrator : public AlgorithmicBase
 		virtual double getStepSize() const = 0;
 
 
+		/**  Returns the step size that the step size control proposed after the    \n
+		*   first accepted step of the last integration, relative to the length of  \n
+		*   the integration interval (0 if not available). With the option          \n
+		*   WARM_START_INTEGRATOR the next integration starts with this step size.   \n
+		*   \return The relative warm start step size.                              \n
+		*/
+		double getWarmStepSize() const;
+
+
+		/**  Sets the relative step size the next integration starts with if the    \n
+		*   option WARM_START_INTEGRATOR is set (0: use INITIAL_INTEGRATOR_STEPSIZE).\n
+		*   \return SUCCESSFUL_RETURN                                               \n
+		*/
+		returnValue setWarmStepSize( double hWarm_ );
+
+
+		/**  Sets an absolute point in time (as returned by acadoGetTime) after     \n
+		*   which the integration stops with RET_INTEGRATOR_DEADLINE_REACHED. A    \n
+		*   non-positive value removes the deadline.                               \n
+		*   \return SUCCESSFUL_RETURN                                               \n
+		*/
+		returnValue setDeadline( double deadline_ );
+
+
+		/**  Returns the deadline of the integration (non-positive if none is set). \n
+		*   \return The absolute deadline.                                          \n
+		*/
+		double getDeadline() const;
+
+
 		/** Prints the run-time profile. This routine \n
 		*  can be used after an integration run in   \n
 		*  order to assess the performance.          \n
@@ -607,6 +654,10 @@ class Integrator : public AlgorithmicBase
 		virtual returnValue setupLogging( );
 
 
+		/**  Returns whether a deadline is set and has already passed. */
+		BooleanType isDeadlineReached() const;
+
+
 	//
 	// DATA MEMBERS:
 	//
@@ -638,6 +689,8 @@ class Integrator : public AlgorithmicBase
 		// ---------
 		double  *h                   ;  /**< the initial step size = h[0]                       */
 		double   hini                ;  /**< storage of the initial step size                   */
+		double   hWarm               ;  /**< the relative warm start step size (0: unused)      */
+		double   deadline            ;  /**< the absolute deadline of the integration (<=0: none)*/
 		double   hmin                ;  /**< the minimum step size                              */
 		double   hmax                ;  /**< the maximum step size                              */
 		double   tune                ;  /**< tuning parameter for the step size control.        */
@@ -727,9 +780,12 @@ CLOSE_NAMESPACE_ACADO
 #include <acado/integrator/integrator_runge_kutta12.hpp>
 #include <acado/integrator/integrator_runge_kutta23.hpp>
 #include <acado/integrator/integrator_runge_kutta45.hpp>
+#include <acado/integrator/integrator_dopri5.hpp>
+#include <acado/integrator/integrator_verner6.hpp>
 #include <acado/integrator/integrator_runge_kutta78.hpp>
 #include <acado/integrator/integrator_discretized_ode.hpp>
 #include <acado/integrator/integrator_bdf.hpp>
+#include <acado/integrator/integrator_ensemble.hpp>
 
 
 #endif  // ACADO_TOOLKIT_INTEGRATOR_HPP
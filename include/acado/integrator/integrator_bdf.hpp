@@ -46,6 +46,10 @@ BEGIN_NAMESPACE_ACADO
  *  The class IntegratorBDF implements the backward-differentiation formula
  *	for integrating differential-algebraic equations (DAEs).
  *
+ *	The option MAX_NUM_STORED_INTEGRATOR_STEPS is not supported: no
+ *	checkpointing is performed, i.e. all intermediate values of a frozen
+ *	trajectory are stored.
+ *
  *	\author Boris Houska, Hans Joachim Ferreau
  */
 class IntegratorBDF : public Integrator{
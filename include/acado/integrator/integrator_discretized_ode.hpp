@@ -88,6 +88,68 @@ public:
 								);
 
 
+    /** Evaluates the discrete-time map for nSteps steps starting at the   \n
+     *  time t0 within the preallocated buffers of the integrator. In       \n
+     *  contrast to integrate(), no grids, seeds or options are processed   \n
+     *  and nothing is logged. The evaluation points are kept such that     \n
+     *  the Jacobian of the map can be obtained by                          \n
+     *  evaluateMapSensitivities() afterwards.                              \n
+     *                                                                      \n
+     *  \param t0              the start time                               \n
+     *  \param nSteps          the number of steps (at least one)           \n
+     *  \param xd              on input the initial, on output the final    \n
+     *                         differential states                          \n
+     *  \param p               the parameters                               \n
+     *  \param u               the controls                                 \n
+     *  \param w               the disturbances                             \n
+     *  \param storeTrajectory whether the states after each step are       \n
+     *                         stored such that getX( VariablesGrid& ) and  \n
+     *                         getI( VariablesGrid& ) can be used.          \n
+     *                                                                      \n
+     *  \return SUCCESSFUL_RETURN                                           \n
+     *          RET_TRIVIAL_RHS                                             \n
+     *          RET_INVALID_ARGUMENTS                                       \n
+     *          RET_INPUT_HAS_WRONG_DIMENSION                               \n
+     *          RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45                \n
+     */
+    returnValue evaluateMap( double        t0    ,
+                             int           nSteps,
+                             Vector       &xd    ,
+                             const Vector &p     ,
+                             const Vector &u     ,
+                             const Vector &w     ,
+                             BooleanType   storeTrajectory = BT_FALSE );
+
+
+    /** Computes the Jacobian of the last evaluateMap() call w.r.t. the     \n
+     *  initial differential states, the parameters, the controls and the   \n
+     *  disturbances by propagating unit forward seeds through all steps.   \n
+     *  The result is kept until the next evaluation of the map.            \n
+     *                                                                      \n
+     *  \return SUCCESSFUL_RETURN                                           \n
+     *          RET_MEMBER_NOT_INITIALISED                                  \n
+     *          RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45                \n
+     */
+    returnValue evaluateMapSensitivities( );
+
+
+    /** Returns the Jacobian computed by evaluateMapSensitivities() as a    \n
+     *  row-major array of dimension m x (m+mp+mu+mw), where the columns     \n
+     *  belong to the states, parameters, controls and disturbances.        \n
+     */
+    inline const double* getMapJacobian( ) const;
+
+
+    /** Repeats the last evaluateMap() call by the standard integration     \n
+     *  routine, e.g. in order to compute second order sensitivities.       \n
+     *                                                                      \n
+     *  \return SUCCESSFUL_RETURN                                           \n
+     *          RET_MEMBER_NOT_INITIALISED                                  \n
+     *          or an error code of integrate()                             \n
+     */
+    returnValue reintegrateMap( );
+
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
@@ -104,12 +166,35 @@ protected:
     returnValue performADbackwardStep2( const int& number_ );
 
 
+    /** Allocates the buffers of evaluateMap() and evaluateMapSensitivities(). */
+    void allocateMapMemory( );
+
+    /** Deletes the buffers of evaluateMap() and evaluateMapSensitivities(). */
+    void deleteMapMemory( );
+
+    /** Copies the buffers of evaluateMap() and evaluateMapSensitivities(). */
+    void copyMapMemory( const IntegratorDiscretizedODE& arg );
+
+
 //
 // PROTECTED MEMBERS:
 //
 protected:
 
     double stepLength;
+
+
+    // DIRECT EVALUATION OF THE MAP:
+    // -----------------------------
+    int         *mapComponents     ;  /**< the state component of each equation               */
+    double      *mapStart          ;  /**< the initial states of the last map evaluation      */
+    double      *mapSeed           ;  /**< forward seed for all variables of the rhs          */
+    double      *mapDir            ;  /**< the currently propagated sensitivity direction     */
+    double      *mapSens           ;  /**< the directional derivative of one step             */
+    double      *mapJacobian       ;  /**< the Jacobian of the last map evaluation            */
+    double       mapTime           ;  /**< the start time of the last map evaluation          */
+    int          nMapSteps         ;  /**< the number of steps of the last map evaluation     */
+    BooleanType  isMapJacobianValid;  /**< whether mapJacobian belongs to the last evaluation */
 };
 
 
@@ -31,11 +31,23 @@
  */
 
 
+BEGIN_NAMESPACE_ACADO
+
+
 //
 // PUBLIC MEMBER FUNCTIONS:
 //
 
 
+inline const double* IntegratorDiscretizedODE::getMapJacobian( ) const{
+
+    return mapJacobian;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+
 
 
 // end of file.
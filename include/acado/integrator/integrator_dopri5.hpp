@@ -0,0 +1,105 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/integrator/integrator_dopri5.hpp
+ *    \author agent
+ */
+
+
+#ifndef ACADO_TOOLKIT_INTEGRATOR_DOPRI5_HPP
+#define ACADO_TOOLKIT_INTEGRATOR_DOPRI5_HPP
+
+
+#include <acado/integrator/integrator_fwd.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** 
+ *	\brief Implements the Dormand-Prince 5(4) scheme for integrating ODEs.
+ *
+ *	\ingroup NumericalAlgorithms
+ *
+ *  The class IntegratorDOPRI5 implements the Dormand-Prince 5(4) scheme
+ *	for integrating ordinary differential equations (ODEs).
+ *
+ *  In contrast to IntegratorRK45, which is based on the same Butcher
+ *  tableau, the solution is propagated with the 5th order weights while
+ *  the embedded 4th order solution is only used for the error estimate.
+ *  As the 5th order weights coincide with the last row of the tableau
+ *  (first same as last), the last stage of an accepted step is reused
+ *  as the first stage of the next one, i.e. only six evaluations of the
+ *  right-hand side are needed per step.
+ *
+ *	\author agent
+ */
+class IntegratorDOPRI5 : public IntegratorRK{
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+public:
+
+    /** Default constructor. */
+    IntegratorDOPRI5( );
+
+    /** Default constructor. */
+    IntegratorDOPRI5( const DifferentialEquation &rhs_ );
+
+    /** Copy constructor (deep copy). */
+    IntegratorDOPRI5( const IntegratorDOPRI5& arg );
+
+    /** Destructor. */
+    virtual ~IntegratorDOPRI5( );
+
+    /** Assignment operator (deep copy). */
+    virtual IntegratorDOPRI5& operator=( const IntegratorDOPRI5& arg );
+
+    /** The (virtual) copy constructor */
+    virtual Integrator* clone() const;
+
+
+protected:
+
+    /** This routine initializes the coefficients of the Butcher Tableau. */
+    virtual void initializeButcherTableau();
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+
+#include <acado/integrator/integrator_dopri5.ipp>
+
+
+#endif  // ACADO_TOOLKIT_INTEGRATOR_DOPRI5_HPP
+
+// end of file.
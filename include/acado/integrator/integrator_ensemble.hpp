@@ -0,0 +1,280 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+/**
+ *    \file include/acado/integrator/integrator_ensemble.hpp
+ *    \author agent
+ */
+
+
+#ifndef ACADO_TOOLKIT_INTEGRATOR_ENSEMBLE_HPP
+#define ACADO_TOOLKIT_INTEGRATOR_ENSEMBLE_HPP
+
+
+#include <acado/integrator/integrator_fwd.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** 
+ *	\brief Integrates an ensemble of trajectories of the same ODE in lockstep.
+ *
+ *	\ingroup NumericalAlgorithms
+ *
+ *  The class IntegratorEnsemble integrates the same ordinary differential
+ *	equation (ODE) for many initial states, parameters, controls and
+ *	disturbances at once (e.g. for Monte Carlo simulations or scenario
+ *	trees). All trajectories (lanes) are advanced together by an embedded
+ *	explicit Runge-Kutta scheme whose Butcher tableau is taken from the
+ *	corresponding IntegratorRK.
+ *
+ *	The states of all lanes are stored component-wise, i.e. the values of
+ *	one component for all lanes are contiguous in memory, such that all
+ *	stage combinations are simple loops over the lanes. A symbolic
+ *	right-hand side is evaluated for all lanes of a stage in one batched
+ *	call (Function::evaluateBatch), which walks the expression tree once
+ *	and applies each operation to all lanes. With OpenMP, each thread
+ *	evaluates one contiguous block of lanes. Other right-hand sides are
+ *	evaluated lane by lane.
+ *
+ *	By default, each lane has its own step size and step acceptance is
+ *	decided per lane (lanes that reject a step or have already reached
+ *	the final time are masked). Alternatively, all lanes can share one
+ *	step size.
+ *
+ *	\author agent
+ */
+class IntegratorEnsemble : public AlgorithmicBase{
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+public:
+
+    /** Default constructor. */
+    IntegratorEnsemble( );
+
+    /** Constructor which takes the right-hand side and the type of the      \n
+     *  Runge-Kutta scheme (INT_RK12, INT_RK23, INT_RK45, INT_RK78,         \n
+     *  INT_DOPRI5 or INT_VERNER6).                                         \n
+     */
+    IntegratorEnsemble( const DifferentialEquation &rhs_,
+                        IntegratorType             type_ = INT_RK45 );
+
+    /** Copy constructor (deep copy). */
+    IntegratorEnsemble( const IntegratorEnsemble& arg );
+
+    /** Destructor. */
+    virtual ~IntegratorEnsemble( );
+
+    /** Assignment operator (deep copy). */
+    IntegratorEnsemble& operator=( const IntegratorEnsemble& arg );
+
+
+    /** The initialization routine which takes the right-hand side of    \n
+     *  the differential equation and the type of the Runge-Kutta scheme. \n
+     *                                                                    \n
+     *  \return SUCCESSFUL_RETURN                                         \n
+     *          RET_TRIVIAL_RHS                                           \n
+     *          RET_RK45_CAN_NOT_TREAT_DAE                                \n
+     *          RET_INVALID_ARGUMENTS                                     \n
+     */
+    returnValue init( const DifferentialEquation &rhs_,
+                      IntegratorType             type_ = INT_RK45 );
+
+
+    /** Specifies whether all lanes share one step size (BT_TRUE) or     \n
+     *  each lane adapts its own step size (BT_FALSE, default).          \n
+     *                                                                   \n
+     *  \return SUCCESSFUL_RETURN                                        \n
+     */
+    inline returnValue setSharedStepSize( BooleanType sharedStepSize_ );
+
+
+    /** Integrates all lanes from t0 to tend. The k-th row of each of the \n
+     *  matrices x0, p, u and w contains the data of the k-th lane. All   \n
+     *  matrices except x0 may have zero rows if the ODE does not depend  \n
+     *  on the corresponding variables or one row if the data is the same \n
+     *  for all lanes.                                                    \n
+     *                                                                    \n
+     *  \return SUCCESSFUL_RETURN                                         \n
+     *          RET_MISSING_INPUTS                                        \n
+     *          RET_INPUT_HAS_WRONG_DIMENSION                             \n
+     *          RET_TO_SMALL_OR_NEGATIVE_TIME_INTERVAL                    \n
+     *          RET_MAX_NUMBER_OF_STEPS_EXCEEDED                          \n
+     *          RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45              \n
+     */
+    returnValue integrate( double        t0,
+                           double        tend,
+                           const Matrix &x0,
+                           const Matrix &p = emptyConstMatrix,
+                           const Matrix &u = emptyConstMatrix,
+                           const Matrix &w = emptyConstMatrix );
+
+
+    /** Returns the states of all lanes at the final time (one row per lane). \n
+     *  \return SUCCESSFUL_RETURN                                             \n
+     */
+    returnValue getX( Matrix &xEnd ) const;
+
+
+    /** Returns the number of lanes of the last integration. */
+    inline int getNumLanes( ) const;
+
+    /** Returns the dimension of the differential state. */
+    inline int getDim( ) const;
+
+    /** Returns the number of accepted steps of the given lane. */
+    inline int getNumberOfSteps( int lane ) const;
+
+    /** Returns the number of rejected steps of the given lane. */
+    inline int getNumberOfRejectedSteps( int lane ) const;
+
+    /** Returns the total number of batched stage evaluations. */
+    inline int getNumberOfBatchEvaluations( ) const;
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+protected:
+
+    /** Adds all integrator options. */
+    returnValue setupOptions( );
+
+    /** Sets all pointer-valued members to NULL. */
+    void initializeVariables( );
+
+    /** Allocates the memory that depends only on the right-hand side. */
+    void allocateMemory( );
+
+    /** Allocates the memory for the lane data. */
+    void allocateLanes( int nLanes_ );
+
+    /** Frees all memory. */
+    void deleteAll( );
+
+    /** Implementation of the copy constructor. */
+    void constructAll( const IntegratorEnsemble& arg );
+
+
+    /** Copies the lane data of the given matrix (one row per lane or a \n
+     *  single row for all lanes) into the evaluation vectors.           \n
+     */
+    returnValue setLaneData( const Matrix &data, int dim_, const int *index_ );
+
+
+    /** Evaluates the right-hand side of the given stage for all lanes \n
+     *  (batched model evaluation).                                      \n
+     *  \return SUCCESSFUL_RETURN                                        \n
+     *          RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45             \n
+     */
+    returnValue evaluateStage( int stage );
+
+
+    /** Performs one (trial) step for all active lanes and determines  \n
+     *  the error estimates.                                          \n
+     *  \return SUCCESSFUL_RETURN                                     \n
+     *          RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45          \n
+     */
+    returnValue determineEta45( );
+
+
+
+//
+// DATA MEMBERS:
+//
+protected:
+
+    // RIGHT-HAND SIDE:
+    // ----------------
+    DifferentialEquation *rhs     ;  /**< one copy of the right-hand side per thread      */
+    int                   nRhs    ;  /**< number of copies of the right-hand side         */
+    int                   m       ;  /**< number of differential states                   */
+    int                   mu      ;  /**< number of controls                              */
+    int                   mp      ;  /**< number of parameters                            */
+    int                   mw      ;  /**< number of disturbances                          */
+    int                   nVars   ;  /**< length of a lane's evaluation vector            */
+
+    int                  *diff_index       ;  /**< index list of the differential states */
+    int                  *control_index    ;  /**< index list of the controls            */
+    int                  *parameter_index  ;  /**< index list of the parameters          */
+    int                  *disturbance_index;  /**< index list of the disturbances        */
+    int                   time_index       ;  /**< index of the time                     */
+
+
+    // BUTCHER TABLEAU:
+    // ----------------
+    int      dim            ;  /**< the dimension of the Butcher Tableau.              */
+    double  *A              ;  /**< the coefficients A (row-major, dim x dim).          */
+    double  *b4             ;  /**< the 4th order coefficients of the Butcher Tableau. */
+    double  *b5             ;  /**< the 5th order coefficients of the Butcher Tableau. */
+    double  *c              ;  /**< the time coefficients of the Butcher Tableau.      */
+    double   err_power      ;  /**< root order of the step size control                */
+
+
+    // LANE DATA (component-major, i.e. entry (i,lane) at i*nLanes+lane):
+    // ------------------------------------------------------------------
+    int      nLanes         ;  /**< number of lanes                                    */
+    double  *eta4           ;  /**< the current states                                 */
+    double  *eta5           ;  /**< the embedded solution                              */
+    double  *eta4_          ;  /**< the states at the beginning of the step            */
+    double  *k              ;  /**< the stage derivatives (dim x m x nLanes)           */
+    double  *xStage         ;  /**< the states at the current stage                    */
+    double  *x              ;  /**< the evaluation matrix (nVars x nLanes)             */
+    double  *f              ;  /**< one right-hand side output buffer per thread       */
+    double  *xThread        ;  /**< one evaluation vector per thread (non-symbolic rhs) */
+    double  *scale          ;  /**< the scaling of the states for the error estimate   */
+    double  *t              ;  /**< the current time of each lane                      */
+    double  *h              ;  /**< the current step size of each lane                 */
+    double  *hStep          ;  /**< the step size of active lanes (0 for masked lanes) */
+    double  *E              ;  /**< the error estimate of each lane                    */
+    int     *active         ;  /**< 1 if the lane has not reached the final time yet   */
+    int     *nSteps         ;  /**< number of accepted steps of each lane              */
+    int     *nRejected      ;  /**< number of rejected steps of each lane              */
+    int      nBatchEvaluations; /**< number of batched stage evaluations               */
+
+
+    // SETTINGS:
+    // ---------
+    BooleanType sharedStepSize;  /**< whether all lanes share one step size            */
+    BooleanType isBatched     ;  /**< whether the rhs supports batched evaluations     */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/integrator/integrator_ensemble.ipp>
+
+
+#endif  // ACADO_TOOLKIT_INTEGRATOR_ENSEMBLE_HPP
+
+// end of file.
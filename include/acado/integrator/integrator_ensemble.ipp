@@ -23,17 +23,14 @@
  */
 
 
+
+
 /**
- *    \file src/nlp_solver/ip_method.cpp
+ *    \file include/acado/integrator/integrator_ensemble.ipp
  *    \author Boris Houska, Hans Joachim Ferreau
- *
  */
 
 
-#include <nlp_solver/ip_method.hpp>
-
-
-
 BEGIN_NAMESPACE_ACADO
 
 
@@ -41,67 +38,46 @@ BEGIN_NAMESPACE_ACADO
 // PUBLIC MEMBER FUNCTIONS:
 //
 
-IPmethod::IPmethod( ) : NLPsolver( )
-{
-}
-
+inline returnValue IntegratorEnsemble::setSharedStepSize( BooleanType sharedStepSize_ ){
 
-IPmethod::IPmethod( UserInteraction* _userInteraction ) : NLPsolver( _userInteraction )
-{
+    sharedStepSize = sharedStepSize_;
+    return SUCCESSFUL_RETURN;
 }
 
 
-IPmethod::IPmethod( const NLP& nlp_ ) : NLPsolver()
-{
-}
-
+inline int IntegratorEnsemble::getNumLanes( ) const{
 
-IPmethod::IPmethod( const IPmethod& rhs ) : NLPsolver( )
-{
+    return nLanes;
 }
 
 
-IPmethod::~IPmethod( )
-{
-}
-
+inline int IntegratorEnsemble::getDim( ) const{
 
-IPmethod& IPmethod::operator=( const IPmethod& rhs )
-{
-	if ( this != &rhs )
-	{
-		NLPsolver::operator=( rhs );
-    }
-	return *this;
+    return m;
 }
 
 
-returnValue IPmethod::init(VariablesGrid    *xd,
-                                 VariablesGrid    *xa,
-                                 VariablesGrid    *p,
-                                 VariablesGrid    *u,
-                                 VariablesGrid    *w   )
-{
-    return THROWERROR( RET_NOT_IMPLEMENTED_YET );
-}
+inline int IntegratorEnsemble::getNumberOfSteps( int lane ) const{
 
-
-returnValue IPmethod::start( int maxNumSteps )
-{
-	return THROWERROR( RET_NOT_IMPLEMENTED_YET );
+    if( lane < 0 || lane >= nLanes ) return 0;
+    return nSteps[lane];
 }
 
 
+inline int IntegratorEnsemble::getNumberOfRejectedSteps( int lane ) const{
 
-
-//
-// PROTECTED MEMBER FUNCTIONS:
-//
+    if( lane < 0 || lane >= nLanes ) return 0;
+    return nRejected[lane];
+}
 
 
+inline int IntegratorEnsemble::getNumberOfBatchEvaluations( ) const{
 
+    return nBatchEvaluations;
+}
 
 
 CLOSE_NAMESPACE_ACADO
 
+
 // end of file.
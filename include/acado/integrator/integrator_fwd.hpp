@@ -58,9 +58,12 @@ BEGIN_NAMESPACE_ACADO
     class IntegratorRK12           ;
     class IntegratorRK23           ;
     class IntegratorRK45           ;
+    class IntegratorDOPRI5         ;
+    class IntegratorVERNER6        ;
     class IntegratorRK78           ;
     class IntegratorDiscretizedODE ;
     class IntegratorBDF            ;
+    class IntegratorEnsemble       ;
 
 
 CLOSE_NAMESPACE_ACADO
@@ -52,6 +52,8 @@ BEGIN_NAMESPACE_ACADO
  */
 class IntegratorRK : public Integrator{
 
+    friend class IntegratorEnsemble;
+
 //
 // PUBLIC MEMBER FUNCTIONS:
 //
@@ -128,7 +130,10 @@ public:
      *  is necessary for the case that automatic differentiation in backward  \n
      *  mode should is used. (Note: This function might for large right hand  \n
      *  sides lead to memory problems as all intemediate values will be       \n
-     *  stored!)                                                              \n
+     *  stored!) The memory can be bounded by setting the option           \n
+     *  MAX_NUM_STORED_INTEGRATOR_STEPS: then only the states at the start   \n
+     *  of each segment of that many steps are stored and the intermediate   \n
+     *  values are recomputed segment-wise during the sensitivity sweeps.    \n
      *  \return SUCCESSFUL_RETURN                                             \n
      *          RET_ALREADY_FROZEN                                            \n
      */
@@ -209,6 +214,21 @@ public:
     virtual int getNumberOfRejectedSteps() const;
 
 
+    /**  Returns the length of the longest stretch of steps of the last          \n
+     *   integration whose step size was limited by stability rather than by    \n
+     *   accuracy (up to five non-stiff steps in between are tolerated).         \n
+     *   \return The number of stiff steps.                                     \n
+     */
+    virtual int getNumberOfStiffSteps() const;
+
+
+    /**  Lets the integrator stop with RET_STIFFNESS_DETECTED as soon as the     \n
+     *   number of stiff steps reaches the given value (0: never stop).          \n
+     *   \return SUCCESSFUL_RETURN                                              \n
+     */
+    virtual returnValue setMaxNumStiffSteps( int maxNumStiffSteps_ );
+
+
     /** Returns the current step size */
     virtual double getStepSize() const;
 
@@ -416,6 +436,59 @@ protected:
 
 
 
+    /** Returns the position in the function buffer at which the intermediate \n
+     *  values of the given step are stored. If checkpointing is active, the  \n
+     *  buffer is reused for each segment of maxNumStoredSteps steps.         \n
+     *  (only for internal use)                                               \n
+     */
+    int getStorageIndex( int number ) const;
+
+
+    /** Stores the state at the beginning of a segment of the trajectory if   \n
+     *  the given step starts a new segment. (only for internal use)          \n
+     */
+    void storeCheckpoint( int number );
+
+
+    /** Stores the forward sensitivities at the beginning of a segment of the \n
+     *  trajectory if the given step starts a new segment. These are needed   \n
+     *  to recompute the segment for second order backward sensitivities.     \n
+     *  (only for internal use)                                               \n
+     */
+    void storeSensitivityCheckpoint( int number );
+
+
+    /** Recomputes the intermediate values of the segment containing the given \n
+     *  step starting from the closest checkpoint, if they have been           \n
+     *  overwritten in the meantime. (only for internal use)                   \n
+     *  \return SUCCESSFUL_RETURN                                              \n
+     *          RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45                    \n
+     */
+    returnValue recomputeSegment( int number );
+
+
+    /** Estimates the dominant eigenvalue of the Jacobian from the last two   \n
+     *  stages of the accepted step (cf. Hairer/Wanner, Sect. IV.2) and        \n
+     *  updates the counters of stiff and non-stiff steps. (only for internal  \n
+     *  use)                                                                   \n
+     */
+    void updateStiffnessEstimate();
+
+
+    /** Returns whether the propagated solution of the Butcher tableau        \n
+     *  coincides with its last stage (first same as last), such that the     \n
+     *  last stage of a step can be reused as the first stage of the next.    \n
+     */
+    BooleanType hasFSALproperty() const;
+
+
+    /** Returns whether the current mode allows to skip the evaluation of     \n
+     *  known stages, i.e. whether the intermediate values of the right-hand  \n
+     *  side are not stored for a later sensitivity sweep.                    \n
+     */
+    BooleanType canReuseStages() const;
+
+
     void interpolate( int jj, double *e1, double *d1, double *e2, VariablesGrid &poly );
 
 
@@ -444,8 +517,8 @@ protected:
     double  *eta5              ;  /**< the result of order 5                              */
     double  *eta4_             ;  /**< the result of order 4                              */
     double  *eta5_             ;  /**< the result of order 5                              */
-    double **k                 ;  /**< the intermediate results                           */
-    double **k2                ;  /**< the intermediate results                           */
+    double **k                 ;  /**< the intermediate results (stored contiguously)     */
+    double **k2                ;  /**< the intermediate results (stored contiguously)     */
     double **l                 ;  /**< the intermediate results                           */
     double **l2                ;  /**< the intermediate results                           */
     double   t                 ;  /**< the actual time                                    */
@@ -453,6 +526,15 @@ protected:
     double   err_power         ;  /**< root order of the step size control                */
 
 
+    // FIRST SAME AS LAST:
+    // -------------------
+    BooleanType isFSAL         ;  /**< whether the tableau has the FSAL property          */
+    double     *kFSAL          ;  /**< the first stage of the current step                */
+    double     *gFSAL          ;  /**< the first sensitivity stage of the current step    */
+    BooleanType kFSALvalid     ;  /**< whether kFSAL holds the current first stage        */
+    BooleanType gFSALvalid     ;  /**< whether gFSAL holds the current first stage        */
+
+
     // SENSITIVITIES:
     // --------------
     Vector     fseed           ;  /**< The forward seed (only internal use)               */
@@ -482,6 +564,27 @@ protected:
     // --------
     int maxAlloc                ;  /**< size of the memory that is allocated to store      \n
                                     *   the trajectory and the mesh.                       */
+
+
+    // CHECKPOINTING:
+    // --------------
+    int      maxNumStoredSteps  ;  /**< number of steps whose intermediate values are kept \n
+                                    *   in memory (0: all steps are stored).              */
+    int      nCheckpoints       ;  /**< number of stored checkpoints                       */
+    int      maxCheckpoints     ;  /**< number of allocated checkpoints                    */
+    int      activeSegment      ;  /**< the segment whose intermediate values are stored   */
+    int      nRecomputedSteps   ;  /**< number of recomputed steps (statistics)            */
+    double  *tCheckpoint        ;  /**< the times at the checkpoints                       */
+    double  *xCheckpoint        ;  /**< the states at the checkpoints                      */
+    double  *gCheckpoint        ;  /**< the forward sensitivities at the checkpoints       */
+
+
+    // STIFFNESS DETECTION:
+    // --------------------
+    int      nStiffSteps        ;  /**< current number of (almost) consecutive stiff steps */
+    int      nNonStiffSteps     ;  /**< current number of consecutive non-stiff steps      */
+    int      maxStiffSteps      ;  /**< maximum of nStiffSteps in the last integration     */
+    int      maxNumStiffSteps   ;  /**< number of stiff steps to stop after (0: never)     */
 };
 
 
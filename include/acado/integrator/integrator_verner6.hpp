@@ -0,0 +1,103 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/integrator/integrator_verner6.hpp
+ *    \author agent
+ */
+
+
+#ifndef ACADO_TOOLKIT_INTEGRATOR_VERNER6_HPP
+#define ACADO_TOOLKIT_INTEGRATOR_VERNER6_HPP
+
+
+#include <acado/integrator/integrator_fwd.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** 
+ *	\brief Implements the Verner 6(5) scheme for integrating ODEs.
+ *
+ *	\ingroup NumericalAlgorithms
+ *
+ *  The class IntegratorVERNER6 implements the Verner 6(5) scheme
+ *	for integrating ordinary differential equations (ODEs).
+ *
+ *  The Butcher tableau with eight stages is the one of Verner's DVERK
+ *  code. The solution is propagated with the 6th order weights, the
+ *  embedded 5th order solution is only used for the error estimate.
+ *  For tight tolerances, the higher order allows considerably larger
+ *  steps than IntegratorRK45 or IntegratorDOPRI5.
+ *
+ *	\author agent
+ */
+class IntegratorVERNER6 : public IntegratorRK{
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+public:
+
+    /** Default constructor. */
+    IntegratorVERNER6( );
+
+    /** Default constructor. */
+    IntegratorVERNER6( const DifferentialEquation &rhs_ );
+
+    /** Copy constructor (deep copy). */
+    IntegratorVERNER6( const IntegratorVERNER6& arg );
+
+    /** Destructor. */
+    virtual ~IntegratorVERNER6( );
+
+    /** Assignment operator (deep copy). */
+    virtual IntegratorVERNER6& operator=( const IntegratorVERNER6& arg );
+
+    /** The (virtual) copy constructor */
+    virtual Integrator* clone() const;
+
+
+protected:
+
+    /** This routine initializes the coefficients of the Butcher Tableau. */
+    virtual void initializeButcherTableau();
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+
+#include <acado/integrator/integrator_verner6.ipp>
+
+
+#endif  // ACADO_TOOLKIT_INTEGRATOR_VERNER6_HPP
+
+// end of file.
@@ -101,6 +101,20 @@ class BlockMatrix{
 
 
 
+		/** Set method that defines a certain component as the product of the \n
+		 *  given factor and another component, i.e.                          \n
+		 *  this(rowIdx,colIdx) := factor * this(argRowIdx,argColIdx).       \n
+		 *  The product is evaluated in place, i.e. without temporary objects \n
+		 *  and reusing the memory of the component if its dimension matches. \n
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue setDenseProduct( uint           rowIdx,    /**< Row index of the component.             */
+                                     uint           colIdx,    /**< Column index of the component.          */
+                                     const Matrix&  factor,    /**< Left factor.                            */
+                                     uint           argRowIdx, /**< Row index of the right factor.          */
+                                     uint           argColIdx  /**< Column index of the right factor.       */ );
+
+
+
 		/** Access method that returns the value of a certain component.
 		 *  \return SUCCESSFUL_RETURN
          */
@@ -109,6 +123,14 @@ class BlockMatrix{
                                         Matrix &value   )  const;
 
 
+		/** Access method that returns a (constant) reference to a certain \n
+		 *  component, i.e. without copying it.                             \n
+		 *  \return Reference to the component
+         */
+		inline const Matrix& getSubBlock( uint rowIdx,  /**< Row index of the component.    */
+                                          uint colIdx   /**< Column index of the component. */ ) const;
+
+
 		/** Access method that returns the value of a certain component and requiring
          *  a given dimension.
 		 *  \return SUCCESSFUL_RETURN
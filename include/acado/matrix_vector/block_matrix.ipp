@@ -49,6 +49,15 @@ inline returnValue BlockMatrix::getSubBlock( uint rowIdx, uint colIdx, Matrix &v
 }
 
 
+inline const Matrix& BlockMatrix::getSubBlock( uint rowIdx, uint colIdx ) const{
+
+	ASSERT( rowIdx < getNumRows( ) );
+	ASSERT( colIdx < getNumCols( ) );
+
+    return elements[rowIdx][colIdx];
+}
+
+
 inline uint BlockMatrix::getNumRows( ) const{
 
 	return nRows;
@@ -201,6 +201,10 @@ CLOSE_NAMESPACE_ACADO
 #include <acado/nlp_derivative_approximation/bfgs_update.ipp>
 
 
+// collect remaining headers
+#include <acado/nlp_derivative_approximation/limited_memory_bfgs_update.hpp>
+
+
 #endif  // ACADO_TOOLKIT_BFGS_UPDATE_HPP
 
 /*
@@ -0,0 +1,223 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file include/acado/nlp_derivative_approximation/limited_memory_bfgs_update.hpp
+ *    \author agent
+ *    \date 2026
+ */
+
+
+#ifndef ACADO_TOOLKIT_LIMITED_MEMORY_BFGS_UPDATE_HPP
+#define ACADO_TOOLKIT_LIMITED_MEMORY_BFGS_UPDATE_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/nlp_derivative_approximation/bfgs_update.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Implements limited-memory BFGS updates for approximating second-order derivatives within NLPsolvers.
+ *
+ *	\ingroup NumericalAlgorithms
+ *
+ *  The class LimitedMemoryBFGSupdate implements limited-memory BFGS updates for
+ *	approximating second-order derivative information within iterative NLPsolvers.
+ *
+ *	Only the last pairs of steps and gradient differences are stored and the
+ *	Hessian approximation is kept in its compact representation
+ *
+ *	   B = delta*I + W*M*W^T,   W = [ delta*S  Y ],
+ *
+ *	where M is a small matrix of the size twice the number of stored pairs.
+ *	Thus, memory and update costs grow only linearly in the number of variables.
+ *	The diagonal part delta*I is written into the Hessian block matrix while the
+ *	low-rank factors W and M are passed to the conic solver separately (see
+ *	getLowRankHessian).
+ *
+ *	If a number of blocks is given, a partitioned update is performed, i.e.
+ *	each stage (all variables of one grid point) keeps a limited-memory update
+ *	of its own and the resulting approximation is block-diagonal.
+ *
+ *	\author agent
+ */
+class LimitedMemoryBFGSupdate : public ConstantHessian
+{
+
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor. */
+        LimitedMemoryBFGSupdate( );
+
+        /** Constructor that takes the number of blocks for partitioned updates. */
+        LimitedMemoryBFGSupdate(	UserInteraction* _userInteraction,
+									uint _nBlocks = 0
+									);
+
+        /** Copy constructor (deep copy). */
+        LimitedMemoryBFGSupdate( const LimitedMemoryBFGSupdate& rhs );
+
+        /** Destructor. */
+        virtual ~LimitedMemoryBFGSupdate( );
+
+        /** Assignment operator (deep copy). */
+        LimitedMemoryBFGSupdate& operator=( const LimitedMemoryBFGSupdate& rhs );
+
+		virtual NLPderivativeApproximation* clone( ) const;
+
+
+
+        virtual returnValue initHessian(	BlockMatrix& B, 	    /**< matrix to be initialised */
+											uint N,                 /**< number of intervals      */
+											const OCPiterate& iter  /**< current iterate          */
+											);
+
+        /** Applies an initial scaling of the form:                   \n
+         *                                                            \n
+         *  B = B*sqrt( (y^T*y)/(x^T*x) )                             \n
+         *                                                            \n
+         *  which is used as diagonal part as long as no pair has     \n
+         *  been stored.                                              \n
+         *                                                            \n
+         *  \return SUCCESSFUL_RETURN                                 \n
+         */
+        virtual returnValue initScaling(	BlockMatrix& B, /**< matrix to be updated */
+											const BlockMatrix& x, /**< direction x          */
+											const BlockMatrix& y  /**< residuum             */
+											);
+
+
+        /** Stores the pair (x,y), drops the oldest pair if the memory \n
+         *  is full and writes the diagonal part delta*I into B.       \n
+         *                                                            \n
+         *  \return SUCCESSFUL_RETURN                                 \n
+         */
+        virtual returnValue apply(       BlockMatrix &B, /**< matrix to be updated */
+                                   const BlockMatrix &x, /**< direction x          */
+                                   const BlockMatrix &y  /**< residuum             */ );
+
+
+        /** Returns the low-rank factors W and M of the compact representation. \n
+         *                                                            \n
+         *  \return SUCCESSFUL_RETURN                                 \n
+         */
+        virtual returnValue getLowRankHessian(	BlockMatrix& W, /**< low-rank factor */
+												BlockMatrix& M  /**< weighting matrix */
+												) const;
+
+
+        inline returnValue setBFGSModification(	const BFGSModificationType &modification_
+												);
+
+
+		inline BooleanType performsBlockUpdates( ) const;
+
+		inline uint getNumPairs( uint groupIdx = 0 ) const;
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+        /** Adds a (possibly modified) pair to the memory of the given group. \n
+         *                                                            \n
+         *  \return SUCCESSFUL_RETURN                                 \n
+         */
+        returnValue applyUpdate(	uint groupIdx,      /**< index of the group */
+									const Vector &s,    /**< direction x        */
+									const Vector &y     /**< residuum           */
+									);
+
+
+        /** Computes the compact representation B = delta*I + W*M*W^T \n
+         *  of the given group.                                        \n
+         *                                                            \n
+         *  \return SUCCESSFUL_RETURN                                 \n
+         */
+        returnValue getCompactForm(	uint groupIdx,
+									Matrix &W,
+									Matrix &M
+									) const;
+
+
+        /** Writes delta*I into B and assembles the low-rank factors. */
+        returnValue setupHessian(	BlockMatrix &B
+									);
+
+
+        returnValue getGroupVector(	uint groupIdx,
+									const BlockMatrix &x,
+									Vector &v
+									) const;
+
+        inline uint getGroup( uint blockIdx ) const;
+
+        void clear( );
+
+        void copy( const LimitedMemoryBFGSupdate& rhs );
+
+
+    //
+    // PROTECTED DATA MEMBERS:
+    //
+    protected:
+
+		BFGSModificationType modification;
+
+		uint nBlocks;                /**< Number of blocks (0 for a single, full update). */
+		uint nGroups;                /**< Number of independently updated groups.         */
+		uint memorySize;             /**< Maximum number of stored pairs per group.       */
+
+		Vector blockDims;            /**< Dimensions of the block rows of the Hessian.    */
+		uint*  groupDims;            /**< Dimensions of the groups.                       */
+
+		Matrix* S;                   /**< Stored steps (column-wise, oldest first).        */
+		Matrix* Y;                   /**< Stored gradient differences.                     */
+		uint*   nPairs;              /**< Number of stored pairs per group.                */
+		double* delta;               /**< Scaling of the diagonal part per group.          */
+
+		BlockMatrix lowRankFactor;   /**< Low-rank factor W of the compact representation. */
+		BlockMatrix lowRankWeight;   /**< Weighting matrix M of the compact representation.*/
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+#include <acado/nlp_derivative_approximation/limited_memory_bfgs_update.ipp>
+
+
+#endif  // ACADO_TOOLKIT_LIMITED_MEMORY_BFGS_UPDATE_HPP
+
+/*
+ *  end of file
+ */
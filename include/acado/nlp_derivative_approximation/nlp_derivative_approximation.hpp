@@ -101,6 +101,17 @@ class NLPderivativeApproximation : public AlgorithmicBase
 									) = 0;
 
 
+        /** Returns the low-rank part W*M*W^T of Hessian approximations that \n
+         *  are not stored explicitly, i.e. the Hessian is given by B + W*M*W^T. \n
+         *  By default, W and M are empty.
+         *
+         *  \return SUCCESSFUL_RETURN
+         */
+        virtual returnValue getLowRankHessian(	BlockMatrix& W, /**< low-rank factor  */
+												BlockMatrix& M  /**< weighting matrix */
+												) const;
+
+
 		inline double getHessianScaling( ) const;
 
 
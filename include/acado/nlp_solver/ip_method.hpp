@@ -35,23 +35,35 @@
 
 
 #include <acado/utils/acado_utils.hpp>
-#include <acado/nlp_solver/nlp_solver.hpp>
+#include <acado/nlp_solver/scp_method.hpp>
 
 
 BEGIN_NAMESPACE_ACADO
 
 
 /**
- *	\brief Implements different interior-point methods for solving NLPs.
+ *	\brief Implements a primal-dual interior-point method for solving NLPs.
  *
  *	\ingroup NumericalAlgorithms
  *
- *  The class IPmethod implements different interior-point methods 
+ *  The class IPmethod implements a primal-dual interior-point method
  *  for solving nonlinear programming problems.
  *
+ *  It shares the evaluation of the discretized NLP, the derivative
+ *  approximations and the globalization strategy with the class
+ *  SCPmethod. However, instead of solving a QP with an active-set
+ *  method in each iteration, only a single primal-dual Newton step on
+ *  the barrier problem is computed by the Riccati based CP solver,
+ *  such that the costs of an iteration do not depend on the number
+ *  of active inequality constraints.
+ *
+ *  The barrier parameter starts at BARRIER_PARAMETER and is decreased
+ *  superlinearly each time the KKT tolerance of the current barrier
+ *  problem has been reduced sufficiently.
+ *
  *	 \author Boris Houska, Hans Joachim Ferreau
  */
-class IPmethod : public NLPsolver
+class IPmethod : public SCPmethod
 {
     //
     // PUBLIC MEMBER FUNCTIONS:
@@ -61,32 +73,41 @@ class IPmethod : public NLPsolver
         /** Default constructor. */
         IPmethod( );
 
-        IPmethod(	UserInteraction* _userInteraction
-					);
-					
         /** Default constructor. */
-        IPmethod( const NLP& nlp_ );
+        IPmethod(	UserInteraction* _userInteraction,
+					const Objective             *objective_             ,
+					const DynamicDiscretization *dynamic_discretization_,
+					const Constraint            *constraint_,
+					BooleanType _isCP = BT_FALSE
+					);
 
         /** Copy constructor (deep copy). */
         IPmethod( const IPmethod& rhs );
 
         /** Destructor. */
-        ~IPmethod( );
+        virtual ~IPmethod( );
 
         /** Assignment operator (deep copy). */
         IPmethod& operator=( const IPmethod& rhs );
 
+        virtual NLPsolver* clone() const;
+
 
-        /** Initialization. */
-        virtual returnValue init(VariablesGrid    *xd,
-                                 VariablesGrid    *xa,
-                                 VariablesGrid    *p,
-                                 VariablesGrid    *u,
-                                 VariablesGrid    *w   );
+        /** Performs the globalized step and updates the barrier parameter. */
+		virtual returnValue performCurrentStep( );
 
 
-        /** Starts execution. */
-        virtual returnValue solve( int maxNumSteps );
+        /** Returns a variance-covariance estimate if possible or an error message otherwise.
+         *
+         *  \return SUCCESSFUL_RETURN
+         *          RET_MEMBER_NOT_INITIALISED
+         */
+        virtual returnValue getVarianceCovariance( Matrix &var );
+
+
+        /** Returns the current barrier parameter. */
+		inline double getBarrierParameter( ) const;
+
 
 
     //
@@ -94,6 +115,42 @@ class IPmethod : public NLPsolver
     //
     protected:
 
+        /** Sets up the SCP method with a Riccati based CP solver in barrier mode. */
+		virtual returnValue setup( );
+
+        /** Allocates a Riccati based CP solver, independently of the option \n
+         *  USE_CONDENSING.                                                   \n
+         *                                                                    \n
+         *  \return SUCCESSFUL_RETURN                                         \n
+         */
+		virtual returnValue allocateBandedCPsolver( );
+
+        /** Convergence is only declared once the barrier parameter has \n
+         *  reached its minimum value.                                   \n
+         */
+        virtual returnValue checkForConvergence( );
+
+        /** Decreases the barrier parameter if the current barrier problem \n
+         *  has been solved accurately enough.                              \n
+         *                                                                  \n
+         *  \return SUCCESSFUL_RETURN                                       \n
+         */
+		returnValue updateBarrierParameter( );
+
+        /** Passes the barrier parameter to the CP solver. If the CP solver    \n
+         *  has switched to condensing, barrier steps are not available: a     \n
+         *  warning is issued and the barrier parameter is set to its minimum, \n
+         *  i.e. the method continues as SQP method.                           \n
+         *                                                                     \n
+         *  \return SUCCESSFUL_RETURN                                          \n
+         *          RET_INVALID_ARGUMENTS                                      \n
+         */
+		returnValue passBarrierParameter( );
+
+        /** Returns the smallest barrier parameter, which is derived from \n
+         *  the KKT tolerance.                                             \n
+         */
+		double getMinBarrierParameter( ) const;
 
 
 
@@ -101,6 +158,8 @@ class IPmethod : public NLPsolver
     // DATA MEMBERS:
     //
     protected:
+
+		double barrierParameter;
 };
 
 
@@ -39,6 +39,10 @@
 BEGIN_NAMESPACE_ACADO
 
 
+inline double IPmethod::getBarrierParameter( ) const
+{
+	return barrierParameter;
+}
 
 
 CLOSE_NAMESPACE_ACADO
@@ -140,6 +140,19 @@ class NLPsolver : public AlgorithmicBase
 		inline returnValue resetNumberOfSteps( );
 
 
+		/** Returns whether the last call to solve has been stopped early   \n
+		 *  as its time budget (cf. option MAX_NLP_SOLVER_TIME) was used up. */
+		inline BooleanType hasExceededTimeBudget( ) const;
+
+		/** Returns whether the iterate returned by the last call to solve \n
+		 *  satisfies all constraints up to the KKT tolerance.             */
+		inline BooleanType isIterateFeasible( ) const;
+
+		/** Returns an estimate of the wall-clock time (in seconds) that    \n
+		 *  one iteration takes, based on the previous iterations.         */
+		inline double getIterationTimeEstimate( ) const;
+
+
 
         virtual returnValue getDifferentialStates( VariablesGrid &xd_ ) const;
         virtual returnValue getAlgebraicStates   ( VariablesGrid &xa_ ) const;
@@ -159,12 +172,23 @@ class NLPsolver : public AlgorithmicBase
 		virtual returnValue setupLogging( );
 
 
+		/** Updates the iteration time estimate with the duration of the   \n
+		 *  last iteration. The estimate follows increases immediately but \n
+		 *  decreases only slowly in order to stay on the safe side.       */
+		returnValue updateIterationTimeEstimate(	double iterationTime
+													);
+
+
     //
     // DATA MEMBERS:
     //
     protected:
 
         int numberOfSteps;
+
+        BooleanType timeBudgetExceeded;     /**< Whether the last solve has been stopped by its time budget. */
+        BooleanType iterateFeasible;        /**< Whether the returned iterate is feasible.                   */
+        double      iterationTimeEstimate;  /**< Estimated duration of one iteration (in seconds).           */
 };
 
 
@@ -52,6 +52,24 @@ inline returnValue NLPsolver::resetNumberOfSteps( )
 }
 
 
+inline BooleanType NLPsolver::hasExceededTimeBudget( ) const
+{
+	return timeBudgetExceeded;
+}
+
+
+inline BooleanType NLPsolver::isIterateFeasible( ) const
+{
+	return iterateFeasible;
+}
+
+
+inline double NLPsolver::getIterationTimeEstimate( ) const
+{
+	return iterationTimeEstimate;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
@@ -95,7 +95,10 @@ class SCPevaluation : public AlgorithmicBase
 
 
         /** Evaluates the objective as well as the ODE/DAE discretization
-         *  and the constraints for the case that they exist.
+         *  and the constraints for the case that they exist. \n
+         *  If the iterate coincides with the one of the last evaluation
+         *  (e.g. the trial point accepted by the line search), the stored
+         *  results are reused and the system is not simulated again.
          */
         virtual returnValue evaluate( OCPiterate& iter, BandedCP& cp );
 
@@ -133,6 +136,55 @@ class SCPevaluation : public AlgorithmicBase
         virtual double getObjectiveValue( ) const;
 
 
+        /** Computes the scaling factors of the objective and of the constraint \n
+         *  rows from the norms of their gradients w.r.t. the scaled variables,  \n
+         *  such that none of them exceeds 100. The gradients are taken from the \n
+         *  given conic program, i.e. from the first linearization.              \n
+         *  Nothing is done if no variable scaling has been set up by init.      \n
+         *                                                                       \n
+         *  \return SUCCESSFUL_RETURN                                            \n
+         */
+        virtual returnValue computeScaling(	const BandedCP& cp
+        									);
+
+        /** Transforms the given conic program into the scaled variables,     \n
+         *  i.e. scales the variables, the objective, the dynamic constraints  \n
+         *  (by the scaling of the states) and the constraint rows.            \n
+         *                                                                     \n
+         *  \return SUCCESSFUL_RETURN                                          \n
+         */
+        returnValue scaleCP(	const BandedCP& cp,
+        						BandedCP& scaledCP
+        						) const;
+
+        /** Transforms the primal and dual solution of a scaled conic program \n
+         *  back into the solution of the original one.                        \n
+         *                                                                     \n
+         *  \return SUCCESSFUL_RETURN                                          \n
+         */
+        returnValue unscaleSolution(	const BandedCP& scaledCP,
+        								BandedCP& cp
+        								) const;
+
+        /** Multiplies each block of the given block column (in the layout of \n
+         *  the primal solution) by the scaling of the respective variables   \n
+         *  or by its inverse.                                                \n
+         *                                                                    \n
+         *  \return SUCCESSFUL_RETURN                                         \n
+         */
+        returnValue scaleVariables(	BlockMatrix& x,
+        							BooleanType inverse = BT_FALSE
+        							) const;
+
+        /** Transforms a Hessian approximation of the scaled problem into one \n
+         *  of the original problem, i.e. computes D^{-1}*H*D^{-1}.           \n
+         *                                                                    \n
+         *  \return SUCCESSFUL_RETURN                                         \n
+         */
+        returnValue unscaleHessian(	BlockMatrix& H
+        							) const;
+
+
 
 
 
@@ -143,6 +195,12 @@ class SCPevaluation : public AlgorithmicBase
 
 		returnValue clearDynamicDiscretization( );
 
+		returnValue shiftDynamicDiscretization( );
+
+		/** Passes an absolute deadline (cf. acadoGetTime) to the integrators \n
+		 *  of the dynamic discretization (non-positive: no deadline).       */
+		returnValue setDeadline( double deadline_ );
+
 
 		inline BooleanType hasLSQobjective( ) const;
 
@@ -153,6 +211,10 @@ class SCPevaluation : public AlgorithmicBase
 		inline uint getNumConstraintBlocks( ) const;
 		inline Vector getConstraintBlockDims( ) const;
 
+		inline double getLiftingTime( ) const;
+
+		inline BooleanType hasScaling( ) const;
+
 
 		virtual returnValue freezeSensitivities( );
 
@@ -169,6 +231,70 @@ class SCPevaluation : public AlgorithmicBase
 		virtual returnValue setupLogging( );
 
 
+        /** Writes the residua of the last evaluation of the dynamic \n
+         *  discretization and the constraints into cp.
+         */
+        returnValue getResidua( BandedCP& cp ) const;
+
+        /** Stores the (evaluated) iterate of the last evaluation as cache. */
+        returnValue storeEvaluation( const OCPiterate& iter );
+
+        /** Restores the results of the last evaluation at the cached      \n
+         *  iterate. The objective is re-evaluated if its reference has   \n
+         *  changed.
+         */
+        returnValue restoreEvaluation(	const OCPiterate& iter,
+										BandedCP& cp
+										);
+
+        /** Returns BT_TRUE iff the given iterate coincides exactly
+         *  with the one of the cached evaluation.
+         */
+        BooleanType isCachedIterate( const OCPiterate& iter ) const;
+
+        /** Returns BT_TRUE iff both grids coincide exactly. */
+        BooleanType isEqualGrid(	const VariablesGrid* const arg1,
+									const VariablesGrid* const arg2
+									) const;
+
+        /** Sets up the scaling of the variables from the scaling \n
+         *  stored within the given iterate.                      */
+        returnValue setupVariableScaling(	const OCPiterate& iter
+        									);
+
+        /** Returns the scaling (or its inverse) of the variables of \n
+         *  the given block of the primal solution.                  */
+        Vector getVariableScaling(	uint blockIdx,
+        							BooleanType inverse = BT_FALSE
+        							) const;
+
+        /** Returns the block of the primal solution that corresponds \n
+         *  to the given block of the bound residua.                  */
+        uint getVariableBlockIdx(	uint boundBlockIdx
+        							) const;
+
+        /** Multiplies the rows of the given sub-block by rowScaling and its \n
+         *  columns by colScaling (an empty scaling is left out).            */
+        returnValue scaleBlock(	BlockMatrix& bm,
+        						uint rowIdx,
+        						uint colIdx,
+        						const Vector& rowScaling,
+        						const Vector& colScaling
+        						) const;
+
+        /** Returns BT_TRUE iff all scaling factors are one. */
+        BooleanType isUnitScaling(	const Vector& scaling
+        							) const;
+
+        /** Returns BT_TRUE iff all scaling factors of the block column are one. */
+        BooleanType isUnitScaling(	const BlockMatrix& scaling
+        							) const;
+
+        /** Returns the scaling factor of a function with the given gradient norm. */
+        double getScalingFactor(	double norm
+        							) const;
+
+
     //
     // DATA MEMBERS:
     //
@@ -182,6 +308,16 @@ class SCPevaluation : public AlgorithmicBase
 
 		BooleanType isCP;
 		BooleanType areSensitivitiesFrozen;
+
+		BooleanType isCacheValid;           /**< Flag indicating whether the cache matches the last evaluation. */
+		BooleanType isObjectiveCacheValid;  /**< Flag indicating whether the cached objective is up-to-date.    */
+		BooleanType isUnfreezePending;      /**< Flag indicating whether unfreezing the integrators is deferred. */
+
+		OCPiterate cachedIterate;           /**< Iterate of the last evaluation (as evaluated). */
+
+		BlockMatrix variableScaling;        /**< Scaling of the variables (block column, empty if not scaled). */
+		BlockMatrix constraintScaling;      /**< Scaling of the constraint rows (block column).                */
+		double objectiveScaling;            /**< Scaling of the objective.                                     */
 };
 
 
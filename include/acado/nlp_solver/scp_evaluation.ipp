@@ -94,6 +94,24 @@ inline Vector SCPevaluation::getConstraintBlockDims( ) const
 }
 
 
+inline double SCPevaluation::getLiftingTime( ) const
+{
+	if ( dynamicDiscretization == 0 )
+		return 0.0;
+
+	return dynamicDiscretization->getLiftingTime( );
+}
+
+
+inline BooleanType SCPevaluation::hasScaling( ) const
+{
+	if ( variableScaling.isEmpty( ) == BT_TRUE )
+		return BT_FALSE;
+	else
+		return BT_TRUE;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
@@ -42,6 +42,7 @@
 #include <acado/conic_solver/dense_qp_solver.hpp>
 #include <acado/conic_solver/banded_cp_solver.hpp>
 #include <acado/conic_solver/condensing_based_cp_solver.hpp>
+#include <acado/conic_solver/riccati_based_cp_solver.hpp>
 
 #include <acado/nlp_solver/scp_evaluation.hpp>
 #include <acado/nlp_solver/scp_step_linesearch.hpp>
@@ -170,7 +171,14 @@ class SCPmethod : public NLPsolver
 		virtual returnValue setupLogging( );
 
 
-		returnValue setup( );
+		virtual returnValue setup( );
+
+		/** Allocates and initializes the banded CP solver as specified by \n
+		 *  the option USE_CONDENSING.                                      \n
+		 *                                                                  \n
+		 *  \return SUCCESSFUL_RETURN                                       \n
+		 */
+		virtual returnValue allocateBandedCPsolver( );
 		
 
         /** Prints the actual values of x, xa, p, u, and w.
@@ -179,7 +187,7 @@ class SCPmethod : public NLPsolver
 
 		returnValue printIteration( );
 		
-        returnValue checkForConvergence( );
+        virtual returnValue checkForConvergence( );
 		
 
 		returnValue computeHessianMatrix(	const BlockMatrix& oldLagrangeGradient,
@@ -190,6 +198,15 @@ class SCPmethod : public NLPsolver
         returnValue initializeHessianProjection( );
 
 
+		/** Solves the current conic program in scaled variables (cf. option    \n
+		 *  USE_AUTOMATIC_SCALING) and transforms its solution back.             \n
+		 *                                                                      \n
+		 *  \return SUCCESSFUL_RETURN                                           \n
+		 *          RET_NLP_STEP_FAILED                                         \n
+		 */
+		returnValue solveScaledCP( );
+
+
 		returnValue checkForRealTimeMode(	const Vector &x0_,
 											const Vector &p_
 											);
@@ -202,6 +219,43 @@ class SCPmethod : public NLPsolver
 		returnValue stopClockAndPrintRuntimeProfile( );
 
 
+		/** Solves the current optimization problem within the given wall-clock   \n
+		 *  time budget (cf. option MAX_NLP_SOLVER_TIME). A further iteration is  \n
+		 *  only started if it is expected to finish in time; running integrations \n
+		 *  and QP solutions are cancelled at the deadline. On early exit the best \n
+		 *  iterate found (feasible ones first, then lowest objective) is kept.    \n
+		 *                                                                        \n
+		 *  \return CONVERGENCE_ACHIEVED                                           \n
+		 *          RET_NLP_TIME_BUDGET_EXCEEDED                                   \n
+		 *          RET_MAX_NUMBER_OF_STEPS_EXCEEDED                               \n
+		 *          RET_NLP_SOLUTION_FAILED                                        \n
+		 */
+		returnValue solveWithinTimeBudget(	const Vector &x0_,
+											const Vector &p_,
+											double maxTime
+											);
+
+		/** Re-evaluates the problem functions and their derivatives at the       \n
+		 *  current iterate, e.g. after a cancelled iteration.                     */
+		returnValue relinearize( );
+
+		/** Sets the absolute deadline (cf. acadoGetTime) of the current solve    \n
+		 *  and passes it to the integrators (non-positive: no deadline).          */
+		returnValue setDeadline(	double deadline_
+									);
+
+		BooleanType isDeadlineReached( ) const;
+
+		/** Returns the maximum constraint violation at the current iterate. */
+		double getInfeasibility( ) const;
+
+		BooleanType isBetterIterate(	double infeasibility,
+										double objectiveValue,
+										double bestInfeasibility,
+										double bestObjectiveValue
+										) const;
+
+
         virtual returnValue getDifferentialStates( VariablesGrid &xd_ ) const;
         virtual returnValue getAlgebraicStates   ( VariablesGrid &xa_ ) const;
         virtual returnValue getParameters        ( VariablesGrid &p_  ) const;
@@ -248,6 +302,9 @@ class SCPmethod : public NLPsolver
 		BooleanType hasPerformedStep;
 		BooleanType isInRealTimeMode;
 		BooleanType needToReevaluate;
+		BooleanType needToRelinearize;
+
+		double deadline;
 };
 
 
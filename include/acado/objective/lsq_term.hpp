@@ -154,6 +154,16 @@ class LSQTerm : public ObjectiveElement{
     //
     protected:
 
+        /** Evaluates the LSQ function at the grid point idx using the    \n
+         *  given evaluation point and stores the weighted residuum.      \n
+         *                                                               \n
+         *  \return The contribution of the grid point to the objective.  \n
+         */
+        double evaluatePoint(	int              idx,      /**< index of the grid point */
+								const OCPiterate &x,       /**< the iterate             */
+								EvaluationPoint  &zThread  /**< the evaluation point    */
+								);
+
 
     //
     // DATA MEMBERS:
@@ -235,6 +235,8 @@ class ObjectiveElement{
         int             *y_index;   /**< index lists             */
         int              t_index;   /**< time index              */
 
+        HessianColoring  hessianColoring; /**< coloring for sparse 2nd order derivatives */
+
         int              nx     ;   /**< number of diff. states  */
         int              na     ;   /**< number of alg. states   */
         int              nu     ;   /**< number of controls      */
@@ -48,6 +48,10 @@ BEGIN_NAMESPACE_ACADO
  *	The class MultiObjectiveAlgorithm serves as a user-interface to formulate and
  *  solve optimal control problems with multiple objectives.
  *
+ *  If a solution cache is used (see setSolutionCache), each point of the Pareto
+ *  front is stored under its vector of weights and warm-started from the points
+ *  with the nearest weights.
+ *
  *  \author Boris Houska, Hans Joachim Ferreau
  */
 class MultiObjectiveAlgorithm : public OptimizationAlgorithm
@@ -83,7 +83,14 @@ class OptimizationAlgorithm : public OptimizationAlgorithmBase, public UserInter
 		 */
 		virtual returnValue init( );
 
-        /** Starts execution. */
+        /** Starts execution.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_NLP_TIME_BUDGET_EXCEEDED, \n
+		 *	        RET_SOLUTION_CACHE_UPDATE_FAILED (the problem has been solved, \n
+		 *	        but the solution could not be cached), \n
+		 *	        RET_OPTALG_SOLVE_FAILED
+		 */
         virtual returnValue solve( );
 
 
@@ -40,6 +40,8 @@
 #include <acado/ocp/ocp.hpp>
 #include <acado/nlp_solver/nlp_solver.hpp>
 #include <acado/nlp_solver/scp_method.hpp>
+#include <acado/nlp_solver/ip_method.hpp>
+#include <acado/optimization_algorithm/solution_cache.hpp>
 
 
 BEGIN_NAMESPACE_ACADO
@@ -148,6 +150,29 @@ class OptimizationAlgorithmBase
 		double getEndTime( ) const;
 
 
+		/** Uses the given cache for warm-starting repeated solves: each solve is
+		 *	initialized by the cached solution for the nearest key (see
+		 *	setSolutionCacheKey) and each converged solution is added to the cache.
+		 *	The cache is not copied and needs to exist as long as it is used.
+		 *
+		 *	@param[in] _solutionCache	Solution cache (0 to stop using a cache).
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue setSolutionCache(	SolutionCache* const _solutionCache
+										);
+
+		/** Sets the key under which the next solution is looked up in and
+		 *	stored to the solution cache, namely the initial state and the
+		 *	parameters of the problem instance.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue setSolutionCacheKey(	const Vector& x0_,
+											const Vector& p_ = emptyConstVector
+											);
+
+
     //
     // PROTECTED MEMBER FUNCTIONS:
     //
@@ -155,6 +180,22 @@ class OptimizationAlgorithmBase
 
 		returnValue clear( );
 
+		/** Replaces the user initialization by the cached solution for the
+		 *	current key.
+		 *
+		 *  \return BT_TRUE  iff a cached solution has been found, \n
+		 *	        BT_FALSE otherwise
+		 */
+		BooleanType initializeFromSolutionCache( );
+
+		/** Adds the current solution to the solution cache under the current key.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_MEMBER_NOT_INITIALISED, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH
+		 */
+		returnValue addToSolutionCache( );
+
 		/** Initializes everything. */
 		returnValue init(	UserInteraction* _userIteraction
 							);
@@ -221,6 +262,21 @@ class OptimizationAlgorithmBase
 													uint nw
 													);
 
+		/** Computes scaling factors of all optimization variables from the
+		 *	magnitude of their initial guess (or of their bounds if the initial
+		 *	guess is zero) and stores them as scaling of the iterate. Variables
+		 *	with magnitudes between 0.01 and 100 are not scaled, all other factors
+		 *	are rounded to powers of two, such that scaling does not introduce
+		 *	any rounding errors.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue computeVariableScaling( );
+
+		/** Computes the scaling factors of all components of the given grid. */
+		returnValue computeVariableScaling(	VariablesGrid* const grid
+											) const;
+
     //
     // DATA MEMBERS:
     //
@@ -231,6 +287,10 @@ class OptimizationAlgorithmBase
 
 		OCPiterate iter;
 		OCPiterate userInit;
+
+		SolutionCache* solutionCache;       /**< Cache for warm-starting (not owned).                    */
+		Vector solutionCacheKey;            /**< Key of the problem instance to be solved.                */
+		double solutionCacheIterations;     /**< Estimated iterations of a cold start (-1 if not warm-started from the cache). */
 };
 
 
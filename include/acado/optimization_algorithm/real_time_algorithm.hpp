@@ -34,6 +34,11 @@
 #define ACADO_TOOLKIT_REAL_TIME_ALGORITHM_HPP
 
 
+#if defined(LINUX)
+  #include <pthread.h>
+#endif
+
+
 #include <acado/optimization_algorithm/optimization_algorithm.hpp>
 #include <acado/control_law/control_law.hpp>
 
@@ -185,6 +190,46 @@ class RealTimeAlgorithm : public OptimizationAlgorithmBase, public ControlLaw
 												);
 
 
+		/** Waits until a pending asynchronous preparation step (see option
+		 *	USE_ASYNC_PREPARATION) has finished and hands the NLP solver back
+		 *	from the background thread. The time spent waiting is stored
+		 *	and counted as a missed deadline if it is positive.
+		 *
+		 *	With asynchronous preparation steps, the NLP solver works on a private
+		 *	user interaction: its logged values are merged into the logs of the
+		 *	algorithm and the options of the algorithm are passed on to it by
+		 *	this function, also if no preparation step is pending. Thus, options
+		 *	must not be changed while a preparation step is pending, and results
+		 *	logged by the NLP solver are available only after calling this function.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_CONTROLLAW_STEP_FAILED
+		 */
+		returnValue waitForPreparation( );
+
+		/** Returns whether an asynchronous preparation step is still pending.
+		 *
+		 *  \return BT_TRUE  iff preparation step is pending, \n
+		 *	        BT_FALSE otherwise
+		 */
+		inline BooleanType isPreparing( ) const;
+
+		/** Returns the time (in seconds) the last feedback step had to wait for
+		 *	the asynchronous preparation step to finish.
+		 *
+		 *  \return Waiting time of last feedback step
+		 */
+		inline double getPreparationWaitingTime( ) const;
+
+		/** Returns the number of feedback steps that had to wait for the 
+		 *	asynchronous preparation step, i.e. the number of preparation steps
+		 *	that did not finish before the next feedback step was due.
+		 *
+		 *  \return Number of missed deadlines
+		 */
+		inline int getNumMissedDeadlines( ) const;
+
+
 		/** (not yet documented).
 		 *
 		 *	@param[in]  .		.
@@ -365,6 +410,78 @@ class RealTimeAlgorithm : public OptimizationAlgorithmBase, public ControlLaw
 											BooleanType isLastIteration = BT_TRUE
 											);
 
+		/** Performs the preparation step on the caller's thread.
+		 *
+		 *	@param[in]  nextTime	Time at next step.
+		 *	@param[in]  _yRef		Piece of reference trajectory for next step.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_CONTROLLAW_STEP_FAILED
+		 */
+		returnValue runPreparationStep(	double nextTime,
+										const VariablesGrid& _yRef
+										);
+
+		/** Performs the preparation of the given NLP solver for the next step
+		 *	without accessing any other data of the algorithm.
+		 *
+		 *	@param[in]  solver					NLP solver to be prepared.
+		 *	@param[in]  _yRef					Piece of reference trajectory for next step.
+		 *	@param[in]  isLastIteration			Flag indicating whether the reference is set and the variables are shifted.
+		 *	@param[in]  useRealTimeShifts		Flag indicating whether the variables are shifted.
+		 *	@param[in]  timeShift				Time shift of the variables.
+		 *	@param[in]  terminateAtConvergence	Flag indicating whether convergence is reported.
+		 *
+		 *  \return CONVERGENCE_ACHIEVED, \n
+		 *	        CONVERGENCE_NOT_YET_ACHIEVED, \n
+		 *	        or an error code of the NLP solver
+		 */
+		returnValue prepareNLPsolver(	NLPsolver* const solver,
+										const VariablesGrid& _yRef,
+										BooleanType isLastIteration,
+										BooleanType useRealTimeShifts,
+										double timeShift,
+										BooleanType terminateAtConvergence
+										);
+
+		/** Dispatches the preparation step to a background thread and returns
+		 *	immediately. The NLP solver is handed over to the background thread
+		 *	and handed back in waitForPreparation(). If no thread can be started,
+		 *	the preparation step is performed on the caller's thread.
+		 *
+		 *	@param[in]  nextTime	Time at next step.
+		 *	@param[in]  _yRef		Piece of reference trajectory for next step.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_CONTROLLAW_STEP_FAILED
+		 */
+		returnValue startPreparationStep(	double nextTime,
+											const VariablesGrid& _yRef
+											);
+
+		/** Entry point of the background thread performing an asynchronous
+		 *	preparation step.
+		 *
+		 *	@param[in]  rtAlgorithm		Pointer to the RealTimeAlgorithm.
+		 *
+		 *  \return 0
+		 */
+		static void* preparationWorker(	void* rtAlgorithm
+										);
+
+		/** Initializes all data members related to asynchronous preparation steps.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue setupPreparation( );
+
+		/** Returns whether preparation steps shall be performed asynchronously.
+		 *
+		 *  \return BT_TRUE  iff option USE_ASYNC_PREPARATION is set and immediate feedback is used, \n
+		 *	        BT_FALSE otherwise
+		 */
+		BooleanType usesAsyncPreparation( ) const;
+
 
 	//
 	// DATA MEMBERS:
@@ -376,6 +493,24 @@ class RealTimeAlgorithm : public OptimizationAlgorithmBase, public ControlLaw
 
 		VariablesGrid* reference;		/**< Deep copy of the most recent reference. */
 
+		#if defined(LINUX)
+		pthread_t preparationThread;			/**< Thread performing the pending asynchronous preparation step. */
+		pthread_mutex_t preparationMutex;		/**< Mutex protecting the results of the asynchronous preparation step. */
+		#endif
+
+		UserInteraction* preparationInteraction;	/**< Private user interaction of the NLP solver if preparation steps are performed asynchronously (0 otherwise). */
+		BooleanType isPreparationPending;		/**< Flag indicating whether an asynchronous preparation step is pending. */
+		NLPsolver* preparationSolver;			/**< NLP solver handed over to the pending preparation step (nlpSolver is 0 meanwhile). */
+		double preparationNextTime;				/**< Time at next step passed to the pending preparation step. */
+		VariablesGrid* preparationReference;	/**< Deep copy of the reference passed to the pending preparation step. */
+		BooleanType preparationUsesShifts;		/**< Flag indicating whether the pending preparation step shifts the variables. */
+		double preparationTimeShift;			/**< Time shift used by the pending preparation step. */
+		BooleanType preparationTerminatesConvergence;	/**< Flag indicating whether the pending preparation step reports convergence. */
+		returnValue preparationStatus;			/**< Return value of the last asynchronous preparation step. */
+		double preparationEndTime;				/**< Time at which the last asynchronous preparation step finished. */
+		double preparationWaitingTime;			/**< Time the last feedback step had to wait for the preparation step. */
+		int numMissedDeadlines;					/**< Number of feedback steps that had to wait for the preparation step. */
+
 };
 
 
@@ -35,6 +35,29 @@ BEGIN_NAMESPACE_ACADO
 
 
 
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+inline BooleanType RealTimeAlgorithm::isPreparing( ) const
+{
+	return isPreparationPending;
+}
+
+
+inline double RealTimeAlgorithm::getPreparationWaitingTime( ) const
+{
+	return preparationWaitingTime;
+}
+
+
+inline int RealTimeAlgorithm::getNumMissedDeadlines( ) const
+{
+	return numMissedDeadlines;
+}
+
+
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
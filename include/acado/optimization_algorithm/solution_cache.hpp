@@ -0,0 +1,255 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/optimization_algorithm/solution_cache.hpp
+ *    \author agent
+ *    \date 2026
+ */
+
+
+#ifndef ACADO_TOOLKIT_SOLUTION_CACHE_HPP
+#define ACADO_TOOLKIT_SOLUTION_CACHE_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/matrix_vector/matrix_vector.hpp>
+#include <acado/variables_grid/variables_grid.hpp>
+#include <acado/function/ocp_iterate.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** Layout of the header of a SolutionCache store (positions in doubles). */
+const uint SC_TAG               = 0;     /**< File tag "ACADOSC1".                               */
+const uint SC_KEY_DIM           = 1;     /**< Dimension of the keys (0 if no layout fixed yet).   */
+const uint SC_CAPACITY          = 2;     /**< Number of entries the store can hold.              */
+const uint SC_NUM_ENTRIES       = 3;     /**< Number of stored entries.                          */
+const uint SC_NUM_WARM_STARTS   = 4;     /**< Number of converged warm-started solves.           */
+const uint SC_SAVED_ITERATIONS  = 5;     /**< Estimated number of saved iterations.              */
+const uint SC_NUM_POINTS        = 6;     /**< Numbers of grid points of x, xa, p, u, w.          */
+const uint SC_DIMS              = 11;    /**< Dimensions of x, xa, p, u, w.                      */
+const uint SC_TIMES             = 16;    /**< Start of the grid times of x, xa, p, u, w.         */
+
+
+/**
+ *	\brief Persistent store of converged solutions for warm-starting repeated optimizations.
+ *
+ *	\ingroup UserInterfaces
+ *
+ *	The class SolutionCache stores converged OCPiterates of one OCP structure,
+ *	each of them identified by a key vector, usually the initial state and the
+ *	parameters of the solved problem instance. A new solve can be initialized
+ *	by the stored solution with the nearest key or by an inverse-distance
+ *	weighted interpolation of the solutions with the nearest keys.
+ *
+ *	The cache is kept in a file that is mapped into memory, thus it persists
+ *	across program runs. If no file name is given, it is kept in memory only.
+ *	All entries have the same dimensions and grids, which are fixed by the
+ *	first stored solution.
+ *
+ *	For each entry, the number of iterations a cold start would have needed is
+ *	estimated (by the one of the entries it has been warm-started from). This
+ *	allows to report how many iterations warm-starting has saved.
+ *
+ *	\author agent
+ */
+class SolutionCache
+{
+	//
+	// PUBLIC MEMBER FUNCTIONS:
+	//
+	public:
+
+		/** Default constructor. */
+		SolutionCache( );
+
+		/** Constructor which opens the given cache file.
+		 *
+		 *	@param[in] _fileName		Name of the cache file (0 for a cache kept in memory).
+		 *	@param[in] _numNeighbors	Number of entries to be interpolated on lookup.
+		 */
+		SolutionCache(	const char* const _fileName,
+						uint _numNeighbors = 1
+						);
+
+		/** Destructor. */
+		virtual ~SolutionCache( );
+
+
+		/** Opens the given cache file, which is created if it does not exist.
+		 *	A previously opened file is closed.
+		 *
+		 *	@param[in] _fileName	Name of the cache file (0 for a cache kept in memory).
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_FILE_CAN_NOT_BE_OPENED, \n
+		 *	        RET_NOT_YET_IMPLEMENTED
+		 */
+		returnValue open(	const char* const _fileName
+							);
+
+		/** Writes all entries back to the cache file and closes it.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_FILE_CAN_NOT_BE_CLOSED
+		 */
+		returnValue close( );
+
+
+		/** Sets the number of entries with nearest keys that are interpolated
+		 *	on lookup (1 means nearest-neighbor lookup).
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_ARGUMENTS
+		 */
+		returnValue setNumNeighbors(	uint _numNeighbors
+										);
+
+
+		/** Stores a converged solution under the given key. An entry with the
+		 *	same key is replaced.
+		 *
+		 *	@param[in] key				Key of the solved problem instance.
+		 *	@param[in] _iter			Converged solution.
+		 *	@param[in] nIterations		Number of iterations the solve has needed.
+		 *	@param[in] nColdIterations	Estimated number of iterations of a cold start as
+		 *								returned by lookup, or a non-positive number if the
+		 *								solve has not been warm-started from this cache.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_MEMBER_NOT_INITIALISED, \n
+		 *	        RET_INVALID_ARGUMENTS, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH
+		 */
+		returnValue store(	const Vector& key,
+							const OCPiterate& _iter,
+							uint nIterations,
+							double nColdIterations = -1.0
+							);
+
+		/** Returns the stored solution with the nearest key, or an interpolation
+		 *	of the solutions with the nearest keys, for warm-starting a new solve.
+		 *
+		 *	@param[in]  key				Key of the problem instance to be solved.
+		 *	@param[out] _iter			Solution for warm-starting.
+		 *	@param[out] nColdIterations	Estimated number of iterations of a cold start.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_FILE_HAS_NO_VALID_ENTRIES, \n
+		 *	        RET_MEMBER_NOT_INITIALISED, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH
+		 */
+		returnValue lookup(	const Vector& key,
+							OCPiterate& _iter,
+							double& nColdIterations
+							) const;
+
+
+		/** Returns whether a cache file (or memory) is open. */
+		inline BooleanType isOpen( ) const;
+
+		/** Returns the number of stored solutions. */
+		inline uint getNumEntries( ) const;
+
+		/** Returns the number of converged solves that have been warm-started from the cache. */
+		inline uint getNumWarmStarts( ) const;
+
+		/** Returns the (estimated) number of iterations saved by warm-starting. */
+		inline uint getNumSavedIterations( ) const;
+
+
+
+	//
+	// PROTECTED MEMBER FUNCTIONS:
+	//
+	protected:
+
+		/** Fixes dimensions and grids of all entries to the ones of the given key and solution. */
+		returnValue setupLayout(	const Vector& key,
+									const OCPiterate& _iter
+									);
+
+		/** Returns whether key and solution match dimensions and grids of the stored entries. */
+		BooleanType hasLayout(	const Vector& key,
+								const OCPiterate& _iter
+								) const;
+
+		/** Enlarges the store such that it can hold the given number of entries. */
+		returnValue reserve(	uint capacity
+								);
+
+		/** Resizes the store (or file mapping) to the given number of doubles. */
+		returnValue resize(	uint _dataSize
+							);
+
+		/** Returns the squared distance between the given key and the one of an entry. */
+		double getSquaredDistance(	const Vector& key,
+									uint entryIdx
+									) const;
+
+		/** Returns the grids of a solution in the order x, xa, p, u, w. */
+		void getGrids(	const OCPiterate& _iter,
+						const VariablesGrid* grids[5]
+						) const;
+
+		inline uint getHeaderSize( ) const;
+		inline uint getEntrySize( ) const;
+		inline double* getEntry( uint idx ) const;
+
+
+	private:
+
+		/** Copying a cache would duplicate the file mapping, thus it is not supported. */
+		SolutionCache( const SolutionCache& rhs );
+		SolutionCache& operator=( const SolutionCache& rhs );
+
+
+
+	//
+	// DATA MEMBERS:
+	//
+	protected:
+
+		int     fileDescriptor;      /**< Descriptor of the mapped cache file (-1 if kept in memory). */
+		double* data;                /**< Header, grids and entries of the cache.                     */
+		uint    dataSize;            /**< Size of the store (in doubles).                             */
+		uint    numNeighbors;        /**< Number of entries interpolated on lookup.                   */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/optimization_algorithm/solution_cache.ipp>
+
+
+#endif  // ACADO_TOOLKIT_SOLUTION_CACHE_HPP
+
+/*
+ *   end of file
+ */
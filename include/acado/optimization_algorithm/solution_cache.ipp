@@ -0,0 +1,116 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/optimization_algorithm/solution_cache.ipp
+ *    \author agent
+ *    \date 2026
+ */
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+inline BooleanType SolutionCache::isOpen( ) const
+{
+	if ( data != 0 )
+		return BT_TRUE;
+	else
+		return BT_FALSE;
+}
+
+
+inline uint SolutionCache::getNumEntries( ) const
+{
+	if ( data == 0 )
+		return 0;
+
+	return (uint) data[SC_NUM_ENTRIES];
+}
+
+
+inline uint SolutionCache::getNumWarmStarts( ) const
+{
+	if ( data == 0 )
+		return 0;
+
+	return (uint) data[SC_NUM_WARM_STARTS];
+}
+
+
+inline uint SolutionCache::getNumSavedIterations( ) const
+{
+	if ( data == 0 )
+		return 0;
+
+	return (uint) data[SC_SAVED_ITERATIONS];
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+inline uint SolutionCache::getHeaderSize( ) const
+{
+	uint headerSize = SC_TIMES;
+
+	for( uint run1 = 0; run1 < 5; run1++ )
+		headerSize += (uint) data[SC_NUM_POINTS+run1];
+
+	return headerSize;
+}
+
+
+inline uint SolutionCache::getEntrySize( ) const
+{
+	// key, estimated iterations of a cold start and the values of x, xa, p, u, w
+	uint entrySize = (uint) data[SC_KEY_DIM] + 1;
+
+	for( uint run1 = 0; run1 < 5; run1++ )
+		entrySize += (uint) data[SC_NUM_POINTS+run1] * (uint) data[SC_DIMS+run1];
+
+	return entrySize;
+}
+
+
+inline double* SolutionCache::getEntry( uint idx ) const
+{
+	return &(data[ getHeaderSize( ) + idx*getEntrySize( ) ]);
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -143,6 +143,17 @@ class ConjugateGradientMethod : public SparseSolver{
         virtual returnValue setPrintLevel( PrintLevel printLevel_ );
 
 
+        /** Selects the preconditioner that is computed by the next call  \n
+         *  of setMatrix. The block size is only used by PT_BLOCK_JACOBI. \n
+         *  Only the diagonal preconditioner is supported by default.     \n
+         *                                                                \n
+         *  \return SUCCESSFUL_RETURN                                     \n
+         *          RET_NOT_IMPLEMENTED_YET                               \n
+         */
+        virtual returnValue setPreconditioner( PreconditionerType preconditioner_,
+                                               int                blockSize_ = 1 );
+
+
 
     //
     // PROTECTED MEMBER FUNCTIONS:
@@ -165,6 +176,9 @@ class ConjugateGradientMethod : public SparseSolver{
     /** Computes the preconditioner and Applies it to the input matrix. */
     virtual returnValue computePreconditioner( double* A_ ) = 0;
 
+    /** Returns whether the matrix A has been defined (only internal use) */
+    virtual BooleanType isMatrixDefined( ) const;
+
 
     //
     // DATA MEMBERS:
@@ -186,7 +200,7 @@ class ConjugateGradientMethod : public SparseSolver{
     // AUXILIARY VARIABLES:
     // --------------------
     double          *norm2;          // Auxiliary variables
-    double             **p;          // conjugate basis vectors
+    double             **p;          // conjugate basis vectors (allocated on demand)
     double              *r;          // the actual residuum
     int           pCounter;          // a counter for the iterates
     double      *condScale;          // scaling factors to improve
@@ -194,6 +208,9 @@ class ConjugateGradientMethod : public SparseSolver{
 
     double             TOL;          // The required tolerance. (default 10^(-10))
     PrintLevel  printLevel;          // The PrintLevel.
+
+    PreconditionerType preconditioner;  // The type of the preconditioner. (default PT_DIAGONAL)
+    int                blockSize;       // The block size of the block-Jacobi preconditioner.
 };
 
 
@@ -0,0 +1,171 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/sparse_solver/matrix_free_conjugate_gradient_method.hpp
+ *    \author agent
+ *    \date   2026
+ */
+
+
+#ifndef ACADO_TOOLKIT_MATRIX_FREE_CONJUGATE_GRADIENT_METHOD_HPP
+#define ACADO_TOOLKIT_MATRIX_FREE_CONJUGATE_GRADIENT_METHOD_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Implements a conjugate gradient method for linear operators that are not stored as matrix.
+ *
+ *	\ingroup NumericalAlgorithms
+ *
+ *  The class MatrixFreeConjugateGradientMethod is a conjugate gradient     \n
+ *  method which allows to solve symmetric linear equations of the form     \n
+ *                                                                            \n
+ *    A * x = b                                                               \n
+ *                                                                            \n
+ *  where A is symmetric and positive definite and only available as a      \n
+ *  user-supplied function computing the product  f = A*x  (see            \n
+ *  setOperator). If the diagonal of A is passed via setMatrix, the system  \n
+ *  is scaled by this diagonal, otherwise it is solved unpreconditioned.     \n
+ *
+ *  \author agent
+ */
+
+
+class MatrixFreeConjugateGradientMethod : public ConjugateGradientMethod{
+
+
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+
+        /** Default constructor. */
+        MatrixFreeConjugateGradientMethod( );
+
+        /** Copy constructor (deep copy). */
+        MatrixFreeConjugateGradientMethod( const MatrixFreeConjugateGradientMethod &arg );
+
+        /** Destructor. */
+        virtual ~MatrixFreeConjugateGradientMethod( );
+
+        /** Clone operator (deep copy). */
+        virtual SparseSolver* clone() const;
+
+
+        /** Defines the dimension n of  A \in R^{n \times n} \n
+         *                                                   \n
+         *  \return SUCCESSFUL_RETURN                        \n
+         */
+        virtual returnValue setDimension( const int &n );
+
+
+        /** Sets the function that evaluates  f = A*x. The operator must  \n
+         *  not change between two calls of solve, as the conjugate basis \n
+         *  of previous solves is reused for warm starting; call         \n
+         *  setOperator again after A has changed.                        \n
+         *                                                               \n
+         *  \return SUCCESSFUL_RETURN                                    \n
+         */
+        returnValue setOperator( cFcnPtr  applyOperator_,
+                                 void    *userData_ = 0  );
+
+
+        /** Index lists are not needed by the matrix-free method. \n
+         *                                                          \n
+         *  \return RET_NOT_IMPLEMENTED_YET                          \n
+         */
+        virtual returnValue setIndices( const int *rowIdx_,
+                                        const int *colIdx_  );
+
+
+        /** Sets the diagonal of A (dimension n) which is used for a   \n
+         *  diagonal preconditioner.                                   \n
+         *                                                             \n
+         *  \return SUCCESSFUL_RETURN                                  \n
+         *          RET_MEMBER_NOT_INITIALISED                         \n
+         *          RET_INVALID_ARGUMENTS                              \n
+         */
+        virtual returnValue setMatrix( double *A_ );
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+
+    /** Evaluates the matrix-vector product  result = A*xx. (only internal use)*/
+    virtual void multiply( double *xx , double *result );
+
+
+    /** Computes the diagonal preconditioner. */
+    virtual returnValue computePreconditioner( double* A_ );
+
+
+    /** Applies the preconditioner to the vector b (only internal use) */
+    virtual returnValue applyPreconditioner( double *b );
+
+    /** Applies the inverse of the preconditioner to the vector x (only internal use) */
+    virtual returnValue applyInversePreconditioner( double *x_ );
+
+    /** Returns whether the operator has been defined (only internal use) */
+    virtual BooleanType isMatrixDefined( ) const;
+
+
+
+    //
+    // DATA MEMBERS:
+    //
+    protected:
+
+
+        cFcnPtr   applyOperator;    // the user-supplied product  f = A*x
+        void          *userData;    // user data passed to applyOperator
+        double            *work;    // auxiliary vector
+
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+
+#include <acado/sparse_solver/matrix_free_conjugate_gradient_method.ipp>
+
+
+#endif  // ACADO_TOOLKIT_MATRIX_FREE_CONJUGATE_GRADIENT_METHOD_HPP
+
+/*
+ *   end of file
+ */
@@ -183,6 +183,7 @@ CLOSE_NAMESPACE_ACADO
 #include <acado/sparse_solver/conjugate_gradient_method.hpp>
 #include <acado/sparse_solver/normal_conjugate_gradient_method.hpp>
 #include <acado/sparse_solver/symmetric_conjugate_gradient_method.hpp>
+#include <acado/sparse_solver/matrix_free_conjugate_gradient_method.hpp>
 
 /*
  *   end of file
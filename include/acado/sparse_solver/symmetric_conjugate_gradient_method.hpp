@@ -51,6 +51,12 @@ BEGIN_NAMESPACE_ACADO
  *    A * x = b                                                               \n
  *                                                                            \n
  *  where A is symmetric and positive definite.                               \n
+ *                                                                            \n
+ *  The system is always scaled by the diagonal of A. In addition, an         \n
+ *  incomplete Cholesky factor (on the sparsity pattern of A) or a            \n
+ *  block-Jacobi factor (exact Cholesky factors of the diagonal blocks) can   \n
+ *  be used as split preconditioner, see setPreconditioner. The products      \n
+ *  with A are parallelized over the rows if OpenMP is enabled.               \n
  *
  *  \author Boris Houska, Hans Joachim Ferreau
  *  \date   2009
@@ -88,11 +94,29 @@ class SymmetricConjugateGradientMethod : public ConjugateGradientMethod{
 
 
         /** Sets an index list containing the positions of the \n
-         *  non-zero elements in the matrix  A.
+         *  non-zero elements in the matrix  A. The entries may   \n
+         *  be given in any order; they are sorted row-wise and   \n
+         *  the values passed to setMatrix are permuted alike.    \n
+         *                                                        \n
+         *  \return SUCCESSFUL_RETURN                             \n
+         *          RET_MEMBER_NOT_INITIALISED                    \n
+         *          RET_INVALID_ARGUMENTS (position out of range, \n
+         *          duplicate position or missing diagonal entry) \n
          */
         virtual returnValue setIndices( const int *indices_ );
 
 
+        /** Selects the preconditioner that is computed by the next call \n
+         *  of setMatrix (PT_DIAGONAL, PT_BLOCK_JACOBI or                 \n
+         *  PT_INCOMPLETE_CHOLESKY).                                      \n
+         *                                                               \n
+         *  \return SUCCESSFUL_RETURN                                    \n
+         *          RET_INVALID_ARGUMENTS                                \n
+         */
+        virtual returnValue setPreconditioner( PreconditionerType preconditioner_,
+                                               int                blockSize_ = 1 );
+
+
     //
     // PROTECTED MEMBER FUNCTIONS:
     //
@@ -103,6 +127,10 @@ class SymmetricConjugateGradientMethod : public ConjugateGradientMethod{
     /** Evaluates the matrix-vector product  result = A*xx efficiently. (only internal use)*/
     virtual void multiply( double *xx , double *result );
 
+    /** Evaluates the product of the scaled matrix with xx, i.e. without the \n
+     *  triangular factor of the preconditioner. (only internal use)        */
+    void multiplyScaledMatrix( double *xx , double *result );
+
 
     /** Computes the preconditioner and Applies it to the input matrix. */
     virtual returnValue computePreconditioner( double* A_ );
@@ -115,6 +143,28 @@ class SymmetricConjugateGradientMethod : public ConjugateGradientMethod{
     virtual returnValue applyInversePreconditioner( double *x_ );
 
 
+    /** Sets up the sparsity pattern of the lower triangular factor of the \n
+     *  preconditioner. (only internal use)                                */
+    void setupFactorPattern( );
+
+    /** Computes the lower triangular factor of the scaled matrix plus     \n
+     *  shift*I on its sparsity pattern. (only internal use)               \n
+     *                                                                     \n
+     *  \return SUCCESSFUL_RETURN                                          \n
+     *          RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR                     \n
+     */
+    returnValue computeFactor( double shift );
+
+    /** Solves  L*b = b  in place. (only internal use) */
+    void solveFactor( double *b );
+
+    /** Solves  L^T*b = b  in place. (only internal use) */
+    void solveTransposedFactor( double *b );
+
+    /** Deletes the triangular factor. (only internal use) */
+    void clearFactor( );
+
+
 
     //
     // DATA MEMBERS:
@@ -125,6 +175,13 @@ class SymmetricConjugateGradientMethod : public ConjugateGradientMethod{
         int     **index;
         int     *nIndex;
         int       *diag;
+        int   *rowStart;        // position of the first entry of each row in A
+        int       *perm;        // position of each (sorted) entry of A in the input
+
+        int  *lRowStart;        // lower triangular factor of the preconditioner
+        int       *lCol;        // (row-wise, the diagonal is the last entry
+        double    *lVal;        //  of each row; not used if lRowStart == 0)
+        double    *work;        // auxiliary vector
 
 };
 
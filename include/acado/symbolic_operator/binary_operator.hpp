@@ -440,6 +440,12 @@ protected:
 
     int     bufferSize       ;    /**< The size of the buffer.    */
 
+    double *  argument2_batch ;   /**< The lane results of the
+                                   *   second summand (see
+                                   *   evaluateBatch).            */
+    int     batchSize        ;    /**< The size of the lane
+                                   *   buffer.                    */
+
     CurvatureType     curvature   ;
     MonotonicityType  monotonicity;
 };
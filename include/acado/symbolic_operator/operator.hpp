@@ -171,6 +171,21 @@ public:
                                   double *result    /**< the result           */  ) = 0;
 
 
+    /** Evaluates the expression for several lanes at once. The   \n
+     *  value of the variable with index i in lane j is stored    \n
+     *  in x[i*ldx+j] and the result of lane j in result[j].      \n
+     *  In contrast to evaluate, the intermediate results are     \n
+     *  not kept per buffer position; binary operators reuse one  \n
+     *  lane buffer that grows with the number of lanes.          \n
+     *  \return SUCCESSFUL_RETURN                                 \n
+     *          RET_NOT_IMPLEMENTED_YET                           \n
+     * */
+    virtual returnValue evaluateBatch( int     nLanes    /**< number of lanes            */,
+                                       int     ldx       /**< leading dimension of x     */,
+                                       double *x         /**< the input variables        */,
+                                       double *result    /**< the results, one per lane  */  );
+
+
 
     /** Returns the derivative of the expression with respect     \n
      *  to the variable var(index).                               \n
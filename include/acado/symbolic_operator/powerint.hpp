@@ -84,6 +84,16 @@ public:
                                   double *result    /**< the result           */  );
 
 
+    /** Evaluates the expression for several lanes at once     \n
+     *  (see Operator::evaluateBatch).                          \n
+     *  \return SUCCESSFUL_RETURN                              \n
+     */
+    virtual returnValue evaluateBatch( int     nLanes    /**< number of lanes            */,
+                                       int     ldx       /**< leading dimension of x     */,
+                                       double *x         /**< the input variables        */,
+                                       double *result    /**< the results, one per lane  */  );
+
+
 
     /** Returns the derivative of the expression with respect     \n
      *  to the variable var(index).                               \n
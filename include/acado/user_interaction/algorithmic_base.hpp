@@ -426,6 +426,18 @@ class AlgorithmicBase
 												) const;
 
 
+		/** Returns whether an item with given name is contained in any
+		 *	of the records, i.e. whether its values are logged at all.
+		 *
+		 *	@param[in]  _name	Internal name of item.
+		 *
+		 *  \return BT_TRUE  iff item is logged, \n
+		 *	        BT_FALSE otherwise
+		 */
+		inline BooleanType isLogged(	LogName _name
+										) const;
+
+
 		/** Sets all numerical values at all time instants of all items
 		 *	with given name within all records.
 		 *
@@ -166,6 +166,14 @@ inline BooleanType AlgorithmicBase::haveOptionsChanged(	uint idx
 
 
 
+inline BooleanType AlgorithmicBase::isLogged(	LogName _name
+												) const
+{
+	return userInteraction->logCollection.hasItem( _name );
+}
+
+
+
 inline returnValue AlgorithmicBase::setAll(	LogName _name,
 											const MatrixVariablesGrid& values
 											)
@@ -140,6 +140,27 @@ class LogCollection
 		 */
 		returnValue clearAllRecords( );
 
+		/** Clears the numerical values of all items within all records,
+		 *	while the records and their items are kept.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue clearAllValues( );
+
+		/** Appends all numerical values of the given collection to the items
+		 *	with the same name within this collection (as if they had been
+		 *	logged here) and clears them within the given collection afterwards.
+		 *	If an item exists in more than one record of the given collection,
+		 *	its values are taken from the record holding most of them.
+		 *
+		 *	@param[in,out] rhs	Collection whose values are to be merged.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_COLLECTION_CORRUPTED 
+		 */
+		returnValue mergeValues(	LogCollection& rhs
+									);
+
 
 		/** Gets all numerical values at all time instants of the item
 		 *	with given name. If this item exists in more than one record,
@@ -150,6 +150,26 @@ class Logging
 										) const;
 
 
+		/** Appends all numerical values logged by the given object to the
+		 *	items with the same name of this object (as if they had been logged
+		 *	here) and clears them within the given object afterwards.
+		 *
+		 *	@param[in,out]  rhs		Object whose logged values are to be merged.
+		 *
+		 *  \return SUCCESSFUL_RETURN, \n
+		 *	        RET_LOG_COLLECTION_CORRUPTED 
+		 */
+		returnValue mergeLogValues(	Logging& rhs
+									);
+
+		/** Clears the numerical values of all items of all records,
+		 *	while the records and their items are kept.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue clearLogValues( );
+
+
 		/** Gets all numerical values at all time instants of the item
 		 *	with given name. If this item exists in more than one record,
 		 *	the first one is choosen as they are expected to have identical
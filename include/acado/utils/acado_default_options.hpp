@@ -48,23 +48,35 @@ const double 	defaultKKTtolerance = 1.0e-6;										/**< Default value for the
 const double 	defaultKKTtoleranceSafeguard = 1.0;									/**< Default value for safeguarding the KKT tolerance as termination criterium for the NLP solver (possible values: any non-negative real number). */
 const double 	defaultLevenbergMarguardt = 0.0;									/**< Default value for Levenberg-Marquardt regularization (possible values: any non-negative real number). */
 const double 	defaultHessianProjectionFactor = -1.0;								/**< Default value for projecting semi-definite Hessians to positive definite part (possible values: any positive real number). */
-const int 		defaultHessianApproximation = BLOCK_BFGS_UPDATE;					/**< Default value for approximating the Hessian within the NLP solver (possible values: CONSTANT_HESSIAN, GAUSS_NEWTON, FULL_BFGS_UPDATE, BLOCK_BFGS_UPDATE, GAUSS_NEWTON_WITH_BLOCK_BFGS, EXACT_HESSIAN, DEFAULT_HESSIAN_APPROXIMATION). */
-const int 		defaultDynamicHessianApproximation = DEFAULT_HESSIAN_APPROXIMATION;	/**< Default value for approximating the Hessian of the dynamic equations within the NLP solver (possible values: CONSTANT_HESSIAN, GAUSS_NEWTON, FULL_BFGS_UPDATE, BLOCK_BFGS_UPDATE, GAUSS_NEWTON_WITH_BLOCK_BFGS, EXACT_HESSIAN, DEFAULT_HESSIAN_APPROXIMATION). */
+const int 		defaultHessianApproximation = BLOCK_BFGS_UPDATE;					/**< Default value for approximating the Hessian within the NLP solver (possible values: CONSTANT_HESSIAN, GAUSS_NEWTON, FULL_BFGS_UPDATE, BLOCK_BFGS_UPDATE, GAUSS_NEWTON_WITH_BLOCK_BFGS, EXACT_HESSIAN, LIMITED_MEMORY_BFGS_UPDATE, BLOCK_LIMITED_MEMORY_BFGS_UPDATE, DEFAULT_HESSIAN_APPROXIMATION). */
+const int 		defaultDynamicHessianApproximation = DEFAULT_HESSIAN_APPROXIMATION;	/**< Default value for approximating the Hessian of the dynamic equations within the NLP solver (possible values: CONSTANT_HESSIAN, GAUSS_NEWTON, FULL_BFGS_UPDATE, BLOCK_BFGS_UPDATE, GAUSS_NEWTON_WITH_BLOCK_BFGS, EXACT_HESSIAN, LIMITED_MEMORY_BFGS_UPDATE, BLOCK_LIMITED_MEMORY_BFGS_UPDATE, DEFAULT_HESSIAN_APPROXIMATION). */
+const int 		defaultBFGSmemorySize = 10;											/**< Default value for the number of pairs stored by limited-memory BFGS updates (possible values: any positive integer). */
 const int 		defaultDynamicSensitivity = BACKWARD_SENSITIVITY;					/**< Default value for generating sensitivities of the dynamic equations (possible values: FORWARD_SENSITIVITY, BACKWARD_SENSITIVITY). */
+const int 		defaultNumLiftedNodes = 0;											/**< Default value for the number of lifted intermediate nodes per shooting interval, only used together with FORWARD_SENSITIVITY_LIFTED (possible values: any non-negative integer). */
 const int 		defaultObjectiveSensitivity = BACKWARD_SENSITIVITY;					/**< Default value for generating sensitivities of the objective function (possible values: FORWARD_SENSITIVITY, BACKWARD_SENSITIVITY). */
 const int 		defaultConstraintSensitivity = BACKWARD_SENSITIVITY;				/**< Default value for generating sensitivities of the constraints (possible values: FORWARD_SENSITIVITY, BACKWARD_SENSITIVITY). */
 const int 		defaultDiscretizationType = MULTIPLE_SHOOTING;						/**< Default value for specifying how to discretize the OCP in time (possible values: SINGLE_SHOOTING, MULTIPLE_SHOOTING, COLLOCATION). */
-const int 		defaultUseCondensing = BT_TRUE;										/**< Default value for specifying whether a condesing-based approach shall be used for solving the sub-QP (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultUseCondensing = BT_TRUE;										/**< Default value for specifying whether a condesing-based approach shall be used for solving the sub-QP, otherwise a Riccati-based interior point method is used (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultCondensingBlockSize = 1;										/**< Default value for the number of stages that are condensed into one block if the sub-QP is solved without (full) condensing (possible values: any positive integer). */
 const int 		defaultGlobalizationStrategy = GS_LINESEARCH;						/**< Default value for specifying which globablization strategy is used within the NLP solver (possible values: GS_FULLSTEP, GS_LINESEARCH). */
+const int 		defaultNLPsolver = NLP_SCP_METHOD;									/**< Default value for specifying which algorithm is used for solving the NLP (possible values: NLP_SCP_METHOD, NLP_IP_METHOD). */
+const double 	defaultBarrierParameter = 1.0e-1;									/**< Default value for the initial barrier parameter of the interior point NLP solver (possible values: any positive real number). */
 const double 	defaultLinesearchTolerance = 1.0e-5;								/**< Default value for the tolerance of the line-search globalization (possible values: any positive real number). */
 const double 	defaultMinLinesearchParameter = 0.5;								/**< Default value for the minimum stepsize of the line-search globalization (possible values: any positive real number). */
+const int 		defaultQPsolver = QP_QPOASES;										/**< Default value for specifying which solver is used for the (condensed) sub-QPs (possible values: QP_QPOASES, QP_ADMM). */
 const int 		defaultMaxNumQPiterations = 10000;									/**< Default value for maximum number of iterations of the (underlying) QP solver (possible values: any positive integer). */
+const double 	defaultQPsolverTolerance = 1.0e-6;									/**< Default value for the tolerance of iterative QP solvers (possible values: any positive real number). */
+const double 	defaultMaxQPsolverTime = -1.0;										/**< Default value for the time budget (in seconds) of iterative QP solvers (possible values: any positive real number, or a non-positive number for no time budget). */
+const double 	defaultMaxNLPsolverTime = -1.0;										/**< Default value for the wall-clock time budget (in seconds) of one call to the NLP solver (possible values: any positive real number, or a non-positive number for no time budget). */
 const int 		defaultHotstartQP = BT_FALSE;										/**< Default value for specifying whether the underlying QP shall be hotstarted or not (possible values: BT_TRUE, BT_FALSE). */
 const double 	defaultInfeasibleQPrelaxation = 1.0e-8;								/**< Default value for the amount constraints are relaxed in case of an infeasible sub-QP (possible values: ). */
 const int 		defaultInfeasibleQPhandling = IQH_RELAX_L2;							/**< Default value for specifying the strategy to handle infeasible sub-QPs (possible values: IQH_STOP, IQH_IGNORE, IQH_RELAX_L2). */
 const int 		defaultUseRealtimeIterations = BT_FALSE;							/**< Default value for specifying whether real-time iterations shall be used (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultUseRealtimeShifts = BT_FALSE;								/**< Default value for specifying whether shifted real-time iterations shall be used (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultUseImmediateFeedback = BT_FALSE;								/**< Default value for specifying whether immediate feedback shall be used (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultUseAsyncPreparation = BT_FALSE;								/**< Default value for specifying whether the preparation step of real-time iterations is performed on a background thread while the process is running (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultUseTangentialPredictor = BT_FALSE;							/**< Default value for specifying whether the feedback of real-time iterations is obtained from a tangential predictor with fixed active set as long as the active set does not change (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultUseAutomaticScaling = BT_FALSE;								/**< Default value for specifying whether variables, objective and constraints are scaled automatically before solving the QP subproblems (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultTerminateAtConvergence = BT_TRUE;							/**< Default value for specifying whether to stop iterations at convergence (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultUseReferencePrediction = BT_TRUE;							/**< Default value for specifying whether the prediction of the reference trajectory shall be known the control law (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultPrintlevel = MEDIUM;											/**< Default value for the printlevel determining the quatity of output given by the optimization algorithm (possible values: HIGH, MEDIUM, LOW, NONE). */
@@ -73,7 +85,7 @@ const int 		defaultprintSCPmethodProfile = BT_FALSE;							/**< Default value fo
 
 // DynamicDiscretization
 const int 		defaultFreezeIntegrator = BT_TRUE;							/**< Default value for specifying whether integrator should freeze all intermediate results (possible values: BT_TRUE, BT_FALSE). */
-const int 		defaultIntegratorType = INT_RK45;							/**< Default value for integrator type (possible values: INT_RK12, INT_RK23, INT_RK45, INT_RK78, INT_BDF). */
+const int 		defaultIntegratorType = INT_RK45;							/**< Default value for integrator type (possible values: INT_RK12, INT_RK23, INT_RK45, INT_RK78, INT_DOPRI5, INT_VERNER6, INT_BDF). */
 const int 		defaultFeasibilityCheck = BT_FALSE;							/**< Default value for specifying whether infeasibilty shall be checked (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultPlotResoltion = LOW;									/**< Default value for specifying the plot resolution (possible values: HIGH, MEDIUM, LOW). */
 
@@ -91,6 +103,10 @@ const int 		defaultLinearAlgebraSolver = HOUSEHOLDER_METHOD;			/**< Default valu
 const int 		defaultAlgebraicRelaxation = ART_ADAPTIVE_POLYNOMIAL;		/**< Default value for specifying how algebraic equations are relaxed within the integrator (possible values: ART_EXPONENTIAL, ART_ADAPTIVE_POLYNOMIAL). */
 const double	defaultRelaxationParameter = 0.5;							/**< Default value for the amount algebraic equations are relaxed within the integrator (possible values: any positive real number). */
 const int       defaultprintIntegratorProfile = BT_FALSE;					/**< Default value for specifying whether a runtime profile of the integrator shall be printed (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultWarmStartIntegrator = BT_FALSE;						/**< Default value for specifying whether adaptive integrators start from the step size proposed in the previous integration of the same interval instead of INITIAL_INTEGRATOR_STEPSIZE (possible values: BT_TRUE, BT_FALSE). */
+const int 		defaultMaxNumStoredSteps = 0;								/**< Default value for the maximum number of integrator steps whose intermediate results are stored for sensitivity generation; longer trajectories are checkpointed and recomputed on demand; only the Runge-Kutta integrators support checkpointing, IntegratorBDF always stores all steps (possible values: any positive integer, 0 for storing all steps). */
+const int 		defaultMaxNumStiffSteps = 15;								/**< Default value for the number of consecutive steps limited by stability after which the RK45 integrator of an INT_AUTO interval gives up and the interval switches to BDF (possible values: any positive integer). */
+const double	defaultAutoIntegratorSwitchTolerance = 0.1;					/**< Default value for the relative change of the start point of an INT_AUTO interval after which the switch to BDF is invalidated and RK45 is tried again (possible values: any positive real number). */
 
 // MultiObjectiveAlgorithm
 const int 		defaultParetoFrontDiscretization = 21;						/**< Default value for the number of points of the pareto front (possible values: any postive integer). */
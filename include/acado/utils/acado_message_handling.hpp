@@ -227,6 +227,8 @@ RET_TO_SMALL_OR_NEGATIVE_TIME_INTERVAL,			/**< the time interval was too small o
 RET_FINAL_STEP_NOT_PERFORMED_YET,				/**< the integration routine is not ready. */
 RET_ALREADY_FROZEN,								/**< the integrator is already freezing or frozen. */
 RET_MAX_NUMBER_OF_STEPS_EXCEEDED,				/**< the maximum number of steps has been exceeded. */
+RET_INTEGRATOR_DEADLINE_REACHED,				/**< the integration routine stopped as its deadline has been reached. */
+RET_STIFFNESS_DETECTED,							/**< the explicit integrator stopped as the problem appears to be stiff. */
 RET_WRONG_DEFINITION_OF_SEEDS,					/**< the seeds are not set correctly or in the wrong order. */
 RET_NOT_FROZEN,									/**< the mesh is not frozen and/or forward results not stored. */
 RET_TO_MANY_DIFFERENTIAL_STATES,				/**< there are to many differential states. */
@@ -259,6 +261,7 @@ RET_OPTALG_FEEDBACK_FAILED, 					/**< Feedback step of optimization algorithm fa
 RET_OPTALG_PREPARE_FAILED, 						/**< Preparation step of optimization algorithm failed. */
 RET_OPTALG_SOLVE_FAILED, 						/**< Problem could not be solved with given optimization algorithm. */
 RET_REALTIME_NO_INITIAL_VALUE, 					/**< No initial value has been specified. */
+RET_SOLUTION_CACHE_UPDATE_FAILED,				/**< The solution could not be added to the solution cache. */
 
 /* INTEGRATION_ALGORITHM: */
 RET_INTALG_INIT_FAILED, 						/**< Initialization of integration algorithm failed. */
@@ -274,6 +277,7 @@ CONVERGENCE_NOT_YET_ACHIEVED,					/**< convergence not yet achieved. */
 RET_NLP_INIT_FAILED, 							/**< Initialization of NLP solver failed. */
 RET_NLP_STEP_FAILED, 							/**< Step of NLP solver failed. */
 RET_NLP_SOLUTION_FAILED,						/**< NLP solution failed. */
+RET_NLP_TIME_BUDGET_EXCEEDED,					/**< NLP solver stopped as its time budget has been used up. */
 RET_INITIALIZE_FIRST, 							/**< Object needs to be initialized first. */
 RET_SOLVER_NOT_SUTIABLE_FOR_REAL_TIME_MODE,		/**< The specified NLP solver is not designed for a real-time mode. */
 RET_ILLFORMED_HESSIAN_MATRIX,					/**< Hessian matrix is too ill-posed to continue. */
@@ -286,6 +290,7 @@ RET_NEED_TO_ACTIVATE_RTI,						/**< Feedback step requires real-time iterations
 RET_CONIC_PROGRAM_INFEASIBLE,					/**< The optimization problem is infeasible. */
 RET_CONIC_PROGRAM_SOLUTION_FAILED,				/**< Conic Program solution failed. The optimization problem might be infeasible. */
 RET_CONIC_PROGRAM_NOT_SOLVED,					/**< The Conic Program has not been solved successfully. */
+RET_BARRIER_STEP_NOT_AVAILABLE,					/**< Barrier steps are not available as the Conic Program is condensed, it is solved to optimality instead. */
 
 /* CP SOLVER */
 RET_UNABLE_TO_CONDENSE,							/**< Unable to condense banded CP. */
@@ -161,6 +161,15 @@ enum LinearAlgebraSolver{
 };
 
 
+/** Defines all possible preconditioners of the conjugate gradient methods. */
+enum PreconditionerType{
+
+    PT_DIAGONAL,
+    PT_BLOCK_JACOBI,
+    PT_INCOMPLETE_CHOLESKY
+};
+
+
 /** Defines all possible monotonicity types. */
 enum MonotonicityType{
 
@@ -198,7 +207,7 @@ enum StateDiscretizationType{
 
     SINGLE_SHOOTING,        /**< Single shooting discretisation.   */
     MULTIPLE_SHOOTING,      /**< Multiple shooting discretisation. */
-    COLLOCATION,            /**< Collocation discretisation.       */
+    COLLOCATION,            /**< Collocation discretisation (not implemented yet, multiple shooting is used instead). */
     UNKNOWN_DISCRETIZATION  /**< Discretisation type unknown.      */
 };
 
@@ -223,6 +232,14 @@ enum GlobalizationStrategy
 };
 
 
+/** Summarises all possible algorithms for solving NLPs. */
+enum NLPsolverName
+{
+	NLP_SCP_METHOD,					/**< Sequential convex programming (active-set QP subproblems). */
+	NLP_IP_METHOD					/**< Primal-dual interior point method. */
+};
+
+
 /** Summarises all possible interpolation modes for VariablesGrids, Curves and the like. */
 enum InterpolationMode
 {
@@ -259,8 +276,11 @@ enum IntegratorType{
      INT_RK23,             /**< Explicit Runge-Kutta integrator of order 2/3          */
      INT_RK45,             /**< Explicit Runge-Kutta integrator of order 4/5          */
      INT_RK78,             /**< Explicit Runge-Kutta integrator of order 7/8          */
+     INT_DOPRI5,           /**< Explicit Dormand-Prince integrator of order 5/4       */
+     INT_VERNER6,          /**< Explicit Verner integrator of order 6/5               */
      INT_BDF,              /**< Implicit backward differentiation formula integrator. */
      INT_DISCRETE,         /**< Discrete time integrator                              */
+     INT_AUTO,             /**< RK45 or BDF, chosen per interval by stiffness         */
      INT_UNKNOWN           /**< unkown.                                               */
 };
 
@@ -336,6 +356,10 @@ enum OptionsName
 	ALGEBRAIC_RELAXATION,
 	RELAXATION_PARAMETER,
 	PRINT_INTEGRATOR_PROFILE,
+	MAX_NUM_STORED_INTEGRATOR_STEPS,
+	WARM_START_INTEGRATOR,
+	MAX_NUM_STIFF_INTEGRATOR_STEPS,
+	AUTO_INTEGRATOR_SWITCH_TOLERANCE,
 	FEASIBILITY_CHECK,
 	MAX_NUM_ITERATIONS,
 	KKT_TOLERANCE,
@@ -345,8 +369,10 @@ enum OptionsName
 	PRINT_COPYRIGHT,
 	HESSIAN_APPROXIMATION,
 	DYNAMIC_HESSIAN_APPROXIMATION,
+	BFGS_MEMORY_SIZE,
 	HESSIAN_PROJECTION_FACTOR,
 	DYNAMIC_SENSITIVITY,
+	NUM_LIFTED_NODES,
 	OBJECTIVE_SENSITIVITY,
 	CONSTRAINT_SENSITIVITY,
 	DISCRETIZATION_TYPE,
@@ -355,11 +381,17 @@ enum OptionsName
 	QP_SOLVER,
 	MAX_NUM_QP_ITERATIONS,
 	HOTSTART_QP,
+	QP_SOLVER_TOLERANCE,
+	MAX_QP_SOLVER_TIME,
+	MAX_NLP_SOLVER_TIME,
 	INFEASIBLE_QP_RELAXATION,
 	INFEASIBLE_QP_HANDLING,
 	USE_REALTIME_ITERATIONS,
 	USE_REALTIME_SHIFTS,
 	USE_IMMEDIATE_FEEDBACK,
+	USE_ASYNC_PREPARATION,
+	USE_TANGENTIAL_PREDICTOR,
+	USE_AUTOMATIC_SCALING,
 	TERMINATE_AT_CONVERGENCE,
 	USE_REFERENCE_PREDICTION,
 	FREEZE_INTEGRATOR,
@@ -376,7 +408,10 @@ enum OptionsName
 	PARAMETER_PLOTTING,
 	OUTPUT_PLOTTING,
 	USE_CONDENSING,
+	CONDENSING_BLOCK_SIZE,
 	GLOBALIZATION_STRATEGY,
+	NLP_SOLVER,
+	BARRIER_PARAMETER,
 	CONIC_SOLVER_MAXIMUM_NUMBER_OF_STEPS,
 	CONIC_SOLVER_TOLERANCE,
 	CONIC_SOLVER_LINE_SEARCH_TUNING,
@@ -455,7 +490,8 @@ enum LogName
     LOG_TIME_INTEGRATOR_FUNCTION_EVALUATIONS,
     LOG_TIME_BDF_INTEGRATOR_JACOBIAN_EVALUATION,
 	// 50
-    LOG_TIME_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITION
+    LOG_TIME_BDF_INTEGRATOR_JACOBIAN_DECOMPOSITION,
+    LOG_TIME_LIFTING
 };
 
 
@@ -581,6 +617,8 @@ enum HessianApproximationMode{
     BLOCK_BFGS_UPDATE,
     GAUSS_NEWTON_WITH_BLOCK_BFGS,
     EXACT_HESSIAN,
+    LIMITED_MEMORY_BFGS_UPDATE,
+    BLOCK_LIMITED_MEMORY_BFGS_UPDATE,
     DEFAULT_HESSIAN_APPROXIMATION
 };
 
@@ -588,7 +626,8 @@ enum HessianApproximationMode{
 enum QPSolverName
 {
 	QP_QPOASES,
-	QP_CVXGEN
+	QP_CVXGEN,
+	QP_ADMM
 };
 
 
@@ -77,6 +77,32 @@ returnValue acadoPrintAutoGenerationNotice( FILE  *file );
 double acadoGetTime( );
 
 
+/** Sets the number of threads of the thread pool shared by all parallel
+ *  loops of ACADO Toolkit (the OpenMP thread team). All parallel loops
+ *  request the same number of threads, such that the threads of the pool
+ *  are reused instead of being created for each loop.
+ *
+ *	@param[in]  nThreads	Number of threads (0: OpenMP default).
+ *
+ * \return SUCCESSFUL_RETURN, \n
+ *         RET_INVALID_ARGUMENTS */
+returnValue acadoSetNumThreads(	int nThreads
+								);
+
+
+/** Returns the number of threads of the shared thread pool, which is 1
+ *  if ACADO Toolkit has been compiled without OpenMP.
+ * \return number of threads */
+int acadoGetNumThreads( );
+
+
+/** Returns the index of the calling thread within the current parallel
+ *  region, which is 0 outside of parallel regions and if ACADO Toolkit
+ *  has been compiled without OpenMP.
+ * \return thread index */
+int acadoGetThreadNum( );
+
+
 /** Returns if x is integer-valued.
  */
 BooleanType acadoIsInteger( double x );
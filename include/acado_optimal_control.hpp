@@ -39,6 +39,7 @@
 #include <acado/dynamic_discretization/integration_algorithm.hpp>
 #include <acado/nlp_solver/nlp_solver.hpp>
 #include <acado/nlp_solver/scp_method.hpp>
+#include <acado/nlp_solver/ip_method.hpp>
 #include <acado/ocp/ocp.hpp>
 #include <acado/optimization_algorithm/optimization_algorithm.hpp>
 #include <acado/optimization_algorithm/real_time_algorithm.hpp>
@@ -75,11 +75,24 @@ BandedCP& BandedCP::operator=( const BandedCP& rhs ){
 }
 
 
+returnValue BandedCP::getHessian( BlockMatrix& H ) const{
+
+    H = hessian;
+
+    if( hasLowRankHessian() == BT_TRUE )
+        H += hessianLowRankFactor*( hessianLowRankWeight*hessianLowRankFactor.transpose() );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 
 void BandedCP::copy( const BandedCP& rhs ){
 
 
     hessian                 = rhs.hessian                ;
+    hessianLowRankFactor    = rhs.hessianLowRankFactor   ;
+    hessianLowRankWeight    = rhs.hessianLowRankWeight   ;
     objectiveGradient       = rhs.objectiveGradient      ;
 
     lowerBoundResiduum      = rhs.lowerBoundResiduum     ;
@@ -122,6 +122,20 @@ returnValue BandedCPsolver::unfreezeCondensing( )
 }
 
 
+returnValue BandedCPsolver::setBarrierParameter(	double barrierParameter_
+													)
+{
+	return ACADOERROR( RET_NOT_IMPLEMENTED_IN_BASE_CLASS );
+}
+
+
+returnValue BandedCPsolver::shiftWorkingSet(	const BandedCP& cp
+												)
+{
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 //
 // PROTECTED MEMBER FUNCTIONS:
@@ -133,12 +147,58 @@ returnValue BandedCPsolver::setupOptions( )
 	addOption( HESSIAN_PROJECTION_FACTOR   , defaultHessianProjectionFactor  );
 	addOption( INFEASIBLE_QP_RELAXATION    , defaultInfeasibleQPrelaxation   );
 	addOption( INFEASIBLE_QP_HANDLING      , defaultInfeasibleQPhandling     );
+	addOption( QP_SOLVER                   , defaultQPsolver                 );
 	addOption( MAX_NUM_QP_ITERATIONS       , defaultMaxNumQPiterations       );
+	addOption( QP_SOLVER_TOLERANCE         , defaultQPsolverTolerance        );
+	addOption( MAX_QP_SOLVER_TIME          , defaultMaxQPsolverTime          );
+	addOption( USE_TANGENTIAL_PREDICTOR    , defaultUseTangentialPredictor   );
+	addOption( CONDENSING_BLOCK_SIZE       , defaultCondensingBlockSize      );
 
 	return SUCCESSFUL_RETURN;
 }
 
 
+returnValue BandedCPsolver::projectHessian( Matrix &H_, double dampingFactor ){
+
+    if( dampingFactor < 0 ) return SUCCESSFUL_RETURN;
+
+    int run1,run2;
+
+
+    // COMPUTE THE EIGENVALUES OF THE HESSIAN:
+    // ---------------------------------------
+
+    Matrix Q;
+    Vector D = H_.getEigenvalues( Q );
+    const int n = D.getDim();
+
+
+    // OVER-PROJECT THE EIGENVALUES BASED ON THE DAMPING TECHNIQUE:
+    // ------------------------------------------------------------
+
+    for( run1 = 0; run1 < n; run1++ ){
+        if( D(run1) <= 0.1 * dampingFactor ){
+            if( fabs(D(run1)) >= dampingFactor ) D(run1) = fabs(D(run1));
+            else                                 D(run1) = dampingFactor;
+        }
+    }
+
+
+    // RECONSTRUCT THE PROJECTED HESSIAN MATRIX:
+    // -----------------------------------------
+
+    Matrix tmp(n,n);
+
+    for( run1 = 0; run1 < n; run1++ )
+        for( run2 = 0; run2 < n; run2++ )
+            tmp(run1,run2) = D(run1)*Q(run2,run1);
+
+    H_ = Q*tmp;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue BandedCPsolver::setupLogging( )
 {
     //LogRecord tmp( LOG_AT_END );
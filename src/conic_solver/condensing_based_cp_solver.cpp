@@ -30,6 +30,7 @@
  */
 
 #include <acado/conic_solver/condensing_based_cp_solver.hpp>
+#include <acado/conic_solver/qp_solver_admm.hpp>
 #include <include/acado_qpoases/qp_solver_qpoases.hpp>
 
 
@@ -50,6 +51,8 @@ CondensingBasedCPsolver::CondensingBasedCPsolver( ) : BandedCPsolver( )
 
     cpSolver   = 0;
     qpRelaxed  = 0;
+
+	isPredictorPrepared = BT_FALSE;
 }
 
 
@@ -63,8 +66,18 @@ CondensingBasedCPsolver::CondensingBasedCPsolver(	UserInteraction* _userInteract
 
 	condensingStatus = COS_NOT_INITIALIZED;
 
-    cpSolver   = new QPsolver_qpOASES( _userInteraction );
+	int qpSolverName = QP_QPOASES;
+	get( QP_SOLVER,qpSolverName );
+
+	// infeasible sub-QPs are always relaxed and solved by qpOASES
+	if ( (QPSolverName) qpSolverName == QP_ADMM )
+		cpSolver = new QPsolver_ADMM( _userInteraction );
+	else
+		cpSolver = new QPsolver_qpOASES( _userInteraction );
+
     qpRelaxed  = new QPsolver_qpOASES( _userInteraction );
+
+	isPredictorPrepared = BT_FALSE;
 }
 
 
@@ -76,6 +89,20 @@ CondensingBasedCPsolver::CondensingBasedCPsolver( const CondensingBasedCPsolver&
 	
 	condensingStatus = rhs.condensingStatus;
 
+	iter        = rhs.iter;
+	T           = rhs.T;
+	d           = rhs.d;
+	dynGradient = rhs.dynGradient;
+	hT          = rhs.hT;
+
+	HDense   = rhs.HDense;
+	gDense   = rhs.gDense;
+	ADense   = rhs.ADense;
+	lbADense = rhs.lbADense;
+	ubADense = rhs.ubADense;
+	lbDense  = rhs.lbDense;
+	ubDense  = rhs.ubDense;
+
     if( rhs.cpSolver != 0 ) cpSolver = rhs.cpSolver->clone();
     else                    cpSolver = 0                    ;
 
@@ -86,6 +113,12 @@ CondensingBasedCPsolver::CondensingBasedCPsolver( const CondensingBasedCPsolver&
 	
 	deltaX = rhs.deltaX;
 	deltaP = rhs.deltaP;
+
+	isPredictorPrepared = rhs.isPredictorPrepared;
+	predictorPrimal     = rhs.predictorPrimal;
+	predictorDual       = rhs.predictorDual;
+	predictorPrimalSens = rhs.predictorPrimalSens;
+	predictorDualSens   = rhs.predictorDualSens;
 }
 
 
@@ -110,6 +143,20 @@ CondensingBasedCPsolver& CondensingBasedCPsolver::operator=( const CondensingBas
 
 		condensingStatus = rhs.condensingStatus;
 
+		iter        = rhs.iter;
+		T           = rhs.T;
+		d           = rhs.d;
+		dynGradient = rhs.dynGradient;
+		hT          = rhs.hT;
+
+		HDense   = rhs.HDense;
+		gDense   = rhs.gDense;
+		ADense   = rhs.ADense;
+		lbADense = rhs.lbADense;
+		ubADense = rhs.ubADense;
+		lbDense  = rhs.lbDense;
+		ubDense  = rhs.ubDense;
+
         if( rhs.cpSolver != 0 ) cpSolver = rhs.cpSolver->clone();
         else                    cpSolver = 0                    ;
 
@@ -120,6 +167,12 @@ CondensingBasedCPsolver& CondensingBasedCPsolver::operator=( const CondensingBas
 
 		deltaX = rhs.deltaX;
 		deltaP = rhs.deltaP;
+
+		isPredictorPrepared = rhs.isPredictorPrepared;
+		predictorPrimal     = rhs.predictorPrimal;
+		predictorDual       = rhs.predictorDual;
+		predictorPrimalSens = rhs.predictorPrimalSens;
+		predictorDualSens   = rhs.predictorDualSens;
     }
     return *this;
 }
@@ -174,6 +227,23 @@ returnValue CondensingBasedCPsolver::prepareSolve(	BandedCP& cp
 	clock.stop( );
 	setLast( LOG_TIME_CONDENSING,clock.getTime() );
 
+
+    // PREPARE THE TANGENTIAL PREDICTOR FOR THE NEXT FEEDBACK (IF SPECIFIED):
+    // ----------------------------------------------------------------------
+	isPredictorPrepared = BT_FALSE;
+
+	int useTangentialPredictor = BT_FALSE;
+	get( USE_TANGENTIAL_PREDICTOR,useTangentialPredictor );
+
+	if ( (BooleanType)useTangentialPredictor == BT_TRUE )
+	{
+		int useRealtimeIterations = BT_FALSE;
+		get( USE_REALTIME_ITERATIONS,useRealtimeIterations );
+
+		if ( (BooleanType)useRealtimeIterations == BT_TRUE )
+			return prepareTangentialPredictor( );
+	}
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -206,8 +276,12 @@ returnValue CondensingBasedCPsolver::solve(	BandedCP& cp
 		}
 	}
 
-    // Solve QP subproblem
+    // Use the tangential predictor as long as the active set does not change,
+    // otherwise solve QP subproblem
     // ------------------------------------
+	if ( applyTangentialPredictor( ) == BT_TRUE )
+		return SUCCESSFUL_RETURN;
+
     returnValue returnvalue = solveQPsubproblem( );
     if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
 
@@ -314,79 +388,105 @@ returnValue CondensingBasedCPsolver::unfreezeCondensing( )
 }
 
 
+returnValue CondensingBasedCPsolver::shiftWorkingSet(	const BandedCP& cp
+														)
+{
+	if ( cpSolver == 0 )
+		return SUCCESSFUL_RETURN;
 
-//
-// PROTECTED MEMBER FUNCTIONS:
-//
+	uint run1, run2, run3;
+
+	const uint N  = getNumPoints();
+	const uint nV = denseCP.getNV();
+	const uint nC = denseCP.getNC();
 
-returnValue CondensingBasedCPsolver::projectHessian( Matrix &H_, double dampingFactor ){
+	if ( N < 2 )
+		return SUCCESSFUL_RETURN;
 
-    if( dampingFactor < 0 ) return SUCCESSFUL_RETURN;
+	int *boundMap      = new int[nV];
+	int *constraintMap = new int[nC];
 
-    int run1,run2;
+	for( run1 = 0; run1 < nV; run1++ ) boundMap     [run1] = run1;
+	for( run1 = 0; run1 < nC; run1++ ) constraintMap[run1] = run1;
 
 
-    // COMPUTE THE EIGENVALUES OF THE HESSIAN:
-    // ---------------------------------------
+	// SHIFT THE BOUNDS OF xa, u AND w (x0 AND p ARE KEPT):
+	// -----------------------------------------------------
+	uint offset = getNX();
 
-    Matrix Q;
-    Vector D = H_.getEigenvalues( Q );
-    const int n = D.getDim();
+	for( run1 = 0; run1 < N-1; run1++ )
+		for( run2 = 0; run2 < getNXA(); run2++ )
+			boundMap[offset+run1*getNXA()+run2] = offset+(run1+1)*getNXA()+run2;
+	offset += N*getNXA() + getNP();
 
+	for( run1 = 0; run1 < N-2; run1++ )
+		for( run2 = 0; run2 < getNU(); run2++ )
+			boundMap[offset+run1*getNU()+run2] = offset+(run1+1)*getNU()+run2;
+	offset += (N-1)*getNU();
 
-    // OVER-PROJECT THE EIGENVALUES BASED ON THE DAMPING TECHNIQUE:
-    // ------------------------------------------------------------
+	for( run1 = 0; run1 < N-2; run1++ )
+		for( run2 = 0; run2 < getNW(); run2++ )
+			boundMap[offset+run1*getNW()+run2] = offset+(run1+1)*getNW()+run2;
 
-    for( run1 = 0; run1 < n; run1++ ){
-        if( D(run1) <= 0.1 * dampingFactor ){
-            if( fabs(D(run1)) >= dampingFactor ) D(run1) = fabs(D(run1));
-            else                                 D(run1) = dampingFactor;
-        }
-    }
 
+	// SHIFT EACH CONSTRAINT BLOCK ONTO THE CORRESPONDING BLOCK OF THE NEXT STAGE:
+	// ---------------------------------------------------------------------------
+	const uint nBlocks = blockDims.getDim();
 
-    // RECONSTRUCT THE PROJECTED HESSIAN MATRIX:
-    // -----------------------------------------
+	int  *blockStage  = new int [nBlocks+1];
+	uint *blockOffset = new uint[nBlocks+1];
 
-    Matrix tmp(n,n);
+	offset = 0;
+	for( run1 = 0; run1 < nBlocks; run1++ ){
+		getConstraintBlockStage( cp, run1, blockStage[run1] );
+		blockOffset[run1] = offset;
+		offset += (uint) blockDims(run1);
+	}
 
-    for( run1 = 0; run1 < n; run1++ )
-        for( run2 = 0; run2 < n; run2++ )
-            tmp(run1,run2) = D(run1)*Q(run2,run1);
+	for( run1 = 0; run1 < nBlocks; run1++ ){
 
-    H_ = Q*tmp;
+		if( blockStage[run1] < 0 ) continue;
 
-    return SUCCESSFUL_RETURN;
-}
+		for( run2 = run1+1; run2 < nBlocks; run2++ )
+			if( ( blockStage[run2] == blockStage[run1]+1 ) && ( blockDims(run2) == blockDims(run1) ) )
+				break;
 
+		if( run2 < nBlocks )
+			for( run3 = 0; run3 < (uint) blockDims(run1); run3++ )
+				constraintMap[blockOffset[run1]+run3] = blockOffset[run2]+run3;
+	}
 
+	for( run1 = 0; run1 < N-2; run1++ )
+		for( run2 = 0; run2 < getNX(); run2++ )
+			constraintMap[offset+run1*getNX()+run2] = offset+(run1+1)*getNX()+run2;
 
-returnValue CondensingBasedCPsolver::solveQPsubproblem( ){
+	delete[] blockOffset;
+	delete[] blockStage;
 
-    uint run1;
-    returnValue returnvalue;
 
+	returnValue returnvalue = cpSolver->shiftWorkingSet( boundMap,constraintMap );
 
-    // PROJECT HESSIAN TO POSITIVE DEFINITE CONE IF NECESSARY:
-    // -------------------------------------------------------
-    double hessianProjectionFactor;
-    get( HESSIAN_PROJECTION_FACTOR, hessianProjectionFactor );
-    projectHessian( denseCP.H, hessianProjectionFactor );
+	delete[] constraintMap;
+	delete[] boundMap;
 
+	return returnvalue;
+}
 
-    // APPLY LEVENBERG-MARQUARD REGULARISATION IF DESIRED:
-    // -------------------------------------------------------
-    double levenbergMarquard;
-    get(LEVENBERG_MARQUARDT, levenbergMarquard );
 
-    if( levenbergMarquard > EPS )
-        for( run1 = 0; run1 < denseCP.H.getNumRows(); run1++ )
-            denseCP.H(run1,run1) += levenbergMarquard;
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue CondensingBasedCPsolver::solveQPsubproblem( ){
+
+    returnValue returnvalue;
 
 
-	// consistency check of Hessian matrix
-	if ( ( denseCP.H.getMax( ) > 1.0e17 ) || ( denseCP.H.getMin( ) < -1.0e17 ) )
-		return RET_ILLFORMED_HESSIAN_MATRIX;
+    // REGULARISE THE HESSIAN IF NECESSARY:
+    // -------------------------------------------------------
+    returnvalue = regularizeHessian( );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
 
 
     // SOLVE QP ALLOWING THE GIVEN NUMBER OF ITERATIONS:
@@ -411,6 +511,16 @@ returnValue CondensingBasedCPsolver::solveQPsubproblem( ){
 			break;
 
 		default: //case: RET_QP_INFEASIBLE:
+			// a QP stopped by its time budget leaves no time for a relaxed one
+			if ( returnvalue == RET_QP_SOLUTION_REACHED_LIMIT )
+			{
+				double maxQPsolverTime;
+				get( MAX_QP_SOLVER_TIME,maxQPsolverTime );
+
+				if ( maxQPsolverTime > 0.0 )
+					return RET_QP_SOLUTION_REACHED_LIMIT;
+			}
+
 			int infeasibleQPhandling;
 			get( INFEASIBLE_QP_HANDLING,infeasibleQPhandling );
 
@@ -446,6 +556,279 @@ returnValue CondensingBasedCPsolver::solveQPsubproblem( ){
 
 
 
+returnValue CondensingBasedCPsolver::regularizeHessian( ){
+
+    uint run1;
+
+
+    // PROJECT HESSIAN TO POSITIVE DEFINITE CONE IF NECESSARY:
+    // -------------------------------------------------------
+    double hessianProjectionFactor;
+    get( HESSIAN_PROJECTION_FACTOR, hessianProjectionFactor );
+    projectHessian( denseCP.H, hessianProjectionFactor );
+
+
+    // APPLY LEVENBERG-MARQUARD REGULARISATION IF DESIRED:
+    // -------------------------------------------------------
+    double levenbergMarquard;
+    get(LEVENBERG_MARQUARDT, levenbergMarquard );
+
+    if( levenbergMarquard > EPS )
+        for( run1 = 0; run1 < denseCP.H.getNumRows(); run1++ )
+            denseCP.H(run1,run1) += levenbergMarquard;
+
+
+    // consistency check of Hessian matrix
+    if ( ( denseCP.H.getMax( ) > 1.0e17 ) || ( denseCP.H.getMin( ) < -1.0e17 ) )
+        return RET_ILLFORMED_HESSIAN_MATRIX;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue CondensingBasedCPsolver::prepareTangentialPredictor( )
+{
+	uint run1, run2, run3;
+
+	const uint nV = denseCP.getNV();
+	const uint nC = denseCP.getNC();
+	const uint nX = getNX();
+
+	isPredictorPrepared = BT_FALSE;
+
+	if ( ( cpSolver == 0 ) || ( nX == 0 ) )
+		return SUCCESSFUL_RETURN;
+
+
+	// SOLVE THE QP FOR THE PREDICTED INITIAL VALUE:
+	// ---------------------------------------------
+	for( run1 = 0; run1 < nX; run1++ )
+	{
+		denseCP.lb(run1) = 0.0;
+		denseCP.ub(run1) = 0.0;
+	}
+
+	// the original Hessian is kept, as a fallback QP regularises it once more
+	Matrix H = denseCP.H;
+
+	if ( regularizeHessian( ) != SUCCESSFUL_RETURN )
+	{
+		denseCP.H = H;
+		return SUCCESSFUL_RETURN;
+	}
+
+	int maxQPiter;
+	get( MAX_NUM_QP_ITERATIONS, maxQPiter );
+
+	returnValue returnvalue = solveQP( maxQPiter );
+
+	Matrix Hreg = denseCP.H;
+	denseCP.H = H;
+
+	if ( returnvalue != SUCCESSFUL_RETURN )
+		return SUCCESSFUL_RETURN;
+
+	predictorPrimal = *denseCP.x;
+	predictorDual   = denseCP.getMergedDualSolution( );
+
+
+	// DETERMINE THE FREE VARIABLES AND THE ACTIVE CONSTRAINTS:
+	// --------------------------------------------------------
+	uint nFree   = 0;
+	uint nActive = 0;
+
+	uint *freeIdx   = new uint[nV];
+	uint *activeIdx = new uint[nC];
+
+	for( run1 = 0; run1 < nV; run1++ )
+		if ( isActiveInPredictor( run1 ) == BT_FALSE )
+			freeIdx[nFree++] = run1;
+
+	for( run1 = 0; run1 < nC; run1++ )
+		if ( isActiveInPredictor( nV+run1 ) == BT_TRUE )
+			activeIdx[nActive++] = run1;
+
+	// more active constraints than free variables violate LICQ
+	if ( nActive > nFree )
+	{
+		delete[] activeIdx;
+		delete[] freeIdx;
+		return SUCCESSFUL_RETURN;
+	}
+
+
+	// SET UP AND FACTORISE THE REDUCED KKT MATRIX  [ H_FF  -A_AF^T ]
+	//                                              [ A_AF     0    ]
+	// -------------------------------------------------------------
+	const uint nK = nFree + nActive;
+
+	Matrix K( nK,nK );
+	K.setZero( );
+
+	for( run1 = 0; run1 < nFree; run1++ )
+	{
+		for( run2 = 0; run2 < nFree; run2++ )
+			K( run1,run2 ) = Hreg( freeIdx[run1],freeIdx[run2] );
+
+		for( run2 = 0; run2 < nActive; run2++ )
+		{
+			K( run1,nFree+run2 ) = -denseCP.A( activeIdx[run2],freeIdx[run1] );
+			K( nFree+run2,run1 ) =  denseCP.A( activeIdx[run2],freeIdx[run1] );
+		}
+	}
+
+	if ( ( nK > 0 ) && ( K.computeQRdecomposition( ) != SUCCESSFUL_RETURN ) )
+	{
+		delete[] activeIdx;
+		delete[] freeIdx;
+		return SUCCESSFUL_RETURN;
+	}
+
+
+	// DIFFERENTIATE THE SOLUTION W.R.T. EACH COMPONENT OF THE INITIAL VALUE:
+	// ----------------------------------------------------------------------
+	predictorPrimalSens.init( nV,nX );
+	predictorDualSens.init( nV+nC,nX );
+	predictorPrimalSens.setZero( );
+	predictorDualSens.setZero( );
+
+	Vector rhs( nK );
+	Vector sol( nK );
+
+	for( run3 = 0; run3 < nX; run3++ )
+	{
+		// stationarity and active constraints for the step e_run3 of the fixed variables
+		for( run1 = 0; run1 < nFree; run1++ )
+			rhs( run1 ) = -Hreg( freeIdx[run1],run3 );
+
+		for( run2 = 0; run2 < nActive; run2++ )
+			rhs( nFree+run2 ) = -denseCP.A( activeIdx[run2],run3 );
+
+		if ( nK > 0 )
+			sol = K.solveQR( rhs );
+
+		predictorPrimalSens( run3,run3 ) = 1.0;
+
+		for( run1 = 0; run1 < nFree; run1++ )
+			predictorPrimalSens( freeIdx[run1],run3 ) = sol( run1 );
+
+		for( run2 = 0; run2 < nActive; run2++ )
+			predictorDualSens( nV+activeIdx[run2],run3 ) = sol( nFree+run2 );
+
+		// the multipliers of the fixed variables follow from stationarity
+		for( run1 = 0; run1 < nV; run1++ )
+		{
+			if ( isActiveInPredictor( run1 ) == BT_FALSE )
+				continue;
+
+			double dy = 0.0;
+
+			for( run2 = 0; run2 < nV; run2++ )
+				dy += Hreg( run1,run2 ) * predictorPrimalSens( run2,run3 );
+
+			for( run2 = 0; run2 < nActive; run2++ )
+				dy -= denseCP.A( activeIdx[run2],run1 ) * sol( nFree+run2 );
+
+			predictorDualSens( run1,run3 ) = dy;
+		}
+	}
+
+	delete[] activeIdx;
+	delete[] freeIdx;
+
+	isPredictorPrepared = BT_TRUE;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+BooleanType CondensingBasedCPsolver::applyTangentialPredictor( )
+{
+	if ( ( isPredictorPrepared == BT_FALSE ) || ( deltaX.isEmpty( ) == BT_TRUE ) || ( deltaP.isEmpty( ) == BT_FALSE ) )
+		return BT_FALSE;
+
+	uint run1;
+
+	const uint nV = denseCP.getNV();
+	const uint nC = denseCP.getNC();
+
+	RealClock clock;
+	clock.start( );
+
+	Vector primal = predictorPrimal + predictorPrimalSens*deltaX;
+	Vector dual   = predictorDual   + predictorDualSens*deltaX;
+	Vector Ax     = denseCP.A*primal;
+
+
+	// THE PREDICTION IS ONLY VALID IF THE ACTIVE SET DOES NOT CHANGE:
+	// ---------------------------------------------------------------
+	for( run1 = getNX(); run1 < nV+nC; run1++ )
+	{
+		if ( isActiveInPredictor( run1 ) == BT_TRUE )
+		{
+			// active constraints must keep the sign of their multipliers
+			if ( dual( run1 )*predictorDual( run1 ) < 0.0 )
+				return BT_FALSE;
+		}
+		else
+		{
+			// inactive constraints must stay satisfied
+			if ( run1 < nV )
+			{
+				if ( ( primal( run1 ) < denseCP.lb( run1 ) - BOUNDTOL ) || ( primal( run1 ) > denseCP.ub( run1 ) + BOUNDTOL ) )
+					return BT_FALSE;
+			}
+			else
+			{
+				if ( ( Ax( run1-nV ) < denseCP.lbA( run1-nV ) - BOUNDTOL ) || ( Ax( run1-nV ) > denseCP.ubA( run1-nV ) + BOUNDTOL ) )
+					return BT_FALSE;
+			}
+		}
+	}
+
+	for( run1 = 0; run1 < getNX(); run1++ )
+		primal( run1 ) = deltaX( run1 );
+
+	denseCP.setQPsolution( primal,dual );
+
+	clock.stop( );
+	setLast( LOG_TIME_QP,clock.getTime() );
+	setLast( LOG_TIME_RELAXED_QP,0.0 );
+	setLast( LOG_IS_QP_RELAXED, BT_FALSE );
+
+	return BT_TRUE;
+}
+
+
+BooleanType CondensingBasedCPsolver::isActiveInPredictor(	uint idx
+															) const
+{
+	const uint nV = denseCP.getNV();
+
+	if ( idx < getNX() )
+		return BT_TRUE;
+
+	if ( fabs( predictorDual( idx ) ) > BOUNDTOL )
+		return BT_TRUE;
+
+	// equality constraints are always active
+	if ( idx < nV )
+	{
+		if ( fabs( denseCP.ub( idx ) - denseCP.lb( idx ) ) <= BOUNDTOL )
+			return BT_TRUE;
+	}
+	else
+	{
+		if ( fabs( denseCP.ubA( idx-nV ) - denseCP.lbA( idx-nV ) ) <= BOUNDTOL )
+			return BT_TRUE;
+	}
+
+	return BT_FALSE;
+}
+
+
+
 returnValue CondensingBasedCPsolver::condense(	BandedCP& cp
 												)
 {
@@ -471,6 +854,11 @@ returnValue CondensingBasedCPsolver::condense(	BandedCP& cp
 		{
 			// generate H
 			hT       = cp.hessian*T;
+
+			// add a low-rank part W*M*W^T without forming it explicitly
+			if( cp.hasLowRankHessian() == BT_TRUE )
+				hT += cp.hessianLowRankFactor*( cp.hessianLowRankWeight*(cp.hessianLowRankFactor^T) );
+
 			HDense   = T^hT;
 
 			if( getNX() != 0 ) generateHessianBlockLine( getNX(), rowOffset, rowOffset1 );
@@ -589,7 +977,10 @@ returnValue CondensingBasedCPsolver::condense(	BandedCP& cp
 
         Matrix tmp;
 
-        cp.hessian           .getSubBlock( 2, 2, denseCP.H  , getNP(), getNP() );
+        BlockMatrix hessian;
+        cp.getHessian( hessian );
+
+        hessian              .getSubBlock( 2, 2, denseCP.H  , getNP(), getNP() );
         cp.objectiveGradient .getSubBlock( 0, 2, tmp, 1 , getNP() );
         for( run1 = 0; run1 < getNP(); run1++ )
             denseCP.g(run1) = tmp(0,run1);
@@ -1099,6 +1490,9 @@ returnValue CondensingBasedCPsolver::expand(	BandedCP& cp
 
         aux = (cp.deltaX^cp.hessian) + cp.objectiveGradient;
 
+        if( cp.hasLowRankHessian() == BT_TRUE )
+            aux += ((cp.deltaX^cp.hessianLowRankFactor)*cp.hessianLowRankWeight)*cp.hessianLowRankFactor.transpose();
+
         Vector aux2(N*getNX());
         aux2.setZero();
 
@@ -1165,18 +1559,6 @@ returnValue CondensingBasedCPsolver::expand(	BandedCP& cp
             cp.lambdaDynamic.setDense( run1, 0, tmp );
         }
 
-
-        int dynMode;
-        get( DYNAMIC_SENSITIVITY, dynMode );
-
-        if( dynMode == FORWARD_SENSITIVITY_LIFTED ){
-            for( run1 = 0; run1 < N-1; run1++ ){
-                 tmp.init( lambdaDyn[run1].getDim(), 1 );
-                 tmp.setAll(1.0/((double) lambdaDyn[run1].getDim()));
-                 cp.lambdaDynamic.setDense( run1, 0, tmp );
-            }
-        }
-
         delete[] lambdaDyn;
         delete[] aux4;
     }
@@ -1291,6 +1673,9 @@ returnValue CondensingBasedCPsolver::initializeCondensingOperator( )
     T.setZero();
     d.setZero();
 
+    // (no sensitivities are known yet, i.e. all block rows will be computed)
+    dynGradient.init( N, 5 );
+
     if( getNX() != 0 ) T.setIdentity( 0, 0, getNX() );
     for( uint run1 = 0; run1 < N; run1++ ){
         if( getNXA() != 0 )        T.setIdentity(   N+run1,   1+run1, getNXA() );
@@ -1317,98 +1702,94 @@ returnValue CondensingBasedCPsolver::computeCondensingOperator(	BandedCP& cp
 	uint run1, run2;
 	uint N = getNumPoints();
 
-	Matrix  Gx;
-	Matrix   G;
-	Matrix tmp;
+	// (a block row of the condensing operator only has to be recomputed if
+	//  the sensitivities of its interval or the block row before changed)
+	BooleanType hasChanged = BT_FALSE;
 
 	for( run1 = 0; run1 < N-1; run1++ )
 	{
 			// DIFFERENTIAL STATES:
 			// --------------------
-			cp.dynGradient.getSubBlock( run1, 0,  Gx );   // Get the sensitivity G_x^i with respect to x
-			
+			const Matrix &Gx = cp.dynGradient.getSubBlock( run1, 0 );   // the sensitivity G_x^i with respect to x
+
 		if ( condensingStatus != COS_FROZEN )
 		{
-			T             .getSubBlock( run1, 0, tmp );   // get the corresponding  C_i .
+			if ( updateDynGradient( cp, run1 ) == BT_TRUE )
+				hasChanged = BT_TRUE;
+		}
 
-			T.setDense( run1+1, 0, Gx*tmp );		   // compute C_{i+1} := G_x^i * C_i
+		if ( ( condensingStatus != COS_FROZEN ) && ( hasChanged == BT_TRUE ) )
+		{
+			T.setDenseProduct( run1+1, 0, Gx, run1, 0 );   // compute C_{i+1} := G_x^i * C_i
 
 			// ALGEBRAIC STATES:
 			// --------------------
 
-			cp.dynGradient.getSubBlock( run1, 1, G );
-
-			for( run2 = 0; run2 <= run1; run2++ ){
+			const Matrix &Ga = cp.dynGradient.getSubBlock( run1, 1 );
 
-				T.getSubBlock( run1, run2+1, tmp );
+			if( Ga.getDim() != 0 ){
 
-				if( G.getDim() != 0 ){
+				for( run2 = 0; run2 < run1; run2++ )
+					T.setDenseProduct( run1+1, run2+1, Gx, run1, run2+1 );
 
-					if( run1 == run2 ) T.setDense( run1+1, run2+1, G      );
-					else               T.setDense( run1+1, run2+1, Gx*tmp );
-				}
+				T.setDense( run1+1, run1+1, Ga );
 			}
 
 			// PARAMETERS:
 			// --------------------
 
-			cp.dynGradient.getSubBlock( run1, 2  ,  G  ); // Get the sensitivity G_p^i with respect to p
-			T             .getSubBlock( run1, N+1, tmp ); // get the corresponding  D_p^i.
+			const Matrix &Gp = cp.dynGradient.getSubBlock( run1, 2 ); // the sensitivity G_p^i with respect to p
 
-			if( tmp.getDim() != 0 ){
-				if( G.getDim() != 0 )
-					T.setDense( run1+1, N+1, Gx*tmp + G );   // compute  D_p^{i+1} := G_x^i D_p^i + G_p^i
-			}
-			else{
-				if( G.getDim() != 0 )
-					T.setDense( run1+1, N+1,          G );   // compute  D_p^{i+1} := G_x^i D_p^i + G_p^i
+			if( Gp.getDim() != 0 ){
+
+				if( T.getSubBlock( run1, N+1 ).getDim() != 0 ){
+					T.setDenseProduct( run1+1, N+1, Gx, run1, N+1 );   // compute  D_p^{i+1} := G_x^i D_p^i + G_p^i
+					T.addDense( run1+1, N+1, Gp );
+				}
+				else
+					T.setDense( run1+1, N+1, Gp );
 			}
 
 			// CONTROLS:
 			// --------------------
 
-			cp.dynGradient.getSubBlock( run1, 3, G );
-			for( run2 = 0; run2 <= run1; run2++ ){
+			const Matrix &Gu = cp.dynGradient.getSubBlock( run1, 3 );
 
-				T.getSubBlock( run1, run2+2+N, tmp );
+			if( Gu.getDim() != 0 ){
 
-				if( G.getDim() != 0 ){
+				for( run2 = 0; run2 < run1; run2++ )
+					T.setDenseProduct( run1+1, run2+2+N, Gx, run1, run2+2+N );
 
-					if( run1 == run2 ) T.setDense( run1+1, run2+2+N, G      );
-					else               T.setDense( run1+1, run2+2+N, Gx*tmp );
-				}
+				T.setDense( run1+1, run1+2+N, Gu );
 			}
 
 			// DISTURBANCES:
 			// --------------------
 
-			cp.dynGradient.getSubBlock( run1, 4, G );
-
-			for( run2 = 0; run2 <= run1; run2++ ){
+			const Matrix &Gw = cp.dynGradient.getSubBlock( run1, 4 );
 
-				T.getSubBlock( run1, run2+1+2*N, tmp );
+			if( Gw.getDim() != 0 ){
 
-				if( G.getDim() != 0 ){
+				for( run2 = 0; run2 < run1; run2++ )
+					T.setDenseProduct( run1+1, run2+1+2*N, Gx, run1, run2+1+2*N );
 
-					if( run1 == run2 ) T.setDense( run1+1, run2+1+2*N, G      );
-					else               T.setDense( run1+1, run2+1+2*N, Gx*tmp );
-				}
+				T.setDense( run1+1, run1+1+2*N, Gw );
 			}
 		}
 
 		// RESIDUUM:
 		// --------------------
 
-		cp.dynResiduum.getSubBlock( run1, 0,  G  );   // Get the residuum  b^i
-		d             .getSubBlock( run1, 0, tmp );   // get the corresponding  d^i.
+		const Matrix &b = cp.dynResiduum.getSubBlock( run1, 0 );   // the residuum  b^i
 
-		if( tmp.getDim() != 0 ){
-			if( G.getDim() != 0 )
-				d.setDense( run1+1, 0, Gx*tmp + G );   // compute  d^{i+1} := G_x^i d^i + b^i
-		}
-		else{
-			if( G.getDim() != 0 )
-				d.setDense( run1+1, 0, G );   // compute  d^{i+1} := G_x^i d^i + b^i
+		if( b.getDim() != 0 ){
+
+			if( d.getSubBlock( run1, 0 ).getDim() != 0 ){
+				d.setDenseProduct( run1+1, 0, Gx, run1, 0 );   // compute  d^{i+1} := G_x^i d^i + b^i
+				d.addDense( run1+1, 0, b );
+			}
+			else
+				d.setDense( run1+1, 0, b );
 		}
 	}
 
@@ -1416,6 +1797,37 @@ returnValue CondensingBasedCPsolver::computeCondensingOperator(	BandedCP& cp
 }
 
 
+BooleanType CondensingBasedCPsolver::updateDynGradient(	const BandedCP& cp,
+														uint stage
+														)
+{
+	uint run1, run2, run3;
+	BooleanType hasChanged = BT_FALSE;
+
+	for( run1 = 0; run1 < 5; run1++ )
+	{
+		const Matrix &G    = cp.dynGradient.getSubBlock( stage, run1 );
+		const Matrix &Gold =    dynGradient.getSubBlock( stage, run1 );
+
+		BooleanType isEqual = BT_TRUE;
+
+		if( ( G.getNumRows() != Gold.getNumRows() ) || ( G.getNumCols() != Gold.getNumCols() ) )
+			isEqual = BT_FALSE;
+
+		for( run2 = 0; ( run2 < G.getNumRows() ) && ( isEqual == BT_TRUE ); run2++ )
+			for( run3 = 0; run3 < G.getNumCols(); run3++ )
+				if( G(run2,run3) != Gold(run2,run3) ) isEqual = BT_FALSE;
+
+		if( isEqual == BT_FALSE ){
+			dynGradient.setDense( stage, run1, G );
+			hasChanged = BT_TRUE;
+		}
+	}
+
+	return hasChanged;
+}
+
+
 
 returnValue CondensingBasedCPsolver::getRelaxedQPdimensions(	InfeasibleQPhandling infeasibleQPhandling,
 																uint& _nV,
@@ -1550,6 +1962,34 @@ returnValue CondensingBasedCPsolver::initializeCPsolver(	InfeasibleQPhandling in
 }
 
 
+returnValue CondensingBasedCPsolver::getConstraintBlockStage(	const BandedCP& cp,
+																uint block,
+																int& stage
+																) const
+{
+	const uint N = getNumPoints();
+
+	stage = -2;
+
+	for( uint run1 = 0; run1 < cp.constraintGradient.getNumCols(); run1++ ){
+
+		if( cp.constraintGradient.getNumRows( block,run1 ) == 0 ||
+			cp.constraintGradient.getNumCols( block,run1 ) == 0    ) continue;
+
+		if( stage == -2 )
+			stage = (int) (run1 % N);
+		else
+			if( stage != (int) (run1 % N) )
+				stage = -1;
+	}
+
+	if( stage == -2 )
+		stage = -1;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue CondensingBasedCPsolver::solveQP( uint maxIter ){
 
 	//denseCP.g.print( "g" );
@@ -79,6 +79,14 @@ DenseCPsolver& DenseCPsolver::operator=( const DenseCPsolver& rhs )
 }
 
 
+returnValue DenseCPsolver::shiftWorkingSet(	const int* const boundMap,
+											const int* const constraintMap
+											)
+{
+	return SUCCESSFUL_RETURN;
+}
+
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
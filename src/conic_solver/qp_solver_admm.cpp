@@ -0,0 +1,830 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+/**
+ *    \file src/conic_solver/qp_solver_admm.cpp
+ *    \author agent
+ *    \date   2026
+ */
+
+
+#include <acado/conic_solver/qp_solver_admm.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+static const double admmSigma          = 1.0e-6;	// regularisation of the primal variables
+static const double admmAlpha          = 1.6;		// relaxation parameter
+static const double admmRhoMin         = 1.0e-6;	// step size of rows without any bound
+static const double admmRhoMax         = 1.0e6;
+static const double admmRhoEqFactor    = 1.0e3;		// relative step size of equality rows
+static const double admmRhoInitial     = 1.0e-1;
+static const double admmRhoAdaptFactor = 5.0;		// step sizes are only changed by larger factors
+static const uint   admmCheckInterval  = 5;			// iterations between two residual checks
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+QPsolver_ADMM::QPsolver_ADMM( ) : DenseQPsolver( )
+{
+	setupOptions( );
+
+	nV = 0;
+	nC = 0;
+
+	x   = 0;
+	z   = 0;
+	y   = 0;
+	rho = 0;
+	rhoBar = admmRhoInitial;
+
+	L     = 0;
+	lastH = 0;
+	lastA = 0;
+
+	objVal = INFTY;
+}
+
+
+QPsolver_ADMM::QPsolver_ADMM( UserInteraction* _userInteraction ) : DenseQPsolver( _userInteraction )
+{
+	// setup options for stand-alone instances
+	if ( _userInteraction == 0 )
+		setupOptions( );
+
+	nV = 0;
+	nC = 0;
+
+	x   = 0;
+	z   = 0;
+	y   = 0;
+	rho = 0;
+	rhoBar = admmRhoInitial;
+
+	L     = 0;
+	lastH = 0;
+	lastA = 0;
+
+	objVal = INFTY;
+}
+
+
+QPsolver_ADMM::QPsolver_ADMM( const QPsolver_ADMM& rhs ) : DenseQPsolver( rhs )
+{
+	copyMemory( rhs );
+}
+
+
+QPsolver_ADMM::~QPsolver_ADMM( )
+{
+	clearMemory( );
+}
+
+
+QPsolver_ADMM& QPsolver_ADMM::operator=( const QPsolver_ADMM& rhs )
+{
+    if ( this != &rhs )
+    {
+		DenseQPsolver::operator=( rhs );
+
+		clearMemory( );
+		copyMemory( rhs );
+    }
+
+    return *this;
+}
+
+
+DenseCPsolver* QPsolver_ADMM::clone( ) const
+{
+	return new QPsolver_ADMM(*this);
+}
+
+
+DenseQPsolver* QPsolver_ADMM::cloneDenseQPsolver( ) const
+{
+	return new QPsolver_ADMM(*this);
+}
+
+
+returnValue QPsolver_ADMM::solve( DenseCP *cp_  )
+{
+    ASSERT( cp_ != 0 );
+
+    if( cp_->isQP() == BT_FALSE )
+        return ACADOERROR( RET_QP_SOLVER_CAN_ONLY_SOLVE_QP );
+
+    // first-order methods need far more iterations than the
+    // hard-coded limit of DenseQPsolver::solveCP
+    int maxIter = defaultMaxNumQPiterations;
+    get( MAX_NUM_QP_ITERATIONS,maxIter );
+
+    returnValue returnvalue;
+    returnvalue = solve( &cp_->H, &cp_->A, &cp_->g, &cp_->lb, &cp_->ub, &cp_->lbA, &cp_->ubA, (uint)maxIter );
+
+    if( returnvalue != SUCCESSFUL_RETURN )
+        return returnvalue;
+
+    Vector xOpt, yOpt;
+
+    getPrimalSolution( xOpt );
+    getDualSolution  ( yOpt );
+
+    cp_->setQPsolution( xOpt, yOpt );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue QPsolver_ADMM::solve(	const double* const H,
+									const double* const A,
+									const double* const g,
+									const double* const lb,
+									const double* const ub,
+									const double* const lbA,
+									const double* const ubA,
+									uint maxIter
+									)
+{
+	if ( x == 0 )
+		return ACADOERROR( RET_INITIALIZE_FIRST );
+
+	if ( ( H == 0 ) || ( g == 0 ) || ( ( A == 0 ) && ( nC > 0 ) ) )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	int    performHotstart = 0;
+	double tol     = defaultQPsolverTolerance;
+	double maxTime = defaultMaxQPsolverTime;
+
+	get( HOTSTART_QP,performHotstart );
+	get( QP_SOLVER_TOLERANCE,tol );
+	get( MAX_QP_SOLVER_TIME,maxTime );
+
+	double startTime = acadoGetTime( );
+
+	uint run1, run2;
+	const uint nZ = nV+nC;
+
+	qpStatus = QPS_SOLVING;
+	objVal   = INFTY;
+
+
+	// SETUP THE BOUNDS OF C*x = [x;A*x]:
+	// ----------------------------------
+	double* l = new double[nZ];
+	double* u = new double[nZ];
+
+	for( run1 = 0; run1 < nV; run1++ )
+	{
+		l[run1] = ( lb != 0 ) ? lb[run1] : -INFTY;
+		u[run1] = ( ub != 0 ) ? ub[run1] :  INFTY;
+	}
+	for( run1 = 0; run1 < nC; run1++ )
+	{
+		l[nV+run1] = ( lbA != 0 ) ? lbA[run1] : -INFTY;
+		u[nV+run1] = ( ubA != 0 ) ? ubA[run1] :  INFTY;
+	}
+
+
+	// START FROM THE LAST SOLUTION OR FROM ZERO:
+	// ------------------------------------------
+	if ( performHotstart != 1 )
+	{
+		for( run1 = 0; run1 < nV; run1++ )
+			x[run1] = 0.0;
+
+		for( run1 = 0; run1 < nZ; run1++ )
+		{
+			z[run1] = 0.0;
+			y[run1] = 0.0;
+		}
+	}
+
+
+	// (RE-)FACTORIZE ONLY IF THE MATRICES OR THE STEP SIZES HAVE CHANGED:
+	// -------------------------------------------------------------------
+	BooleanType haveStepSizesChanged = setupStepSizes( l,u );
+
+	if ( ( haveStepSizesChanged == BT_TRUE ) || ( isFactorizationValid( H,A ) == BT_FALSE ) )
+	{
+		if ( factorize( H,A ) != SUCCESSFUL_RETURN )
+		{
+			delete[] l;
+			delete[] u;
+			qpStatus = QPS_NOTSOLVED;
+			return ACADOERROR( RET_QP_SOLUTION_FAILED );
+		}
+	}
+
+
+	// ADMM ITERATIONS:
+	// ----------------
+	double* xTilde = new double[nV];
+	double* Hx     = new double[nV];
+	double* w      = new double[nZ];
+
+	BooleanType isConverged   = BT_FALSE;
+	BooleanType isOutOfTime   = BT_FALSE;
+	uint        nIter         = 0;
+
+	double zRelaxed, zNew;
+	double resPrimal, resDual, scalePrimal, scaleDual, ratio;
+
+	while ( ( nIter < maxIter ) && ( isConverged == BT_FALSE ) && ( isOutOfTime == BT_FALSE ) )
+	{
+		// solve the regularized KKT system for xTilde and compute zTilde = C*xTilde
+		for( run1 = 0; run1 < nZ; run1++ )
+			w[run1] = rho[run1]*z[run1] - y[run1];
+
+		multiplyCtransposed( A,w,xTilde );
+
+		for( run1 = 0; run1 < nV; run1++ )
+			xTilde[run1] += admmSigma*x[run1] - g[run1];
+
+		solveFactorized( xTilde );
+		multiplyC( A,xTilde,w );
+
+		// relaxed updates of the primal, the projected and the dual variables
+		for( run1 = 0; run1 < nV; run1++ )
+			x[run1] = admmAlpha*xTilde[run1] + (1.0-admmAlpha)*x[run1];
+
+		for( run1 = 0; run1 < nZ; run1++ )
+		{
+			zRelaxed = admmAlpha*w[run1] + (1.0-admmAlpha)*z[run1];
+
+			zNew = zRelaxed + y[run1]/rho[run1];
+			if ( zNew < l[run1] ) zNew = l[run1];
+			if ( zNew > u[run1] ) zNew = u[run1];
+
+			y[run1] += rho[run1]*( zRelaxed - zNew );
+			z[run1]  = zNew;
+		}
+
+		nIter++;
+
+		if ( ( nIter % admmCheckInterval == 0 ) || ( nIter == maxIter ) )
+		{
+			// primal residual |C*x - z| and dual residual |H*x + g + C'*y|
+			multiplyC( A,x,w );
+
+			resPrimal   = 0.0;
+			scalePrimal = 0.0;
+			for( run1 = 0; run1 < nZ; run1++ )
+			{
+				resPrimal   = acadoMax( resPrimal,   fabs( w[run1]-z[run1] ) );
+				scalePrimal = acadoMax( scalePrimal, acadoMax( fabs( w[run1] ),fabs( z[run1] ) ) );
+			}
+
+			multiplyCtransposed( A,y,xTilde );
+
+			resDual   = 0.0;
+			scaleDual = 0.0;
+			for( run1 = 0; run1 < nV; run1++ )
+			{
+				Hx[run1] = 0.0;
+				for( run2 = 0; run2 < nV; run2++ )
+					Hx[run1] += H[run1*nV+run2]*x[run2];
+
+				resDual   = acadoMax( resDual,   fabs( Hx[run1]+g[run1]+xTilde[run1] ) );
+				scaleDual = acadoMax( scaleDual, acadoMax( fabs( Hx[run1] ),fabs( xTilde[run1] ) ) );
+				scaleDual = acadoMax( scaleDual, fabs( g[run1] ) );
+			}
+
+			if ( ( resPrimal <= tol*( 1.0 + scalePrimal ) ) && ( resDual <= tol*( 1.0 + scaleDual ) ) )
+			{
+				isConverged = BT_TRUE;
+			}
+			else
+			{
+				// balance both residuals by adapting the step size of the inequalities
+				ratio = ( resPrimal / acadoMax( scalePrimal,EPS ) ) / acadoMax( resDual / acadoMax( scaleDual,EPS ),EPS );
+				ratio = sqrt( ratio );
+
+				if ( ( ratio > admmRhoAdaptFactor ) || ( ratio < 1.0/admmRhoAdaptFactor ) )
+				{
+					rhoBar = acadoMin( acadoMax( rhoBar*ratio,admmRhoMin ),admmRhoMax );
+
+					if ( setupStepSizes( l,u ) == BT_TRUE )
+					{
+						if ( factorize( H,A ) != SUCCESSFUL_RETURN )
+							break;
+					}
+				}
+			}
+		}
+
+		if ( ( maxTime > 0.0 ) && ( acadoGetTime( )-startTime >= maxTime ) )
+			isOutOfTime = BT_TRUE;
+	}
+
+	numberOfSteps = nIter;
+	setLast( LOG_NUM_QP_ITERATIONS, numberOfSteps );
+
+
+	// OBJECTIVE FUNCTION VALUE 1/2*x'*H*x + g'*x:
+	// -------------------------------------------
+	double tmp;
+	objVal = 0.0;
+	for( run1 = 0; run1 < nV; run1++ )
+	{
+		tmp = 0.0;
+		for( run2 = 0; run2 < nV; run2++ )
+			tmp += H[run1*nV+run2]*x[run2];
+
+		objVal += ( 0.5*tmp + g[run1] )*x[run1];
+	}
+
+	delete[] w;
+	delete[] Hx;
+	delete[] xTilde;
+	delete[] u;
+	delete[] l;
+
+
+	if ( isConverged == BT_TRUE )
+	{
+		qpStatus = QPS_SOLVED;
+		return SUCCESSFUL_RETURN;
+	}
+
+	qpStatus = QPS_NOTSOLVED;
+	objVal   = INFTY;
+
+	// an exhausted time budget is reported like an exhausted iteration limit
+	if ( ( nIter < maxIter ) && ( isOutOfTime == BT_FALSE ) )
+		return ACADOERROR( RET_QP_SOLUTION_FAILED );
+
+	return RET_QP_SOLUTION_REACHED_LIMIT;
+}
+
+
+returnValue QPsolver_ADMM::solve(	const Matrix *H,
+									const Matrix *A,
+									const Vector *g,
+									const Vector *lb,
+									const Vector *ub,
+									const Vector *lbA,
+									const Vector *ubA,
+									uint maxIter
+									)
+{
+    double* H_tmp   = 0;
+    double* A_tmp   = 0;
+    double* g_tmp   = 0;
+    double* lb_tmp  = 0;
+    double* ub_tmp  = 0;
+    double* lbA_tmp = 0;
+    double* ubA_tmp = 0;
+
+    returnValue returnvalue;
+	returnvalue = convertQPdata( 	H,A,g,lb,ub,lbA,ubA,
+									&H_tmp,&A_tmp,&g_tmp,&lb_tmp,&ub_tmp,&lbA_tmp,&ubA_tmp
+									);
+    returnvalue = solve( H_tmp,A_tmp,g_tmp,lb_tmp,ub_tmp,lbA_tmp,ubA_tmp,maxIter );
+
+    if( H_tmp   != 0 ) delete[] H_tmp  ;
+    if( A_tmp   != 0 ) delete[] A_tmp  ;
+    if( g_tmp   != 0 ) delete[] g_tmp  ;
+    if( lb_tmp  != 0 ) delete[] lb_tmp ;
+    if( ub_tmp  != 0 ) delete[] ub_tmp ;
+    if( lbA_tmp != 0 ) delete[] lbA_tmp;
+    if( ubA_tmp != 0 ) delete[] ubA_tmp;
+
+    return returnvalue;
+}
+
+
+returnValue QPsolver_ADMM::step(	const double* const H,
+									const double* const A,
+									const double* const g,
+									const double* const lb,
+									const double* const ub,
+									const double* const lbA,
+									const double* const ubA
+									)
+{
+	/* perform a single ADMM iteration */
+	return solve( H,A,g,lb,ub,lbA,ubA,1 );
+}
+
+
+returnValue QPsolver_ADMM::step(	const Matrix *H,
+									const Matrix *A,
+									const Vector *g,
+									const Vector *lb,
+									const Vector *ub,
+									const Vector *lbA,
+									const Vector *ubA
+									)
+{
+	/* perform a single ADMM iteration */
+	return solve( H,A,g,lb,ub,lbA,ubA,1 );
+}
+
+
+returnValue QPsolver_ADMM::getPrimalSolution( Vector& xOpt ) const
+{
+	if ( x == 0 )
+		return ACADOERROR( RET_INITIALIZE_FIRST );
+
+	if ( qpStatus != QPS_SOLVED )
+		return ACADOERROR( RET_QP_NOT_SOLVED );
+
+	xOpt.init( nV,x );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue QPsolver_ADMM::getDualSolution( Vector& yOpt ) const
+{
+	if ( y == 0 )
+		return ACADOERROR( RET_INITIALIZE_FIRST );
+
+	if ( qpStatus != QPS_SOLVED )
+		return ACADOERROR( RET_QP_NOT_SOLVED );
+
+	// ADMM multipliers have the opposite sign convention of qpOASES
+	yOpt.init( nV+nC );
+
+	for( uint run1 = 0; run1 < nV+nC; run1++ )
+		yOpt(run1) = -y[run1];
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+double QPsolver_ADMM::getObjVal( ) const
+{
+	return objVal;
+}
+
+
+uint QPsolver_ADMM::getNumberOfVariables( ) const
+{
+	return nV;
+}
+
+
+uint QPsolver_ADMM::getNumberOfConstraints( ) const
+{
+	return nC;
+}
+
+
+returnValue QPsolver_ADMM::getVarianceCovariance( Matrix &var )
+{
+	return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+}
+
+
+returnValue QPsolver_ADMM::getVarianceCovariance( Matrix &H, Matrix &var )
+{
+	return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue QPsolver_ADMM::setupOptions( )
+{
+	addOption( HOTSTART_QP           , defaultHotstartQP         );
+	addOption( MAX_NUM_QP_ITERATIONS , defaultMaxNumQPiterations );
+	addOption( QP_SOLVER_TOLERANCE   , defaultQPsolverTolerance  );
+	addOption( MAX_QP_SOLVER_TIME    , defaultMaxQPsolverTime    );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue QPsolver_ADMM::setupQPobject( uint nV_, uint nC_ )
+{
+	clearMemory( );
+
+	nV = nV_;
+	nC = nC_;
+
+	x   = new double[nV];
+	z   = new double[nV+nC];
+	y   = new double[nV+nC];
+	rho = new double[nV+nC];
+
+	uint run1;
+
+	for( run1 = 0; run1 < nV; run1++ )
+		x[run1] = 0.0;
+
+	// step sizes of zero enforce a factorization at the first solve
+	for( run1 = 0; run1 < nV+nC; run1++ )
+	{
+		z[run1]   = 0.0;
+		y[run1]   = 0.0;
+		rho[run1] = 0.0;
+	}
+	rhoBar = admmRhoInitial;
+
+	qpStatus = QPS_INITIALIZED;
+	objVal   = INFTY;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+BooleanType QPsolver_ADMM::isFactorizationValid(	const double* const H,
+													const double* const A
+													) const
+{
+	if ( ( L == 0 ) || ( lastH == 0 ) || ( lastA == 0 ) )
+		return BT_FALSE;
+
+	uint run1;
+
+	for( run1 = 0; run1 < nV*nV; run1++ )
+		if ( H[run1] != lastH[run1] )
+			return BT_FALSE;
+
+	for( run1 = 0; run1 < nC*nV; run1++ )
+		if ( A[run1] != lastA[run1] )
+			return BT_FALSE;
+
+	return BT_TRUE;
+}
+
+
+returnValue QPsolver_ADMM::factorize(	const double* const H,
+										const double* const A
+										)
+{
+	uint run1, run2, run3;
+
+	if ( L == 0 )
+		L = new double[nV*nV];
+
+	if ( lastH == 0 )
+		lastH = new double[nV*nV];
+
+	if ( lastA == 0 )
+		lastA = new double[nC*nV+1];
+
+	for( run1 = 0; run1 < nV*nV; run1++ )
+		lastH[run1] = H[run1];
+
+	for( run1 = 0; run1 < nC*nV; run1++ )
+		lastA[run1] = A[run1];
+
+
+	// ASSEMBLE THE LOWER TRIANGLE OF  H + sigma*I + C'*diag(rho)*C:
+	// -------------------------------------------------------------
+	for( run1 = 0; run1 < nV; run1++ )
+	{
+		for( run2 = 0; run2 <= run1; run2++ )
+			L[run1*nV+run2] = H[run1*nV+run2];
+
+		L[run1*nV+run1] += admmSigma + rho[run1];
+	}
+
+	for( run3 = 0; run3 < nC; run3++ )
+	{
+		const double* a = &(A[run3*nV]);
+
+		for( run1 = 0; run1 < nV; run1++ )
+		{
+			if ( a[run1] == 0.0 )
+				continue;
+
+			for( run2 = 0; run2 <= run1; run2++ )
+				L[run1*nV+run2] += rho[nV+run3]*a[run1]*a[run2];
+		}
+	}
+
+
+	// CHOLESKY FACTORIZATION (IN PLACE):
+	// ----------------------------------
+	double sum;
+
+	for( run2 = 0; run2 < nV; run2++ )
+	{
+		sum = L[run2*nV+run2];
+		for( run3 = 0; run3 < run2; run3++ )
+			sum -= L[run2*nV+run3]*L[run2*nV+run3];
+
+		if ( sum <= 0.0 )
+		{
+			// an invalid factor must not be reused
+			delete[] L;
+			L = 0;
+			return RET_QP_SOLUTION_FAILED;
+		}
+
+		L[run2*nV+run2] = sqrt( sum );
+
+		for( run1 = run2+1; run1 < nV; run1++ )
+		{
+			sum = L[run1*nV+run2];
+			for( run3 = 0; run3 < run2; run3++ )
+				sum -= L[run1*nV+run3]*L[run2*nV+run3];
+
+			L[run1*nV+run2] = sum / L[run2*nV+run2];
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+void QPsolver_ADMM::solveFactorized( double* const b ) const
+{
+	int run1, run2;
+	const int n = (int)nV;
+
+	// forward substitution with L
+	for( run1 = 0; run1 < n; run1++ )
+	{
+		for( run2 = 0; run2 < run1; run2++ )
+			b[run1] -= L[run1*n+run2]*b[run2];
+
+		b[run1] /= L[run1*n+run1];
+	}
+
+	// backward substitution with L'
+	for( run1 = n-1; run1 >= 0; run1-- )
+	{
+		for( run2 = run1+1; run2 < n; run2++ )
+			b[run1] -= L[run2*n+run1]*b[run2];
+
+		b[run1] /= L[run1*n+run1];
+	}
+}
+
+
+BooleanType QPsolver_ADMM::setupStepSizes(	const double* const l,
+											const double* const u
+											)
+{
+	BooleanType hasChanged = BT_FALSE;
+	double rhoNew;
+
+	for( uint run1 = 0; run1 < nV+nC; run1++ )
+	{
+		if ( ( l[run1] <= -INFTY ) && ( u[run1] >= INFTY ) )
+			rhoNew = admmRhoMin;
+		else
+		{
+			if ( u[run1] - l[run1] < BOUNDTOL )
+				rhoNew = admmRhoEqFactor*rhoBar;
+			else
+				rhoNew = rhoBar;
+		}
+
+		if ( rhoNew != rho[run1] )
+		{
+			rho[run1]  = rhoNew;
+			hasChanged = BT_TRUE;
+		}
+	}
+
+	return hasChanged;
+}
+
+
+void QPsolver_ADMM::multiplyC(	const double* const A,
+								const double* const v,
+								double* const Cv
+								) const
+{
+	uint run1, run2;
+
+	for( run1 = 0; run1 < nV; run1++ )
+		Cv[run1] = v[run1];
+
+	for( run1 = 0; run1 < nC; run1++ )
+	{
+		Cv[nV+run1] = 0.0;
+		for( run2 = 0; run2 < nV; run2++ )
+			Cv[nV+run1] += A[run1*nV+run2]*v[run2];
+	}
+}
+
+
+void QPsolver_ADMM::multiplyCtransposed(	const double* const A,
+											const double* const w,
+											double* const Ctw
+											) const
+{
+	uint run1, run2;
+
+	for( run1 = 0; run1 < nV; run1++ )
+		Ctw[run1] = w[run1];
+
+	for( run1 = 0; run1 < nC; run1++ )
+		for( run2 = 0; run2 < nV; run2++ )
+			Ctw[run2] += A[run1*nV+run2]*w[nV+run1];
+}
+
+
+void QPsolver_ADMM::clearMemory( )
+{
+	if ( x != 0 )     delete[] x;
+	if ( z != 0 )     delete[] z;
+	if ( y != 0 )     delete[] y;
+	if ( rho != 0 )   delete[] rho;
+	if ( L != 0 )     delete[] L;
+	if ( lastH != 0 ) delete[] lastH;
+	if ( lastA != 0 ) delete[] lastA;
+
+	x     = 0;
+	z     = 0;
+	y     = 0;
+	rho   = 0;
+	L     = 0;
+	lastH = 0;
+	lastA = 0;
+}
+
+
+void QPsolver_ADMM::copyMemory( const QPsolver_ADMM& rhs )
+{
+	uint run1;
+
+	nV     = rhs.nV;
+	nC     = rhs.nC;
+	rhoBar = rhs.rhoBar;
+	objVal = rhs.objVal;
+
+	x     = 0;
+	z     = 0;
+	y     = 0;
+	rho   = 0;
+	L     = 0;
+	lastH = 0;
+	lastA = 0;
+
+	if ( rhs.x != 0 )
+	{
+		x   = new double[nV];
+		z   = new double[nV+nC];
+		y   = new double[nV+nC];
+		rho = new double[nV+nC];
+
+		for( run1 = 0; run1 < nV; run1++ )
+			x[run1] = rhs.x[run1];
+
+		for( run1 = 0; run1 < nV+nC; run1++ )
+		{
+			z[run1]   = rhs.z[run1];
+			y[run1]   = rhs.y[run1];
+			rho[run1] = rhs.rho[run1];
+		}
+	}
+
+	if ( ( rhs.L != 0 ) && ( rhs.lastH != 0 ) && ( rhs.lastA != 0 ) )
+	{
+		L     = new double[nV*nV];
+		lastH = new double[nV*nV];
+		lastA = new double[nC*nV+1];
+
+		for( run1 = 0; run1 < nV*nV; run1++ )
+		{
+			L[run1]     = rhs.L[run1];
+			lastH[run1] = rhs.lastH[run1];
+		}
+
+		for( run1 = 0; run1 < nC*nV; run1++ )
+			lastA[run1] = rhs.lastA[run1];
+	}
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
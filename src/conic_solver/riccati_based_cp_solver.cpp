@@ -0,0 +1,1930 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/conic_solver/riccati_based_cp_solver.cpp
+ *    \author agent
+ *
+ */
+
+#include <acado/conic_solver/riccati_based_cp_solver.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+RiccatiBasedCPsolver::RiccatiBasedCPsolver( ) : BandedCPsolver( )
+{
+	nConstraints = 0;
+    blockDims = 0;
+
+    condensing = 0;
+
+    blockSize = 1;
+    nBlocks   = 0;
+
+    H = 0;  g = 0;  F = 0;  c = 0;  C = 0;  lbI = 0;  ubI = 0;
+
+    nStageConstraints = 0;
+    constraintStage   = 0;
+    constraintRow     = 0;
+
+    z  = 0;  lambda = 0;  yL = 0;  yU = 0;
+
+    T  = 0;  d  = 0;  blockSlot = 0;
+
+    Hb = 0;  gb = 0;  Fb = 0;  cb = 0;  Cb = 0;  lbIb = 0;  ubIb = 0;
+
+    zb = 0;  lambdab = 0;
+    tL = 0;  tU = 0;  yLb = 0;  yUb = 0;
+    P  = 0;  K  = 0;  L = 0;
+
+    nIterations = 0;
+    barrierParameter = 0.0;
+}
+
+
+RiccatiBasedCPsolver::RiccatiBasedCPsolver(	UserInteraction* _userInteraction,
+											uint nConstraints_,
+											const Vector& blockDims_
+											) : BandedCPsolver( _userInteraction )
+{
+	nConstraints = nConstraints_;
+    blockDims = blockDims_;
+
+    condensing = 0;
+
+    blockSize = 1;
+    nBlocks   = 0;
+
+    H = 0;  g = 0;  F = 0;  c = 0;  C = 0;  lbI = 0;  ubI = 0;
+
+    nStageConstraints = 0;
+    constraintStage   = 0;
+    constraintRow     = 0;
+
+    z  = 0;  lambda = 0;  yL = 0;  yU = 0;
+
+    T  = 0;  d  = 0;  blockSlot = 0;
+
+    Hb = 0;  gb = 0;  Fb = 0;  cb = 0;  Cb = 0;  lbIb = 0;  ubIb = 0;
+
+    zb = 0;  lambdab = 0;
+    tL = 0;  tU = 0;  yLb = 0;  yUb = 0;
+    P  = 0;  K  = 0;  L = 0;
+
+    nIterations = 0;
+    barrierParameter = 0.0;
+}
+
+
+RiccatiBasedCPsolver::RiccatiBasedCPsolver( const RiccatiBasedCPsolver& rhs )
+                     :BandedCPsolver( rhs )
+{
+	nConstraints = rhs.nConstraints;
+    blockDims    = rhs.blockDims;
+    iter         = rhs.iter;
+    blockSize    = rhs.blockSize;
+    nBlocks      = rhs.nBlocks;
+
+    barrierParameter = rhs.barrierParameter;
+
+    if( rhs.condensing != 0 ) condensing = (CondensingBasedCPsolver*) rhs.condensing->clone();
+    else                      condensing = 0;
+
+    copyStageMemory( rhs );
+
+	deltaX = rhs.deltaX;
+	deltaP = rhs.deltaP;
+}
+
+
+RiccatiBasedCPsolver::~RiccatiBasedCPsolver( ){
+
+    if( condensing != 0 ) delete condensing;
+    deleteStageMemory( );
+}
+
+
+RiccatiBasedCPsolver& RiccatiBasedCPsolver::operator=( const RiccatiBasedCPsolver& rhs ){
+
+    if ( this != &rhs ){
+
+        if( condensing != 0 ) delete condensing;
+        deleteStageMemory( );
+
+        BandedCPsolver::operator=( rhs );
+
+		nConstraints = rhs.nConstraints;
+		blockDims    = rhs.blockDims;
+		iter         = rhs.iter;
+		blockSize    = rhs.blockSize;
+		nBlocks      = rhs.nBlocks;
+
+		barrierParameter = rhs.barrierParameter;
+
+        if( rhs.condensing != 0 ) condensing = (CondensingBasedCPsolver*) rhs.condensing->clone();
+        else                      condensing = 0;
+
+        copyStageMemory( rhs );
+
+		deltaX = rhs.deltaX;
+		deltaP = rhs.deltaP;
+    }
+    return *this;
+}
+
+
+BandedCPsolver* RiccatiBasedCPsolver::clone() const
+{
+     return new RiccatiBasedCPsolver(*this);
+}
+
+
+
+returnValue RiccatiBasedCPsolver::init(	const OCPiterate &iter_
+										)
+{
+    if( condensing != 0 ) delete condensing;
+    condensing = 0;
+
+    deleteStageMemory( );
+
+    iter = iter_;
+
+
+    // ALGEBRAIC STATES AND PURE PARAMETER ESTIMATION PROBLEMS ARE CONDENSED:
+    // ----------------------------------------------------------------------
+    if( getNXA() > 0 || getNX() == 0 || getNumPoints() < 2 )
+        return initializeCondensing( );
+
+    get( CONDENSING_BLOCK_SIZE, blockSize );
+    if( blockSize < 1 ) blockSize = 1;
+
+    // (the terminal stage always forms a block on its own)
+    nBlocks = ( getNumPoints() + blockSize - 2 ) / blockSize + 1;
+
+    allocateStageMemory( );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue RiccatiBasedCPsolver::prepareSolve(	BandedCP& cp
+												)
+{
+	if ( condensing != 0 )
+		return condensing->prepareSolve( cp );
+
+    // SET UP THE MULTI-STAGE QP (OR SWITCH TO CONDENSING):
+    // ----------------------------------------------------
+	if ( ( setupStageStructure( cp ) == BT_FALSE ) || ( setupStageData( cp ) == BT_FALSE ) )
+	{
+		if ( initializeCondensing( ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_BANDED_CP_INIT_FAILED );
+
+		return condensing->prepareSolve( cp );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::solve(	BandedCP& cp
+										)
+{
+	if ( condensing != 0 )
+		return condensing->solve( cp );
+
+	uint run1, run2;
+	returnValue returnvalue;
+
+	if ( areRealTimeParametersDefined( ) == BT_FALSE )
+	{
+		returnvalue = prepareSolve( cp );
+		if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+		if ( condensing != 0 )
+			return condensing->solve( cp );
+	}
+
+
+    // ADD THE FEEDBACK DATA TO THE FIRST STAGE (IF SPECIFIED):
+    // --------------------------------------------------------
+
+	if ( deltaX.isEmpty( ) == BT_FALSE )
+	{
+		for( run1 = 0; run1 < getNX(); run1++ )
+		{
+			lbI[0](run1) = deltaX(run1);
+			ubI[0](run1) = deltaX(run1);
+		}
+	}
+
+	if ( deltaP.isEmpty( ) == BT_FALSE )
+	{
+		for( run1 = 0; run1 < getNP(); run1++ )
+		{
+			lbI[0](getNX()+run1) = deltaP(run1);
+			ubI[0](getNX()+run1) = deltaP(run1);
+		}
+	}
+
+
+    // PROJECT THE STAGE HESSIANS TO THE POSITIVE DEFINITE CONE IF NECESSARY:
+    // ----------------------------------------------------------------------
+    double hessianProjectionFactor;
+    get( HESSIAN_PROJECTION_FACTOR, hessianProjectionFactor );
+
+    for( run1 = 0; run1 < getNumPoints(); run1++ )
+        projectHessian( H[run1], hessianProjectionFactor );
+
+
+    // APPLY LEVENBERG-MARQUARD REGULARISATION IF DESIRED:
+    // (only to the variables that remain after condensing)
+    // ----------------------------------------------------
+    double levenbergMarquard;
+    get(LEVENBERG_MARQUARDT, levenbergMarquard );
+
+    if( levenbergMarquard > EPS ){
+
+        for( run1 = 0; run1 < getNX()+getNP(); run1++ )
+            H[0](run1,run1) += levenbergMarquard;
+
+        for( run1 = 0; run1 < getNumPoints()-1; run1++ )
+            for( run2 = getNX()+getNP(); run2 < getNZ(); run2++ )
+                H[run1](run2,run2) += levenbergMarquard;
+    }
+
+
+	// consistency check of Hessian matrices
+    for( run1 = 0; run1 < getNumPoints(); run1++ )
+        if ( ( H[run1].getMax( ) > 1.0e17 ) || ( H[run1].getMin( ) < -1.0e17 ) )
+            return RET_ILLFORMED_HESSIAN_MATRIX;
+
+
+    // SOLVE THE (PARTIALLY CONDENSED) MULTI-STAGE QP:
+    // -----------------------------------------------
+	RealClock clock;
+	clock.start( );
+
+	returnvalue = condenseStages( );
+
+	if( returnvalue == SUCCESSFUL_RETURN )
+		returnvalue = solveMultiStageQP( );
+
+	if( returnvalue == SUCCESSFUL_RETURN )
+		returnvalue = expandStages( );
+
+	clock.stop( );
+	setLast( LOG_TIME_QP,clock.getTime() );
+	setLast( LOG_TIME_RELAXED_QP,0.0 );
+	setLast( LOG_IS_QP_RELAXED, BT_FALSE );
+
+	if( returnvalue == RET_QP_SOLUTION_REACHED_LIMIT )
+		return RET_QP_SOLUTION_REACHED_LIMIT;
+
+	if( returnvalue != SUCCESSFUL_RETURN )
+		return RET_QP_SOLUTION_FAILED;
+
+
+	if ( areRealTimeParametersDefined( ) == BT_FALSE )
+		return finalizeSolve( cp );
+	else
+		return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::finalizeSolve(	BandedCP& cp
+													)
+{
+	if ( condensing != 0 )
+		return condensing->finalizeSolve( cp );
+
+    uint run1, run2;
+
+    const uint N  = getNumPoints();
+    const uint nx = getNX();
+    const uint np = getNP();
+    const uint nu = getNU();
+    const uint nw = getNW();
+    const uint nz = getNZ();
+
+    Matrix tmp;
+
+
+    // PRIMAL SOLUTION:
+    // (the controls of the last grid point are those of the last interval)
+    // --------------------------------------------------------------------
+    cp.deltaX.init( 5*N, 1 );
+
+    for( run1 = 0; run1 < N; run1++ ){
+
+        uint k = run1;
+        if( k == N-1 ) k = N-2;
+
+        tmp.init( nx, 1 );
+        for( run2 = 0; run2 < nx; run2++ ) tmp(run2,0) = z[run1](run2);
+        cp.deltaX.setDense( run1, 0, tmp );
+
+        if( np > 0 ){
+            tmp.init( np, 1 );
+            for( run2 = 0; run2 < np; run2++ ) tmp(run2,0) = z[0](nx+run2);
+            cp.deltaX.setDense( 2*N+run1, 0, tmp );
+        }
+        if( nu > 0 ){
+            tmp.init( nu, 1 );
+            for( run2 = 0; run2 < nu; run2++ ) tmp(run2,0) = z[k](nx+np+run2);
+            cp.deltaX.setDense( 3*N+run1, 0, tmp );
+        }
+        if( nw > 0 ){
+            tmp.init( nw, 1 );
+            for( run2 = 0; run2 < nw; run2++ ) tmp(run2,0) = z[k](nx+np+nu+run2);
+            cp.deltaX.setDense( 4*N+run1, 0, tmp );
+        }
+    }
+
+
+    // MULTIPLIERS OF THE DYNAMICS:
+    // ----------------------------
+    cp.lambdaDynamic.init( N-1, 1 );
+
+    for( run1 = 0; run1 < N-1; run1++ ){
+        tmp.init( nx, 1 );
+        for( run2 = 0; run2 < nx; run2++ ) tmp(run2,0) = lambda[run1](run2);
+        cp.lambdaDynamic.setDense( run1, 0, tmp );
+    }
+
+
+    // MULTIPLIERS OF THE CONSTRAINTS:
+    // -------------------------------
+    cp.lambdaConstraint.init( blockDims.getDim(), 1 );
+
+    int run = 0;
+    for( run1 = 0; run1 < blockDims.getDim(); run1++ ){
+        tmp.init( (int) blockDims(run1), 1 );
+
+        for( run2 = 0; run2 < blockDims(run1); run2++ ){
+            const int  stage = constraintStage[run+run2];
+            const uint idx   = nz + constraintRow[run+run2];
+            tmp(run2,0) = yL[stage](idx) - yU[stage](idx);
+        }
+        cp.lambdaConstraint.setDense( run1, 0, tmp );
+        run += (int) blockDims(run1);
+    }
+
+
+    // MULTIPLIERS OF THE BOUNDS:
+    // --------------------------
+    cp.lambdaBound.init( 4*N+1, 1 );
+
+    for( run1 = 0; run1 < N; run1++ ){
+        tmp.init( nx, 1 );
+        for( run2 = 0; run2 < nx; run2++ )
+            tmp(run2,0) = yL[run1](run2) - yU[run1](run2);
+        cp.lambdaBound.setDense( run1, 0, tmp );
+    }
+
+    if( np > 0 ){
+        tmp.init( np, 1 );
+        for( run2 = 0; run2 < np; run2++ )
+            tmp(run2,0) = yL[0](nx+run2) - yU[0](nx+run2);
+        cp.lambdaBound.setDense( 2*N, 0, tmp );
+    }
+
+    for( run1 = 0; run1 < N-1; run1++ ){
+        if( nu > 0 ){
+            tmp.init( nu, 1 );
+            for( run2 = 0; run2 < nu; run2++ )
+                tmp(run2,0) = yL[run1](nx+np+run2) - yU[run1](nx+np+run2);
+            cp.lambdaBound.setDense( 2*N+1+run1, 0, tmp );
+        }
+        if( nw > 0 ){
+            tmp.init( nw, 1 );
+            for( run2 = 0; run2 < nw; run2++ )
+                tmp(run2,0) = yL[run1](nx+np+nu+run2) - yU[run1](nx+np+nu+run2);
+            cp.lambdaBound.setDense( 3*N+1+run1, 0, tmp );
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue RiccatiBasedCPsolver::getParameters( Vector &p_  ) const
+{
+	if ( condensing != 0 )
+		return condensing->getParameters( p_ );
+
+	if ( p_.getDim( ) != getNP( ) )
+		return ACADOERROR( RET_INCOMPATIBLE_DIMENSIONS );
+
+	for( uint i=0; i<getNP(); ++i )
+		p_( i ) = z[0]( getNX()+i );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::getFirstControl( Vector &u0_ ) const
+{
+	if ( condensing != 0 )
+		return condensing->getFirstControl( u0_ );
+
+	if ( u0_.getDim( ) != getNU( ) )
+		return ACADOERROR( RET_INCOMPATIBLE_DIMENSIONS );
+
+	for( uint i=0; i<getNU(); ++i )
+		u0_( i ) = z[0]( getNX()+getNP()+i );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue RiccatiBasedCPsolver::getVarianceCovariance( Matrix &var )
+{
+	if ( condensing != 0 )
+		return condensing->getVarianceCovariance( var );
+
+	return BandedCPsolver::getVarianceCovariance( var );
+}
+
+
+
+returnValue RiccatiBasedCPsolver::setRealTimeParameters(	const Vector& DeltaX,
+															const Vector& DeltaP
+															)
+{
+	deltaX = DeltaX;
+	deltaP = DeltaP;
+
+	if ( condensing != 0 )
+		return condensing->setRealTimeParameters( DeltaX,DeltaP );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue RiccatiBasedCPsolver::freezeCondensing( )
+{
+	if ( condensing != 0 )
+		return condensing->freezeCondensing( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::unfreezeCondensing( )
+{
+	if ( condensing != 0 )
+		return condensing->unfreezeCondensing( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::setBarrierParameter(	double barrierParameter_
+														)
+{
+	if ( barrierParameter_ < 0.0 )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	barrierParameter = barrierParameter_;
+
+	if ( ( condensing != 0 ) && ( barrierParameter > 0.0 ) )
+		return RET_BARRIER_STEP_NOT_AVAILABLE;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::shiftWorkingSet(	const BandedCP& cp
+													)
+{
+	if ( condensing != 0 )
+		return condensing->shiftWorkingSet( cp );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void RiccatiBasedCPsolver::getStageCandidates( uint colIdx, int &first, int &second ) const{
+
+    const int N    = getNumPoints();
+    const int node = colIdx % N;
+
+    second = -1;
+
+    switch( colIdx / N ){
+
+        case 0:  first = node;  break;                  // differential states
+        case 2:  first = -2;    break;                  // parameters (constant states)
+
+        case 3:                                         // controls and disturbances
+        case 4:  first = node;
+                 if( node == N-1 ) second = N-2;
+                 break;
+
+        default: first = -1;    break;                  // algebraic states
+    }
+}
+
+
+BooleanType RiccatiBasedCPsolver::intersectStageCandidates( uint colIdx, int &first, int &second ) const{
+
+    int first1, second1;
+    getStageCandidates( colIdx, first1, second1 );
+
+    if( first1 == -2 ) return BT_TRUE;
+
+    if( first == -2 ){
+        first  = first1;
+        second = second1;
+        return BT_TRUE;
+    }
+
+    BooleanType hasFirst  = BT_FALSE;
+    BooleanType hasSecond = BT_FALSE;
+
+    if( first  >= 0 && ( first  == first1 || first  == second1 ) ) hasFirst  = BT_TRUE;
+    if( second >= 0 && ( second == first1 || second == second1 ) ) hasSecond = BT_TRUE;
+
+    if( hasFirst == BT_FALSE ){
+        if( hasSecond == BT_FALSE ) return BT_FALSE;
+        first = second;
+    }
+    if( hasFirst == BT_FALSE || hasSecond == BT_FALSE )
+        second = -1;
+
+    return BT_TRUE;
+}
+
+
+BooleanType RiccatiBasedCPsolver::setupStageStructure( const BandedCP& cp ){
+
+    uint run1, run2, run3, run4;
+
+    const uint N = getNumPoints();
+
+    for( run1 = 0; run1 < N; run1++ )
+        nStageConstraints[run1] = 0;
+
+
+    // ASSIGN EACH CONSTRAINT ROW TO THE STAGE OF ITS NONZERO ENTRIES:
+    // (the rows of one block may belong to different stages, e.g. for
+    //  boundary constraints at the start and the end of the horizon)
+    // ---------------------------------------------------------------
+    int run = 0;
+
+    for( run1 = 0; run1 < cp.constraintGradient.getNumRows(); run1++ ){
+
+        const uint nRows = (uint) blockDims(run1);
+
+        int *first  = new int[nRows];
+        int *second = new int[nRows];
+
+        for( run2 = 0; run2 < nRows; run2++ ){
+            first [run2] = -2;
+            second[run2] = -1;
+        }
+
+        BooleanType isSupported = BT_TRUE;
+
+        for( run3 = 0; run3 < cp.constraintGradient.getNumCols(); run3++ ){
+
+            if( cp.constraintGradient.getNumRows( run1,run3 ) == 0 ||
+                cp.constraintGradient.getNumCols( run1,run3 ) == 0    ) continue;
+
+            Matrix tmp;
+            cp.constraintGradient.getSubBlock( run1, run3, tmp );
+
+            for( run2 = 0; run2 < nRows; run2++ ){
+
+                for( run4 = 0; run4 < tmp.getNumCols(); run4++ )
+                    if( fabs( tmp(run2,run4) ) > 0.0 ) break;
+
+                if( run4 < tmp.getNumCols() )
+                    if( intersectStageCandidates( run3, first[run2], second[run2] ) == BT_FALSE )
+                        isSupported = BT_FALSE;
+            }
+        }
+
+        for( run2 = 0; run2 < nRows; run2++ ){
+
+            int stage = first[run2];
+            if( stage < 0 ) stage = 0;
+
+            constraintStage[run+run2] = stage;
+            constraintRow  [run+run2] = nStageConstraints[stage];
+            nStageConstraints[stage]++;
+        }
+
+        delete[] first;
+        delete[] second;
+
+        if( isSupported == BT_FALSE ) return BT_FALSE;
+
+        run += nRows;
+    }
+
+    return BT_TRUE;
+}
+
+
+BooleanType RiccatiBasedCPsolver::setupStageData( const BandedCP& cp ){
+
+    uint run1, run2, run3, run4;
+
+    const uint N  = getNumPoints();
+    const uint nx = getNX();
+    const uint np = getNP();
+    const uint nz = getNZ();
+
+    Matrix tmp;
+
+    for( run1 = 0; run1 < N; run1++ ){
+
+        H  [run1].init( nz, nz );
+        g  [run1].init( nz );
+        C  [run1].init( nStageConstraints[run1], nz );
+        lbI[run1].init( nz + nStageConstraints[run1] );
+        ubI[run1].init( nz + nStageConstraints[run1] );
+
+        H[run1].setZero();
+        g[run1].setZero();
+        C[run1].setZero();
+
+        lbI[run1].setAll( -INFTY );
+        ubI[run1].setAll(  INFTY );
+    }
+
+
+    // STAGE HESSIANS AND GRADIENTS:
+    // -----------------------------
+    BlockMatrix hessian;
+    cp.getHessian( hessian );
+
+    for( run1 = 0; run1 < 5*N; run1++ ){
+        for( run2 = 0; run2 < 5*N; run2++ ){
+
+            if( hessian.getNumRows( run1,run2 ) == 0 ||
+                hessian.getNumCols( run1,run2 ) == 0    ) continue;
+
+            hessian.getSubBlock( run1, run2, tmp );
+
+            int first = -2, second = -1;
+
+            if( intersectStageCandidates( run1, first, second ) == BT_FALSE ||
+                intersectStageCandidates( run2, first, second ) == BT_FALSE ){
+
+                if( tmp.isZero() == BT_TRUE ) continue;
+                return BT_FALSE;
+            }
+            if( first == -2 ) first = run1 % N;
+
+            const uint offset1 = getStageOffset( run1 );
+            const uint offset2 = getStageOffset( run2 );
+
+            for( run3 = 0; run3 < tmp.getNumRows(); run3++ )
+                for( run4 = 0; run4 < tmp.getNumCols(); run4++ )
+                    H[first](offset1+run3,offset2+run4) += tmp(run3,run4);
+        }
+    }
+
+    for( run2 = 0; run2 < cp.objectiveGradient.getNumCols(); run2++ ){
+
+        if( cp.objectiveGradient.getNumCols( 0,run2 ) == 0 ) continue;
+
+        int first, second;
+        getStageCandidates( run2, first, second );
+        if( first == -1 ) return BT_FALSE;
+        if( first == -2 ) first = run2 % N;
+
+        cp.objectiveGradient.getSubBlock( 0, run2, tmp );
+
+        const uint offset = getStageOffset( run2 );
+        for( run4 = 0; run4 < tmp.getNumCols(); run4++ )
+            g[first](offset+run4) += tmp(0,run4);
+    }
+
+
+    // STAGE DYNAMICS:
+    // (parameters are constant states; the controls and disturbances of the
+    //  last interval are carried over as states of the last stage)
+    // ----------------------------------------------------------------------
+    for( run1 = 0; run1 < N-1; run1++ ){
+
+        uint nNext = nx + np;
+        if( run1 == N-2 ) nNext = nz;
+
+        F[run1].init( nNext, nz );
+        c[run1].init( nNext );
+        F[run1].setZero();
+        c[run1].setZero();
+
+        for( run2 = 0; run2 < 5; run2++ ){
+
+            if( run2 == 1 ) continue;
+
+            cp.dynGradient.getSubBlock( run1, run2, tmp );
+            if( tmp.getDim() == 0 ) continue;
+
+            const uint offset = getStageOffset( run2*N );
+            for( run3 = 0; run3 < nx; run3++ )
+                for( run4 = 0; run4 < tmp.getNumCols(); run4++ )
+                    F[run1](run3,offset+run4) = tmp(run3,run4);
+        }
+
+        for( run3 = nx; run3 < nNext; run3++ )
+            F[run1](run3,run3) = 1.0;
+
+        cp.dynResiduum.getSubBlock( run1, 0, tmp );
+        if( tmp.getDim() != 0 )
+            for( run3 = 0; run3 < nx; run3++ )
+                c[run1](run3) = tmp(run3,0);
+    }
+
+
+    // STAGE BOUNDS:
+    // -------------
+    for( run1 = 0; run1 < N; run1++ ){
+
+        cp.lowerBoundResiduum.getSubBlock( run1, 0, tmp, nx, 1 );
+        for( run3 = 0; run3 < nx; run3++ ) lbI[run1](run3) = tmp(run3,0);
+        cp.upperBoundResiduum.getSubBlock( run1, 0, tmp, nx, 1 );
+        for( run3 = 0; run3 < nx; run3++ ) ubI[run1](run3) = tmp(run3,0);
+    }
+
+    if( np > 0 ){
+        cp.lowerBoundResiduum.getSubBlock( 2*N, 0, tmp, np, 1 );
+        for( run3 = 0; run3 < np; run3++ ) lbI[0](nx+run3) = tmp(run3,0);
+        cp.upperBoundResiduum.getSubBlock( 2*N, 0, tmp, np, 1 );
+        for( run3 = 0; run3 < np; run3++ ) ubI[0](nx+run3) = tmp(run3,0);
+    }
+
+    for( run1 = 0; run1 < N-1; run1++ ){
+        for( run2 = 3; run2 < 5; run2++ ){
+
+            const uint offset = getStageOffset( run2*N );
+
+            uint nv = getNU();
+            if( run2 == 4 ) nv = getNW();
+
+            if( nv == 0 ) continue;
+
+            cp.lowerBoundResiduum.getSubBlock( (run2-1)*N+1+run1, 0, tmp, nv, 1 );
+            for( run3 = 0; run3 < nv; run3++ ) lbI[run1](offset+run3) = tmp(run3,0);
+            cp.upperBoundResiduum.getSubBlock( (run2-1)*N+1+run1, 0, tmp, nv, 1 );
+            for( run3 = 0; run3 < nv; run3++ ) ubI[run1](offset+run3) = tmp(run3,0);
+        }
+    }
+
+
+    // STAGE CONSTRAINTS:
+    // ------------------
+    int run = 0;
+
+    for( run1 = 0; run1 < cp.constraintGradient.getNumRows(); run1++ ){
+
+        const uint nRows = (uint) blockDims(run1);
+
+        for( run3 = 0; run3 < cp.constraintGradient.getNumCols(); run3++ ){
+
+            if( cp.constraintGradient.getNumRows( run1,run3 ) == 0 ||
+                cp.constraintGradient.getNumCols( run1,run3 ) == 0    ) continue;
+
+            cp.constraintGradient.getSubBlock( run1, run3, tmp );
+
+            const uint offset = getStageOffset( run3 );
+
+            for( run2 = 0; run2 < nRows; run2++ ){
+
+                const int stage = constraintStage[run+run2];
+                const int row   = constraintRow  [run+run2];
+
+                for( run4 = 0; run4 < tmp.getNumCols(); run4++ )
+                    C[stage](row,offset+run4) += tmp(run2,run4);
+            }
+        }
+
+        cp.lowerConstraintResiduum.getSubBlock( run1, 0, tmp, nRows, 1 );
+        for( run2 = 0; run2 < nRows; run2++ )
+            lbI[constraintStage[run+run2]](nz+constraintRow[run+run2]) = tmp(run2,0);
+
+        cp.upperConstraintResiduum.getSubBlock( run1, 0, tmp, nRows, 1 );
+        for( run2 = 0; run2 < nRows; run2++ )
+            ubI[constraintStage[run+run2]](nz+constraintRow[run+run2]) = tmp(run2,0);
+
+        run += nRows;
+    }
+
+    return BT_TRUE;
+}
+
+
+void RiccatiBasedCPsolver::allocateStageMemory( ){
+
+    uint run1;
+
+    const uint N = getNumPoints();
+
+    H   = new Matrix[N];
+    g   = new Vector[N];
+    F   = new Matrix[N-1];
+    c   = new Vector[N-1];
+    C   = new Matrix[N];
+    lbI = new Vector[N];
+    ubI = new Vector[N];
+
+    nStageConstraints = new int[N];
+    constraintStage   = new int[nConstraints+1];
+    constraintRow     = new int[nConstraints+1];
+
+    z      = new Vector[N];
+    lambda = new Vector[N-1];
+    yL     = new Vector[N];
+    yU     = new Vector[N];
+
+    T         = new Matrix[N];
+    d         = new Vector[N];
+    blockSlot = new int*[N];
+
+    for( run1 = 0; run1 < N; run1++ )
+        blockSlot[run1] = 0;
+
+    Hb   = new Matrix[nBlocks];
+    gb   = new Vector[nBlocks];
+    Fb   = new Matrix[nBlocks];
+    cb   = new Vector[nBlocks];
+    Cb   = new Matrix[nBlocks];
+    lbIb = new Vector[nBlocks];
+    ubIb = new Vector[nBlocks];
+
+    zb      = new Vector[nBlocks];
+    lambdab = new Vector[nBlocks];
+    tL      = new Vector[nBlocks];
+    tU      = new Vector[nBlocks];
+    yLb     = new Vector[nBlocks];
+    yUb     = new Vector[nBlocks];
+    P       = new Matrix[nBlocks];
+    K       = new Matrix[nBlocks];
+    L       = new Matrix[nBlocks];
+
+    nIterations = 0;
+}
+
+
+void RiccatiBasedCPsolver::deleteStageMemory( ){
+
+    uint run1;
+
+    if( blockSlot != 0 ){
+        for( run1 = 0; run1 < getNumPoints(); run1++ )
+            if( blockSlot[run1] != 0 ) delete[] blockSlot[run1];
+        delete[] blockSlot;
+    }
+
+    if( H   != 0 ) delete[] H;
+    if( g   != 0 ) delete[] g;
+    if( F   != 0 ) delete[] F;
+    if( c   != 0 ) delete[] c;
+    if( C   != 0 ) delete[] C;
+    if( lbI != 0 ) delete[] lbI;
+    if( ubI != 0 ) delete[] ubI;
+
+    if( nStageConstraints != 0 ) delete[] nStageConstraints;
+    if( constraintStage   != 0 ) delete[] constraintStage;
+    if( constraintRow     != 0 ) delete[] constraintRow;
+
+    if( z      != 0 ) delete[] z;
+    if( lambda != 0 ) delete[] lambda;
+    if( yL     != 0 ) delete[] yL;
+    if( yU     != 0 ) delete[] yU;
+
+    if( T      != 0 ) delete[] T;
+    if( d      != 0 ) delete[] d;
+
+    if( Hb   != 0 ) delete[] Hb;
+    if( gb   != 0 ) delete[] gb;
+    if( Fb   != 0 ) delete[] Fb;
+    if( cb   != 0 ) delete[] cb;
+    if( Cb   != 0 ) delete[] Cb;
+    if( lbIb != 0 ) delete[] lbIb;
+    if( ubIb != 0 ) delete[] ubIb;
+
+    if( zb      != 0 ) delete[] zb;
+    if( lambdab != 0 ) delete[] lambdab;
+    if( tL      != 0 ) delete[] tL;
+    if( tU      != 0 ) delete[] tU;
+    if( yLb     != 0 ) delete[] yLb;
+    if( yUb     != 0 ) delete[] yUb;
+    if( P       != 0 ) delete[] P;
+    if( K       != 0 ) delete[] K;
+    if( L       != 0 ) delete[] L;
+
+    H = 0;  g = 0;  F = 0;  c = 0;  C = 0;  lbI = 0;  ubI = 0;
+
+    nStageConstraints = 0;
+    constraintStage   = 0;
+    constraintRow     = 0;
+
+    z  = 0;  lambda = 0;  yL = 0;  yU = 0;
+
+    T  = 0;  d  = 0;  blockSlot = 0;
+
+    Hb = 0;  gb = 0;  Fb = 0;  cb = 0;  Cb = 0;  lbIb = 0;  ubIb = 0;
+
+    zb = 0;  lambdab = 0;
+    tL = 0;  tU = 0;  yLb = 0;  yUb = 0;
+    P  = 0;  K  = 0;  L = 0;
+}
+
+
+void RiccatiBasedCPsolver::copyStageMemory( const RiccatiBasedCPsolver& rhs ){
+
+    uint run1, run2;
+
+    H = 0;  g = 0;  F = 0;  c = 0;  C = 0;  lbI = 0;  ubI = 0;
+
+    nStageConstraints = 0;
+    constraintStage   = 0;
+    constraintRow     = 0;
+
+    z  = 0;  lambda = 0;  yL = 0;  yU = 0;
+
+    T  = 0;  d  = 0;  blockSlot = 0;
+
+    Hb = 0;  gb = 0;  Fb = 0;  cb = 0;  Cb = 0;  lbIb = 0;  ubIb = 0;
+
+    zb = 0;  lambdab = 0;
+    tL = 0;  tU = 0;  yLb = 0;  yUb = 0;
+    P  = 0;  K  = 0;  L = 0;
+
+    nIterations = rhs.nIterations;
+    L0          = rhs.L0;
+
+    if( rhs.H == 0 ) return;
+
+    allocateStageMemory( );
+    nIterations = rhs.nIterations;
+
+    const uint N = getNumPoints();
+
+    for( run1 = 0; run1 < N; run1++ ){
+
+        H  [run1] = rhs.H  [run1];
+        g  [run1] = rhs.g  [run1];
+        C  [run1] = rhs.C  [run1];
+        lbI[run1] = rhs.lbI[run1];
+        ubI[run1] = rhs.ubI[run1];
+        z  [run1] = rhs.z  [run1];
+        yL [run1] = rhs.yL [run1];
+        yU [run1] = rhs.yU [run1];
+        T  [run1] = rhs.T  [run1];
+        d  [run1] = rhs.d  [run1];
+
+        nStageConstraints[run1] = rhs.nStageConstraints[run1];
+
+        if( rhs.blockSlot[run1] != 0 ){
+            blockSlot[run1] = new int[rhs.lbI[run1].getDim()];
+            for( run2 = 0; run2 < rhs.lbI[run1].getDim(); run2++ )
+                blockSlot[run1][run2] = rhs.blockSlot[run1][run2];
+        }
+    }
+
+    for( run1 = 0; run1 < N-1; run1++ ){
+
+        F     [run1] = rhs.F     [run1];
+        c     [run1] = rhs.c     [run1];
+        lambda[run1] = rhs.lambda[run1];
+    }
+
+    for( run1 = 0; run1 < nConstraints; run1++ ){
+
+        constraintStage[run1] = rhs.constraintStage[run1];
+        constraintRow  [run1] = rhs.constraintRow  [run1];
+    }
+
+    for( run1 = 0; run1 < nBlocks; run1++ ){
+
+        Hb  [run1] = rhs.Hb  [run1];
+        gb  [run1] = rhs.gb  [run1];
+        Fb  [run1] = rhs.Fb  [run1];
+        cb  [run1] = rhs.cb  [run1];
+        Cb  [run1] = rhs.Cb  [run1];
+        lbIb[run1] = rhs.lbIb[run1];
+        ubIb[run1] = rhs.ubIb[run1];
+
+        zb     [run1] = rhs.zb     [run1];
+        lambdab[run1] = rhs.lambdab[run1];
+        tL     [run1] = rhs.tL     [run1];
+        tU     [run1] = rhs.tU     [run1];
+        yLb    [run1] = rhs.yLb    [run1];
+        yUb    [run1] = rhs.yUb    [run1];
+        P      [run1] = rhs.P      [run1];
+        K      [run1] = rhs.K      [run1];
+        L      [run1] = rhs.L      [run1];
+    }
+}
+
+
+
+returnValue RiccatiBasedCPsolver::condenseStages( ){
+
+    uint run1, run2, run3, run4;
+
+    const uint   N        = getNumPoints();
+    const uint   ns       = getNX() + getNP();
+    const uint   nz       = getNZ();
+    const uint   nv       = nz - ns;
+    const double inactive = 0.5*INFTY;
+
+    Matrix tmp;
+
+    for( run1 = 0; run1 < nBlocks; run1++ ){
+
+        const uint first = getFirstBlockStage( run1 );
+        const uint last  = getLastBlockStage ( run1 );
+
+        const uint nS = getNumBlockStates( run1 );
+
+        uint nZ = nS;
+        for( run2 = first; run2 <= last; run2++ )
+            if( run2 < N-1 ) nZ += nv;
+
+
+        // CONDENSING OPERATORS z_k = T_k Z + d_k OF THE STAGES IN THE BLOCK:
+        // -----------------------------------------------------------------
+        for( run2 = first; run2 <= last; run2++ ){
+
+            T[run2].init( nz, nZ );
+            d[run2].init( nz );
+            T[run2].setZero();
+            d[run2].setZero();
+
+            if( run2 == first ){
+                for( run3 = 0; run3 < nS; run3++ )
+                    T[run2](run3,run3) = 1.0;
+            }
+            else{
+                tmp = F[run2-1]*T[run2-1];
+                Vector tmp2 = F[run2-1]*d[run2-1] + c[run2-1];
+
+                for( run3 = 0; run3 < tmp.getNumRows(); run3++ ){
+                    d[run2](run3) = tmp2(run3);
+                    for( run4 = 0; run4 < nZ; run4++ )
+                        T[run2](run3,run4) = tmp(run3,run4);
+                }
+            }
+
+            if( run2 < N-1 )
+                for( run3 = 0; run3 < nv; run3++ )
+                    T[run2](ns+run3,ns+(run2-first)*nv+run3) = 1.0;
+        }
+
+
+        // BLOCK OBJECTIVE AND DYNAMICS:
+        // -----------------------------
+        Hb[run1].init( nZ, nZ );
+        gb[run1].init( nZ );
+        Hb[run1].setZero();
+        gb[run1].setZero();
+
+        for( run2 = first; run2 <= last; run2++ ){
+
+            Hb[run1] += T[run2]^( H[run2]*T[run2] );
+            gb[run1] += T[run2]^( H[run2]*d[run2] + g[run2] );
+        }
+
+        if( run1 < nBlocks-1 ){
+            Fb[run1] = F[last]*T[last];
+            cb[run1] = F[last]*d[last] + c[last];
+        }
+
+
+        // BLOCK INEQUALITIES: THE BOUNDS OF THE BLOCK VARIABLES ARE KEPT AS
+        // BOUNDS, ALL OTHER (FINITE) BOUNDS AND CONSTRAINTS BECOME ROWS:
+        // ------------------------------------------------------------------
+        uint nRows = 0;
+
+        for( run2 = first; run2 <= last; run2++ ){
+
+            if( blockSlot[run2] != 0 ) delete[] blockSlot[run2];
+            blockSlot[run2] = new int[lbI[run2].getDim()];
+
+            for( run3 = 0; run3 < lbI[run2].getDim(); run3++ ){
+
+                blockSlot[run2][run3] = -1;
+
+                if( run3 < nz && run2 == first && run3 < nS )
+                    blockSlot[run2][run3] = run3;
+                else if( run3 < nz && run2 < N-1 && run3 >= ns )
+                    blockSlot[run2][run3] = ns + (run2-first)*nv + run3-ns;
+                else if( lbI[run2](run3) > -inactive || ubI[run2](run3) < inactive )
+                    blockSlot[run2][run3] = nZ + nRows++;
+            }
+        }
+
+        Cb  [run1].init( nRows, nZ );
+        lbIb[run1].init( nZ + nRows );
+        ubIb[run1].init( nZ + nRows );
+
+        for( run2 = first; run2 <= last; run2++ ){
+            for( run3 = 0; run3 < lbI[run2].getDim(); run3++ ){
+
+                const int slot = blockSlot[run2][run3];
+                if( slot < 0 ) continue;
+
+                if( slot < (int) nZ ){
+                    lbIb[run1](slot) = lbI[run2](run3);
+                    ubIb[run1](slot) = ubI[run2](run3);
+                    continue;
+                }
+
+                double offset = 0.0;
+
+                if( run3 < nz ){
+                    offset = d[run2](run3);
+                    for( run4 = 0; run4 < nZ; run4++ )
+                        Cb[run1](slot-nZ,run4) = T[run2](run3,run4);
+                }
+                else{
+                    for( run4 = 0; run4 < nz; run4++ )
+                        offset += C[run2](run3-nz,run4)*d[run2](run4);
+                    for( run4 = 0; run4 < nZ; run4++ ){
+                        Cb[run1](slot-nZ,run4) = 0.0;
+                        for( uint run5 = 0; run5 < nz; run5++ )
+                            Cb[run1](slot-nZ,run4) += C[run2](run3-nz,run5)*T[run2](run5,run4);
+                    }
+                }
+
+                lbIb[run1](slot) = lbI[run2](run3);
+                ubIb[run1](slot) = ubI[run2](run3);
+
+                if( lbI[run2](run3) > -inactive ) lbIb[run1](slot) -= offset;
+                if( ubI[run2](run3) <  inactive ) ubIb[run1](slot) -= offset;
+            }
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::expandStages( ){
+
+    uint run1, run2, run3;
+
+    const uint N  = getNumPoints();
+    const uint nz = getNZ();
+
+    for( run1 = 0; run1 < nBlocks; run1++ ){
+
+        const uint first = getFirstBlockStage( run1 );
+        const uint last  = getLastBlockStage ( run1 );
+
+
+        // PRIMAL SOLUTION AND MULTIPLIERS OF THE INEQUALITIES:
+        // ----------------------------------------------------
+        for( run2 = first; run2 <= last; run2++ ){
+
+            z[run2] = T[run2]*zb[run1] + d[run2];
+
+            yL[run2].init( lbI[run2].getDim() );
+            yU[run2].init( lbI[run2].getDim() );
+
+            for( run3 = 0; run3 < lbI[run2].getDim(); run3++ ){
+
+                yL[run2](run3) = 0.0;
+                yU[run2](run3) = 0.0;
+
+                if( blockSlot[run2][run3] >= 0 ){
+                    yL[run2](run3) = yLb[run1]( blockSlot[run2][run3] );
+                    yU[run2](run3) = yUb[run1]( blockSlot[run2][run3] );
+                }
+            }
+        }
+
+
+        // MULTIPLIERS OF THE CONDENSED DYNAMICS (BACKWARD RECURSION):
+        // -----------------------------------------------------------
+        if( run1 < nBlocks-1 )
+            lambda[last] = lambdab[run1];
+
+        for( run2 = last; run2 > first; run2-- ){
+
+            Vector r = H[run2]*z[run2] + g[run2];
+
+            if( run2 < N-1 )
+                r += F[run2]^lambda[run2];
+
+            for( run3 = 0; run3 < lbI[run2].getDim(); run3++ ){
+
+                const double y = yL[run2](run3) - yU[run2](run3);
+                if( y == 0.0 ) continue;
+
+                if( run3 < nz ) r(run3) -= y;
+                else for( uint run4 = 0; run4 < nz; run4++ ) r(run4) -= C[run2](run3-nz,run4)*y;
+            }
+
+            lambda[run2-1].init( F[run2-1].getNumRows() );
+            for( run3 = 0; run3 < F[run2-1].getNumRows(); run3++ )
+                lambda[run2-1](run3) = r(run3);
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue RiccatiBasedCPsolver::solveMultiStageQP( ){
+
+    uint run1, run2, run3, run4;
+
+    const double inactive = 0.5*INFTY;
+
+    int maxNumIterations;
+    get( MAX_NUM_QP_ITERATIONS, maxNumIterations );
+
+    double maxTime;
+    get( MAX_QP_SOLVER_TIME, maxTime );
+
+    const double startTime = acadoGetTime( );
+
+    Matrix *Ht  = new Matrix[nBlocks];
+    Vector *rz  = new Vector[nBlocks];
+    Vector *q   = new Vector[nBlocks];
+    Vector *rd  = new Vector[nBlocks-1];
+    Vector *dz  = new Vector[nBlocks];
+    Vector *dl  = new Vector[nBlocks-1];
+    Vector *rL  = new Vector[nBlocks];
+    Vector *rU  = new Vector[nBlocks];
+    Vector *rcL = new Vector[nBlocks];
+    Vector *rcU = new Vector[nBlocks];
+    Vector *dtL = new Vector[nBlocks];
+    Vector *dtU = new Vector[nBlocks];
+    Vector *dyL = new Vector[nBlocks];
+    Vector *dyU = new Vector[nBlocks];
+
+
+    // INFEASIBLE STARTING POINT AT THE LINEARIZATION POINT:
+    // (equalities carry their multiplier in yL and have no slacks)
+    // ------------------------------------------------------------
+    double scale = 1.0;
+    int    nActive = 0;
+
+    // (a barrier step starts from the slacks of the linearization point
+    //  and from the multipliers of the last step)
+    const BooleanType isBarrierStep = ( barrierParameter > 0.0 ) ? BT_TRUE : BT_FALSE;
+
+    for( run1 = 0; run1 < nBlocks; run1++ ){
+
+        const uint nI = lbIb[run1].getDim();
+        const uint nz = Hb[run1].getNumRows();
+
+        zb[run1].init( nz );
+        zb[run1].setZero();
+
+        const BooleanType isWarm = ( isBarrierStep == BT_TRUE && yLb[run1].getDim() == nI ) ? BT_TRUE : BT_FALSE;
+
+        if( isWarm == BT_FALSE ){
+            yLb[run1].init( nI );
+            yUb[run1].init( nI );
+        }
+
+        tL[run1].init( nI );  rL[run1].init( nI );  rcL[run1].init( nI );
+        tU[run1].init( nI );  rU[run1].init( nI );  rcU[run1].init( nI );
+
+        for( run2 = 0; run2 < nI; run2++ ){
+
+            const double yL0 = ( isWarm == BT_TRUE ) ? yLb[run1](run2) : 0.0;
+            const double yU0 = ( isWarm == BT_TRUE ) ? yUb[run1](run2) : 0.0;
+
+            tL[run1](run2) = 1.0;  yLb[run1](run2) = 0.0;  rcL[run1](run2) = 0.0;
+            tU[run1](run2) = 1.0;  yUb[run1](run2) = 0.0;  rcU[run1](run2) = 0.0;
+
+            if( isEquality( run1,run2 ) == BT_TRUE ){
+                yLb[run1](run2) = yL0;
+                continue;
+            }
+
+            if( isBarrierStep == BT_TRUE ){
+
+                if( lbIb[run1](run2) > -inactive ){
+                    tL[run1](run2) = -lbIb[run1](run2);
+                    if( tL[run1](run2) < barrierParameter ) tL[run1](run2) = barrierParameter;
+                    yLb[run1](run2) = ( yL0 > 0.0 ) ? yL0 : barrierParameter/tL[run1](run2);
+                    nActive++;
+                }
+                if( ubIb[run1](run2) < inactive ){
+                    tU[run1](run2) = ubIb[run1](run2);
+                    if( tU[run1](run2) < barrierParameter ) tU[run1](run2) = barrierParameter;
+                    yUb[run1](run2) = ( yU0 > 0.0 ) ? yU0 : barrierParameter/tU[run1](run2);
+                    nActive++;
+                }
+                continue;
+            }
+
+            if( lbIb[run1](run2) > -inactive ){
+                if( -lbIb[run1](run2) > 1.0 ) tL[run1](run2) = -lbIb[run1](run2);
+                yLb[run1](run2) = 1.0;
+                nActive++;
+            }
+            if( ubIb[run1](run2) < inactive ){
+                if( ubIb[run1](run2) > 1.0 ) tU[run1](run2) = ubIb[run1](run2);
+                yUb[run1](run2) = 1.0;
+                nActive++;
+            }
+        }
+
+        for( run2 = 0; run2 < nz; run2++ )
+            if( fabs( gb[run1](run2) ) > scale ) scale = fabs( gb[run1](run2) );
+    }
+
+    for( run1 = 0; run1 < nBlocks-1; run1++ ){
+
+        lambdab[run1].init( cb[run1].getDim() );
+        lambdab[run1].setZero();
+
+        for( run2 = 0; run2 < cb[run1].getDim(); run2++ )
+            if( fabs( cb[run1](run2) ) > scale ) scale = fabs( cb[run1](run2) );
+    }
+
+    // (the round-off level of the condensed blocks grows with their Hessians)
+    for( run1 = 0; run1 < nBlocks; run1++ )
+        for( run2 = 0; run2 < Hb[run1].getNumRows(); run2++ )
+            if( fabs( Hb[run1](run2,run2) ) > scale ) scale = fabs( Hb[run1](run2,run2) );
+    const double tolerance      = 1.0e-12*scale;
+    const double regularisation = 1.0e8*scale;
+
+
+    // PRIMAL-DUAL INTERIOR POINT ITERATIONS (MEHROTRA PREDICTOR-CORRECTOR):
+    // (if the barrier terms get numerically singular before the tolerance
+    //  is met, an iterate within a relaxed tolerance is accepted)
+    // ---------------------------------------------------------------------
+    returnValue returnvalue  = RET_QP_SOLUTION_FAILED;
+    BooleanType isAcceptable = BT_FALSE;
+
+    for( nIterations = 0; nIterations < maxNumIterations; nIterations++ ){
+
+        double residuum = 0.0;
+        double mu       = 0.0;
+
+        // residuum of the stationarity conditions:
+        for( run1 = 0; run1 < nBlocks; run1++ ){
+
+            const uint nz = Hb[run1].getNumRows();
+
+            rz[run1] = Hb[run1]*zb[run1] + gb[run1];
+
+            if( run1 < nBlocks-1 )
+                rz[run1] += Fb[run1]^lambdab[run1];
+
+            if( run1 > 0 )
+                for( run2 = 0; run2 < lambdab[run1-1].getDim(); run2++ )
+                    rz[run1](run2) -= lambdab[run1-1](run2);
+
+            for( run2 = 0; run2 < lbIb[run1].getDim(); run2++ ){
+
+                const double y = yLb[run1](run2) - yUb[run1](run2);
+                if( y == 0.0 ) continue;
+
+                if( run2 < nz ) rz[run1](run2) -= y;
+                else for( run3 = 0; run3 < nz; run3++ ) rz[run1](run3) -= Cb[run1](run2-nz,run3)*y;
+            }
+
+            for( run2 = 0; run2 < nz; run2++ )
+                if( fabs( rz[run1](run2) ) > residuum ) residuum = fabs( rz[run1](run2) );
+        }
+
+        // residuum of the dynamics:
+        for( run1 = 0; run1 < nBlocks-1; run1++ ){
+
+            rd[run1] = Fb[run1]*zb[run1] + cb[run1];
+
+            for( run2 = 0; run2 < rd[run1].getDim(); run2++ ){
+                rd[run1](run2) -= zb[run1+1](run2);
+                if( fabs( rd[run1](run2) ) > residuum ) residuum = fabs( rd[run1](run2) );
+            }
+        }
+
+        // residuum of the inequalities and complementarity measure:
+        for( run1 = 0; run1 < nBlocks; run1++ ){
+            for( run2 = 0; run2 < lbIb[run1].getDim(); run2++ ){
+
+                const double value = getInequalityValue( run1, run2, zb[run1] );
+
+                rL[run1](run2) = 0.0;
+                rU[run1](run2) = 0.0;
+
+                if( isEquality( run1,run2 ) == BT_TRUE ){
+                    rL[run1](run2) = value - lbIb[run1](run2);
+                    if( fabs( rL[run1](run2) ) > residuum ) residuum = fabs( rL[run1](run2) );
+                    continue;
+                }
+
+                if( lbIb[run1](run2) > -inactive ){
+                    rL[run1](run2) = value - lbIb[run1](run2) - tL[run1](run2);
+                    mu += tL[run1](run2)*yLb[run1](run2);
+                    if( fabs( rL[run1](run2) ) > residuum ) residuum = fabs( rL[run1](run2) );
+                }
+                if( ubIb[run1](run2) < inactive ){
+                    rU[run1](run2) = ubIb[run1](run2) - value - tU[run1](run2);
+                    mu += tU[run1](run2)*yUb[run1](run2);
+                    if( fabs( rU[run1](run2) ) > residuum ) residuum = fabs( rU[run1](run2) );
+                }
+            }
+        }
+
+        if( nActive > 0 ) mu /= (double) nActive;
+
+        if( acadoIsFinite( residuum ) == BT_FALSE || acadoIsFinite( mu ) == BT_FALSE ){
+            returnvalue = RET_QP_SOLUTION_FAILED;
+            break;
+        }
+
+        if( isBarrierStep == BT_FALSE && residuum <= tolerance && mu <= tolerance ){
+            returnvalue = SUCCESSFUL_RETURN;
+            break;
+        }
+
+        if( residuum <= 1.0e4*tolerance && mu <= 1.0e4*tolerance ) isAcceptable = BT_TRUE;
+        else                                                       isAcceptable = BT_FALSE;
+
+        // (once the duality gap is closed, the remaining residuum of an
+        //  acceptable iterate is at the round-off level of the condensing)
+        if( isBarrierStep == BT_FALSE && isAcceptable == BT_TRUE && mu <= tolerance ){
+            returnvalue = SUCCESSFUL_RETURN;
+            break;
+        }
+
+        // (an exhausted time budget is reported like an exhausted
+        //  iteration limit; an acceptable iterate is still accepted)
+        if( maxTime > 0.0 && acadoGetTime( ) - startTime > maxTime ){
+            returnvalue = RET_QP_SOLUTION_REACHED_LIMIT;
+            break;
+        }
+
+
+        // condensed barrier Hessians:
+        for( run1 = 0; run1 < nBlocks; run1++ ){
+
+            const uint nz = Hb[run1].getNumRows();
+
+            Ht[run1] = Hb[run1];
+
+            for( run2 = 0; run2 < lbIb[run1].getDim(); run2++ ){
+
+                double weight = yLb[run1](run2)/tL[run1](run2) + yUb[run1](run2)/tU[run1](run2);
+                if( isEquality( run1,run2 ) == BT_TRUE ) weight = regularisation;
+                if( weight == 0.0 ) continue;
+
+                if( run2 < nz ) Ht[run1](run2,run2) += weight;
+                else
+                    for( run3 = 0; run3 < nz; run3++ )
+                        for( run4 = 0; run4 < nz; run4++ )
+                            Ht[run1](run3,run4) += Cb[run1](run2-nz,run3)*weight*Cb[run1](run2-nz,run4);
+            }
+        }
+
+        returnvalue = factorizeKKTsystem( Ht );
+        if( returnvalue != SUCCESSFUL_RETURN ) break;
+
+
+        // predictor (run4 == 0) and corrector (run4 == 1) step:
+        // (a barrier step is a single Newton step towards the central
+        //  path point of the given barrier parameter)
+        double alpha = 1.0;
+
+        for( run1 = 0; run1 < nBlocks; run1++ ){
+            for( run2 = 0; run2 < lbIb[run1].getDim(); run2++ ){
+
+                rcL[run1](run2) = -tL[run1](run2)*yLb[run1](run2);
+                rcU[run1](run2) = -tU[run1](run2)*yUb[run1](run2);
+
+                if( isBarrierStep == BT_FALSE || isEquality( run1,run2 ) == BT_TRUE ) continue;
+
+                if( lbIb[run1](run2) > -inactive ) rcL[run1](run2) += barrierParameter;
+                if( ubIb[run1](run2) <  inactive ) rcU[run1](run2) += barrierParameter;
+            }
+        }
+
+        for( run4 = 0; run4 < 2; run4++ ){
+
+            for( run1 = 0; run1 < nBlocks; run1++ ){
+
+                const uint nz = Hb[run1].getNumRows();
+
+                q[run1] = rz[run1];
+
+                for( run2 = 0; run2 < lbIb[run1].getDim(); run2++ ){
+
+                    double w;
+
+                    if( isEquality( run1,run2 ) == BT_TRUE )
+                        w = -regularisation*rL[run1](run2);
+                    else
+                        w = ( rcL[run1](run2) - yLb[run1](run2)*rL[run1](run2) )/tL[run1](run2)
+                          - ( rcU[run1](run2) - yUb[run1](run2)*rU[run1](run2) )/tU[run1](run2);
+
+                    if( w == 0.0 ) continue;
+
+                    if( run2 < nz ) q[run1](run2) -= w;
+                    else for( run3 = 0; run3 < nz; run3++ ) q[run1](run3) -= Cb[run1](run2-nz,run3)*w;
+                }
+            }
+
+            returnvalue = solveKKTsystem( q, rd, dz, dl );
+            if( returnvalue != SUCCESSFUL_RETURN ) break;
+
+            alpha = 1.0;
+
+            for( run1 = 0; run1 < nBlocks; run1++ ){
+
+                const uint nI = lbIb[run1].getDim();
+
+                dtL[run1].init( nI );  dyL[run1].init( nI );
+                dtU[run1].init( nI );  dyU[run1].init( nI );
+
+                for( run2 = 0; run2 < nI; run2++ ){
+
+                    const double av = getInequalityValue( run1, run2, dz[run1] );
+
+                    dtL[run1](run2) = 0.0;  dyL[run1](run2) = 0.0;
+                    dtU[run1](run2) = 0.0;  dyU[run1](run2) = 0.0;
+
+                    if( isEquality( run1,run2 ) == BT_TRUE ){
+                        dyL[run1](run2) = -regularisation*( av + rL[run1](run2) );
+                        continue;
+                    }
+
+                    if( lbIb[run1](run2) > -inactive ){
+                        dtL[run1](run2) = av + rL[run1](run2);
+                        dyL[run1](run2) = ( rcL[run1](run2) - yLb[run1](run2)*dtL[run1](run2) )/tL[run1](run2);
+                        if( dtL[run1](run2) < 0.0 && -tL[run1](run2)/dtL[run1](run2) < alpha ) alpha = -tL[run1](run2)/dtL[run1](run2);
+                        if( dyL[run1](run2) < 0.0 && -yLb[run1](run2)/dyL[run1](run2) < alpha ) alpha = -yLb[run1](run2)/dyL[run1](run2);
+                    }
+                    if( ubIb[run1](run2) < inactive ){
+                        dtU[run1](run2) = rU[run1](run2) - av;
+                        dyU[run1](run2) = ( rcU[run1](run2) - yUb[run1](run2)*dtU[run1](run2) )/tU[run1](run2);
+                        if( dtU[run1](run2) < 0.0 && -tU[run1](run2)/dtU[run1](run2) < alpha ) alpha = -tU[run1](run2)/dtU[run1](run2);
+                        if( dyU[run1](run2) < 0.0 && -yUb[run1](run2)/dyU[run1](run2) < alpha ) alpha = -yUb[run1](run2)/dyU[run1](run2);
+                    }
+                }
+            }
+
+            if( run4 == 1 || nActive == 0 || isBarrierStep == BT_TRUE ) break;
+
+            // centering parameter from the affine scaling step:
+            double muAffine = 0.0;
+
+            for( run1 = 0; run1 < nBlocks; run1++ ){
+                for( run2 = 0; run2 < lbIb[run1].getDim(); run2++ ){
+
+                    if( isEquality( run1,run2 ) == BT_TRUE ) continue;
+
+                    muAffine += ( tL[run1](run2) + alpha*dtL[run1](run2) )*( yLb[run1](run2) + alpha*dyL[run1](run2) )
+                              + ( tU[run1](run2) + alpha*dtU[run1](run2) )*( yUb[run1](run2) + alpha*dyU[run1](run2) );
+                }
+            }
+
+            muAffine /= (double) nActive;
+
+            double sigma = 0.0;
+            if( mu > 0.0 ) sigma = pow( muAffine/mu, 3 );
+            if( sigma > 1.0 ) sigma = 1.0;
+
+            for( run1 = 0; run1 < nBlocks; run1++ ){
+                for( run2 = 0; run2 < lbIb[run1].getDim(); run2++ ){
+
+                    if( isEquality( run1,run2 ) == BT_TRUE ) continue;
+
+                    if( lbIb[run1](run2) > -inactive )
+                        rcL[run1](run2) = sigma*mu - tL[run1](run2)*yLb[run1](run2) - dtL[run1](run2)*dyL[run1](run2);
+                    if( ubIb[run1](run2) < inactive )
+                        rcU[run1](run2) = sigma*mu - tU[run1](run2)*yUb[run1](run2) - dtU[run1](run2)*dyU[run1](run2);
+                }
+            }
+        }
+
+        if( returnvalue != SUCCESSFUL_RETURN ) break;
+
+        returnvalue = RET_QP_SOLUTION_FAILED;
+
+        if( nActive > 0 ){
+            if( isBarrierStep == BT_TRUE && barrierParameter < 0.01 ) alpha *= 1.0 - barrierParameter;
+            else                                                     alpha *= ( isBarrierStep == BT_TRUE ) ? 0.99 : 0.995;
+        }
+
+
+        // update of the iterate:
+        for( run1 = 0; run1 < nBlocks; run1++ ){
+
+            for( run2 = 0; run2 < zb[run1].getDim(); run2++ )
+                zb[run1](run2) += alpha*dz[run1](run2);
+
+            for( run2 = 0; run2 < lbIb[run1].getDim(); run2++ ){
+                tL[run1](run2) += alpha*dtL[run1](run2);  yLb[run1](run2) += alpha*dyL[run1](run2);
+                tU[run1](run2) += alpha*dtU[run1](run2);  yUb[run1](run2) += alpha*dyU[run1](run2);
+            }
+        }
+
+        for( run1 = 0; run1 < nBlocks-1; run1++ )
+            for( run2 = 0; run2 < lambdab[run1].getDim(); run2++ )
+                lambdab[run1](run2) += alpha*dl[run1](run2);
+
+        if( isBarrierStep == BT_TRUE ){
+            returnvalue = SUCCESSFUL_RETURN;
+            break;
+        }
+    }
+
+    delete[] Ht;   delete[] rz;   delete[] q;    delete[] rd;
+    delete[] dz;   delete[] dl;   delete[] rL;   delete[] rU;
+    delete[] rcL;  delete[] rcU;  delete[] dtL;  delete[] dtU;
+    delete[] dyL;  delete[] dyU;
+
+    if( returnvalue != SUCCESSFUL_RETURN && isAcceptable == BT_TRUE )
+        return SUCCESSFUL_RETURN;
+
+    return returnvalue;
+}
+
+
+returnValue RiccatiBasedCPsolver::factorizeKKTsystem( const Matrix *Ht ){
+
+    uint run1, run2, run3, run4;
+
+    for( run1 = nBlocks; run1 > 0; run1-- ){
+
+        const uint k  = run1-1;
+        const uint ns = getNumBlockStates( k );
+
+        Matrix M = Ht[k];
+        if( k < nBlocks-1 )
+            M += Fb[k]^( P[run1]*Fb[k] );
+
+        const uint nv = M.getNumRows() - ns;
+
+        P[k].init( ns, ns );
+        for( run2 = 0; run2 < ns; run2++ )
+            for( run3 = 0; run3 < ns; run3++ )
+                P[k](run2,run3) = M(run2,run3);
+
+        if( nv == 0 ) continue;
+
+        L[k].init( nv, nv );
+        for( run2 = 0; run2 < nv; run2++ )
+            for( run3 = 0; run3 < nv; run3++ )
+                L[k](run2,run3) = M(ns+run2,ns+run3);
+
+        if( factorizeCholesky( L[k] ) != SUCCESSFUL_RETURN )
+            return RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR;
+
+        // feedback gain K = - M_vv^{-1} M_vs:
+        K[k].init( nv, ns );
+        Vector col( nv );
+
+        for( run3 = 0; run3 < ns; run3++ ){
+
+            for( run2 = 0; run2 < nv; run2++ )
+                col(run2) = M(ns+run2,run3);
+
+            solveCholesky( L[k], col );
+
+            for( run2 = 0; run2 < nv; run2++ )
+                K[k](run2,run3) = -col(run2);
+        }
+
+        // cost-to-go Hessian P = M_ss + M_sv K:
+        for( run2 = 0; run2 < ns; run2++ )
+            for( run3 = 0; run3 < ns; run3++ )
+                for( run4 = 0; run4 < nv; run4++ )
+                    P[k](run2,run3) += M(run2,ns+run4)*K[k](run4,run3);
+    }
+
+    L0 = P[0];
+
+    if( factorizeCholesky( L0 ) != SUCCESSFUL_RETURN )
+        return RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::solveKKTsystem( const Vector *q, const Vector *c_,
+                                                  Vector *dz, Vector *dlambda ){
+
+    uint run1, run2;
+
+    Vector *p   = new Vector[nBlocks];
+    Vector *kff = new Vector[nBlocks];
+
+
+    // BACKWARD RECURSION OF THE COST-TO-GO GRADIENTS:
+    // -----------------------------------------------
+    for( run1 = nBlocks; run1 > 0; run1-- ){
+
+        const uint k  = run1-1;
+        const uint ns = getNumBlockStates( k );
+
+        Vector m = q[k];
+        if( k < nBlocks-1 )
+            m += Fb[k]^( P[run1]*c_[k] + p[run1] );
+
+        const uint nv = m.getDim() - ns;
+
+        p[k].init( ns );
+        for( run2 = 0; run2 < ns; run2++ )
+            p[k](run2) = m(run2);
+
+        if( nv == 0 ) continue;
+
+        Vector mv( nv );
+        for( run2 = 0; run2 < nv; run2++ )
+            mv(run2) = m(ns+run2);
+
+        p[k] += K[k]^mv;
+
+        solveCholesky( L[k], mv );
+        kff[k] = mv;
+        kff[k] *= -1.0;
+    }
+
+
+    // FORWARD SIMULATION OF THE CLOSED-LOOP STEP:
+    // -------------------------------------------
+    Vector s = p[0];
+    solveCholesky( L0, s );
+
+    dz[0].init( Hb[0].getNumRows() );
+    dz[0].setZero();
+    for( run2 = 0; run2 < s.getDim(); run2++ )
+        dz[0](run2) = -s(run2);
+
+    for( run1 = 0; run1 < nBlocks; run1++ ){
+
+        const uint ns = getNumBlockStates( run1 );
+        const uint nv = dz[run1].getDim() - ns;
+
+        if( nv > 0 ){
+
+            s.init( ns );
+            for( run2 = 0; run2 < ns; run2++ )
+                s(run2) = dz[run1](run2);
+
+            Vector v = K[run1]*s + kff[run1];
+
+            for( run2 = 0; run2 < nv; run2++ )
+                dz[run1](ns+run2) = v(run2);
+        }
+
+        if( run1 == nBlocks-1 ) break;
+
+        Vector sNext = Fb[run1]*dz[run1] + c_[run1];
+
+        dz[run1+1].init( Hb[run1+1].getNumRows() );
+        dz[run1+1].setZero();
+        for( run2 = 0; run2 < sNext.getDim(); run2++ )
+            dz[run1+1](run2) = sNext(run2);
+
+        dlambda[run1] = P[run1+1]*sNext + p[run1+1];
+    }
+
+    delete[] p;
+    delete[] kff;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::factorizeCholesky( Matrix &A ) const{
+
+    uint run1, run2, run3, run4;
+
+    const uint n = A.getNumRows();
+    if( n == 0 ) return SUCCESSFUL_RETURN;
+
+    // REGULARIZE THE DIAGONAL IF THE MATRIX IS (NUMERICALLY) SINGULAR:
+    // ----------------------------------------------------------------
+    double regularisation = 0.0;
+    Matrix A0 = A;
+
+    for( run4 = 0; run4 < 8; run4++ ){
+
+        A = A0;
+        for( run1 = 0; run1 < n; run1++ )
+            A(run1,run1) += regularisation*( 1.0 + fabs( A0(run1,run1) ) );
+
+        for( run1 = 0; run1 < n; run1++ ){
+
+            double sum = A(run1,run1);
+            for( run3 = 0; run3 < run1; run3++ )
+                sum -= A(run1,run3)*A(run1,run3);
+
+            if( sum <= 1.0e2*EPS*fabs( A(run1,run1) ) ) break;
+
+            A(run1,run1) = sqrt( sum );
+
+            for( run2 = run1+1; run2 < n; run2++ ){
+                sum = A(run2,run1);
+                for( run3 = 0; run3 < run1; run3++ )
+                    sum -= A(run2,run3)*A(run1,run3);
+                A(run2,run1) = sum / A(run1,run1);
+            }
+        }
+
+        if( run1 == n ){
+            for( run1 = 0; run1 < n; run1++ )
+                for( run2 = run1+1; run2 < n; run2++ )
+                    A(run1,run2) = 0.0;
+            return SUCCESSFUL_RETURN;
+        }
+
+        if( regularisation == 0.0 ) regularisation  = 1.0e-12;
+        else                        regularisation *= 100.0;
+    }
+
+    return RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR;
+}
+
+
+void RiccatiBasedCPsolver::solveCholesky( const Matrix &L_, Vector &b ) const{
+
+    int run1, run2;
+
+    const int n = L_.getNumRows();
+
+    for( run1 = 0; run1 < n; run1++ ){
+        for( run2 = 0; run2 < run1; run2++ )
+            b(run1) -= L_(run1,run2)*b(run2);
+        b(run1) /= L_(run1,run1);
+    }
+
+    for( run1 = n-1; run1 >= 0; run1-- ){
+        for( run2 = run1+1; run2 < n; run2++ )
+            b(run1) -= L_(run2,run1)*b(run2);
+        b(run1) /= L_(run1,run1);
+    }
+}
+
+
+returnValue RiccatiBasedCPsolver::initializeCondensing( ){
+
+    deleteStageMemory( );
+
+    if( condensing != 0 ) delete condensing;
+    condensing = new CondensingBasedCPsolver( userInteraction, nConstraints, blockDims );
+
+    returnValue returnvalue = condensing->init( iter );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    if( deltaX.isEmpty( ) == BT_FALSE )
+        return condensing->setRealTimeParameters( deltaX,deltaP );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
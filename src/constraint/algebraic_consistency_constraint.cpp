@@ -148,38 +148,66 @@ AlgebraicConsistencyConstraint& AlgebraicConsistencyConstraint::operator=( const
 
 returnValue AlgebraicConsistencyConstraint::evaluate( const OCPiterate& iter ){
 
-    int run1, run2;
+    int run1;
 
     if( fcn            == 0       ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
     if( numberOfStages != counter ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
-    int stageIdx = 0;
     const int T  = grid.getLastIndex();
 
     residuumL.init(T+1,1);
     residuumU.init(T+1,1);
 
+    // THE LAST GRID POINT OF EACH STAGE IS EVALUATED FIRST, SUCH THAT THE
+    // BUFFERS OF ALL FUNCTIONS HAVE THEIR FINAL SIZE IN THE PARALLEL LOOP:
+    // --------------------------------------------------------------------
+    for( run1 = 0; run1 <= T; run1++ )
+        if( isLastPointOfStage( run1 ) == BT_TRUE )
+            evaluatePoint( run1, iter, z );
+
+#ifdef _OPENMP
+    #pragma omp parallel num_threads( acadoGetNumThreads( ) ) if( areStagesParallelizable( ) == BT_TRUE )
+#endif
+    {
+        int run2;
+
+        EvaluationPoint *zThread = new EvaluationPoint[nFcn];
+        for( run2 = 0; run2 < nFcn; run2++ )
+            zThread[run2] = z[run2];
+
+#ifdef _OPENMP
+        #pragma omp for schedule(static)
+#endif
+        for( run1 = 0; run1 <= T; run1++ )
+            if( isLastPointOfStage( run1 ) == BT_FALSE )
+                evaluatePoint( run1, iter, zThread );
+
+        delete[] zThread;
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
 
-    for( run1 = 0; run1 <= T; run1++ ){
+returnValue AlgebraicConsistencyConstraint::evaluatePoint( int idx, const OCPiterate& iter, EvaluationPoint *zThread ){
 
-        int nc = numberOfAlgebraicStates[stageIdx];
-		Matrix res( nc, 1 );
-		
-		z[stageIdx].setZ( run1, iter );
-		Vector result = fcn[stageIdx].evaluate( z[stageIdx],run1 );
+    int run1;
 
-        for( run2 = 0; run2 < nc; run2++ )
-             res( run2, 0 ) = -result(numberOfDifferentialStates[stageIdx]+run2);
+    const int stageIdx = getStageIndex( idx );
+    const int nc       = numberOfAlgebraicStates[stageIdx];
 
-        // STORE THE RESULTS:
-        // ------------------
-        residuumL.setDense( run1, 0, res );
-        residuumU.setDense( run1, 0, res );
+    Matrix res( nc, 1 );
 
-        // INCREASE THE STAGE COUNTER IF NECESSARY:
-        // ----------------------------------------
-        if( run1 == breakPoints[stageIdx+1] ) stageIdx++;
-    }
+    zThread[stageIdx].setZ( idx, iter );
+    Vector result = fcn[stageIdx].evaluate( zThread[stageIdx],idx );
+
+    for( run1 = 0; run1 < nc; run1++ )
+         res( run1, 0 ) = -result(numberOfDifferentialStates[stageIdx]+run1);
+
+    // STORE THE RESULTS:
+    // ------------------
+    residuumL.setDense( idx, 0, res );
+    residuumU.setDense( idx, 0, res );
 
     return SUCCESSFUL_RETURN;
 }
@@ -212,54 +240,75 @@ returnValue AlgebraicConsistencyConstraint::evaluateSensitivities(){
 
         dBackward.init( N, 5*N );
 
+        int nFailed = 0;
+
+#ifdef _OPENMP
+        #pragma omp parallel num_threads( acadoGetNumThreads( ) ) if( areStagesParallelizable( ) == BT_TRUE ) reduction(+:nFailed)
+#endif
+        {
+            int run2;
+
+            EvaluationPoint *JJthread = new EvaluationPoint[nFcn];
+            for( run2 = 0; run2 < nFcn; run2++ )
+                JJthread[run2] = JJ[run2];
+
+#ifdef _OPENMP
+            #pragma omp for schedule(static)
+#endif
+            for( run3 = 0; run3 < N; run3++ )
+            {
+                const int stageIdx = getStageIndex( run3 );
+
+                Matrix bseed_;
+                bSeed->getSubBlock( 0, run3, bseed_ );
 
-        for( run3 = 0; run3 < N; run3++ )
-		{
-            Matrix bseed_;
-            bSeed->getSubBlock( 0, run3, bseed_ );
+                int nBDirs = bSeed->getNumRows( 0, run3 );
 
-			Vector bseedTmp( numberOfDifferentialStates[stageIdx] );
-			bseedTmp.setZero();
+                Matrix Dx ( nBDirs, nx );
+                Matrix Dxa( nBDirs, na );
+                Matrix Dp ( nBDirs, np );
+                Matrix Du ( nBDirs, nu );
+                Matrix Dw ( nBDirs, nw );
 
-            nBDirs = bSeed->getNumRows( 0, run3 );
+                for( run2 = 0; run2 < nBDirs; run2++ )
+                {
+                    Vector bseedTmp( numberOfDifferentialStates[stageIdx] );
+                    bseedTmp.setZero();
+                    bseedTmp.append( bseed_.getRow(run2) );
 
-            Matrix Dx ( nBDirs, nx );
-            Matrix Dxa( nBDirs, na );
-            Matrix Dp ( nBDirs, np );
-            Matrix Du ( nBDirs, nu );
-            Matrix Dw ( nBDirs, nw );
+                    if( fcn[stageIdx].AD_backward( bseedTmp,JJthread[stageIdx],run3 ) != SUCCESSFUL_RETURN )
+                        nFailed++;
 
-            for( run1 = 0; run1 < nBDirs; run1++ )
-			{
-				bseedTmp.append( bseed_.getRow(run1) );
-				ACADO_TRY( fcn[stageIdx].AD_backward( bseedTmp,JJ[stageIdx],run3 ) );
-		
-				if( nx > 0 ) Dx .setRow( run1, JJ[stageIdx].getX () );
-				if( na > 0 ) Dxa.setRow( run1, JJ[stageIdx].getXA() );
-				if( np > 0 ) Dp .setRow( run1, JJ[stageIdx].getP () );
-				if( nu > 0 ) Du .setRow( run1, JJ[stageIdx].getU () );
-				if( nw > 0 ) Dw .setRow( run1, JJ[stageIdx].getW () );
-				
-				JJ[stageIdx].setZero( );
-			}
+                    if( nx > 0 ) Dx .setRow( run2, JJthread[stageIdx].getX () );
+                    if( na > 0 ) Dxa.setRow( run2, JJthread[stageIdx].getXA() );
+                    if( np > 0 ) Dp .setRow( run2, JJthread[stageIdx].getP () );
+                    if( nu > 0 ) Du .setRow( run2, JJthread[stageIdx].getU () );
+                    if( nw > 0 ) Dw .setRow( run2, JJthread[stageIdx].getW () );
 
-			if( nx > 0 )
-				dBackward.setDense( run3,     run3, Dx );
+                    JJthread[stageIdx].setZero( );
+                }
 
-			if( na > 0 )
-				dBackward.setDense( run3,   N+run3, Dxa );
+                if( nx > 0 )
+                    dBackward.setDense( run3,     run3, Dx );
 
-			if( np > 0 )
-				dBackward.setDense( run3, 2*N+run3, Dp );
+                if( na > 0 )
+                    dBackward.setDense( run3,   N+run3, Dxa );
 
-			if( nu > 0 )
-				dBackward.setDense( run3, 3*N+run3, Du );
+                if( np > 0 )
+                    dBackward.setDense( run3, 2*N+run3, Dp );
 
-			if( nw > 0 )
-				dBackward.setDense( run3, 4*N+run3, Dw );
+                if( nu > 0 )
+                    dBackward.setDense( run3, 3*N+run3, Du );
+
+                if( nw > 0 )
+                    dBackward.setDense( run3, 4*N+run3, Dw );
+            }
+
+            delete[] JJthread;
+        }
 
-			if( run3 == breakPoints[stageIdx+1] ) stageIdx++;
-		}
+        if( nFailed > 0 )
+            return ACADOERROR( RET_UNABLE_TO_EVALUATE_CONSTRAINTS );
 
 		return SUCCESSFUL_RETURN;
 	}
@@ -332,275 +381,57 @@ returnValue AlgebraicConsistencyConstraint::evaluateSensitivities( int &count,
     if( fcn == 0 ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
     if( numberOfStages != counter ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
-    int stageIdx = 0;
-
     dBackward.init( N, 5*N );
 
+    // THE COLORINGS ARE SET UP BEFORE THE GRID POINTS ARE PROCESSED IN PARALLEL:
+    // --------------------------------------------------------------------------
+    for( run3 = 0; run3 < numberOfStages; run3++ )
+        if( hessianColoring[run3].isInitialized() == BT_FALSE )
+            if( hessianColoring[run3].init( fcn[run3], nx, na, np, nu, nw, y_index[run3] ) != SUCCESSFUL_RETURN )
+                return ACADOERROR(RET_UNABLE_TO_EVALUATE_CONSTRAINTS);
+
+    int nFailed = 0;
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static) num_threads( acadoGetNumThreads( ) ) if( areStagesParallelizable( ) == BT_TRUE ) reduction(+:nFailed)
+#endif
     for( run3 = 0; run3 < N; run3++ ){
 
-        int nc = numberOfAlgebraicStates[stageIdx];
+        const int stageIdx = getStageIndex( run3 );
+        const int nc       = numberOfAlgebraicStates[stageIdx];
+        const int nf       = fcn[stageIdx].getDim();
 
         Matrix seed;
-        seed_.getSubBlock( count, 0, seed, nc, 1 );
-        count++;
+        seed_.getSubBlock( count+run3, 0, seed, nc, 1 );
 
         // EVALUATION OF THE SENSITIVITIES:
         // --------------------------------
 
-        int run1, run2;
+        int run1;
 
-        double *bseed1 = new double[fcn[stageIdx].getDim()];
-        double *bseed2 = new double[fcn[stageIdx].getDim()];
-        double *R      = new double[fcn[stageIdx].getDim()];
-        double *J      = new double[fcn[stageIdx].getNumberOfVariables() +1];
-        double *H      = new double[fcn[stageIdx].getNumberOfVariables() +1];
-        double *fseed  = new double[fcn[stageIdx].getNumberOfVariables() +1];
+        double *bseed1 = new double[nf];
 
-        for( run1 = 0; run1 < fcn[stageIdx].getDim()-nc; run1++ ){
+        for( run1 = 0; run1 < nf-nc; run1++ )
             bseed1[run1] = 0.0;
-            bseed2[run1] = 0.0;
-        }
 
-        for( run1 = 0; run1 < nc; run1++ ){
-            bseed1[fcn[stageIdx].getDim() - nc + run1] = seed(run1,0);
-            bseed2[fcn[stageIdx].getDim() - nc + run1] = 0.0;
-        }
-
-        for( run1 = 0; run1 < fcn[stageIdx].getNumberOfVariables()+1; run1++ )
-            fseed[run1] = 0.0;
-
-        Matrix Dx ( nc, nx );
-        Matrix Dxa( nc, na );
-        Matrix Dp ( nc, np );
-        Matrix Du ( nc, nu );
-        Matrix Dw ( nc, nw );
-
-        Matrix Hx ( nx, nx );
-        Matrix Hxa( nx, na );
-        Matrix Hp ( nx, np );
-        Matrix Hu ( nx, nu );
-        Matrix Hw ( nx, nw );
-
-        for( run2 = 0; run2 < nx; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[stageIdx][run2]] = 1.0;
-            fcn[stageIdx].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dx( run1, run2 ) = R[fcn[stageIdx].getDim() - nc + run1];
-            fseed[y_index[stageIdx][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[stageIdx].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
+        for( run1 = 0; run1 < nc; run1++ )
+            bseed1[nf - nc + run1] = seed(run1,0);
 
-            fcn[stageIdx].AD_backward2( run3, bseed1, bseed2, J, H );
-
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2, run1             ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2, run1-nx          ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2, run1-nx-na       ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2, run1-nx-na-np    ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2, run1-nx-na-np-nu ) = -H[y_index[stageIdx][run1]];
-        }
-
-        if( nx > 0 ){
-
-            dBackward.setDense( run3, run3, Dx );
-
-            if( nx > 0 ) hessian.addDense( run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( run3, 4*N + run3, Hw  );
-        }
-
-        Hx.init ( na, nx );
-        Hxa.init( na, na );
-        Hp.init ( na, np );
-        Hu.init ( na, nu );
-        Hw.init ( na, nw );
-
-        for( run2 = nx; run2 < nx+na; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[stageIdx][run2]] = 1.0;
-            fcn[stageIdx].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dxa( run1, run2-nx ) = R[fcn[stageIdx].getDim() - nc + run1];
-            fseed[y_index[stageIdx][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[stageIdx].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn[stageIdx].AD_backward2( run3, bseed1, bseed2, J, H );
-
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx, run1             ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx, run1-nx          ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx, run1-nx-na       ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx, run1-nx-na-np    ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx, run1-nx-na-np-nu ) = -H[y_index[stageIdx][run1]];
-        }
+        Matrix D, H;
 
-        if( na > 0 ){
-
-            dBackward.setDense( run3, N+run3, Dxa );
-
-            if( nx > 0 ) hessian.addDense( N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( N+run3, 4*N + run3, Hw  );
-        }
-
-        Hx.init ( np, nx );
-        Hxa.init( np, na );
-        Hp.init ( np, np );
-        Hu.init ( np, nu );
-        Hw.init ( np, nw );
-
-        for( run2 = nx+na; run2 < nx+na+np; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[stageIdx][run2]] = 1.0;
-            fcn[stageIdx].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dp( run1, run2-nx-na ) = R[fcn[stageIdx].getDim() - nc + run1];
-            fseed[y_index[stageIdx][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[stageIdx].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn[stageIdx].AD_backward2( run3, bseed1, bseed2, J, H );
-
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na, run1             ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na, run1-nx          ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na, run1-nx-na       ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na, run1-nx-na-np    ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na, run1-nx-na-np-nu ) = -H[y_index[stageIdx][run1]];
-        }
-
-        if( np > 0 ){
-
-            dBackward.setDense( run3, 2*N+run3, Dp );
-
-            if( nx > 0 ) hessian.addDense( 2*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 2*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 2*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 2*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 2*N+run3, 4*N + run3, Hw  );
-        }
-
-
-        Hx.init ( nu, nx );
-        Hxa.init( nu, na );
-        Hp.init ( nu, np );
-        Hu.init ( nu, nu );
-        Hw.init ( nu, nw );
-
-        for( run2 = nx+na+np; run2 < nx+na+np+nu; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[stageIdx][run2]] = 1.0;
-            fcn[stageIdx].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Du( run1, run2-nx-na-np ) = R[fcn[stageIdx].getDim() - nc + run1];
-            fseed[y_index[stageIdx][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[stageIdx].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn[stageIdx].AD_backward2( run3, bseed1, bseed2, J, H );
-
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na-np, run1             ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na-np, run1-nx          ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na-np, run1-nx-na       ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na-np, run1-nx-na-np    ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na-np, run1-nx-na-np-nu ) = -H[y_index[stageIdx][run1]];
-        }
-
-        if( nu > 0 ){
-
-            dBackward.setDense( run3, 3*N+run3, Du );
-
-            if( nx > 0 ) hessian.addDense( 3*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 3*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 3*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 3*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 3*N+run3, 4*N + run3, Hw  );
-        }
-
-        Hx.init ( nw, nx );
-        Hxa.init( nw, na );
-        Hp.init ( nw, np );
-        Hu.init ( nw, nu );
-        Hw.init ( nw, nw );
-
-        for( run2 = nx+na+np+nu; run2 < nx+na+np+nu+nw; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[stageIdx][run2]] = 1.0;
-            fcn[stageIdx].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dw( run1, run2-nx-na-np-nu ) = R[fcn[stageIdx].getDim() - nc + run1];
-            fseed[y_index[stageIdx][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[stageIdx].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn[stageIdx].AD_backward2( run3, bseed1, bseed2, J, H );
-
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na-np-nu, run1             ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na-np-nu, run1-nx          ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na-np-nu, run1-nx-na       ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na-np-nu, run1-nx-na-np    ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na-np-nu, run1-nx-na-np-nu ) = -H[y_index[stageIdx][run1]];
-        }
-
-        if( nw > 0 ){
-
-            dBackward.setDense( run3, 4*N+run3, Dw );
-
-            if( nx > 0 ) hessian.addDense( 4*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 4*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 4*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 4*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 4*N+run3, 4*N + run3, Hw  );
-        }
+        if( evaluateSecondOrderDerivatives( stageIdx, run3, bseed1, D, H ) != SUCCESSFUL_RETURN )
+            nFailed++;
+        else
+            addSecondOrderDerivatives( run3, run3, N, D.getRows( nf-nc, nf-1 ), H, hessian );
 
         delete[] bseed1;
-        delete[] bseed2;
-        delete[] R     ;
-        delete[] J     ;
-        delete[] H     ;
-        delete[] fseed ;
-
-        if( run3 == breakPoints[stageIdx+1] ) stageIdx++;
     }
 
+    count += N;
+
+    if( nFailed > 0 )
+        return ACADOERROR(RET_UNABLE_TO_EVALUATE_CONSTRAINTS);
+
     return SUCCESSFUL_RETURN;
 }
 
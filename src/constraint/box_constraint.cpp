@@ -299,6 +299,8 @@ returnValue BoxConstraint::evaluateBounds( const OCPiterate& iter ){
     }
 
 
+    // several bounds on the same component are intersected:
+
     for( run1 = 0; (int) run1 < nb; run1++ ){
 
         switch( var[run1] ){
@@ -306,8 +308,8 @@ returnValue BoxConstraint::evaluateBounds( const OCPiterate& iter ){
             case VT_DIFFERENTIAL_STATE:
                 if( iter.x != NULL ){
                     for( run2 = 0; run2 < N; run2++ ){
-                        residuumXL[run2](index[run1],0) = blb[run1][0](run2) - iter.x->operator()(run2,index[run1]);
-                        residuumXU[run2](index[run1],0) = bub[run1][0](run2) - iter.x->operator()(run2,index[run1]);
+                        residuumXL[run2](index[run1],0) = acadoMax( residuumXL[run2](index[run1],0), blb[run1][0](run2) - iter.x->operator()(run2,index[run1]) );
+                        residuumXU[run2](index[run1],0) = acadoMin( residuumXU[run2](index[run1],0), bub[run1][0](run2) - iter.x->operator()(run2,index[run1]) );
                     }
                 }
                 else ACADOERROR( RET_INVALID_ARGUMENTS );
@@ -317,8 +319,8 @@ returnValue BoxConstraint::evaluateBounds( const OCPiterate& iter ){
             case VT_ALGEBRAIC_STATE:
                 if( iter.xa != NULL ){
                     for( run2 = 0; run2 < N; run2++ ){
-                        residuumXAL[run2](index[run1],0) = blb[run1][0](run2) - iter.xa->operator()(run2,index[run1]);
-                        residuumXAU[run2](index[run1],0) = bub[run1][0](run2) - iter.xa->operator()(run2,index[run1]);
+                        residuumXAL[run2](index[run1],0) = acadoMax( residuumXAL[run2](index[run1],0), blb[run1][0](run2) - iter.xa->operator()(run2,index[run1]) );
+                        residuumXAU[run2](index[run1],0) = acadoMin( residuumXAU[run2](index[run1],0), bub[run1][0](run2) - iter.xa->operator()(run2,index[run1]) );
                     }
                 }
                 else ACADOERROR( RET_INVALID_ARGUMENTS );
@@ -327,8 +329,10 @@ returnValue BoxConstraint::evaluateBounds( const OCPiterate& iter ){
 
             case VT_PARAMETER:
                 if( iter.p != NULL ){
-                    residuumPL[0](index[run1],0) = blb[run1][0](0) - iter.p->operator()(0,index[run1]);
-                    residuumPU[0](index[run1],0) = bub[run1][0](0) - iter.p->operator()(0,index[run1]);
+                    for( run2 = 0; run2 < N; run2++ ){
+                        residuumPL[0](index[run1],0) = acadoMax( residuumPL[0](index[run1],0), blb[run1][0](run2) - iter.p->operator()(0,index[run1]) );
+                        residuumPU[0](index[run1],0) = acadoMin( residuumPU[0](index[run1],0), bub[run1][0](run2) - iter.p->operator()(0,index[run1]) );
+                    }
                 }
                 else ACADOERROR( RET_INVALID_ARGUMENTS );
                 break;
@@ -336,8 +340,8 @@ returnValue BoxConstraint::evaluateBounds( const OCPiterate& iter ){
             case VT_CONTROL:
                 if( iter.u != NULL ){
                     for( run2 = 0; run2 < N; run2++ ){
-                        residuumUL[run2](index[run1],0) = blb[run1][0](run2) - iter.u->operator()(run2,index[run1]);
-                        residuumUU[run2](index[run1],0) = bub[run1][0](run2) - iter.u->operator()(run2,index[run1]);
+                        residuumUL[run2](index[run1],0) = acadoMax( residuumUL[run2](index[run1],0), blb[run1][0](run2) - iter.u->operator()(run2,index[run1]) );
+                        residuumUU[run2](index[run1],0) = acadoMin( residuumUU[run2](index[run1],0), bub[run1][0](run2) - iter.u->operator()(run2,index[run1]) );
                     }
                 }
                 else ACADOERROR( RET_INVALID_ARGUMENTS );
@@ -346,8 +350,8 @@ returnValue BoxConstraint::evaluateBounds( const OCPiterate& iter ){
             case VT_DISTURBANCE:
                 if( iter.w != NULL ){
                     for( run2 = 0; run2 < N; run2++ ){
-                        residuumWL[run2](index[run1],0) = blb[run1][0](run2) - iter.w->operator()(run2,index[run1]);
-                        residuumWU[run2](index[run1],0) = bub[run1][0](run2) - iter.w->operator()(run2,index[run1]);
+                        residuumWL[run2](index[run1],0) = acadoMax( residuumWL[run2](index[run1],0), blb[run1][0](run2) - iter.w->operator()(run2,index[run1]) );
+                        residuumWU[run2](index[run1],0) = acadoMin( residuumWU[run2](index[run1],0), bub[run1][0](run2) - iter.w->operator()(run2,index[run1]) );
                     }
                 }
                 else {ASSERT(1==0);ACADOERROR( RET_INVALID_ARGUMENTS );}
@@ -372,20 +376,18 @@ inline returnValue BoxConstraint::getBounds( const OCPiterate& iter ){
 
     const uint N = grid.getNumPoints();
 
+    // several bounds on the same component (e.g. a path bound and a bound at
+    // a single grid point) are intersected with the bounds already present:
+
     for( run1 = 0; (int) run1 < nb; run1++ ){
 
         switch( var[run1] ){
 
             case VT_DIFFERENTIAL_STATE:
                 if( iter.x != NULL ){
-                    for( run2 = 0; run2 < N; run2++ ){
-
-                        if( bub[run1][0](run2) - blb[run1][0](run2) < -0.5*BOUNDTOL )
+                    for( run2 = 0; run2 < N; run2++ )
+                        if( addBound( iter.x, run2, index[run1], blb[run1][0](run2), bub[run1][0](run2) ) != SUCCESSFUL_RETURN )
                             return ACADOERROR( RET_INCONSISTENT_BOUNDS );
-
-                        iter.x->setLowerBound(run2,index[run1],blb[run1][0](run2));
-                        iter.x->setUpperBound(run2,index[run1],bub[run1][0](run2));
-                    }
                 }
                 else ACADOERROR( RET_INVALID_ARGUMENTS );
                 break;
@@ -393,14 +395,9 @@ inline returnValue BoxConstraint::getBounds( const OCPiterate& iter ){
 
             case VT_ALGEBRAIC_STATE:
                 if( iter.xa != NULL ){
-                    for( run2 = 0; run2 < N; run2++ ){
-
-                        if( bub[run1][0](run2) - blb[run1][0](run2) < -0.5*BOUNDTOL )
+                    for( run2 = 0; run2 < N; run2++ )
+                        if( addBound( iter.xa, run2, index[run1], blb[run1][0](run2), bub[run1][0](run2) ) != SUCCESSFUL_RETURN )
                             return ACADOERROR( RET_INCONSISTENT_BOUNDS );
-
-                        iter.xa->setLowerBound(run2,index[run1],blb[run1][0](run2));
-                        iter.xa->setUpperBound(run2,index[run1],bub[run1][0](run2));
-                    }
                 }
                 else ACADOERROR( RET_INVALID_ARGUMENTS );
                 break;
@@ -408,41 +405,37 @@ inline returnValue BoxConstraint::getBounds( const OCPiterate& iter ){
 
             case VT_PARAMETER:
                 if( iter.p != NULL ){
-					for( run2 = 0; run2 < N; run2++ ){
-                        if( bub[run1][0](0) - blb[run1][0](0) < -0.5*BOUNDTOL )
-                            return ACADOERROR( RET_INCONSISTENT_BOUNDS );
 
-                        iter.p->setLowerBound(run2,index[run1],blb[run1][0](0));
-                        iter.p->setUpperBound(run2,index[run1],bub[run1][0](0));
-					}
+                    // parameters are constant, thus a bound at any grid point holds on the whole horizon
+                    double lb_ = blb[run1][0](0);
+                    double ub_ = bub[run1][0](0);
+
+                    for( run2 = 1; run2 < N; run2++ ){
+                        lb_ = acadoMax( lb_, blb[run1][0](run2) );
+                        ub_ = acadoMin( ub_, bub[run1][0](run2) );
+                    }
+
+                    for( run2 = 0; run2 < N; run2++ )
+                        if( addBound( iter.p, run2, index[run1], lb_, ub_ ) != SUCCESSFUL_RETURN )
+                            return ACADOERROR( RET_INCONSISTENT_BOUNDS );
                 }
                 else ACADOERROR( RET_INVALID_ARGUMENTS );
                 break;
 
             case VT_CONTROL:
                 if( iter.u != NULL ){
-                    for( run2 = 0; run2 < N; run2++ ){
-
-                        if( bub[run1][0](run2) - blb[run1][0](run2) < -0.5*BOUNDTOL )
+                    for( run2 = 0; run2 < N; run2++ )
+                        if( addBound( iter.u, run2, index[run1], blb[run1][0](run2), bub[run1][0](run2) ) != SUCCESSFUL_RETURN )
                             return ACADOERROR( RET_INCONSISTENT_BOUNDS );
-
-                        iter.u->setLowerBound(run2,index[run1],blb[run1][0](run2));
-                        iter.u->setUpperBound(run2,index[run1],bub[run1][0](run2));
-                    }
                 }
                 else ACADOERROR( RET_INVALID_ARGUMENTS );
                 break;
 
             case VT_DISTURBANCE:
                 if( iter.w != NULL ){
-                    for( run2 = 0; run2 < N; run2++ ){
-
-                        if( bub[run1][0](run2) - blb[run1][0](run2) < -0.5*BOUNDTOL )
+                    for( run2 = 0; run2 < N; run2++ )
+                        if( addBound( iter.w, run2, index[run1], blb[run1][0](run2), bub[run1][0](run2) ) != SUCCESSFUL_RETURN )
                             return ACADOERROR( RET_INCONSISTENT_BOUNDS );
-
-                        iter.w->setLowerBound(run2,index[run1],blb[run1][0](run2));
-                        iter.w->setUpperBound(run2,index[run1],bub[run1][0](run2));
-                    }
                 }
                 else ACADOERROR( RET_INVALID_ARGUMENTS );
                 break;
@@ -459,6 +452,23 @@ inline returnValue BoxConstraint::getBounds( const OCPiterate& iter ){
 }
 
 
+returnValue BoxConstraint::addBound( VariablesGrid* const variables,
+                                     uint pointIdx, uint component,
+                                     double lb_, double ub_ ) const{
+
+    double lower = acadoMax( variables->getLowerBound( pointIdx,component ), lb_ );
+    double upper = acadoMin( variables->getUpperBound( pointIdx,component ), ub_ );
+
+    if( upper - lower < -0.5*BOUNDTOL )
+        return RET_INCONSISTENT_BOUNDS;
+
+    variables->setLowerBound( pointIdx,component,lower );
+    variables->setUpperBound( pointIdx,component,upper );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
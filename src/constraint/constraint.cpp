@@ -449,14 +449,23 @@ returnValue Constraint::evaluate( const OCPiterate& iter ){
     // --------------------------
 
     if( point_constraints != 0 ){
-        for( run1 = 0; run1 < grid.getNumPoints(); run1++ ){
+
+        const uint N = grid.getNumPoints();
+        int nFailed = 0;
+
+#ifdef _OPENMP
+        #pragma omp parallel for schedule(dynamic) num_threads( acadoGetNumThreads( ) ) if( arePointConstraintsParallelizable( ) == BT_TRUE ) reduction(+:nFailed)
+#endif
+        for( run1 = 0; run1 < N; run1++ ){
             if( point_constraints[run1] != 0 ){
-                returnvalue = point_constraints[run1]->init( iter );
-                if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
-                returnvalue = point_constraints[run1]->evaluate( iter );
-                if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
+                if( point_constraints[run1]->init( iter ) != SUCCESSFUL_RETURN )
+                    nFailed++;
+                else if( point_constraints[run1]->evaluate( iter ) != SUCCESSFUL_RETURN )
+                    nFailed++;
             }
         }
+
+        if( nFailed > 0 ) return ACADOERROR(RET_UNABLE_TO_EVALUATE_CONSTRAINTS);
     }
 
 
@@ -513,12 +522,20 @@ returnValue Constraint::evaluateSensitivities( ){
     // --------------------------
 
     if( point_constraints != 0 ){
-        for( run1 = 0; run1 < grid.getNumPoints(); run1++ ){
-            if( point_constraints[run1] != 0 ){
-                returnvalue = point_constraints[run1]->evaluateSensitivities( );
-                if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
-            }
+
+        const uint N = grid.getNumPoints();
+        int nFailed = 0;
+
+#ifdef _OPENMP
+        #pragma omp parallel for schedule(dynamic) num_threads( acadoGetNumThreads( ) ) if( arePointConstraintsParallelizable( ) == BT_TRUE ) reduction(+:nFailed)
+#endif
+        for( run1 = 0; run1 < N; run1++ ){
+            if( point_constraints[run1] != 0 )
+                if( point_constraints[run1]->evaluateSensitivities( ) != SUCCESSFUL_RETURN )
+                    nFailed++;
         }
+
+        if( nFailed > 0 ) return ACADOERROR(RET_UNABLE_TO_EVALUATE_CONSTRAINTS);
     }
 
     return SUCCESSFUL_RETURN;
@@ -578,14 +595,34 @@ returnValue Constraint::evaluateSensitivities( const BlockMatrix &seed, BlockMat
     // --------------------------
 
     if( point_constraints != 0 ){
-        for( run1 = 0; run1 < grid.getNumPoints(); run1++ ){
+
+        const uint N = grid.getNumPoints();
+        int nFailed = 0;
+
+        // THE SEED BLOCK OF EACH POINT CONSTRAINT IS DETERMINED IN ADVANCE:
+        // -----------------------------------------------------------------
+        int *seedIdx = new int[N];
+
+        for( run1 = 0; run1 < N; run1++ ){
+            seedIdx[run1] = count;
+            if( point_constraints[run1] != 0 ) count++;
+        }
+
+#ifdef _OPENMP
+        #pragma omp parallel for schedule(dynamic) num_threads( acadoGetNumThreads( ) ) if( arePointConstraintsParallelizable( ) == BT_TRUE ) reduction(+:nFailed)
+#endif
+        for( run1 = 0; run1 < N; run1++ ){
             if( point_constraints[run1] != 0 ){
-                seed.getSubBlock( count, 0, tmp, point_constraints[run1]->getNC(), 1 );
-                returnvalue = point_constraints[run1]->evaluateSensitivities( tmp, hessian );
-                if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
-                count++;
+                Matrix seedTmp;
+                seed.getSubBlock( seedIdx[run1], 0, seedTmp, point_constraints[run1]->getNC(), 1 );
+                if( point_constraints[run1]->evaluateSensitivities( seedTmp, hessian ) != SUCCESSFUL_RETURN )
+                    nFailed++;
             }
         }
+
+        delete[] seedIdx;
+
+        if( nFailed > 0 ) return ACADOERROR(RET_UNABLE_TO_EVALUATE_CONSTRAINTS);
     }
     return SUCCESSFUL_RETURN;
 }
@@ -1186,6 +1223,29 @@ returnValue Constraint::add( const int index_, const double lb_,
     // ------------------
     if( lb_ > ub_ + EPS )  return ACADOERROR(RET_INFEASIBLE_CONSTRAINT);
 
+
+    // CHECK FOR A BOUND:
+    // ------------------
+    // (a simple bound at a single grid point is stored like a path bound which
+    //  is unbounded at all other grid points; hence, it is passed to the QP as
+    //  a bound and no constraint function needs to be evaluated for it)
+
+    if( arg.isVariable( ) == BT_TRUE ){
+        if( arg.getVariableType( ) != VT_INTERMEDIATE_STATE ){
+
+            Vector tmp_lb( grid.getNumPoints() );
+            Vector tmp_ub( grid.getNumPoints() );
+
+            tmp_lb.setAll( -INFTY );
+            tmp_ub.setAll(  INFTY );
+
+            tmp_lb( index_ ) = acadoMin( lb_, ub_ );
+            tmp_ub( index_ ) = ub_;
+
+            return add( tmp_lb, arg, tmp_ub );
+        }
+    }
+
     if( point_constraints[index_] == 0 )
         point_constraints[index_] = new PointConstraint(grid,index_);
 
@@ -1219,6 +1279,22 @@ returnValue Constraint::getBounds( const OCPiterate& iter ){
 }
 
 
+BooleanType Constraint::arePointConstraintsParallelizable( ) const{
+
+    uint run1;
+
+    if( point_constraints == 0 )
+        return BT_FALSE;
+
+    for( run1 = 0; run1 < grid.getNumPoints(); run1++ )
+        if( point_constraints[run1] != 0 )
+            if( point_constraints[run1]->isParallelizable( ) == BT_FALSE )
+                return BT_FALSE;
+
+    return BT_TRUE;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
@@ -52,6 +52,8 @@ ConstraintElement::ConstraintElement( ){
 	z       = 0;
 	JJ      = 0;
 
+    hessianColoring = 0;
+
     nx      = 0;
     na      = 0;
     nu      = 0;
@@ -98,6 +100,8 @@ ConstraintElement::ConstraintElement( const Grid& grid_, int nFcn_, int nB_ ){
     y_index = new int*    [nFcn];
     t_index = new int     [nFcn];
 
+    hessianColoring = new HessianColoring[nFcn];
+
     for( run1 = 0; run1 < nFcn; run1++ ){
         y_index[run1] = 0;
     }
@@ -152,6 +156,9 @@ ConstraintElement::ConstraintElement( const ConstraintElement& rhs ){
     if( rhs.t_index != 0 )  t_index = new int     [nFcn];
     else                    t_index = 0                 ;
 
+    if( rhs.hessianColoring != 0 )  hessianColoring = new HessianColoring[nFcn];
+    else                            hessianColoring = 0                        ;
+
 	if( rhs.z       != 0 )  z       = new EvaluationPoint( *(rhs.z) );
 	else                    z       = 0                 ;
 
@@ -179,6 +186,9 @@ ConstraintElement::ConstraintElement( const ConstraintElement& rhs ){
         }
 
         t_index[run1] = rhs.t_index[run1];
+
+        if( hessianColoring != 0 )
+            hessianColoring[run1] = rhs.hessianColoring[run1];
     }
 
     if( fcn == 0 ){
@@ -278,11 +288,14 @@ ConstraintElement::~ConstraintElement( ){
     if( t_index != 0 )
         delete[] t_index;
 
-	if ( z != 0 )
-		delete[] z;
-	
-	if ( JJ != 0 )
-		delete[] JJ;
+    if( hessianColoring != 0 )
+        delete[] hessianColoring;
+
+    if ( z != 0 )
+        delete[] z;
+
+    if ( JJ != 0 )
+        delete[] JJ;
 
     if( xSeed   != 0 ) delete xSeed  ;
     if( xaSeed  != 0 ) delete xaSeed ;
@@ -338,6 +351,9 @@ ConstraintElement& ConstraintElement::operator=( const ConstraintElement& rhs ){
         if( t_index != 0 )
             delete[] t_index;
 
+        if( hessianColoring != 0 )
+            delete[] hessianColoring;
+
 		if ( z != 0 )
 			delete[] z;
 		
@@ -380,6 +396,9 @@ ConstraintElement& ConstraintElement::operator=( const ConstraintElement& rhs ){
         if( rhs.t_index != 0 )  t_index = new int     [nFcn];
         else                    t_index = 0                 ;
 
+        if( rhs.hessianColoring != 0 )  hessianColoring = new HessianColoring[nFcn];
+        else                            hessianColoring = 0                        ;
+
 		if( rhs.z       != 0 )  z       = new EvaluationPoint( *(rhs.z) );
 		else                    z       = 0                 ;
 
@@ -408,6 +427,8 @@ ConstraintElement& ConstraintElement::operator=( const ConstraintElement& rhs ){
 
             t_index[run1] = rhs.t_index[run1];
 
+            if( hessianColoring != 0 )
+                hessianColoring[run1] = rhs.hessianColoring[run1];
         }
 
         if( fcn == 0 ){
@@ -520,6 +541,10 @@ returnValue ConstraintElement::init(  const OCPiterate& iter ){
             y_index[run2][nx+na+np+nu+run1] = fcn[run2].index( VT_DISTURBANCE, run1 );
 
         t_index[run2] = fcn[run2].index( VT_TIME, 0 );
+
+        // THE COLORING IS RECOMPUTED ON DEMAND:
+        // -------------------------------------
+        hessianColoring[run2] = HessianColoring();
     }
 
     return SUCCESSFUL_RETURN;
@@ -750,6 +775,59 @@ returnValue ConstraintElement::initializeEvaluationPoints( const OCPiterate& ite
 }
 
 
+returnValue ConstraintElement::evaluateSecondOrderDerivatives(	int     idx,
+																int     number,
+																double *bseed,
+																Matrix &D,
+																Matrix &H
+																)
+{
+	if( hessianColoring[idx].isInitialized() == BT_FALSE )
+		if( hessianColoring[idx].init( fcn[idx], nx, na, np, nu, nw, y_index[idx] ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_UNABLE_TO_EVALUATE_CONSTRAINTS );
+
+	return hessianColoring[idx].evaluate( fcn[idx], number, bseed, D, H );
+}
+
+
+returnValue ConstraintElement::addSecondOrderDerivatives(	int                dRow,
+															int                stage,
+															int                N,
+															const Matrix      &D,
+															const Matrix      &H,
+															BlockMatrix       &hessian
+															)
+{
+	int run1, run2;
+
+	int offset[6];
+
+	offset[0] = 0;
+	offset[1] = nx;
+	offset[2] = nx+na;
+	offset[3] = nx+na+np;
+	offset[4] = nx+na+np+nu;
+	offset[5] = nx+na+np+nu+nw;
+
+	for( run1 = 0; run1 < 5; run1++ )
+	{
+		if( offset[run1+1] == offset[run1] )
+			continue;
+
+		dBackward.setDense( dRow, run1*N+stage, D.getCols( offset[run1], offset[run1+1]-1 ) );
+
+		Matrix Hrow = H.getRows( offset[run1], offset[run1+1]-1 );
+		Hrow *= -1.0;
+
+		for( run2 = 0; run2 < 5; run2++ )
+			if( offset[run2+1] > offset[run2] )
+				hessian.addDense( run1*N+stage, run2*N+stage, Hrow.getCols( offset[run2], offset[run2+1]-1 ) );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
@@ -45,20 +45,28 @@ BEGIN_NAMESPACE_ACADO
 PathConstraint::PathConstraint( )
                :ConstraintElement(){
 
+    threadBuffer     = 0;
+    threadBufferSize = 0;
 }
 
 PathConstraint::PathConstraint( const Grid& grid_ )
                :ConstraintElement(grid_, 1, grid_.getNumPoints() ){
 
+    threadBuffer     = 0;
+    threadBufferSize = 0;
 }
 
 PathConstraint::PathConstraint( const PathConstraint& rhs )
                :ConstraintElement(rhs){
 
+    threadBuffer     = 0;
+    threadBufferSize = 0;
 }
 
 PathConstraint::~PathConstraint( ){
 
+    if( threadBuffer != 0 )
+        delete[] threadBuffer;
 }
 
 PathConstraint& PathConstraint::operator=( const PathConstraint& rhs ){
@@ -74,7 +82,7 @@ PathConstraint& PathConstraint::operator=( const PathConstraint& rhs ){
 
 returnValue PathConstraint::evaluate( const OCPiterate& iter ){
 
-    int run1, run2;
+    int run1;
 
     if( fcn == 0 ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
@@ -86,25 +94,53 @@ returnValue PathConstraint::evaluate( const OCPiterate& iter ){
     residuumL.init(T+1,1);
     residuumU.init(T+1,1);
 
-    for( run1 = 0; run1 <= T; run1++ ){
+    // THE LAST GRID POINT IS EVALUATED FIRST, SUCH THAT THE BUFFERS OF THE FUNCTION
+    // ALREADY HAVE THEIR FINAL SIZE WHEN THE OTHER POINTS ARE EVALUATED IN PARALLEL:
+    // ------------------------------------------------------------------------------
+    allocateThreadBuffer( nc );
+
+    evaluatePoint( T, iter, z[0], threadBuffer );
+
+#ifdef _OPENMP
+    #pragma omp parallel num_threads( acadoGetNumThreads( ) ) if( isParallelizable( 0 ) == BT_TRUE )
+#endif
+    {
+        EvaluationPoint zThread( z[0] );
+        double *result = &threadBuffer[ nc*acadoGetThreadNum( ) ];
+
+#ifdef _OPENMP
+        #pragma omp for schedule(static)
+#endif
+        for( run1 = 0; run1 < T; run1++ )
+            evaluatePoint( run1, iter, zThread, result );
+    }
 
-        Matrix resL( nc, 1 );
-        Matrix resU( nc, 1 );
+    return SUCCESSFUL_RETURN;
+}
 
-		z[0].setZ( run1, iter );
-		Vector result = fcn[0].evaluate( z[0],run1 );
 
-        for( run2 = 0; run2 < nc; run2++ ){
-             resL( run2, 0 ) = lb[run1][run2] - result(run2);
-             resU( run2, 0 ) = ub[run1][run2] - result(run2);
-        }
+returnValue PathConstraint::evaluatePoint( int idx, const OCPiterate& iter, EvaluationPoint& zThread, double *result ){
+
+    int run1;
 
-        // STORE THE RESULTS:
-        // ------------------
-        residuumL.setDense( run1, 0, resL );
-        residuumU.setDense( run1, 0, resU );
+    const int nc = fcn[0].getDim();
+
+    Matrix resL( nc, 1 );
+    Matrix resU( nc, 1 );
+
+    zThread.setZ( idx, iter );
+    fcn[0].evaluate( idx, zThread, result );
+
+    for( run1 = 0; run1 < nc; run1++ ){
+         resL( run1, 0 ) = lb[idx][run1] - result[run1];
+         resU( run1, 0 ) = ub[idx][run1] - result[run1];
     }
 
+    // STORE THE RESULTS:
+    // ------------------
+    residuumL.setDense( idx, 0, resL );
+    residuumU.setDense( idx, 0, resU );
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -112,8 +148,7 @@ returnValue PathConstraint::evaluate( const OCPiterate& iter ){
 returnValue PathConstraint::evaluateSensitivities(){
 
 
-    int run1, run3;
-    returnValue returnvalue;
+    int run3;
 
     if( fcn == 0 ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
@@ -129,54 +164,68 @@ returnValue PathConstraint::evaluateSensitivities(){
             xSeed2 != 0 || pSeed2 != 0 || uSeed2 != 0 || wSeed2 != 0 )
             return ACADOERROR( RET_WRONG_DEFINITION_OF_SEEDS );
 
-		int nBDirs;
-
         dBackward.init( N, 5*N );
 
+        int nFailed = 0;
 
-        for( run3 = 0; run3 < N; run3++ )
-		{
-            Matrix bseed_;
-            bSeed->getSubBlock( 0, run3, bseed_);
-			
-            nBDirs = bSeed->getNumRows( 0, run3 );
-
-            Matrix Dx ( nBDirs, nx );
-            Matrix Dxa( nBDirs, na );
-            Matrix Dp ( nBDirs, np );
-            Matrix Du ( nBDirs, nu );
-            Matrix Dw ( nBDirs, nw );
-
-			for( run1 = 0; run1 < nBDirs; run1++ )
-			{
-				ACADO_TRY( fcn[0].AD_backward( bseed_.getRow(run1),JJ[0],run3 ) );
-		
-				if( nx > 0 ) Dx .setRow( run1, JJ[0].getX () );
-				if( na > 0 ) Dxa.setRow( run1, JJ[0].getXA() );
-				if( np > 0 ) Dp .setRow( run1, JJ[0].getP () );
-				if( nu > 0 ) Du .setRow( run1, JJ[0].getU () );
-				if( nw > 0 ) Dw .setRow( run1, JJ[0].getW () );
-				
-				JJ[0].setZero( );
+#ifdef _OPENMP
+        #pragma omp parallel num_threads( acadoGetNumThreads( ) ) if( isParallelizable( 0 ) == BT_TRUE ) reduction(+:nFailed)
+#endif
+        {
+            EvaluationPoint JJthread( JJ[0] );
 
-            }
+#ifdef _OPENMP
+            #pragma omp for schedule(static)
+#endif
+            for( run3 = 0; run3 < N; run3++ )
+            {
+                int run1;
+
+                Matrix bseed_;
+                bSeed->getSubBlock( 0, run3, bseed_);
+
+                int nBDirs = bSeed->getNumRows( 0, run3 );
+
+                Matrix Dx ( nBDirs, nx );
+                Matrix Dxa( nBDirs, na );
+                Matrix Dp ( nBDirs, np );
+                Matrix Du ( nBDirs, nu );
+                Matrix Dw ( nBDirs, nw );
+
+                for( run1 = 0; run1 < nBDirs; run1++ )
+                {
+                    if( fcn[0].AD_backward( bseed_.getRow(run1),JJthread,run3 ) != SUCCESSFUL_RETURN )
+                        nFailed++;
+
+                    if( nx > 0 ) Dx .setRow( run1, JJthread.getX () );
+                    if( na > 0 ) Dxa.setRow( run1, JJthread.getXA() );
+                    if( np > 0 ) Dp .setRow( run1, JJthread.getP () );
+                    if( nu > 0 ) Du .setRow( run1, JJthread.getU () );
+                    if( nw > 0 ) Dw .setRow( run1, JJthread.getW () );
+
+                    JJthread.setZero( );
+                }
 
-			if( nx > 0 )
-				dBackward.setDense( run3,     run3, Dx );
+                if( nx > 0 )
+                    dBackward.setDense( run3,     run3, Dx );
 
-			if( na > 0 )
-				dBackward.setDense( run3,   N+run3, Dxa );
+                if( na > 0 )
+                    dBackward.setDense( run3,   N+run3, Dxa );
 
-			if( np > 0 )
-				dBackward.setDense( run3, 2*N+run3, Dp );
+                if( np > 0 )
+                    dBackward.setDense( run3, 2*N+run3, Dp );
 
-			if( nu > 0 )
-				dBackward.setDense( run3, 3*N+run3, Du );
+                if( nu > 0 )
+                    dBackward.setDense( run3, 3*N+run3, Du );
 
-			if( nw > 0 )
-				dBackward.setDense( run3, 4*N+run3, Dw );
+                if( nw > 0 )
+                    dBackward.setDense( run3, 4*N+run3, Dw );
+            }
         }
 
+        if( nFailed > 0 )
+            return ACADOERROR( RET_UNABLE_TO_EVALUATE_CONSTRAINTS );
+
 		return SUCCESSFUL_RETURN;
 	}
 	
@@ -197,264 +246,74 @@ returnValue PathConstraint::evaluateSensitivities( int &count, const BlockMatrix
 
     dBackward.init( N, 5*N );
 
-    for( run3 = 0; run3 < N; run3++ ){
-
-        Matrix seed;
-        seed_.getSubBlock( count, 0, seed, nc, 1 );
-        count++;
-
-        // EVALUATION OF THE SENSITIVITIES:
-        // --------------------------------
-
-        int run1, run2;
-
-        double *bseed1 = new double[nc];
-        double *bseed2 = new double[nc];
-        double *R      = new double[nc];
-        double *J      = new double[fcn[0].getNumberOfVariables() +1];
-        double *H      = new double[fcn[0].getNumberOfVariables() +1];
-        double *fseed  = new double[fcn[0].getNumberOfVariables() +1];
-
-        for( run1 = 0; run1 < nc; run1++ ){
-            bseed1[run1] = seed(run1,0);
-            bseed2[run1] = 0.0;
-        }
-
-        for( run1 = 0; run1 < fcn[0].getNumberOfVariables()+1; run1++ )
-            fseed[run1] = 0.0;
-
-        Matrix Dx ( nc, nx );
-        Matrix Dxa( nc, na );
-        Matrix Dp ( nc, np );
-        Matrix Du ( nc, nu );
-        Matrix Dw ( nc, nw );
-
-        Matrix Hx ( nx, nx );
-        Matrix Hxa( nx, na );
-        Matrix Hp ( nx, np );
-        Matrix Hu ( nx, nu );
-        Matrix Hw ( nx, nw );
-
-        for( run2 = 0; run2 < nx; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[0][run2]] = 1.0;
-            fcn[0].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dx( run1, run2 ) = R[run1];
-            fseed[y_index[0][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn[0].AD_backward2( run3, bseed1, bseed2, J, H );
-
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2, run1             ) = -H[y_index[0][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2, run1-nx          ) = -H[y_index[0][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2, run1-nx-na       ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2, run1-nx-na-np    ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-        }
-
-        if( nx > 0 ){
+    // THE COLORING IS SET UP BEFORE THE GRID POINTS ARE PROCESSED IN PARALLEL:
+    // ------------------------------------------------------------------------
+    if( hessianColoring[0].isInitialized() == BT_FALSE )
+        if( hessianColoring[0].init( fcn[0], nx, na, np, nu, nw, y_index[0] ) != SUCCESSFUL_RETURN )
+            return ACADOERROR(RET_UNABLE_TO_EVALUATE_CONSTRAINTS);
 
-            dBackward.setDense( run3, run3, Dx );
+    allocateThreadBuffer( nc );
 
-            if( nx > 0 ) hessian.addDense( run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( run3, 4*N + run3, Hw  );
-        }
-
-        Hx.init ( na, nx );
-        Hxa.init( na, na );
-        Hp.init ( na, np );
-        Hu.init ( na, nu );
-        Hw.init ( na, nw );
-
-        for( run2 = nx; run2 < nx+na; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[0][run2]] = 1.0;
-            fcn[0].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dxa( run1, run2-nx ) = R[run1];
-            fseed[y_index[0][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn[0].AD_backward2( run3, bseed1, bseed2, J, H );
-
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx, run1             ) = -H[y_index[0][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx, run1-nx          ) = -H[y_index[0][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx, run1-nx-na       ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx, run1-nx-na-np    ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-        }
-
-        if( na > 0 ){
-
-            dBackward.setDense( run3, N+run3, Dxa );
-
-            if( nx > 0 ) hessian.addDense( N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( N+run3, 4*N + run3, Hw  );
-        }
-
-        Hx.init ( np, nx );
-        Hxa.init( np, na );
-        Hp.init ( np, np );
-        Hu.init ( np, nu );
-        Hw.init ( np, nw );
-
-        for( run2 = nx+na; run2 < nx+na+np; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[0][run2]] = 1.0;
-            fcn[0].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dp( run1, run2-nx-na ) = R[run1];
-            fseed[y_index[0][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn[0].AD_backward2( run3, bseed1, bseed2, J, H );
+    int nFailed = 0;
 
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na, run1             ) = -H[y_index[0][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na, run1-nx          ) = -H[y_index[0][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na, run1-nx-na       ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na, run1-nx-na-np    ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-        }
-
-        if( np > 0 ){
+#ifdef _OPENMP
+    #pragma omp parallel num_threads( acadoGetNumThreads( ) ) if( isParallelizable( 0 ) == BT_TRUE ) reduction(+:nFailed)
+#endif
+    {
+        double *bseed1 = &threadBuffer[ nc*acadoGetThreadNum( ) ];
 
-            dBackward.setDense( run3, 2*N+run3, Dp );
+#ifdef _OPENMP
+        #pragma omp for schedule(static)
+#endif
+        for( run3 = 0; run3 < N; run3++ ){
 
-            if( nx > 0 ) hessian.addDense( 2*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 2*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 2*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 2*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 2*N+run3, 4*N + run3, Hw  );
-        }
+            int run1;
 
+            Matrix seed;
+            seed_.getSubBlock( count+run3, 0, seed, nc, 1 );
 
-        Hx.init ( nu, nx );
-        Hxa.init( nu, na );
-        Hp.init ( nu, np );
-        Hu.init ( nu, nu );
-        Hw.init ( nu, nw );
+            // EVALUATION OF THE SENSITIVITIES:
+            // --------------------------------
 
-        for( run2 = nx+na+np; run2 < nx+na+np+nu; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[0][run2]] = 1.0;
-            fcn[0].AD_forward( run3, fseed, R );
             for( run1 = 0; run1 < nc; run1++ )
-                Du( run1, run2-nx-na-np ) = R[run1];
-            fseed[y_index[0][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
+                bseed1[run1] = seed(run1,0);
 
-            fcn[0].AD_backward2( run3, bseed1, bseed2, J, H );
+            Matrix D, H;
 
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na-np, run1             ) = -H[y_index[0][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na-np, run1-nx          ) = -H[y_index[0][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na-np, run1-nx-na       ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na-np, run1-nx-na-np    ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na-np, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
+            if( evaluateSecondOrderDerivatives( 0, run3, bseed1, D, H ) != SUCCESSFUL_RETURN )
+                nFailed++;
+            else
+                addSecondOrderDerivatives( run3, run3, N, D, H, hessian );
         }
+    }
 
-        if( nu > 0 ){
-
-            dBackward.setDense( run3, 3*N+run3, Du );
+    count += N;
 
-            if( nx > 0 ) hessian.addDense( 3*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 3*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 3*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 3*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 3*N+run3, 4*N + run3, Hw  );
-        }
+    if( nFailed > 0 )
+        return ACADOERROR(RET_UNABLE_TO_EVALUATE_CONSTRAINTS);
 
-        Hx.init ( nw, nx );
-        Hxa.init( nw, na );
-        Hp.init ( nw, np );
-        Hu.init ( nw, nu );
-        Hw.init ( nw, nw );
-
-        for( run2 = nx+na+np+nu; run2 < nx+na+np+nu+nw; run2++ ){
+    return SUCCESSFUL_RETURN;
+}
 
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[0][run2]] = 1.0;
-            fcn[0].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dw( run1, run2-nx-na-np-nu ) = R[run1];
-            fseed[y_index[0][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
 
-            fcn[0].AD_backward2( run3, bseed1, bseed2, J, H );
 
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na-np-nu, run1             ) = -H[y_index[0][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na-np-nu, run1-nx          ) = -H[y_index[0][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na-np-nu, run1-nx-na       ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na-np-nu, run1-nx-na-np    ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na-np-nu, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-        }
 
-        if( nw > 0 ){
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
 
-            dBackward.setDense( run3, 4*N+run3, Dw );
+void PathConstraint::allocateThreadBuffer( int nc ){
 
-            if( nx > 0 ) hessian.addDense( 4*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 4*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 4*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 4*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 4*N+run3, 4*N + run3, Hw  );
-        }
+    int size = nc*acadoGetNumThreads( );
 
-        delete[] bseed1;
-        delete[] bseed2;
-        delete[] R     ;
-        delete[] J     ;
-        delete[] H     ;
-        delete[] fseed ;
-    }
+    if( size <= threadBufferSize )
+        return;
 
+    if( threadBuffer != 0 )
+        delete[] threadBuffer;
 
-    return SUCCESSFUL_RETURN;
+    threadBuffer     = new double[size];
+    threadBufferSize = size;
 }
 
 
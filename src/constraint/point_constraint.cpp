@@ -342,7 +342,7 @@ returnValue PointConstraint::evaluateSensitivities( const Matrix &seed, BlockMat
     // EVALUATION OF THE SENSITIVITIES:
     // --------------------------------
 
-    int run1, run2;
+    int run1;
 
     if( fcn == 0 ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
@@ -352,252 +352,21 @@ returnValue PointConstraint::evaluateSensitivities( const Matrix &seed, BlockMat
     ASSERT( (int) seed.getNumRows() == nc );
 
     double *bseed1 = new double[nc];
-    double *bseed2 = new double[nc];
-    double *R      = new double[nc];
-    double *J      = new double[fcn[0].getNumberOfVariables() +1];
-    double *H      = new double[fcn[0].getNumberOfVariables() +1];
-    double *fseed  = new double[fcn[0].getNumberOfVariables() +1];
 
-    for( run1 = 0; run1 < nc; run1++ ){
+    for( run1 = 0; run1 < nc; run1++ )
         bseed1[run1] = seed(run1,0);
-        bseed2[run1] = 0.0;
-    }
-
-    for( run1 = 0; run1 < fcn[0].getNumberOfVariables()+1; run1++ )
-        fseed[run1] = 0.0;
 
     dBackward.init( 1, 5*N );
 
-    Matrix Dx ( nc, nx );
-    Matrix Dxa( nc, na );
-    Matrix Dp ( nc, np );
-    Matrix Du ( nc, nu );
-    Matrix Dw ( nc, nw );
-
-    Matrix Hx ( nx, nx );
-    Matrix Hxa( nx, na );
-    Matrix Hp ( nx, np );
-    Matrix Hu ( nx, nu );
-    Matrix Hw ( nx, nw );
-
-    for( run2 = 0; run2 < nx; run2++ ){
-
-        // FIRST ORDER DERIVATIVES:
-        // ------------------------
-        fseed[y_index[0][run2]] = 1.0;
-        fcn[0].AD_forward( 0, fseed, R );
-        for( run1 = 0; run1 < nc; run1++ )
-            Dx( run1, run2 ) = R[run1];
-        fseed[y_index[0][run2]] = 0.0;
-
-        // SECOND ORDER DERIVATIVES:
-        // -------------------------
-        for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-            J[run1] = 0.0;
-            H[run1] = 0.0;
-        }
-
-        fcn[0].AD_backward2( 0, bseed1, bseed2, J, H );
-
-        for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2, run1             ) = -H[y_index[0][run1]];
-        for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2, run1-nx          ) = -H[y_index[0][run1]];
-        for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2, run1-nx-na       ) = -H[y_index[0][run1]];
-        for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2, run1-nx-na-np    ) = -H[y_index[0][run1]];
-        for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-    }
-
-    if( nx > 0 ){
-
-        dBackward.setDense( 0, point_index, Dx );
-
-        if( nx > 0 ) hessian.addDense( point_index,       point_index, Hx  );
-        if( na > 0 ) hessian.addDense( point_index,   N + point_index, Hxa );
-        if( np > 0 ) hessian.addDense( point_index, 2*N + point_index, Hp  );
-        if( nu > 0 ) hessian.addDense( point_index, 3*N + point_index, Hu  );
-        if( nw > 0 ) hessian.addDense( point_index, 4*N + point_index, Hw  );
-    }
-
-    Hx.init ( na, nx );
-    Hxa.init( na, na );
-    Hp.init ( na, np );
-    Hu.init ( na, nu );
-    Hw.init ( na, nw );
-
-    for( run2 = nx; run2 < nx+na; run2++ ){
-
-        // FIRST ORDER DERIVATIVES:
-        // ------------------------
-        fseed[y_index[0][run2]] = 1.0;
-        fcn[0].AD_forward( 0, fseed, R );
-        for( run1 = 0; run1 < nc; run1++ )
-            Dxa( run1, run2-nx ) = R[run1];
-        fseed[y_index[0][run2]] = 0.0;
-
-        // SECOND ORDER DERIVATIVES:
-        // -------------------------
-        for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-            J[run1] = 0.0;
-            H[run1] = 0.0;
-        }
-
-        fcn[0].AD_backward2( 0, bseed1, bseed2, J, H );
-
-        for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx, run1             ) = -H[y_index[0][run1]];
-        for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx, run1-nx          ) = -H[y_index[0][run1]];
-        for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx, run1-nx-na       ) = -H[y_index[0][run1]];
-        for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx, run1-nx-na-np    ) = -H[y_index[0][run1]];
-        for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-    }
-
-    if( na > 0 ){
-
-        dBackward.setDense( 0, N+point_index, Dxa );
-
-        if( nx > 0 ) hessian.addDense( N+point_index,       point_index, Hx  );
-        if( na > 0 ) hessian.addDense( N+point_index,   N + point_index, Hxa );
-        if( np > 0 ) hessian.addDense( N+point_index, 2*N + point_index, Hp  );
-        if( nu > 0 ) hessian.addDense( N+point_index, 3*N + point_index, Hu  );
-        if( nw > 0 ) hessian.addDense( N+point_index, 4*N + point_index, Hw  );
-    }
-
-    Hx.init ( np, nx );
-    Hxa.init( np, na );
-    Hp.init ( np, np );
-    Hu.init ( np, nu );
-    Hw.init ( np, nw );
-
-    for( run2 = nx+na; run2 < nx+na+np; run2++ ){
-
-        // FIRST ORDER DERIVATIVES:
-        // ------------------------
-        fseed[y_index[0][run2]] = 1.0;
-        fcn[0].AD_forward( 0, fseed, R );
-        for( run1 = 0; run1 < nc; run1++ )
-            Dp( run1, run2-nx-na ) = R[run1];
-        fseed[y_index[0][run2]] = 0.0;
-
-        // SECOND ORDER DERIVATIVES:
-        // -------------------------
-        for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-            J[run1] = 0.0;
-            H[run1] = 0.0;
-        }
-
-        fcn[0].AD_backward2( 0, bseed1, bseed2, J, H );
-
-        for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na, run1             ) = -H[y_index[0][run1]];
-        for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na, run1-nx          ) = -H[y_index[0][run1]];
-        for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na, run1-nx-na       ) = -H[y_index[0][run1]];
-        for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na, run1-nx-na-np    ) = -H[y_index[0][run1]];
-        for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-    }
-
-    if( np > 0 ){
-
-        dBackward.setDense( 0, 2*N+point_index, Dp );
-
-        if( nx > 0 ) hessian.addDense( 2*N+point_index,       point_index, Hx  );
-        if( na > 0 ) hessian.addDense( 2*N+point_index,   N + point_index, Hxa );
-        if( np > 0 ) hessian.addDense( 2*N+point_index, 2*N + point_index, Hp  );
-        if( nu > 0 ) hessian.addDense( 2*N+point_index, 3*N + point_index, Hu  );
-        if( nw > 0 ) hessian.addDense( 2*N+point_index, 4*N + point_index, Hw  );
-    }
-
-
-    Hx.init ( nu, nx );
-    Hxa.init( nu, na );
-    Hp.init ( nu, np );
-    Hu.init ( nu, nu );
-    Hw.init ( nu, nw );
-
-    for( run2 = nx+na+np; run2 < nx+na+np+nu; run2++ ){
-
-        // FIRST ORDER DERIVATIVES:
-        // ------------------------
-        fseed[y_index[0][run2]] = 1.0;
-        fcn[0].AD_forward( 0, fseed, R );
-        for( run1 = 0; run1 < nc; run1++ )
-            Du( run1, run2-nx-na-np ) = R[run1];
-        fseed[y_index[0][run2]] = 0.0;
-
-        // SECOND ORDER DERIVATIVES:
-        // -------------------------
-        for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-            J[run1] = 0.0;
-            H[run1] = 0.0;
-        }
-
-        fcn[0].AD_backward2( 0, bseed1, bseed2, J, H );
-
-        for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na-np, run1             ) = -H[y_index[0][run1]];
-        for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na-np, run1-nx          ) = -H[y_index[0][run1]];
-        for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na-np, run1-nx-na       ) = -H[y_index[0][run1]];
-        for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na-np, run1-nx-na-np    ) = -H[y_index[0][run1]];
-        for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na-np, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-    }
-
-    if( nu > 0 ){
-
-        dBackward.setDense( 0, 3*N+point_index, Du );
-
-        if( nx > 0 ) hessian.addDense( 3*N+point_index,       point_index, Hx  );
-        if( na > 0 ) hessian.addDense( 3*N+point_index,   N + point_index, Hxa );
-        if( np > 0 ) hessian.addDense( 3*N+point_index, 2*N + point_index, Hp  );
-        if( nu > 0 ) hessian.addDense( 3*N+point_index, 3*N + point_index, Hu  );
-        if( nw > 0 ) hessian.addDense( 3*N+point_index, 4*N + point_index, Hw  );
-    }
-
-    Hx.init ( nw, nx );
-    Hxa.init( nw, na );
-    Hp.init ( nw, np );
-    Hu.init ( nw, nu );
-    Hw.init ( nw, nw );
-
-    for( run2 = nx+na+np+nu; run2 < nx+na+np+nu+nw; run2++ ){
-
-        // FIRST ORDER DERIVATIVES:
-        // ------------------------
-        fseed[y_index[0][run2]] = 1.0;
-        fcn[0].AD_forward( 0, fseed, R );
-        for( run1 = 0; run1 < nc; run1++ )
-            Dw( run1, run2-nx-na-np-nu ) = R[run1];
-        fseed[y_index[0][run2]] = 0.0;
-
-        // SECOND ORDER DERIVATIVES:
-        // -------------------------
-        for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-            J[run1] = 0.0;
-            H[run1] = 0.0;
-        }
-
-        fcn[0].AD_backward2( 0, bseed1, bseed2, J, H );
-
-        for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na-np-nu, run1             ) = -H[y_index[0][run1]];
-        for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na-np-nu, run1-nx          ) = -H[y_index[0][run1]];
-        for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na-np-nu, run1-nx-na       ) = -H[y_index[0][run1]];
-        for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na-np-nu, run1-nx-na-np    ) = -H[y_index[0][run1]];
-        for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na-np-nu, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-    }
-
-    if( nw > 0 ){
-
-        dBackward.setDense( 0, 4*N+point_index, Dw );
-
-        if( nx > 0 ) hessian.addDense( 4*N+point_index,       point_index, Hx  );
-        if( na > 0 ) hessian.addDense( 4*N+point_index,   N + point_index, Hxa );
-        if( np > 0 ) hessian.addDense( 4*N+point_index, 2*N + point_index, Hp  );
-        if( nu > 0 ) hessian.addDense( 4*N+point_index, 3*N + point_index, Hu  );
-        if( nw > 0 ) hessian.addDense( 4*N+point_index, 4*N + point_index, Hw  );
-    }
+    Matrix D, H;
+    returnValue returnvalue = evaluateSecondOrderDerivatives( 0, 0, bseed1, D, H );
 
     delete[] bseed1;
-    delete[] bseed2;
-    delete[] R     ;
-    delete[] J     ;
-    delete[] H     ;
-    delete[] fseed ;
 
-    return SUCCESSFUL_RETURN;
+    if( returnvalue != SUCCESSFUL_RETURN )
+        return ACADOERROR(RET_UNABLE_TO_EVALUATE_CONSTRAINTS);
+
+    return addSecondOrderDerivatives( 0, point_index, N, D, H, hessian );
 }
 
 
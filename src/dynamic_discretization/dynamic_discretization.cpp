@@ -181,6 +181,18 @@ returnValue DynamicDiscretization::deleteAllSeeds(){
 }
 
 
+returnValue DynamicDiscretization::shiftMesh(){
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue DynamicDiscretization::setDeadline( double deadline_ ){
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 
 //
 // PROTECTED MEMBER FUNCTIONS:
@@ -206,6 +218,13 @@ returnValue DynamicDiscretization::setupOptions( ){
 	addOption( LINEAR_ALGEBRA_SOLVER       , defaultLinearAlgebraSolver     );
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
+	addOption( MAX_NUM_STORED_INTEGRATOR_STEPS, defaultMaxNumStoredSteps   );
+	addOption( WARM_START_INTEGRATOR       , defaultWarmStartIntegrator     );
+	addOption( MAX_NUM_STIFF_INTEGRATOR_STEPS , defaultMaxNumStiffSteps        );
+	addOption( AUTO_INTEGRATOR_SWITCH_TOLERANCE, defaultAutoIntegratorSwitchTolerance );
+
+	// add lifting options
+	addOption( NUM_LIFTED_NODES            , defaultNumLiftedNodes          );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -240,6 +259,8 @@ void DynamicDiscretization::initializeVariables(){
     np               = 0        ;
     nu               = 0        ;
     nw               = 0        ;
+
+    liftingTime      = 0.0      ;
 }
 
 void DynamicDiscretization::copy( const DynamicDiscretization& arg ){
@@ -251,6 +272,8 @@ void DynamicDiscretization::copy( const DynamicDiscretization& arg ){
     nu = arg.nu;
     nw = arg.nw;
 
+    liftingTime   = arg.liftingTime;
+
     unionGrid     = arg.unionGrid ;
     printLevel    = arg.printLevel;
     residuum      = arg.residuum  ;
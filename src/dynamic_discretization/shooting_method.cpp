@@ -46,14 +46,22 @@ BEGIN_NAMESPACE_ACADO
 
 ShootingMethod::ShootingMethod() : DynamicDiscretization( ){
 
-    integrator = 0;
+    integrator     = 0;
+    autoIntegrator = 0;
+    autoPoint      = 0;
+    mapSteps       = 0;
+    initializeLiftedVariables();
 }
 
 
 ShootingMethod::ShootingMethod( UserInteraction* _userInteraction )
                :DynamicDiscretization( _userInteraction ){
 
-    integrator = 0;
+    integrator     = 0;
+    autoIntegrator = 0;
+    autoPoint      = 0;
+    mapSteps       = 0;
+    initializeLiftedVariables();
 }
 
 ShootingMethod::ShootingMethod ( const ShootingMethod& arg ) : DynamicDiscretization( arg ){
@@ -92,7 +100,61 @@ void ShootingMethod::copy( const ShootingMethod &arg ){
     }
     else integrator = 0;
 
+    if( arg.autoIntegrator != 0 ){
+        autoIntegrator = (Integrator**)calloc(N,sizeof(Integrator*));
+        for( run1 = 0; run1 < N; run1++ ){
+            if( arg.autoIntegrator[run1] != 0 ) autoIntegrator[run1] = (arg.autoIntegrator[run1])->clone();
+            else                                autoIntegrator[run1] = 0                                  ;
+        }
+    }
+    else autoIntegrator = 0;
+
+    if( arg.autoPoint != 0 ){
+        autoPoint = new Vector[N];
+        for( run1 = 0; run1 < N; run1++ )
+            autoPoint[run1] = arg.autoPoint[run1];
+    }
+    else autoPoint = 0;
+
+    if( ( arg.mapSteps != 0 ) && ( N > 0 ) ){
+        mapSteps = (int*)calloc(N,sizeof(int));
+        for( run1 = 0; run1 < N; run1++ )
+            mapSteps[run1] = arg.mapSteps[run1];
+    }
+    else mapSteps = 0;
+
     breakPoints = arg.breakPoints;
+
+    initializeLiftedVariables();
+    nLifted = arg.nLifted;
+
+    if( arg.liftedIntegrator != 0 ){
+        liftedIntegrator = (Integrator**)calloc(N*nLifted,sizeof(Integrator*));
+        for( run1 = 0; run1 < N*nLifted; run1++ ){
+            if( arg.liftedIntegrator[run1] != 0 ) liftedIntegrator[run1] = (arg.liftedIntegrator[run1])->clone();
+            else                                  liftedIntegrator[run1] = 0                                    ;
+        }
+    }
+
+    if( arg.isLiftable != 0 ){
+
+        allocateLiftedVariables();
+
+        for( run1 = 0; run1 < N; run1++ ){
+            isLiftable      [run1] = arg.isLiftable      [run1];
+            liftedPoint     [run1] = arg.liftedPoint     [run1];
+            liftedPointRef  [run1] = arg.liftedPointRef  [run1];
+            liftedCorrection[run1] = arg.liftedCorrection[run1];
+        }
+        for( run1 = 0; run1 < N*nLifted; run1++ ){
+            liftedNodes    [run1] = arg.liftedNodes    [run1];
+            liftedNodesRef [run1] = arg.liftedNodesRef [run1];
+            liftedDefects  [run1] = arg.liftedDefects  [run1];
+            liftedOffsets  [run1] = arg.liftedOffsets  [run1];
+            liftedJacobians[run1] = arg.liftedJacobians[run1];
+            liftedSens     [run1] = arg.liftedSens     [run1];
+        }
+    }
 }
 
 DynamicDiscretization* ShootingMethod::clone( ) const{
@@ -127,17 +189,63 @@ returnValue ShootingMethod::addStage( const DynamicSystem  &dynamicSystem_,
     // CONSTRUCT THE APPROPRIATE INTEGRATOR BASED ON THE OPTIONS:
     // ----------------------------------------------------------
     int run1 = N;
+    const int nOld = N;
     unionGrid = unionGrid & stageIntervals;
     N         = unionGrid.getNumIntervals();
 
-    integrator = (Integrator**)realloc(integrator,N*sizeof(Integrator*));
+    integrator     = (Integrator**)realloc(integrator    ,N*sizeof(Integrator*));
+    autoIntegrator = (Integrator**)realloc(autoIntegrator,N*sizeof(Integrator*));
+
+    if( N > 0 ){
+        mapSteps = (int*)realloc(mapSteps,N*sizeof(int));
+        for( int run2 = nOld; run2 < N; run2++ )
+            mapSteps[run2] = 0;
+    }
 
     while( run1 < N ){
         allocateIntegrator( run1, (IntegratorType) integratorTypeTmp );
         integrator[run1]->init( differentialEquation_ );
+        autoIntegrator[run1] = 0;
+
+        if( integratorTypeTmp == INT_DISCRETE ) mapSteps[run1] =  0;
+        else                                    mapSteps[run1] = -1;
+
+        // INT_AUTO: START WITH RK45 AND KEEP A BDF INTEGRATOR IN RESERVE:
+        if( integratorTypeTmp == INT_AUTO ){
+            autoIntegrator[run1] = new IntegratorBDF();
+            autoIntegrator[run1]->init( differentialEquation_ );
+        }
         run1++;
     }
 
+    if( autoPoint != 0 ) delete[] autoPoint;
+    autoPoint = new Vector[N];
+
+
+    // ALLOCATE THE INTEGRATORS FOR THE LIFTED SUB-INTERVALS IF REQUESTED:
+    // -------------------------------------------------------------------
+    // (the sub-intervals are cloned before any transition is added, such
+    //  that only the last sub-interval evaluates the transition)
+    if( breakPoints.getNumRows() == 0 ){
+        get( NUM_LIFTED_NODES, nLifted );
+        if( nLifted < 0 ) nLifted = 0;
+    }
+
+    deleteLiftedVariables();
+
+    if( nLifted > 0 ){
+
+        liftedIntegrator = (Integrator**)realloc(liftedIntegrator,N*nLifted*sizeof(Integrator*));
+
+        for( run1 = nOld; run1 < N; run1++ ){
+            for( int run2 = 0; run2 < nLifted; run2++ ){
+                if( integratorTypeTmp == INT_DISCRETE ||
+                    integratorTypeTmp == INT_AUTO        ) liftedIntegrator[run1*nLifted+run2] = 0;
+                else                                    liftedIntegrator[run1*nLifted+run2] = integrator[run1]->clone();
+            }
+        }
+    }
+
     // STORE THE INFORMATION ABOUT STAGE-BREAK POINTS AND START/END TIMES:
     // -------------------------------------------------------------------
     int tmp = 0;
@@ -169,7 +277,10 @@ returnValue ShootingMethod::allocateIntegrator( uint idx, IntegratorType type_ )
          case INT_RK23    : integrator[idx] = new IntegratorRK23          (); break;
          case INT_RK45    : integrator[idx] = new IntegratorRK45          (); break;
          case INT_RK78    : integrator[idx] = new IntegratorRK78          (); break;
+         case INT_DOPRI5  : integrator[idx] = new IntegratorDOPRI5        (); break;
+         case INT_VERNER6 : integrator[idx] = new IntegratorVERNER6       (); break;
          case INT_BDF     : integrator[idx] = new IntegratorBDF           (); break;
+         case INT_AUTO    : integrator[idx] = new IntegratorRK45          (); break;
          case INT_UNKNOWN : integrator[idx] = new IntegratorBDF           (); break;
 
          default: return ACADOERROR( RET_UNKNOWN_BUG ); break;
@@ -184,6 +295,9 @@ returnValue ShootingMethod::addTransition( const Transition& transition_ ){
     if( transition_.getNXA() != 0 ) return ACADOERROR( RET_TRANSITION_DEPENDS_ON_ALGEBRAIC_STATES );
     integrator[N-1]->setTransition( transition_ );
 
+    if( autoIntegrator[N-1] != 0 )
+        autoIntegrator[N-1]->setTransition( transition_ );
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -192,7 +306,9 @@ returnValue ShootingMethod::clear(){
 
     deleteAllSeeds();
     ShootingMethod::deleteAll();
-    integrator = 0;
+    integrator     = 0;
+    autoIntegrator = 0;
+    mapSteps       = 0;
     breakPoints.init(0,0);
 
     return SUCCESSFUL_RETURN;
@@ -227,6 +343,13 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
     iter.getInitialData( x, xa, p, u, w );
 // 	iter.print();
 
+    if( nLifted > 0 && liftedIntegrator != 0 && isLiftable == 0 )
+        ACADO_TRY( allocateLiftedVariables() );
+
+    liftingTime = 0.0;
+
+    const BooleanType logging = isTrajectoryLogged();
+
     // RUN A LOOP OVER ALL INTERVALS OF THE UNION GRID:
     // ------------------------------------------------
 
@@ -259,15 +382,79 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
 		else
 			outputGrid.init( tStart,tEnd, 1+acadoRound( (tEnd-tStart)/integrator[run1]->getDifferentialEquationSampleTime() ) );
 
-        if ( integrator[run1]->integrate( outputGrid&evaluationGrid, x, xa, p, u, w ) != SUCCESSFUL_RETURN )
-			return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
+		// INTERVALS WITH LIFTED INTERMEDIATE NODES:
+		// (lifting starts after the first lifted sensitivity evaluation)
+		BooleanType lifted = BT_FALSE;
+		Vector      xLifted;
+
+		if( isLiftable != 0 ){
+
+			isLiftable[run1] = BT_FALSE;
+			if( na == 0 && evaluationGrid.getNumPoints( ) <= 2 && liftedIntegrator[run1*nLifted] != 0 &&
+			    acadoIsNegative( integrator[run1]->getDifferentialEquationSampleTime( ) ) == BT_TRUE )
+				isLiftable[run1] = BT_TRUE;
+
+			if ( isLiftable[run1] == BT_TRUE ){
+				for( uint run2 = 0; run2 < (uint) nLifted; run2++ ){
+					liftedIntegrator[run1*nLifted+run2]->setOptions( getOptions( 0 ) );
+					if ( (BooleanType)freezeIntegrator == BT_TRUE )
+						liftedIntegrator[run1*nLifted+run2]->freezeAll();
+				}
+			}
+
+			liftedPoint[run1] = x;
+			liftedPoint[run1].append( p );
+			liftedPoint[run1].append( u );
+			liftedPoint[run1].append( w );
+
+			if( isLiftable[run1] == BT_TRUE && liftedPointRef[run1].getDim() > 0 )
+				lifted = BT_TRUE;
+		}
+
+		if ( lifted == BT_TRUE )
+		{
+			if ( integrateLifted( run1, x, p, u, w, xLifted ) != SUCCESSFUL_RETURN )
+				return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
+		}
+		else if ( autoIntegrator[run1] != 0 )
+		{
+			if ( integrateAuto( run1, outputGrid&evaluationGrid, x, xa, p, u, w ) != SUCCESSFUL_RETURN )
+				return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
+		}
+		else if ( isMapEvaluable( run1, evaluationGrid ) == BT_TRUE )
+		{
+			// DISCRETE-TIME INTERVALS: EVALUATE THE MAP DIRECTLY
+			// (the final states are available by getX as usual)
+			IntegratorDiscretizedODE *map = (IntegratorDiscretizedODE*) integrator[run1];
+
+			int nSteps = acadoRound( (tEnd-tStart)/map->stepLength );
+			if ( nSteps < 1 ) nSteps = 1;
+
+			if ( map->evaluateMap( tStart, nSteps, x, p, u, w, logging ) != SUCCESSFUL_RETURN )
+				return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
+
+			mapSteps[run1] = nSteps;
+		}
+		else
+		{
+			if ( mapSteps[run1] > 0 ) mapSteps[run1] = 0;
+
+			if ( integrator[run1]->integrate( outputGrid&evaluationGrid, x, xa, p, u, w ) != SUCCESSFUL_RETURN )
+				return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
+
+			if( isLiftable != 0 ){
+				liftedCorrection[run1].init( nx );
+				liftedCorrection[run1].setZero( );
+			}
+		}
 
 		Vector xOld;
 		Vector pOld = p;
 		
 		if ( evaluationGrid.getNumPoints( ) <= 2 )
 		{
-			integrator[run1]->getX ( x  );
+			if ( lifted == BT_TRUE ) x = xLifted;
+			else                     integrator[run1]->getX ( x  );
 			integrator[run1]->getXA( xa );
 
 			xOld = x;
@@ -300,6 +487,9 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
 
     // LOG THE RESULTS:
     // ----------------
+    if( logging == BT_FALSE )
+        return SUCCESSFUL_RETURN;
+
     return logTrajectory( iter );
 }
 
@@ -314,6 +504,19 @@ returnValue ShootingMethod::differentiateBackward( const int    &idx ,
 
     uint run1;
 
+    if( mapSteps != 0 && mapSteps[idx] > 0 ){
+
+        Matrix Jx, Jp, Ju, Jw;
+        ACADO_TRY( getMapJacobian( idx, Jx, Jp, Ju, Jw ) );
+
+        Gx = seed*Jx;
+        Gp = seed*Jp;
+        Gu = seed*Ju;
+        Gw = seed*Jw;
+
+        return SUCCESSFUL_RETURN;
+    }
+
     Gx.init( seed.getNumRows(), nx );
     Gp.init( seed.getNumRows(), np );
     Gu.init( seed.getNumRows(), nu );
@@ -359,6 +562,20 @@ returnValue ShootingMethod::differentiateForward(  const int     &idx,
 
     D.init( nx, n );
 
+    if( mapSteps != 0 && mapSteps[idx] > 0 ){
+
+        Matrix Jx, Jp, Ju, Jw;
+        ACADO_TRY( getMapJacobian( idx, Jx, Jp, Ju, Jw ) );
+
+        D.setZero();
+        if( dX.isEmpty() == BT_FALSE ) D += Jx*dX;
+        if( dP.isEmpty() == BT_FALSE ) D += Jp*dP;
+        if( dU.isEmpty() == BT_FALSE ) D += Ju*dU;
+        if( dW.isEmpty() == BT_FALSE ) D += Jw*dW;
+
+        return SUCCESSFUL_RETURN;
+    }
+
     for( run1 = 0; run1 < n; run1++ ){
 
          Vector tmp;
@@ -406,6 +623,14 @@ returnValue ShootingMethod::differentiateForwardBackward( const int     &idx ,
     ddU.init( n, nu );
     ddW.init( n, nw );
 
+    // (second order derivatives are not provided by the direct map
+    //  evaluation, so the interval is integrated in the usual way)
+    if( mapSteps != 0 && mapSteps[idx] > 0 ){
+
+        ACADO_TRY( ((IntegratorDiscretizedODE*) integrator[idx])->reintegrateMap() );
+        mapSteps[idx] = 0;
+    }
+
     for( run1 = 0; run1 < n; run1++ ){
 
          Vector tmp;
@@ -497,70 +722,110 @@ returnValue ShootingMethod::evaluateSensitivities(){
 
 
 
-returnValue ShootingMethod::update( Matrix &G, const Matrix &A, const Matrix &B ){
-
-    if( B.getNumCols() == 0 ) return SUCCESSFUL_RETURN;
-
-    Matrix E = eye(B.getNumCols());
-    E *= 1e-10;
-
-    Matrix S = ((A^A)+E).getInverse();
-    G += (B-G*A)*(S*A.transpose());
-    return SUCCESSFUL_RETURN;
-}
-
-
-
 returnValue ShootingMethod::evaluateSensitivitiesLifted( ){
 
-    int i,j;
+    if( nLifted == 0 || isLiftable == 0 )
+        return evaluateSensitivities();
+
+    int i, k, run1;
+    RealClock clock;
 
     dForward.init( N, 5 );
-    Matrix Gx, *Gu, b, d, D, E, X, P, U, W, A, B;
-    Gu = new Matrix[N];
 
     for( i = 0; i < N; i++ ){
 
+        Matrix X, P, U, W, D, E, J, G, S;
+
         if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( i, 0, X );
         if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( i, 0, P );
         if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( i, 0, U );
         if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( i, 0, W );
 
-        if( np > 0 ){ D.init( nx, np ); D.setZero(); dForward.setDense( i, 2, D ); }
-        if( nw > 0 ){ D.init( nx, nw ); D.setZero(); dForward.setDense( i, 4, D ); }
+        if( isLiftable[i] == BT_FALSE ){
 
-        if( nu > 0 ){ ACADO_TRY( differentiateForward( i, E, E, U, E, D )); dForward.setDense( i, 3, D ); Gu[i] = D; }
-    }
+            if( nx > 0 ){ ACADO_TRY( differentiateForward( i, X, E, E, E, D )); dForward.setDense( i, 0, D ); }
+            if( np > 0 ){ ACADO_TRY( differentiateForward( i, E, P, E, E, D )); dForward.setDense( i, 2, D ); }
+            if( nu > 0 ){ ACADO_TRY( differentiateForward( i, E, E, U, E, D )); dForward.setDense( i, 3, D ); }
+            if( nw > 0 ){ ACADO_TRY( differentiateForward( i, E, E, E, W, D )); dForward.setDense( i, 4, D ); }
+            continue;
+        }
 
-    if( nu > 0 ){
+        // THE FIRST LIFTED SENSITIVITY EVALUATION INITIALIZES THE
+        // INTERMEDIATE NODES BY SIMULATING THE SUB-INTERVALS:
+        // -------------------------------------------------------
+        if( liftedPointRef[i].getDim() == 0 ){
 
-        d.init(nx,1);
-        d.setZero();
+            Vector x(nx), p(np), u(nu), w(nw), xEnd;
 
-        for( i = 0; i < N; i++ ){
-            A.init(0,0);
-            B.init(0,0);
-            for( j = 0; j < i; j++ ){
-                differentiateForward( i, Gu[j], E, E, E, D );
-                A.appendCols( Gu[j] );
-                B.appendCols( D     );
-                Gu[j] = D;
-            }
+            for( run1 = 0; run1 < nx; run1++ ) x(run1) = liftedPoint[i](         run1);
+            for( run1 = 0; run1 < np; run1++ ) p(run1) = liftedPoint[i](nx      +run1);
+            for( run1 = 0; run1 < nu; run1++ ) u(run1) = liftedPoint[i](nx+np   +run1);
+            for( run1 = 0; run1 < nw; run1++ ) w(run1) = liftedPoint[i](nx+np+nu+run1);
+
+            ACADO_TRY( integrateLifted( i, x, p, u, w, xEnd ) );
+        }
+
+
+        // CONDENSE THE LIFTED NODES:
+        // --------------------------
+        //   S_1     = J_0                      e_1     = d_0
+        //   S_{k+1} = G_k S_k + J_k^(p,u,w)    e_{k+1} = G_k e_k + d_k
+        //
+        ACADO_TRY( differentiateLifted( liftedIntegrator[i*nLifted], S ) );
+
+        clock.reset( );
+        clock.start( );
+
+        Vector e = liftedDefects[i*nLifted];
+        liftedSens   [i*nLifted] = S;
+        liftedOffsets[i*nLifted] = e;
+
+        clock.stop( );
+        liftingTime += clock.getTime();
 
-            if( i > 0 ){
-                differentiateForward( i, d, E, E, E, b );
-                A.appendCols( d );
-                B.appendCols( b );
-                d = b;
+        for( k = 1; k <= nLifted; k++ ){
+
+            if( k < nLifted ) ACADO_TRY( differentiateLifted( liftedIntegrator[i*nLifted+k], J ) );
+            else              ACADO_TRY( differentiateLifted( integrator[i]                  , J ) );
+
+            clock.reset( );
+            clock.start( );
+
+            G = J.getCols( 0, nx-1 );
+            liftedJacobians[i*nLifted+k-1] = G;
+
+            S = G*S;
+            for( run1 = nx; run1 < (int) J.getNumCols(); run1++ )
+                S.setCol( run1, S.getCol( run1 ) + J.getCol( run1 ) );
+
+            e = G*e;
+
+            if( k < nLifted ){
+                e += liftedDefects[i*nLifted+k];
+                liftedSens   [i*nLifted+k] = S;
+                liftedOffsets[i*nLifted+k] = e;
             }
-            d += residuum.getMatrix(i);
-            Gx = eye(nx);
-            Gx *= 0.001;
-            update( Gx, A, B );
-            dForward.setDense( i, 0, Gx );
+
+            clock.stop( );
+            liftingTime += clock.getTime();
         }
+
+
+        // REPLACE THE CONDENSED DEFECTS IN THE RESIDUUM
+        // AND STORE THE NEW LINEARIZATION POINT:
+        // ---------------------------------------------
+        residuum.setVector( i, residuum.getVector( i ) - liftedCorrection[i] + e );
+        liftedCorrection[i] = e;
+
+        liftedPointRef[i] = liftedPoint[i];
+        for( k = 0; k < nLifted; k++ )
+            liftedNodesRef[i*nLifted+k] = liftedNodes[i*nLifted+k];
+
+        if( nx > 0 && X.isEmpty() == BT_FALSE ) dForward.setDense( i, 0, S.getCols( 0       , nx         -1 )*X );
+        if( np > 0 && P.isEmpty() == BT_FALSE ) dForward.setDense( i, 2, S.getCols( nx      , nx+np      -1 )*P );
+        if( nu > 0 && U.isEmpty() == BT_FALSE ) dForward.setDense( i, 3, S.getCols( nx+np   , nx+np+nu   -1 )*U );
+        if( nw > 0 && W.isEmpty() == BT_FALSE ) dForward.setDense( i, 4, S.getCols( nx+np+nu, nx+np+nu+nw-1 )*W );
     }
-    delete[] Gu;
 
     return SUCCESSFUL_RETURN;
 }
@@ -635,8 +900,52 @@ returnValue ShootingMethod::evaluateSensitivities( const BlockMatrix &seed, Bloc
 returnValue ShootingMethod::unfreeze(){
 
     int run1;
-    for( run1 = 0; run1 < (int) unionGrid.getNumIntervals(); run1++ )
+    for( run1 = 0; run1 < (int) unionGrid.getNumIntervals(); run1++ ){
          integrator[run1]->unfreeze();
+         if( autoIntegrator[run1] != 0 )
+             autoIntegrator[run1]->unfreeze();
+    }
+
+    if( liftedIntegrator != 0 )
+        for( run1 = 0; run1 < N*nLifted; run1++ )
+            if( liftedIntegrator[run1] != 0 )
+                liftedIntegrator[run1]->unfreeze();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ShootingMethod::shiftMesh(){
+
+    int run1, run2;
+
+    for( run1 = 0; run1 < N-1; run1++ ){
+
+        integrator[run1]->setWarmStepSize( integrator[run1+1]->getWarmStepSize() );
+
+        if( liftedIntegrator != 0 )
+            for( run2 = 0; run2 < nLifted; run2++ )
+                if( liftedIntegrator[run1*nLifted+run2] != 0 && liftedIntegrator[(run1+1)*nLifted+run2] != 0 )
+                    liftedIntegrator[run1*nLifted+run2]->setWarmStepSize( liftedIntegrator[(run1+1)*nLifted+run2]->getWarmStepSize() );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ShootingMethod::setDeadline( double deadline_ ){
+
+    int run1;
+    for( run1 = 0; run1 < (int) unionGrid.getNumIntervals(); run1++ ){
+         integrator[run1]->setDeadline( deadline_ );
+         if( autoIntegrator[run1] != 0 )
+             autoIntegrator[run1]->setDeadline( deadline_ );
+    }
+
+    if( liftedIntegrator != 0 )
+        for( run1 = 0; run1 < N*nLifted; run1++ )
+            if( liftedIntegrator[run1] != 0 )
+                liftedIntegrator[run1]->setDeadline( deadline_ );
 
     return SUCCESSFUL_RETURN;
 }
@@ -647,8 +956,16 @@ returnValue ShootingMethod::deleteAllSeeds(){
     DynamicDiscretization::deleteAllSeeds();
 
     uint i;
-    for( i = 0; i < unionGrid.getNumIntervals(); i++ )
+    for( i = 0; i < unionGrid.getNumIntervals(); i++ ){
         integrator[i]->deleteAllSeeds();
+        if( autoIntegrator[i] != 0 )
+            autoIntegrator[i]->deleteAllSeeds();
+    }
+
+    if( liftedIntegrator != 0 )
+        for( i = 0; i < (uint) (N*nLifted); i++ )
+            if( liftedIntegrator[i] != 0 )
+                liftedIntegrator[i]->deleteAllSeeds();
 
     return SUCCESSFUL_RETURN;
 }
@@ -675,6 +992,33 @@ returnValue ShootingMethod::deleteAll(){
         integrator = 0;
     }
 
+    if( autoIntegrator != 0 ){
+        for( run1 = 0; run1 < N; run1++ )
+            if( autoIntegrator[run1] != 0 )
+                delete autoIntegrator[run1];
+        free(autoIntegrator);
+        autoIntegrator = 0;
+    }
+
+    if( autoPoint != 0 ){
+        delete[] autoPoint;
+        autoPoint = 0;
+    }
+
+    if( mapSteps != 0 ){
+        free(mapSteps);
+        mapSteps = 0;
+    }
+
+    if( liftedIntegrator != 0 ){
+        for( run1 = 0; run1 < N*nLifted; run1++ )
+            if( liftedIntegrator[run1] != 0 )
+                delete liftedIntegrator[run1];
+        free(liftedIntegrator);
+        liftedIntegrator = 0;
+    }
+    deleteLiftedVariables();
+
 	unionGrid.init();
 	DynamicDiscretization::initializeVariables( );
 
@@ -682,6 +1026,335 @@ returnValue ShootingMethod::deleteAll(){
 }
 
 
+returnValue ShootingMethod::integrateAuto( int idx, const Grid &t_, const Vector &x,
+                                           const Vector &xa, const Vector &p,
+                                           const Vector &u, const Vector &w ){
+
+    Vector z = x;
+    z.append( p );
+    z.append( u );
+    z.append( w );
+
+
+    // INVALIDATE THE CHOICE OF BDF IF THE START POINT HAS CHANGED SIGNIFICANTLY:
+    // --------------------------------------------------------------------------
+    double switchTolerance;
+    get( AUTO_INTEGRATOR_SWITCH_TOLERANCE, switchTolerance );
+
+    if( autoPoint[idx].getDim() > 0 ){
+
+        if( autoPoint[idx].getDim() != z.getDim() ||
+            (z - autoPoint[idx]).getNorm( VN_LINF ) > switchTolerance*( 1.0 + autoPoint[idx].getNorm( VN_LINF ) ) ){
+
+            ACADO_TRY( switchAutoIntegrator( idx ) );
+            autoPoint[idx].init( 0 );
+        }
+    }
+
+
+    // TRY THE EXPLICIT INTEGRATOR FIRST AND SWITCH TO BDF IF IT FAILS:
+    // ----------------------------------------------------------------
+    // (the RK45 stops by itself after MAX_NUM_STIFF_INTEGRATOR_STEPS steps
+    //  limited by stability)
+    if( autoPoint[idx].getDim() == 0 ){
+
+        int maxNumStiffSteps;
+        get( MAX_NUM_STIFF_INTEGRATOR_STEPS, maxNumStiffSteps );
+        ACADO_TRY( integrator[idx]->setMaxNumStiffSteps( maxNumStiffSteps ) );
+
+        if( integrator[idx]->integrate( t_, x, xa, p, u, w ) == SUCCESSFUL_RETURN )
+            return SUCCESSFUL_RETURN;
+
+        ACADO_TRY( switchAutoIntegrator( idx ) );
+        autoPoint[idx] = z;
+    }
+
+    return integrator[idx]->integrate( t_, x, xa, p, u, w );
+}
+
+
+returnValue ShootingMethod::switchAutoIntegrator( int idx ){
+
+    Integrator *tmp      = integrator[idx];
+    integrator[idx]      = autoIntegrator[idx];
+    autoIntegrator[idx]  = tmp;
+
+    integrator[idx]->setOptions( getOptions( 0 ) );
+
+    int freezeIntegrator;
+    get( FREEZE_INTEGRATOR, freezeIntegrator );
+
+    if ( (BooleanType)freezeIntegrator == BT_TRUE )
+        integrator[idx]->freezeAll();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+BooleanType ShootingMethod::isMapEvaluable( int idx, const Grid &evaluationGrid ) const{
+
+    if( mapSteps == 0 || mapSteps[idx] < 0 ) return BT_FALSE;
+    if( na > 0 || evaluationGrid.getNumPoints( ) > 2 ) return BT_FALSE;
+
+    const IntegratorDiscretizedODE *map = (const IntegratorDiscretizedODE*) integrator[idx];
+
+    if( map->transition != 0 || (int) map->getDim() != nx ) return BT_FALSE;
+
+    return BT_TRUE;
+}
+
+
+BooleanType ShootingMethod::isTrajectoryLogged( ) const{
+
+    if( isLogged( LOG_DIFFERENTIAL_STATES       ) == BT_TRUE ) return BT_TRUE;
+    if( isLogged( LOG_ALGEBRAIC_STATES          ) == BT_TRUE ) return BT_TRUE;
+    if( isLogged( LOG_PARAMETERS                ) == BT_TRUE ) return BT_TRUE;
+    if( isLogged( LOG_CONTROLS                  ) == BT_TRUE ) return BT_TRUE;
+    if( isLogged( LOG_DISTURBANCES              ) == BT_TRUE ) return BT_TRUE;
+    if( isLogged( LOG_INTERMEDIATE_STATES       ) == BT_TRUE ) return BT_TRUE;
+    if( isLogged( LOG_DISCRETIZATION_INTERVALS  ) == BT_TRUE ) return BT_TRUE;
+
+    return BT_FALSE;
+}
+
+
+returnValue ShootingMethod::getMapJacobian( int idx, Matrix &Jx, Matrix &Jp,
+                                            Matrix &Ju, Matrix &Jw ){
+
+    int run1, run2;
+    IntegratorDiscretizedODE *map = (IntegratorDiscretizedODE*) integrator[idx];
+
+    ACADO_TRY( map->evaluateMapSensitivities() );
+
+    const double *J  = map->getMapJacobian();
+    const int     mx = map->m;
+    const int     nJ = map->m + map->mp + map->mu + map->mw;
+
+    Jx.init( nx, nx );  Jx.setZero();
+    Jp.init( nx, np );  Jp.setZero();
+    Ju.init( nx, nu );  Ju.setZero();
+    Jw.init( nx, nw );  Jw.setZero();
+
+    for( run1 = 0; run1 < nx; run1++ ){
+        for( run2 = 0; run2 < mx     ; run2++ ) Jx( run1, run2 ) = J[run1*nJ + run2];
+        for( run2 = 0; run2 < map->mp; run2++ ) Jp( run1, run2 ) = J[run1*nJ + mx + run2];
+        for( run2 = 0; run2 < map->mu; run2++ ) Ju( run1, run2 ) = J[run1*nJ + mx + map->mp + run2];
+        for( run2 = 0; run2 < map->mw; run2++ ) Jw( run1, run2 ) = J[run1*nJ + mx + map->mp + map->mu + run2];
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+void ShootingMethod::initializeLiftedVariables( ){
+
+    nLifted          = 0;
+    liftedIntegrator = 0;
+    isLiftable       = 0;
+    liftedNodes      = 0;
+    liftedNodesRef   = 0;
+    liftedDefects    = 0;
+    liftedOffsets    = 0;
+    liftedJacobians  = 0;
+    liftedSens       = 0;
+    liftedPoint      = 0;
+    liftedPointRef   = 0;
+    liftedCorrection = 0;
+}
+
+
+returnValue ShootingMethod::allocateLiftedVariables( ){
+
+    int run1;
+
+    deleteLiftedVariables();
+
+    isLiftable       = new BooleanType[N];
+    liftedPoint      = new Vector     [N];
+    liftedPointRef   = new Vector     [N];
+    liftedCorrection = new Vector     [N];
+
+    liftedNodes      = new Vector[N*nLifted];
+    liftedNodesRef   = new Vector[N*nLifted];
+    liftedDefects    = new Vector[N*nLifted];
+    liftedOffsets    = new Vector[N*nLifted];
+    liftedJacobians  = new Matrix[N*nLifted];
+    liftedSens       = new Matrix[N*nLifted];
+
+    for( run1 = 0; run1 < N; run1++ )
+        isLiftable[run1] = BT_FALSE;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+void ShootingMethod::deleteLiftedVariables( ){
+
+    if( isLiftable       != 0 ) delete[] isLiftable      ;
+    if( liftedPoint      != 0 ) delete[] liftedPoint     ;
+    if( liftedPointRef   != 0 ) delete[] liftedPointRef  ;
+    if( liftedCorrection != 0 ) delete[] liftedCorrection;
+    if( liftedNodes      != 0 ) delete[] liftedNodes     ;
+    if( liftedNodesRef   != 0 ) delete[] liftedNodesRef  ;
+    if( liftedDefects    != 0 ) delete[] liftedDefects   ;
+    if( liftedOffsets    != 0 ) delete[] liftedOffsets   ;
+    if( liftedJacobians  != 0 ) delete[] liftedJacobians ;
+    if( liftedSens       != 0 ) delete[] liftedSens      ;
+
+    isLiftable       = 0;
+    liftedPoint      = 0;
+    liftedPointRef   = 0;
+    liftedCorrection = 0;
+    liftedNodes      = 0;
+    liftedNodesRef   = 0;
+    liftedDefects    = 0;
+    liftedOffsets    = 0;
+    liftedJacobians  = 0;
+    liftedSens       = 0;
+}
+
+
+returnValue ShootingMethod::integrateLifted( int idx, const Vector &x, const Vector &p,
+                                             const Vector &u, const Vector &w, Vector &xEnd ){
+
+    int k;
+    RealClock clock;
+
+    const double tStart = unionGrid.getTime( idx   );
+    const double tEnd   = unionGrid.getTime( idx+1 );
+    const double h      = ( tEnd - tStart )/( (double) (nLifted+1) );
+
+    BooleanType hasReference = BT_FALSE;
+    if( liftedPointRef[idx].getDim() > 0 ) hasReference = BT_TRUE;
+
+
+    // EXPAND THE LIFTED NODES BY THE LAST LINEARIZATION:
+    // --------------------------------------------------
+    if( hasReference == BT_TRUE ){
+
+        clock.reset( );
+        clock.start( );
+
+        Vector dz = liftedPoint[idx] - liftedPointRef[idx];
+
+        for( k = 0; k < nLifted; k++ )
+            liftedNodes[idx*nLifted+k] = liftedNodesRef[idx*nLifted+k] + liftedOffsets[idx*nLifted+k]
+                                       + liftedSens[idx*nLifted+k]*dz;
+        clock.stop( );
+        liftingTime += clock.getTime();
+    }
+
+
+    // INTEGRATE ALL SUB-INTERVALS STARTING FROM THE LIFTED NODES:
+    // -----------------------------------------------------------
+    Vector xs = x;
+    Vector xa, xk;
+
+    for( k = 0; k <= nLifted; k++ ){
+
+        Integrator *integrator_ = integrator[idx];
+        double      t2          = tEnd;
+
+        if( k < nLifted ){
+            integrator_ = liftedIntegrator[idx*nLifted+k];
+            t2          = tStart + (k+1)*h;
+        }
+
+        Grid outputGrid( tStart + k*h, t2, getNumEvaluationPoints() );
+
+        if( integrator_->integrate( outputGrid, xs, xa, p, u, w ) != SUCCESSFUL_RETURN )
+            return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
+
+        integrator_->getX( xk );
+
+        if( k < nLifted ){
+
+            // without linearization the nodes are initialized by simulation:
+            if( hasReference == BT_FALSE )
+                liftedNodes[idx*nLifted+k] = xk;
+
+            liftedDefects[idx*nLifted+k] = xk - liftedNodes[idx*nLifted+k];
+            xs = liftedNodes[idx*nLifted+k];
+        }
+    }
+
+
+    // PROPAGATE THE DEFECTS TO THE END OF THE INTERVAL:
+    // -------------------------------------------------
+    Vector e( nx );
+    e.setZero( );
+
+    if( hasReference == BT_TRUE ){
+
+        clock.reset( );
+        clock.start( );
+
+        e = liftedDefects[idx*nLifted];
+        for( k = 1; k < nLifted; k++ )
+            e = liftedJacobians[idx*nLifted+k-1]*e + liftedDefects[idx*nLifted+k];
+        e = liftedJacobians[idx*nLifted+nLifted-1]*e;
+
+        clock.stop( );
+        liftingTime += clock.getTime();
+    }
+
+    liftedCorrection[idx] = e;
+    xEnd = xk + e;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ShootingMethod::differentiateLifted( Integrator *integrator_, Matrix &J ){
+
+    int run1;
+    const int nz = nx+np+nu+nw;
+
+    J.init( nx, nz );
+
+    for( run1 = 0; run1 < nz; run1++ ){
+
+         Vector tmp;
+
+         Vector tmpX( nx ); tmpX.setZero();
+         Vector tmpP( np ); tmpP.setZero();
+         Vector tmpU( nu ); tmpU.setZero();
+         Vector tmpW( nw ); tmpW.setZero();
+
+         if     ( run1 < nx       ) tmpX( run1          ) = 1.0;
+         else if( run1 < nx+np    ) tmpP( run1-nx       ) = 1.0;
+         else if( run1 < nx+np+nu ) tmpU( run1-nx-np    ) = 1.0;
+         else                       tmpW( run1-nx-np-nu ) = 1.0;
+
+         ACADO_TRY( integrator_->setForwardSeed( 1, tmpX, tmpP, tmpU, tmpW ) );
+         ACADO_TRY( integrator_->integrateSensitivities( )                   );
+         ACADO_TRY( integrator_->getForwardSensitivities( tmp, 1 )           );
+
+         J.setCol( run1, tmp );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ShootingMethod::prependLiftedTrajectory( int idx, BooleanType intermediateStates,
+                                                     VariablesGrid &trajectory ) const{
+
+    int run1;
+    VariablesGrid sub, all;
+
+    for( run1 = 0; run1 < nLifted; run1++ ){
+        if( intermediateStates == BT_TRUE ) liftedIntegrator[idx*nLifted+run1]->getI( sub );
+        else                                liftedIntegrator[idx*nLifted+run1]->getX( sub );
+        all.appendTimes( sub );
+    }
+    all.appendTimes( trajectory );
+    trajectory = all;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue ShootingMethod::logTrajectory( const OCPiterate &iter ){
 
     if( integrator == 0 ) return SUCCESSFUL_RETURN;
@@ -712,6 +1385,8 @@ returnValue ShootingMethod::logTrajectory( const OCPiterate &iter ){
         if( i == 0 ) T = t1;
 
         integrator[i]->getX( tmp );
+        if( isLiftable != 0 && isLiftable[i] == BT_TRUE && liftedPointRef[i].getDim() > 0 )
+            prependLiftedTrajectory( i, BT_FALSE, tmp );
 
         intervalPoints(i+1,0) = intervalPoints(i,0) + tmp.getNumPoints();
 
@@ -752,6 +1427,8 @@ returnValue ShootingMethod::logTrajectory( const OCPiterate &iter ){
                       logW .appendTimes( tmp );
                     }
                       integrator[i]->getI( tmp );
+                      if( isLiftable != 0 && isLiftable[i] == BT_TRUE && liftedPointRef[i].getDim() > 0 )
+                          prependLiftedTrajectory( i, BT_TRUE, tmp );
                       if ( needToRescale == BT_TRUE ) rescale( &tmp, T, h );
                       logI .appendTimes( tmp );
         T = tmp.getLastTime();
@@ -271,6 +271,12 @@ returnValue Function::evaluate( int number, double *x, double *_result ){
 }
 
 
+returnValue Function::evaluateBatch( int nLanes, int ld, double *x, double *_result ){
+
+    return evaluationTree.evaluateBatch( nLanes, ld, x, _result );
+}
+
+
 
 returnValue Function::substitute( VariableType variableType_, int index_,
                                   double sub_ ){
@@ -319,6 +325,16 @@ BooleanType Function::isRationalIn( const Expression &variable ){
 }
 
 
+returnValue Function::getSparsityPattern( int           nVars,
+                                          VariableType *varType,
+                                          int          *component,
+                                          BooleanType  *jacobianPattern,
+                                          BooleanType  *hessianPattern ){
+
+    return evaluationTree.getSparsityPattern( nVars, varType, component, jacobianPattern, hessianPattern );
+}
+
+
 BooleanType Function::isNondecreasing(){
 
 
@@ -501,6 +517,14 @@ Vector Function::evaluate( const EvaluationPoint &x,
 }
 
 
+returnValue Function::evaluate( int                    number,
+                                const EvaluationPoint &x     ,
+                                double                *_result ){
+
+    return evaluate( number, x.getEvaluationPointer(), _result );
+}
+
+
 Vector Function::AD_forward( const EvaluationPoint &x,
                              const int        &number  ){
 
@@ -296,6 +296,30 @@ returnValue FunctionEvaluationTree::evaluate( int number, double *x, double *res
 }
 
 
+returnValue FunctionEvaluationTree::evaluateBatch( int nLanes, int ld, double *x, double *result ){
+
+    int run1;
+    returnValue returnvalue;
+
+    if( isSymbolic() == BT_FALSE )
+        return RET_NOT_IMPLEMENTED_YET;
+
+    for( run1 = 0; run1 < n; run1++ ){
+
+        returnvalue = sub[run1]->evaluateBatch( nLanes, ld, x, &x[ ld*indexList->index(VT_INTERMEDIATE_STATE,
+                                                                                        lhs_comp[run1]         ) ] );
+        if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+    }
+    for( run1 = 0; run1 < dim; run1++ ){
+
+        returnvalue = f[run1]->evaluateBatch( nLanes, ld, x, &result[run1*ld] );
+        if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 
 FunctionEvaluationTree* FunctionEvaluationTree::differentiate( int index_ ){
 
@@ -645,6 +669,69 @@ BooleanType FunctionEvaluationTree::isRationalIn( const Expression &variable ){
 }
 
 
+returnValue FunctionEvaluationTree::getSparsityPattern( int           nVars,
+                                                        VariableType *varType,
+                                                        int          *component,
+                                                        BooleanType  *jacobianPattern,
+                                                        BooleanType  *hessianPattern ){
+
+    int run1, run2, run3;
+
+    BooleanType  *implicit_dep = new BooleanType [n+1];
+    VariableType  pairType [2];
+    int           pairComp [2];
+
+
+    // JACOBIAN PATTERN:
+    // -----------------
+    for( run2 = 0; run2 < nVars; run2++ ){
+
+        for( run1 = 0; run1 < n; run1++ )
+            implicit_dep[run1] = sub[run1]->isDependingOn( 1, &varType[run2], &component[run2], implicit_dep );
+
+        for( run1 = 0; run1 < dim; run1++ )
+            jacobianPattern[run1*nVars+run2] = f[run1]->isDependingOn( 1, &varType[run2], &component[run2], implicit_dep );
+    }
+
+
+    // HESSIAN PATTERN:
+    // ----------------
+    // An entry (run2,run3) might be nonzero if one of the components depends on both
+    // variables. If there are no intermediate states, components that are linear in
+    // both variables jointly are skipped, as they have a zero second derivative w.r.t.
+    // this pair of variables.
+
+    for( run2 = 0; run2 < nVars; run2++ ){
+        for( run3 = run2; run3 < nVars; run3++ ){
+
+            BooleanType isNonzero = BT_FALSE;
+
+            pairType[0] = varType[run2];  pairComp[0] = component[run2];
+            pairType[1] = varType[run3];  pairComp[1] = component[run3];
+
+            for( run1 = 0; run1 < dim; run1++ ){
+
+                if( jacobianPattern[run1*nVars+run2] == BT_FALSE ) continue;
+                if( jacobianPattern[run1*nVars+run3] == BT_FALSE ) continue;
+
+                if( n == 0 && f[run1]->isLinearIn( 2, pairType, pairComp, implicit_dep ) == BT_TRUE )
+                    continue;
+
+                isNonzero = BT_TRUE;
+                break;
+            }
+
+            hessianPattern[run2*nVars+run3] = isNonzero;
+            hessianPattern[run3*nVars+run2] = isNonzero;
+        }
+    }
+
+    delete[] implicit_dep;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 MonotonicityType FunctionEvaluationTree::getMonotonicity( ){
 
     int run1;
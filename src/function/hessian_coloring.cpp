@@ -0,0 +1,360 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file src/function/hessian_coloring.cpp
+ *    \author agent
+ *    \date 2026
+ */
+
+
+#include <acado/function/hessian_coloring.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+HessianColoring::HessianColoring( ){
+
+    nVars           = 0;
+    nOut            = 0;
+    nColors         = 0;
+
+    varIndex        = 0;
+    color           = 0;
+    jacobianPattern = 0;
+    hessianPattern  = 0;
+}
+
+
+HessianColoring::HessianColoring( const HessianColoring& rhs ){
+
+    copy( rhs );
+}
+
+
+HessianColoring::~HessianColoring( ){
+
+    clear( );
+}
+
+
+HessianColoring& HessianColoring::operator=( const HessianColoring& rhs ){
+
+    if ( this != &rhs ){
+
+        clear( );
+        copy( rhs );
+    }
+    return *this;
+}
+
+
+
+returnValue HessianColoring::init(	Function     &f,
+									int           nVars_,
+									const int    *varIndex_,
+									VariableType *varType,
+									int          *component
+									){
+
+    int run1;
+
+    clear( );
+
+    nVars = nVars_;
+    nOut  = f.getDim();
+
+    varIndex        = new int        [nVars+1];
+    color           = new int        [nVars+1];
+    jacobianPattern = new BooleanType[nOut*nVars+1];
+    hessianPattern  = new BooleanType[nVars*nVars+1];
+
+    for( run1 = 0; run1 < nVars; run1++ )
+        varIndex[run1] = varIndex_[run1];
+
+    if( f.getSparsityPattern( nVars, varType, component, jacobianPattern, hessianPattern ) != SUCCESSFUL_RETURN ){
+
+        clear( );
+        return ACADOERROR(RET_UNKNOWN_BUG);
+    }
+
+    return computeColoring( );
+}
+
+
+
+returnValue HessianColoring::init(	Function     &f,
+									int           nx,
+									int           na,
+									int           np,
+									int           nu,
+									int           nw,
+									const int    *varIndex_
+									){
+
+    int run1;
+    const int ny = nx+na+np+nu+nw;
+
+    VariableType *varType   = new VariableType[ny+1];
+    int          *component = new int         [ny+1];
+
+    for( run1 = 0; run1 < ny; run1++ ){
+
+        if( run1 < nx ){
+            varType  [run1] = VT_DIFFERENTIAL_STATE;
+            component[run1] = run1;
+        }
+        else if( run1 < nx+na ){
+            varType  [run1] = VT_ALGEBRAIC_STATE;
+            component[run1] = run1-nx;
+        }
+        else if( run1 < nx+na+np ){
+            varType  [run1] = VT_PARAMETER;
+            component[run1] = run1-nx-na;
+        }
+        else if( run1 < nx+na+np+nu ){
+            varType  [run1] = VT_CONTROL;
+            component[run1] = run1-nx-na-np;
+        }
+        else{
+            varType  [run1] = VT_DISTURBANCE;
+            component[run1] = run1-nx-na-np-nu;
+        }
+    }
+
+    returnValue returnvalue = init( f, ny, varIndex_, varType, component );
+
+    delete[] varType  ;
+    delete[] component;
+
+    return returnvalue;
+}
+
+
+
+returnValue HessianColoring::evaluate(	Function &f,
+										int       number,
+										double   *bseed,
+										Matrix   &D,
+										Matrix   &H
+										){
+
+    if( isInitialized() == BT_FALSE )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+    int run1, run2, run3;
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    const int nv = f.getNumberOfVariables();
+
+    double *fseed  = new double[nv+1];
+    double *J      = new double[nv+1];
+    double *ddf    = new double[nv+1];
+    double *R      = new double[nOut+1];
+    double *bseed2 = new double[nOut+1];
+
+    for( run1 = 0; run1 <= nv; run1++ )
+        fseed[run1] = 0.0;
+
+    for( run1 = 0; run1 < nOut; run1++ )
+        bseed2[run1] = 0.0;
+
+    D.init( nOut , nVars );
+    H.init( nVars, nVars );
+    D.setZero();
+    H.setZero();
+
+    for( run3 = 0; run3 < nColors; run3++ ){
+
+        // FIRST ORDER DERIVATIVES:
+        // ------------------------
+        for( run2 = 0; run2 < nVars; run2++ )
+            if( color[run2] == run3 ) fseed[varIndex[run2]] = 1.0;
+
+        returnvalue = f.AD_forward( number, fseed, R );
+        if( returnvalue != SUCCESSFUL_RETURN ) break;
+
+        for( run2 = 0; run2 < nVars; run2++ ){
+            if( color[run2] == run3 ){
+                fseed[varIndex[run2]] = 0.0;
+                for( run1 = 0; run1 < nOut; run1++ )
+                    if( jacobianPattern[run1*nVars+run2] == BT_TRUE ) D( run1, run2 ) = R[run1];
+            }
+        }
+
+        // SECOND ORDER DERIVATIVES:
+        // -------------------------
+        for( run1 = 0; run1 <= nv; run1++ ){
+            J  [run1] = 0.0;
+            ddf[run1] = 0.0;
+        }
+
+        returnvalue = f.AD_backward2( number, bseed, bseed2, J, ddf );
+        if( returnvalue != SUCCESSFUL_RETURN ) break;
+
+        for( run2 = 0; run2 < nVars; run2++ ){
+            if( color[run2] == run3 ){
+                for( run1 = 0; run1 < nVars; run1++ )
+                    if( hessianPattern[run1*nVars+run2] == BT_TRUE ) H( run2, run1 ) = ddf[varIndex[run1]];
+            }
+        }
+    }
+
+    delete[] fseed ;
+    delete[] J     ;
+    delete[] ddf   ;
+    delete[] R     ;
+    delete[] bseed2;
+
+    return returnvalue;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue HessianColoring::computeColoring( ){
+
+    int run1, run2;
+
+    BooleanType *isForbidden = new BooleanType[nVars+1];
+
+    nColors = 0;
+
+    for( run1 = 0; run1 < nVars; run1++ ){
+
+        // VARIABLES THE FUNCTION DOES NOT DEPEND ON ARE NEVER SEEDED:
+        // ----------------------------------------------------------
+        color[run1] = -1;
+
+        for( run2 = 0; run2 < nOut; run2++ )
+            if( jacobianPattern[run2*nVars+run1] == BT_TRUE )
+                color[run1] = 0;
+
+        if( color[run1] < 0 ) continue;
+
+        for( run2 = 0; run2 < nColors; run2++ )
+            isForbidden[run2] = BT_FALSE;
+
+        for( run2 = 0; run2 < run1; run2++ )
+            if( color[run2] >= 0 && isOverlapping( run1, run2 ) == BT_TRUE )
+                isForbidden[color[run2]] = BT_TRUE;
+
+        color[run1] = 0;
+        while( color[run1] < nColors && isForbidden[color[run1]] == BT_TRUE )
+            color[run1]++;
+
+        if( color[run1] == nColors )
+            nColors++;
+    }
+
+    delete[] isForbidden;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+BooleanType HessianColoring::isOverlapping(	int idx1,
+											int idx2
+											) const{
+
+    int run1;
+
+    for( run1 = 0; run1 < nOut; run1++ )
+        if( jacobianPattern[run1*nVars+idx1] == BT_TRUE && jacobianPattern[run1*nVars+idx2] == BT_TRUE )
+            return BT_TRUE;
+
+    for( run1 = 0; run1 < nVars; run1++ )
+        if( hessianPattern[run1*nVars+idx1] == BT_TRUE && hessianPattern[run1*nVars+idx2] == BT_TRUE )
+            return BT_TRUE;
+
+    return BT_FALSE;
+}
+
+
+void HessianColoring::clear( ){
+
+    if( varIndex        != 0 ) delete[] varIndex       ;
+    if( color           != 0 ) delete[] color          ;
+    if( jacobianPattern != 0 ) delete[] jacobianPattern;
+    if( hessianPattern  != 0 ) delete[] hessianPattern ;
+
+    nVars           = 0;
+    nOut            = 0;
+    nColors         = 0;
+
+    varIndex        = 0;
+    color           = 0;
+    jacobianPattern = 0;
+    hessianPattern  = 0;
+}
+
+
+void HessianColoring::copy( const HessianColoring& rhs ){
+
+    int run1;
+
+    nVars   = rhs.nVars  ;
+    nOut    = rhs.nOut   ;
+    nColors = rhs.nColors;
+
+    if( rhs.color != 0 ){
+
+        varIndex        = new int        [nVars+1];
+        color           = new int        [nVars+1];
+        jacobianPattern = new BooleanType[nOut*nVars+1];
+        hessianPattern  = new BooleanType[nVars*nVars+1];
+
+        for( run1 = 0; run1 < nVars; run1++ ){
+            varIndex[run1] = rhs.varIndex[run1];
+            color   [run1] = rhs.color   [run1];
+        }
+        for( run1 = 0; run1 < nOut*nVars; run1++ )
+            jacobianPattern[run1] = rhs.jacobianPattern[run1];
+        for( run1 = 0; run1 < nVars*nVars; run1++ )
+            hessianPattern[run1] = rhs.hessianPattern[run1];
+    }
+    else{
+
+        varIndex        = 0;
+        color           = 0;
+        jacobianPattern = 0;
+        hessianPattern  = 0;
+    }
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -39,6 +39,8 @@
 #include <acado/integrator/integrator_runge_kutta12.hpp>
 #include <acado/integrator/integrator_runge_kutta23.hpp>
 #include <acado/integrator/integrator_runge_kutta45.hpp>
+#include <acado/integrator/integrator_dopri5.hpp>
+#include <acado/integrator/integrator_verner6.hpp>
 #include <acado/integrator/integrator_runge_kutta78.hpp>
 #include <acado/integrator/integrator_bdf.hpp>
 
@@ -75,6 +77,8 @@ Integrator::Integrator( )
     // ---------
     h     = (double*)calloc(1,sizeof(double));
     h[0]  = 0.001    ;
+    hWarm = 0.0      ;
+    deadline = -1.0  ;
     hmin  = 0.000001 ;
     hmax  = 1.0e10   ;
 
@@ -131,6 +135,28 @@ Integrator::Integrator( const Integrator &arg )
 
     if( arg.transition == 0 )  transition = 0;
     else                       transition = new Transition( *arg.transition );
+
+    hWarm    = arg.hWarm   ;
+    deadline = arg.deadline;
+
+    // the results of the last integration, such that a copy of a frozen
+    // integrator can evaluate sensitivities without integrating again:
+    timeInterval = arg.timeInterval;
+
+    xE  = arg.xE ;
+    dX  = arg.dX ;
+    dP  = arg.dP ;
+    dU  = arg.dU ;
+    dW  = arg.dW ;
+    dXb = arg.dXb;
+    dPb = arg.dPb;
+    dUb = arg.dUb;
+    dWb = arg.dWb;
+
+    xStore   = arg.xStore  ;
+    dxStore  = arg.dxStore ;
+    ddxStore = arg.ddxStore;
+    iStore   = arg.iStore  ;
 }
 
 
@@ -453,6 +479,53 @@ returnValue Integrator::getBackwardSensitivities(	Vector &DX,
 }
 
 
+double Integrator::getWarmStepSize() const{
+
+    return hWarm;
+}
+
+
+returnValue Integrator::setWarmStepSize( double hWarm_ ){
+
+    hWarm = hWarm_;
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Integrator::setDeadline( double deadline_ ){
+
+    deadline = deadline_;
+    return SUCCESSFUL_RETURN;
+}
+
+
+double Integrator::getDeadline() const{
+
+    return deadline;
+}
+
+
+BooleanType Integrator::isDeadlineReached() const{
+
+    if( deadline > 0.0 && acadoGetTime() > deadline )
+        return BT_TRUE;
+
+    return BT_FALSE;
+}
+
+
+int Integrator::getNumberOfStiffSteps() const{
+
+    return 0;
+}
+
+
+returnValue Integrator::setMaxNumStiffSteps( int maxNumStiffSteps_ ){
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 BooleanType Integrator::canHandleImplicitSwitches( ) const{
 
     return BT_FALSE;
@@ -575,6 +648,8 @@ returnValue Integrator::setupOptions( )
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
+	addOption( MAX_NUM_STORED_INTEGRATOR_STEPS, defaultMaxNumStoredSteps   );
+	addOption( WARM_START_INTEGRATOR       , defaultWarmStartIntegrator     );
 	
 	return SUCCESSFUL_RETURN;
 }
@@ -1277,6 +1277,12 @@ returnValue IntegratorBDF::evaluate( const Vector &x0  ,
 
         returnvalue = step(count);
         count++;
+
+        if( returnvalue == RET_FINAL_STEP_NOT_PERFORMED_YET && isDeadlineReached() == BT_TRUE ){
+            count2 = count-1;
+            totalTime.stop();
+            return RET_INTEGRATOR_DEADLINE_REACHED;
+        }
     }
 
 	// log final step
@@ -1747,6 +1753,9 @@ returnValue IntegratorBDF::evaluateSensitivities(){
 
             returnvalue = step(count);
             count++;
+
+            if( returnvalue == RET_FINAL_STEP_NOT_PERFORMED_YET && isDeadlineReached() == BT_TRUE )
+                return RET_INTEGRATOR_DEADLINE_REACHED;
         }
 
         if( nBDirs2 == 0 && nFDirs != 0 )
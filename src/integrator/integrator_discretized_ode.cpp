@@ -51,6 +51,17 @@ BEGIN_NAMESPACE_ACADO
 
 IntegratorDiscretizedODE::IntegratorDiscretizedODE( )
                          :IntegratorRK12( ){
+
+    mapComponents = 0;
+    mapStart      = 0;
+    mapSeed       = 0;
+    mapDir        = 0;
+    mapSens       = 0;
+    mapJacobian   = 0;
+    mapTime       = 0.0;
+    nMapSteps     = 0;
+
+    isMapJacobianValid = BT_FALSE;
 }
 
 
@@ -67,6 +78,17 @@ IntegratorDiscretizedODE::IntegratorDiscretizedODE( const DifferentialEquation &
     }
 
     stepLength = rhs_.getStepLength();
+
+    mapComponents = 0;
+    mapStart      = 0;
+    mapSeed       = 0;
+    mapDir        = 0;
+    mapSens       = 0;
+    mapJacobian   = 0;
+    mapTime       = 0.0;
+    nMapSteps     = 0;
+
+    isMapJacobianValid = BT_FALSE;
 }
 
 
@@ -74,11 +96,13 @@ IntegratorDiscretizedODE::IntegratorDiscretizedODE( const IntegratorDiscretizedO
                          :IntegratorRK12( arg ){
 
     stepLength = arg.stepLength;
+    copyMapMemory( arg );
 }
 
 
 IntegratorDiscretizedODE::~IntegratorDiscretizedODE( ){
 
+    deleteMapMemory();
 }
 
 
@@ -87,6 +111,8 @@ IntegratorDiscretizedODE& IntegratorDiscretizedODE::operator=( const IntegratorD
     if( this != &arg ){
         IntegratorRK12::operator=( arg );
         stepLength = arg.stepLength;
+        deleteMapMemory();
+        copyMapMemory( arg );
     }
     return *this;
 }
@@ -102,11 +128,172 @@ Integrator* IntegratorDiscretizedODE::clone() const{
 returnValue IntegratorDiscretizedODE::init( const DifferentialEquation &rhs_ )
 {
 	stepLength = rhs_.getStepLength( );
+	deleteMapMemory( );
 	return IntegratorRK12::init( rhs_ );
 }
 
 
 
+returnValue IntegratorDiscretizedODE::evaluateMap( double        t0    ,
+                                                   int           nSteps,
+                                                   Vector       &xd    ,
+                                                   const Vector &p     ,
+                                                   const Vector &u     ,
+                                                   const Vector &w     ,
+                                                   BooleanType   storeTrajectory ){
+
+    int run1, run2;
+
+    if( rhs == 0 ) return ACADOERROR( RET_TRIVIAL_RHS );
+    if( nSteps < 1 ) return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+    if( (int) xd.getDim() < m  || (int) p.getDim() < mp ||
+        (int) u.getDim()  < mu || (int) w.getDim() < mw )
+        return ACADOERROR( RET_INPUT_HAS_WRONG_DIMENSION );
+
+    if( mapComponents == 0 ) allocateMapMemory();
+
+
+    // LOAD THE INITIAL VALUES:
+    // ------------------------
+    for( run1 = 0; run1 < m; run1++ ){
+        eta4    [run1] = xd( mapComponents[run1] );
+        mapStart[run1] = eta4[run1];
+    }
+    for( run1 = 0; run1 < mp; run1++ ) x[parameter_index  [run1]] = p( run1 );
+    for( run1 = 0; run1 < mu; run1++ ) x[control_index    [run1]] = u( run1 );
+    for( run1 = 0; run1 < mw; run1++ ) x[disturbance_index[run1]] = w( run1 );
+
+    if( storeTrajectory == BT_TRUE ){
+
+        Grid trajectoryGrid( t0, t0 + nSteps*stepLength, nSteps+1 );
+        xStore.init(  m, trajectoryGrid );
+        iStore.init( mn, trajectoryGrid );
+
+        for( run1 = 0; run1 < m; run1++ )
+            xStore( 0, run1 ) = eta4[run1];
+    }
+
+
+    // PERFORM ALL STEPS (THE EVALUATION POINTS ARE KEPT FOR THE DERIVATIVES):
+    // -----------------------------------------------------------------------
+    t = t0;
+
+    for( run2 = 0; run2 < nSteps; run2++ ){
+
+        if( performDiscreteStep( run2 ) != SUCCESSFUL_RETURN )
+            return ACADOERROR( RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45 );
+
+        t = t + stepLength;
+
+        if( storeTrajectory == BT_TRUE ){
+            for( run1 = 0; run1 < m; run1++ )
+                xStore( run2+1, run1 ) = eta4[run1];
+            for( run1 = 0; run1 < mn; run1++ )
+                iStore( run2+1, run1 ) = x[rhs->index( VT_INTERMEDIATE_STATE, run1 )];
+        }
+    }
+
+    if( storeTrajectory == BT_TRUE )
+        for( run1 = 0; run1 < mn; run1++ )
+            iStore( 0, run1 ) = iStore( 1, run1 );
+
+
+    // RETURN THE FINAL STATES:
+    // ------------------------
+    x[time_index] = t;
+
+    if( (int) xE.getDim() != m )
+        xE.init( m );
+
+    for( run1 = 0; run1 < m; run1++ ){
+        x[diff_index[run1]]       = eta4[run1];
+        xd( mapComponents[run1] ) = eta4[run1];
+        xE( mapComponents[run1] ) = eta4[run1];
+    }
+
+    mapTime            = t0;
+    nMapSteps          = nSteps;
+    isMapJacobianValid = BT_FALSE;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue IntegratorDiscretizedODE::evaluateMapSensitivities( ){
+
+    int run1, run2, run3;
+
+    if( nMapSteps <= 0 || mapComponents == 0 )
+        return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+    if( isMapJacobianValid == BT_TRUE )
+        return SUCCESSFUL_RETURN;
+
+    const int nv = rhs->getNumberOfVariables() + 1 + m;
+    const int nJ = m + mp + mu + mw;
+
+    // (one unit direction after the other is propagated through all steps,
+    //  using the evaluation points stored by evaluateMap)
+    for( run1 = 0; run1 < nJ; run1++ ){
+
+        for( run2 = 0; run2 < nv; run2++ )
+            mapSeed[run2] = 0.0;
+
+        if( run1 >= m ){
+            if     ( run1 < m+mp       ) mapSeed[parameter_index  [run1-m      ]] = 1.0;
+            else if( run1 < m+mp+mu    ) mapSeed[control_index    [run1-m-mp   ]] = 1.0;
+            else                         mapSeed[disturbance_index[run1-m-mp-mu]] = 1.0;
+        }
+
+        for( run2 = 0; run2 < m; run2++ ){
+            if( mapComponents[run2] == run1 ) mapDir[run2] = 1.0;
+            else                              mapDir[run2] = 0.0;
+        }
+
+        for( run3 = 0; run3 < nMapSteps; run3++ ){
+
+            for( run2 = 0; run2 < m; run2++ )
+                mapSeed[diff_index[run2]] = mapDir[run2];
+
+            if( rhs[0].AD_forward( run3, mapSeed, mapSens ) != SUCCESSFUL_RETURN )
+                return ACADOERROR( RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45 );
+
+            for( run2 = 0; run2 < m; run2++ )
+                mapDir[run2] = mapSens[run2];
+        }
+
+        for( run2 = 0; run2 < m; run2++ )
+            mapJacobian[mapComponents[run2]*nJ + run1] = mapDir[run2];
+    }
+
+    isMapJacobianValid = BT_TRUE;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue IntegratorDiscretizedODE::reintegrateMap( ){
+
+    int run1;
+
+    if( nMapSteps <= 0 || mapComponents == 0 )
+        return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+    Vector x0( m ), xa, p( mp ), u( mu ), w( mw );
+
+    for( run1 = 0; run1 < m ; run1++ ) x0( mapComponents[run1] ) = mapStart[run1];
+    for( run1 = 0; run1 < mp; run1++ ) p ( run1 ) = x[parameter_index  [run1]];
+    for( run1 = 0; run1 < mu; run1++ ) u ( run1 ) = x[control_index    [run1]];
+    for( run1 = 0; run1 < mw; run1++ ) w ( run1 ) = x[disturbance_index[run1]];
+
+    return integrate( mapTime, mapTime + nMapSteps*stepLength, x0, xa, p, u, w );
+}
+
+
+
 returnValue IntegratorDiscretizedODE::step(int number){
 
     // DEFINE SOME LOCAL VARIABLES:
@@ -371,6 +558,85 @@ returnValue IntegratorDiscretizedODE::performADbackwardStep2( const int& number_
 
 
 
+void IntegratorDiscretizedODE::allocateMapMemory( ){
+
+    int run1;
+
+    Vector components = rhs->getDifferentialStateComponents();
+
+    mapComponents = new int   [m];
+    mapStart      = new double[m];
+    mapSeed       = new double[rhs->getNumberOfVariables() + 1 + m];
+    mapDir        = new double[m];
+    mapSens       = new double[m];
+    mapJacobian   = new double[m*(m+mp+mu+mw)];
+
+    for( run1 = 0; run1 < m; run1++ ){
+        mapComponents[run1] = (int) components(run1);
+        mapStart     [run1] = 0.0;
+    }
+
+    nMapSteps          = 0;
+    isMapJacobianValid = BT_FALSE;
+}
+
+
+
+void IntegratorDiscretizedODE::deleteMapMemory( ){
+
+    if( mapComponents != 0 ) delete[] mapComponents;
+    if( mapStart      != 0 ) delete[] mapStart     ;
+    if( mapSeed       != 0 ) delete[] mapSeed      ;
+    if( mapDir        != 0 ) delete[] mapDir       ;
+    if( mapSens       != 0 ) delete[] mapSens      ;
+    if( mapJacobian   != 0 ) delete[] mapJacobian  ;
+
+    mapComponents = 0;
+    mapStart      = 0;
+    mapSeed       = 0;
+    mapDir        = 0;
+    mapSens       = 0;
+    mapJacobian   = 0;
+    mapTime       = 0.0;
+    nMapSteps     = 0;
+
+    isMapJacobianValid = BT_FALSE;
+}
+
+
+
+void IntegratorDiscretizedODE::copyMapMemory( const IntegratorDiscretizedODE& arg ){
+
+    int run1;
+
+    mapComponents = 0;
+    mapStart      = 0;
+    mapSeed       = 0;
+    mapDir        = 0;
+    mapSens       = 0;
+    mapJacobian   = 0;
+    mapTime       = 0.0;
+    nMapSteps     = 0;
+
+    isMapJacobianValid = BT_FALSE;
+
+    if( arg.mapComponents == 0 ) return;
+
+    allocateMapMemory();
+
+    for( run1 = 0; run1 < m; run1++ )
+        mapStart[run1] = arg.mapStart[run1];
+
+    for( run1 = 0; run1 < m*(m+mp+mu+mw); run1++ )
+        mapJacobian[run1] = arg.mapJacobian[run1];
+
+    mapTime            = arg.mapTime;
+    nMapSteps          = arg.nMapSteps;
+    isMapJacobianValid = arg.isMapJacobianValid;
+}
+
+
+
 CLOSE_NAMESPACE_ACADO
 
 
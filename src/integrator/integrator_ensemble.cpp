@@ -0,0 +1,732 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/integrator/integrator_ensemble.cpp
+ *    \author agent
+ *    \date   2026
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/matrix_vector/matrix_vector.hpp>
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/function_.hpp>
+#include <acado/function/differential_equation.hpp>
+#include <acado/integrator/integrator.hpp>
+#include <acado/integrator/integrator_ensemble.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+IntegratorEnsemble::IntegratorEnsemble( )
+                   :AlgorithmicBase( ){
+
+    initializeVariables();
+    setupOptions();
+}
+
+
+IntegratorEnsemble::IntegratorEnsemble( const DifferentialEquation &rhs_,
+                                        IntegratorType             type_ )
+                   :AlgorithmicBase( ){
+
+    initializeVariables();
+    setupOptions();
+    init( rhs_, type_ );
+}
+
+
+IntegratorEnsemble::IntegratorEnsemble( const IntegratorEnsemble& arg )
+                   :AlgorithmicBase( arg ){
+
+    initializeVariables();
+    constructAll( arg );
+}
+
+
+IntegratorEnsemble::~IntegratorEnsemble( ){
+
+    deleteAll();
+}
+
+
+IntegratorEnsemble& IntegratorEnsemble::operator=( const IntegratorEnsemble& arg ){
+
+    if ( this != &arg ){
+
+        deleteAll();
+        AlgorithmicBase::operator=( arg );
+        initializeVariables();
+        constructAll( arg );
+    }
+    return *this;
+}
+
+
+returnValue IntegratorEnsemble::init( const DifferentialEquation &rhs_,
+                                      IntegratorType             type_ ){
+
+    int run1, run2;
+
+    if( rhs_.getNXA() != 0 || rhs_.getNDX() != 0 )
+        return ACADOERROR(RET_RK45_CAN_NOT_TREAT_DAE);
+
+    if( rhs_.getDim() < 1 )
+        return ACADOERROR(RET_TRIVIAL_RHS);
+
+
+    // GET THE BUTCHER TABLEAU FROM THE CORRESPONDING RK INTEGRATOR:
+    // -------------------------------------------------------------
+    IntegratorRK *prototype = 0;
+
+    switch( type_ ){
+
+        case INT_RK12: prototype = new IntegratorRK12(); break;
+        case INT_RK23: prototype = new IntegratorRK23(); break;
+        case INT_RK45: prototype = new IntegratorRK45(); break;
+        case INT_RK78: prototype = new IntegratorRK78(); break;
+        case INT_DOPRI5: prototype = new IntegratorDOPRI5(); break;
+        case INT_VERNER6: prototype = new IntegratorVERNER6(); break;
+
+        default: return ACADOERROR(RET_INVALID_ARGUMENTS);
+    }
+
+    deleteAll();
+    initializeVariables();
+
+    dim       = prototype->dim;
+    err_power = prototype->err_power;
+
+    A  = new double[dim*dim];
+    b4 = new double[dim];
+    b5 = new double[dim];
+    c  = new double[dim];
+
+    for( run1 = 0; run1 < dim; run1++ ){
+        for( run2 = 0; run2 < dim; run2++ )
+            A[run1*dim+run2] = prototype->A[run1][run2];
+        b4[run1] = prototype->b4[run1];
+        b5[run1] = prototype->b5[run1];
+        c [run1] = prototype->c [run1];
+    }
+
+    delete prototype;
+
+
+    // ONE COPY OF THE RIGHT-HAND SIDE PER THREAD:
+    // -------------------------------------------
+    nRhs = acadoGetNumThreads();
+    if( nRhs < 1 ) nRhs = 1;
+
+    rhs = new DifferentialEquation[nRhs];
+    for( run1 = 0; run1 < nRhs; run1++ )
+        rhs[run1] = rhs_;
+
+    m   = rhs_.getDim();
+    mu  = rhs_.getNU ();
+    mp  = rhs_.getNP ();
+    mw  = rhs_.getNW ();
+
+    allocateMemory();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue IntegratorEnsemble::integrate( double        t0,
+                                           double        tend,
+                                           const Matrix &x0,
+                                           const Matrix &p,
+                                           const Matrix &u,
+                                           const Matrix &w ){
+
+    int run1, run2;
+
+    if( rhs == 0 )
+        return ACADOERROR(RET_TRIVIAL_RHS);
+
+    if( x0.isEmpty() == BT_TRUE )
+        return ACADOERROR(RET_MISSING_INPUTS);
+
+    if( (int) x0.getNumCols() < m )
+        return ACADOERROR(RET_INPUT_HAS_WRONG_DIMENSION);
+
+    if( tend - t0 < 10.0*EPS )
+        return ACADOERROR(RET_TO_SMALL_OR_NEGATIVE_TIME_INTERVAL);
+
+
+    // GET THE OPTIONS:
+    // ----------------
+    int    maxNumberOfSteps, printLevel;
+    double TOL, atol, hini, hmin, hmax, tune;
+
+    get( MAX_NUM_INTEGRATOR_STEPS   , maxNumberOfSteps );
+    get( INTEGRATOR_TOLERANCE       , TOL              );
+    get( ABSOLUTE_TOLERANCE         , atol             );
+    get( INITIAL_INTEGRATOR_STEPSIZE, hini             );
+    get( MIN_INTEGRATOR_STEPSIZE    , hmin             );
+    get( MAX_INTEGRATOR_STEPSIZE    , hmax             );
+    get( STEPSIZE_TUNING            , tune             );
+    get( INTEGRATOR_PRINTLEVEL      , printLevel       );
+
+
+    // INITIALIZE THE LANES:
+    // ---------------------
+    allocateLanes( (int) x0.getNumRows() );
+
+    for( run1 = 0; run1 < m; run1++ ){
+        for( run2 = 0; run2 < nLanes; run2++ ){
+            eta4 [run1*nLanes+run2] = x0(run2,run1);
+            eta5 [run1*nLanes+run2] = x0(run2,run1);
+            scale[run1*nLanes+run2] = fabs(x0(run2,run1)) + atol/TOL;
+        }
+    }
+
+    if( setLaneData( p, mp, parameter_index   ) != SUCCESSFUL_RETURN ) return ACADOERROR(RET_INPUT_HAS_WRONG_DIMENSION);
+    if( setLaneData( u, mu, control_index     ) != SUCCESSFUL_RETURN ) return ACADOERROR(RET_INPUT_HAS_WRONG_DIMENSION);
+    if( setLaneData( w, mw, disturbance_index ) != SUCCESSFUL_RETURN ) return ACADOERROR(RET_INPUT_HAS_WRONG_DIMENSION);
+
+    double h0 = hini;
+    if( tend - t0 - h0 < EPS )
+        h0 = tend - t0;
+
+    for( run2 = 0; run2 < nLanes; run2++ ){
+        t        [run2] = t0;
+        h        [run2] = h0;
+        active   [run2] = 1 ;
+        nSteps   [run2] = 0 ;
+        nRejected[run2] = 0 ;
+    }
+    nBatchEvaluations = 0;
+
+    int nActive = nLanes;
+    double Emin = 1e-3*sqrt(TOL)*pow(hini, ((1.0/err_power)+1.0)/2.0 );
+
+
+    // THE MAIN LOOP:
+    // --------------
+    while( nActive > 0 ){
+
+        // in shared mode, all active lanes take the smallest step size:
+        // --------------------------------------------------------------
+        if( sharedStepSize == BT_TRUE ){
+
+            double hShared = tend;
+            for( run2 = 0; run2 < nLanes; run2++ )
+                if( active[run2] == 1 && h[run2] < hShared ) hShared = h[run2];
+            for( run2 = 0; run2 < nLanes; run2++ )
+                if( active[run2] == 1 ) h[run2] = hShared;
+        }
+
+        for( run2 = 0; run2 < nLanes; run2++ )
+            hStep[run2] = active[run2]*h[run2];
+
+        if( determineEta45() != SUCCESSFUL_RETURN )
+            return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45);
+
+
+        // in shared mode, the step is rejected for all lanes if one lane rejects it:
+        // --------------------------------------------------------------------------
+        int rejectAll = 0;
+        if( sharedStepSize == BT_TRUE ){
+            for( run2 = 0; run2 < nLanes; run2++ )
+                if( active[run2] == 1 && E[run2] >= TOL*h[run2] ) rejectAll = 1;
+        }
+
+        for( run2 = 0; run2 < nLanes; run2++ ){
+
+            if( active[run2] == 0 ) continue;
+
+            // REJECT THE STEP IF GIVEN TOLERANCE IS NOT ACHIEVED:
+            // ---------------------------------------------------
+            if( E[run2] >= TOL*h[run2] || rejectAll == 1 ){
+
+                if( printLevel == HIGH ){
+                    acadoPrintf("LANE %d: STEP REJECTED: error estimate           = %.16e \n", run2, E[run2]        );
+                    acadoPrintf("                        required local tolerance = %.16e \n",       TOL*h[run2]   );
+                }
+
+                nRejected[run2]++;
+
+                for( run1 = 0; run1 < m; run1++ )
+                    eta4[run1*nLanes+run2] = eta4_[run1*nLanes+run2];
+
+                if( h[run2] <= hmin + EPS )
+                    return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45);
+
+                h[run2] = 0.5*h[run2];
+                if( h[run2] < hmin ) h[run2] = hmin;
+                continue;
+            }
+
+            // PROCEED IF THE STEP IS ACCEPTED:
+            // --------------------------------
+            t     [run2] += h[run2];
+            nSteps[run2]++;
+
+            if( printLevel == HIGH )
+                acadoPrintf("LANE %d: t = %.16e  h = %.16e\n", run2, t[run2], h[run2] );
+
+            if( t[run2] >= tend - EPS ){
+                active[run2] = 0;
+                nActive--;
+                continue;
+            }
+
+            if( nSteps[run2] >= maxNumberOfSteps ){
+                if( printLevel != NONE )
+                    return ACADOERROR(RET_MAX_NUMBER_OF_STEPS_EXCEEDED);
+                return RET_MAX_NUMBER_OF_STEPS_EXCEEDED;
+            }
+
+            // recompute the scaling based on the actual states:
+            // -------------------------------------------------
+            for( run1 = 0; run1 < m; run1++ )
+                scale[run1*nLanes+run2] = fabs(eta4[run1*nLanes+run2]) + atol/TOL;
+
+            // determine the new step size:
+            // ----------------------------
+            double Elane = E[run2];
+            if( Elane < Emin     ) Elane = Emin    ;
+            if( Elane < 10.0*EPS ) Elane = 10.0*EPS;
+
+            h[run2] = h[run2]*pow( tune*(TOL*h[run2]/Elane), err_power );
+
+            if( h[run2] > hmax ) h[run2] = hmax;
+            if( h[run2] < hmin ) h[run2] = hmin;
+
+            if( t[run2] + h[run2] >= tend ) h[run2] = tend - t[run2];
+        }
+    }
+
+    if( printLevel == MEDIUM || printLevel == HIGH ){
+        for( run2 = 0; run2 < nLanes; run2++ )
+            acadoPrintf("ENSEMBLE: lane %d: number of steps:  %d (%d rejected)\n", run2, nSteps[run2], nRejected[run2] );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue IntegratorEnsemble::getX( Matrix &xEnd ) const{
+
+    int run1, run2;
+
+    xEnd.init( nLanes, m );
+
+    for( run2 = 0; run2 < nLanes; run2++ )
+        for( run1 = 0; run1 < m; run1++ )
+            xEnd(run2,run1) = eta4[run1*nLanes+run2];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue IntegratorEnsemble::setupOptions( ){
+
+    addOption( MAX_NUM_INTEGRATOR_STEPS    , defaultMaxNumSteps          );
+    addOption( INTEGRATOR_TOLERANCE        , defaultIntegratorTolerance  );
+    addOption( ABSOLUTE_TOLERANCE          , defaultAbsoluteTolerance    );
+    addOption( INITIAL_INTEGRATOR_STEPSIZE , defaultInitialStepsize      );
+    addOption( MIN_INTEGRATOR_STEPSIZE     , defaultMinStepsize          );
+    addOption( MAX_INTEGRATOR_STEPSIZE     , defaultMaxStepsize          );
+    addOption( STEPSIZE_TUNING             , defaultStepsizeTuning       );
+    addOption( INTEGRATOR_PRINTLEVEL       , defaultIntegratorPrintlevel );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+void IntegratorEnsemble::initializeVariables( ){
+
+    rhs = 0; nRhs = 0;
+    m = 0; mu = 0; mp = 0; mw = 0; nVars = 0;
+
+    diff_index = 0; control_index = 0; parameter_index = 0;
+    disturbance_index = 0; time_index = 0;
+
+    dim = 0; A = 0; b4 = 0; b5 = 0; c = 0;
+    err_power = 1.0;
+
+    nLanes = 0;
+    eta4 = 0; eta5 = 0; eta4_ = 0; k = 0; xStage = 0; x = 0;
+    f = 0; xThread = 0; scale = 0; t = 0; h = 0; hStep = 0; E = 0;
+    active = 0; nSteps = 0; nRejected = 0;
+    nBatchEvaluations = 0;
+
+    isBatched      = BT_FALSE;
+    sharedStepSize = BT_FALSE;
+}
+
+
+void IntegratorEnsemble::allocateMemory( ){
+
+    int run1;
+
+    nVars = rhs[0].getNumberOfVariables() + 1 + m;
+
+    diff_index = new int[m];
+
+    for( run1 = 0; run1 < m; run1++ ){
+        diff_index[run1] = rhs[0].getStateEnumerationIndex( run1 );
+        if( diff_index[run1] == rhs[0].getNumberOfVariables() ){
+            diff_index[run1] = diff_index[run1] + 1 + run1;
+        }
+    }
+
+    control_index = new int[mu];
+    for( run1 = 0; run1 < mu; run1++ )
+        control_index[run1] = rhs[0].index( VT_CONTROL, run1 );
+
+    parameter_index = new int[mp];
+    for( run1 = 0; run1 < mp; run1++ )
+        parameter_index[run1] = rhs[0].index( VT_PARAMETER, run1 );
+
+    disturbance_index = new int[mw];
+    for( run1 = 0; run1 < mw; run1++ )
+        disturbance_index[run1] = rhs[0].index( VT_DISTURBANCE, run1 );
+
+    time_index = rhs[0].index( VT_TIME, 0 );
+
+    f       = new double[nRhs*m    ];
+    xThread = new double[nRhs*nVars];
+
+    isBatched = rhs[0].isSymbolic();
+}
+
+
+void IntegratorEnsemble::allocateLanes( int nLanes_ ){
+
+    int run1;
+
+    if( nLanes_ != nLanes ){
+
+        if( eta4      != 0 ) delete[] eta4     ;
+        if( eta5      != 0 ) delete[] eta5     ;
+        if( eta4_     != 0 ) delete[] eta4_    ;
+        if( k         != 0 ) delete[] k        ;
+        if( xStage    != 0 ) delete[] xStage   ;
+        if( x         != 0 ) delete[] x        ;
+        if( scale     != 0 ) delete[] scale    ;
+        if( t         != 0 ) delete[] t        ;
+        if( h         != 0 ) delete[] h        ;
+        if( hStep     != 0 ) delete[] hStep    ;
+        if( E         != 0 ) delete[] E        ;
+        if( active    != 0 ) delete[] active   ;
+        if( nSteps    != 0 ) delete[] nSteps   ;
+        if( nRejected != 0 ) delete[] nRejected;
+
+        nLanes = nLanes_;
+
+        eta4      = new double[m*nLanes]    ;
+        eta5      = new double[m*nLanes]    ;
+        eta4_     = new double[m*nLanes]    ;
+        k         = new double[dim*m*nLanes];
+        xStage    = new double[m*nLanes]    ;
+        x         = new double[nVars*nLanes];
+        scale     = new double[m*nLanes]    ;
+        t         = new double[nLanes]      ;
+        h         = new double[nLanes]      ;
+        hStep     = new double[nLanes]      ;
+        E         = new double[nLanes]      ;
+        active    = new int   [nLanes]      ;
+        nSteps    = new int   [nLanes]      ;
+        nRejected = new int   [nLanes]      ;
+    }
+
+    for( run1 = 0; run1 < dim*m*nLanes; run1++ )
+        k[run1] = 0.0;
+
+    for( run1 = 0; run1 < nVars*nLanes; run1++ )
+        x[run1] = 0.0;
+}
+
+
+void IntegratorEnsemble::deleteAll( ){
+
+    if( rhs               != 0 ) delete[] rhs              ;
+    if( diff_index        != 0 ) delete[] diff_index       ;
+    if( control_index     != 0 ) delete[] control_index    ;
+    if( parameter_index   != 0 ) delete[] parameter_index  ;
+    if( disturbance_index != 0 ) delete[] disturbance_index;
+
+    if( A  != 0 ) delete[] A ;
+    if( b4 != 0 ) delete[] b4;
+    if( b5 != 0 ) delete[] b5;
+    if( c  != 0 ) delete[] c ;
+
+    if( eta4      != 0 ) delete[] eta4     ;
+    if( eta5      != 0 ) delete[] eta5     ;
+    if( eta4_     != 0 ) delete[] eta4_    ;
+    if( k         != 0 ) delete[] k        ;
+    if( xStage    != 0 ) delete[] xStage   ;
+    if( x         != 0 ) delete[] x        ;
+    if( f         != 0 ) delete[] f        ;
+    if( xThread   != 0 ) delete[] xThread  ;
+    if( scale     != 0 ) delete[] scale    ;
+    if( t         != 0 ) delete[] t        ;
+    if( h         != 0 ) delete[] h        ;
+    if( hStep     != 0 ) delete[] hStep    ;
+    if( E         != 0 ) delete[] E        ;
+    if( active    != 0 ) delete[] active   ;
+    if( nSteps    != 0 ) delete[] nSteps   ;
+    if( nRejected != 0 ) delete[] nRejected;
+}
+
+
+void IntegratorEnsemble::constructAll( const IntegratorEnsemble& arg ){
+
+    int run1;
+
+    sharedStepSize = arg.sharedStepSize;
+
+    if( arg.rhs == 0 ) return;
+
+    dim       = arg.dim      ;
+    err_power = arg.err_power;
+
+    A  = new double[dim*dim];
+    b4 = new double[dim];
+    b5 = new double[dim];
+    c  = new double[dim];
+
+    for( run1 = 0; run1 < dim*dim; run1++ )
+        A[run1] = arg.A[run1];
+
+    for( run1 = 0; run1 < dim; run1++ ){
+        b4[run1] = arg.b4[run1];
+        b5[run1] = arg.b5[run1];
+        c [run1] = arg.c [run1];
+    }
+
+    nRhs = arg.nRhs;
+    rhs  = new DifferentialEquation[nRhs];
+    for( run1 = 0; run1 < nRhs; run1++ )
+        rhs[run1] = arg.rhs[run1];
+
+    m  = arg.m ;
+    mu = arg.mu;
+    mp = arg.mp;
+    mw = arg.mw;
+
+    allocateMemory();
+
+    // the lane data is not copied, as it is only valid after integrate()
+}
+
+
+returnValue IntegratorEnsemble::setLaneData( const Matrix &data, int dim_, const int *index_ ){
+
+    int run1, run2;
+
+    if( dim_ == 0 ) return SUCCESSFUL_RETURN;
+
+    if( (int) data.getNumCols() < dim_ )
+        return RET_INPUT_HAS_WRONG_DIMENSION;
+
+    if( (int) data.getNumRows() != 1 && (int) data.getNumRows() != nLanes )
+        return RET_INPUT_HAS_WRONG_DIMENSION;
+
+    for( run2 = 0; run2 < nLanes; run2++ ){
+
+        int row = ( data.getNumRows() == 1 ) ? 0 : run2;
+
+        for( run1 = 0; run1 < dim_; run1++ )
+            x[index_[run1]*nLanes+run2] = data(row,run1);
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue IntegratorEnsemble::evaluateStage( int stage ){
+
+    int run1, lane;
+    int nFailed = 0;
+
+    // STORE THE TIMES AND STATES OF THE STAGE IN THE EVALUATION MATRIX:
+    // -----------------------------------------------------------------
+    double *xTime = &x[time_index*nLanes];
+
+    for( lane = 0; lane < nLanes; lane++ )
+        xTime[lane] = t[lane] + c[stage]*h[lane];
+
+    for( run1 = 0; run1 < m; run1++ ){
+
+        double       *xi = &x[diff_index[run1]*nLanes];
+        const double *xs = &xStage[run1*nLanes];
+
+        for( lane = 0; lane < nLanes; lane++ )
+            xi[lane] = xs[lane];
+    }
+
+    // EVALUATE ALL LANES IN ONE BATCH (ONE CONTIGUOUS BLOCK OF LANES PER THREAD):
+    // ---------------------------------------------------------------------------
+#ifdef _OPENMP
+    #pragma omp parallel num_threads( nRhs ) reduction(+:nFailed)
+#endif
+    {
+        int thread   = 0;
+        int nThreads = 1;
+#ifdef _OPENMP
+        thread   = omp_get_thread_num ();
+        nThreads = omp_get_num_threads();
+#endif
+        const int first = ( nLanes* thread    )/nThreads;
+        const int last  = ( nLanes*(thread+1) )/nThreads;
+
+        double *kStage = &k[stage*m*nLanes];
+
+        if( isBatched == BT_TRUE ){
+
+            if( rhs[thread].evaluateBatch( last-first, nLanes, &x[first], &kStage[first] ) != SUCCESSFUL_RETURN )
+                nFailed++;
+        }
+        else{
+
+            // non-symbolic right-hand sides are evaluated lane by lane:
+            // ---------------------------------------------------------
+            int     run2, run3;
+            double *xLane = &xThread[thread*nVars];
+            double *fLane = &f      [thread*m    ];
+
+            for( run2 = first; run2 < last; run2++ ){
+
+                if( active[run2] == 0 ) continue;
+
+                for( run3 = 0; run3 < nVars; run3++ )
+                    xLane[run3] = x[run3*nLanes+run2];
+
+                if( rhs[thread].evaluate( 0, xLane, fLane ) != SUCCESSFUL_RETURN ){
+                    nFailed++;
+                    continue;
+                }
+
+                for( run3 = 0; run3 < m; run3++ )
+                    kStage[run3*nLanes+run2] = fLane[run3];
+            }
+        }
+    }
+
+    nBatchEvaluations++;
+
+    if( nFailed > 0 )
+        return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45);
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue IntegratorEnsemble::determineEta45( ){
+
+    int run1, run2, run3, lane;
+    const int N = nLanes;
+
+    // determine k:
+    // -----------------------------------------------
+       for( run1 = 0; run1 < dim; run1++ ){
+
+           for( run2 = 0; run2 < m; run2++ ){
+
+               double       *xs = &xStage[run2*N];
+               const double *y  = &eta4  [run2*N];
+
+               for( lane = 0; lane < N; lane++ )
+                   xs[lane] = y[lane];
+
+               for( run3 = 0; run3 < run1; run3++ ){
+                   const double  a  = A[run1*dim+run3];
+                   const double *kk = &k[(run3*m+run2)*N];
+                   for( lane = 0; lane < N; lane++ )
+                       xs[lane] = xs[lane] + a*hStep[lane]*kk[lane];
+               }
+           }
+
+           if( evaluateStage( run1 ) != SUCCESSFUL_RETURN )
+               return RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45;
+       }
+
+    // save previous eta4:
+    // ----------------------------------------------
+       for( run1 = 0; run1 < m*N; run1++ ){
+           eta4_[run1] = eta4[run1];
+           eta5 [run1] = eta4[run1];
+       }
+
+    // determine eta4 and eta5:
+    // ----------------------------------------------
+       for( run1 = 0; run1 < dim; run1++ ){
+           for( run2 = 0; run2 < m; run2++ ){
+
+               double       *y4 = &eta4[run2*N];
+               double       *y5 = &eta5[run2*N];
+               const double *kk = &k[(run1*m+run2)*N];
+
+               for( lane = 0; lane < N; lane++ ){
+                   y4[lane] = y4[lane] + b4[run1]*hStep[lane]*kk[lane];
+                   y5[lane] = y5[lane] + b5[run1]*hStep[lane]*kk[lane];
+               }
+           }
+       }
+
+    // determine the local error estimate of each lane:
+    // ----------------------------------------------
+       for( lane = 0; lane < N; lane++ )
+           E[lane] = EPS;
+
+       for( run2 = 0; run2 < m; run2++ ){
+           for( lane = 0; lane < N; lane++ ){
+               double e = (eta4[run2*N+lane]-eta5[run2*N+lane])/scale[run2*N+lane];
+               if( e  >= E[lane] ) E[lane] =  e;
+               if( e <= -E[lane] ) E[lane] = -e;
+           }
+       }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+// end of file.
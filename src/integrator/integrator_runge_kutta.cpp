@@ -81,6 +81,7 @@ IntegratorRK::IntegratorRK( const DifferentialEquation& rhs_, int dim_, double p
 
     int run1;
 
+    initializeVariables();
     dim       = dim_  ;
     err_power = power_;
 
@@ -144,6 +145,16 @@ void IntegratorRK::initializeVariables(){
 
     maxAlloc  = 0;
     err_power = 1.0;
+
+    maxNumStoredSteps = 0; nCheckpoints = 0; maxCheckpoints = 0;
+    activeSegment = -1; nRecomputedSteps = 0;
+    tCheckpoint = 0; xCheckpoint = 0; gCheckpoint = 0;
+
+    nStiffSteps = 0; nNonStiffSteps = 0; maxStiffSteps = 0;
+    maxNumStiffSteps = 0;
+
+    isFSAL = BT_FALSE; kFSAL = 0; gFSAL = 0;
+    kFSALvalid = BT_FALSE; gFSALvalid = BT_FALSE;
 }
 
 
@@ -174,12 +185,17 @@ void IntegratorRK::allocateMemory( ){
     eta4_ = new double [m];
     eta5_ = new double [m];
 
+    kFSAL = new double [m];
+    gFSAL = new double [m];
+
     for( run1 = 0; run1 < m; run1++ ){
 
         eta4 [run1] = 0.0;
         eta5 [run1] = 0.0;
         eta4_[run1] = 0.0;
         eta5_[run1] = 0.0;
+        kFSAL[run1] = 0.0;
+        gFSAL[run1] = 0.0;
     }
 
     k     = new double*[dim];
@@ -195,9 +211,14 @@ void IntegratorRK::allocateMemory( ){
     t     = 0.0;
 
 
+    // (the stages are stored contiguously such that their linear
+    //  combinations run over consecutive memory)
+    k [0] = new double[dim*m];
+    k2[0] = new double[dim*m];
+
     for( run1 = 0; run1 < dim; run1++ ){
-        k    [run1] = new double[m];
-        k2   [run1] = new double[m];
+        k    [run1] = k [0] + run1*m;
+        k2   [run1] = k2[0] + run1*m;
 
         for( run2 = 0; run2 < m; run2++ ){
             k [run1][run2] = 0.0;
@@ -319,12 +340,21 @@ void IntegratorRK::deleteAll(){
     if( eta5_ != NULL ){
         delete[] eta5_;
     }
+    if( kFSAL != NULL ){
+        delete[] kFSAL;
+    }
+    if( gFSAL != NULL ){
+        delete[] gFSAL;
+    }
 
-    for( run1 = 0; run1 < dim; run1++ ){
-      if( k[run1]  != NULL )
-          delete[] k[run1] ;
-      if( k2[run1] != NULL )
-          delete[] k2[run1];
+    if( dim > 0 && k != NULL ){
+      if( k [0] != NULL )
+          delete[] k [0];
+      if( k2[0] != NULL )
+          delete[] k2[0];
+    }
+
+    for( run1 = 0; run1 < dim && k != NULL; run1++ ){
       if( l[run1]  != NULL )
           delete[] l[run1] ;
       if( l2[run1] != NULL )
@@ -388,6 +418,19 @@ void IntegratorRK::deleteAll(){
 
     if( etaH3  != NULL )
         delete[] etaH3;
+
+
+    // CHECKPOINTS:
+    // ----------------------------------------
+
+    if( tCheckpoint != NULL )
+        delete[] tCheckpoint;
+
+    if( xCheckpoint != NULL )
+        delete[] xCheckpoint;
+
+    if( gCheckpoint != NULL )
+        delete[] gCheckpoint;
 }
 
 
@@ -458,6 +501,17 @@ void IntegratorRK::constructAll( const IntegratorRK& arg ){
         eta5_[run1] = arg.eta5_[run1];
     }
 
+    kFSAL = new double [m];
+    gFSAL = new double [m];
+
+    for( run1 = 0; run1 < m; run1++ ){
+        kFSAL[run1] = arg.kFSAL[run1];
+        gFSAL[run1] = arg.gFSAL[run1];
+    }
+    isFSAL     = arg.isFSAL    ;
+    kFSALvalid = arg.kFSALvalid;
+    gFSALvalid = arg.gFSALvalid;
+
     k     = new double*[dim];
     k2    = new double*[dim];
     l     = new double*[dim];
@@ -471,9 +525,12 @@ void IntegratorRK::constructAll( const IntegratorRK& arg ){
     t     = arg.t;
 
 
+    k [0] = new double[dim*m];
+    k2[0] = new double[dim*m];
+
     for( run1 = 0; run1 < dim; run1++ ){
-        k    [run1] = new double[m];
-        k2   [run1] = new double[m];
+        k    [run1] = k [0] + run1*m;
+        k2   [run1] = k2[0] + run1*m;
 
         for( run2 = 0; run2 < m; run2++ ){
             k [run1][run2] = arg.k [run1][run2];
@@ -598,6 +655,42 @@ void IntegratorRK::constructAll( const IntegratorRK& arg ){
     // STORAGE:
     // --------
     maxAlloc = arg.maxAlloc;
+
+
+    // CHECKPOINTING:
+    // --------------
+    maxNumStoredSteps = arg.maxNumStoredSteps;
+    nCheckpoints      = arg.nCheckpoints     ;
+    maxCheckpoints    = arg.maxCheckpoints   ;
+    activeSegment     = arg.activeSegment    ;
+    nRecomputedSteps  = arg.nRecomputedSteps ;
+
+
+    // STIFFNESS DETECTION:
+    // --------------------
+    nStiffSteps       = arg.nStiffSteps      ;
+    nNonStiffSteps    = arg.nNonStiffSteps   ;
+    maxStiffSteps     = arg.maxStiffSteps    ;
+    maxNumStiffSteps  = arg.maxNumStiffSteps ;
+
+    tCheckpoint = NULL;
+    xCheckpoint = NULL;
+    gCheckpoint = NULL;
+
+    if( maxCheckpoints > 0 ){
+
+        tCheckpoint = new double[maxCheckpoints  ];
+        xCheckpoint = new double[maxCheckpoints*m];
+        gCheckpoint = new double[maxCheckpoints*m];
+
+        for( run1 = 0; run1 < maxCheckpoints; run1++ )
+            tCheckpoint[run1] = arg.tCheckpoint[run1];
+
+        for( run1 = 0; run1 < maxCheckpoints*m; run1++ ){
+            xCheckpoint[run1] = arg.xCheckpoint[run1];
+            gCheckpoint[run1] = arg.gCheckpoint[run1];
+        }
+    }
 }
 
 
@@ -637,6 +730,17 @@ returnValue IntegratorRK::unfreeze(){
     h = (double*)realloc(h,maxAlloc*sizeof(double));
     soa = SOA_UNFROZEN;
 
+    if( tCheckpoint != NULL ) delete[] tCheckpoint;
+    if( xCheckpoint != NULL ) delete[] xCheckpoint;
+    if( gCheckpoint != NULL ) delete[] gCheckpoint;
+
+    tCheckpoint    = NULL;
+    xCheckpoint    = NULL;
+    gCheckpoint    = NULL;
+    nCheckpoints   = 0;
+    maxCheckpoints = 0;
+    activeSegment  = -1;
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -661,6 +765,13 @@ returnValue IntegratorRK::evaluate( const Vector &x0  ,
 
     Integrator::initializeOptions();
 
+    if( soa == SOA_FREEZING_ALL ){
+        get( MAX_NUM_STORED_INTEGRATOR_STEPS, maxNumStoredSteps );
+        nCheckpoints     = 0;
+        activeSegment    = -1;
+        nRecomputedSteps = 0;
+    }
+
     timeInterval  = t_;
 
     xStore.init(  m, timeInterval );
@@ -675,6 +786,16 @@ returnValue IntegratorRK::evaluate( const Vector &x0  ,
     if( soa != SOA_MESH_FROZEN && soa != SOA_MESH_FROZEN_FREEZING_ALL && soa != SOA_EVERYTHING_FROZEN  ){
        h[0] = hini;
 
+       // start from the step size proposed in the previous integration:
+       int warmStart;
+       get( WARM_START_INTEGRATOR, warmStart );
+
+       if( (BooleanType) warmStart == BT_TRUE && hWarm > 0.0 ){
+           h[0] = hWarm*( timeInterval.getLastTime() - timeInterval.getFirstTime() );
+           if( h[0] > hmax ) h[0] = hmax;
+           if( h[0] < hmin ) h[0] = hmin;
+       }
+
        if( timeInterval.getLastTime() - timeInterval.getFirstTime() - h[0] < EPS ){
            h[0] = timeInterval.getLastTime() - timeInterval.getFirstTime();
 
@@ -763,10 +884,33 @@ returnValue IntegratorRK::evaluate( const Vector &x0  ,
     count3 = 0;
     count  = 1;
 
+    if( soa != SOA_EVERYTHING_FROZEN && soa != SOA_MESH_FROZEN && soa != SOA_MESH_FROZEN_FREEZING_ALL ){
+        nStiffSteps    = 0;
+        nNonStiffSteps = 0;
+        maxStiffSteps  = 0;
+    }
+
+    isFSAL     = hasFSALproperty();
+    kFSALvalid = BT_FALSE;
+    gFSALvalid = BT_FALSE;
+
     while( returnvalue == RET_FINAL_STEP_NOT_PERFORMED_YET && count <= maxNumberOfSteps ){
 
         returnvalue = step(count);
         count++;
+
+        if( returnvalue == RET_FINAL_STEP_NOT_PERFORMED_YET &&
+            maxNumStiffSteps > 0 && nStiffSteps >= maxNumStiffSteps ){
+            count2 = count-1;
+            totalTime.stop();
+            return RET_STIFFNESS_DETECTED;
+        }
+
+        if( returnvalue == RET_FINAL_STEP_NOT_PERFORMED_YET && isDeadlineReached() == BT_TRUE ){
+            count2 = count-1;
+            totalTime.stop();
+            return RET_INTEGRATOR_DEADLINE_REACHED;
+        }
     }
 
     count2 = count-1;
@@ -1165,6 +1309,9 @@ returnValue IntegratorRK::evaluateSensitivities(){
 
             returnvalue = step(count);
             count++;
+
+            if( returnvalue == RET_FINAL_STEP_NOT_PERFORMED_YET && isDeadlineReached() == BT_TRUE )
+                return RET_INTEGRATOR_DEADLINE_REACHED;
         }
 
         if( nBDirs2 == 0 && nFDirs != 0 )
@@ -1211,7 +1358,8 @@ returnValue IntegratorRK::step(int number_){
         }
     }
     if( soa == SOA_FREEZING_ALL ){
-        E = determineEta45(dim*number_);
+        storeCheckpoint( number_ );
+        E = determineEta45( getStorageIndex(number_) );
     }
 
 
@@ -1256,7 +1404,7 @@ returnValue IntegratorRK::step(int number_){
                 }
             }
             if( soa == SOA_FREEZING_ALL ){
-                E = determineEta45(dim*number_);
+                E = determineEta45( getStorageIndex(number_) );
             }
 
             if( E < 0.0 ){
@@ -1265,11 +1413,26 @@ returnValue IntegratorRK::step(int number_){
         }
 
         count3 += number_of_rejected_steps;
+
+        updateStiffnessEstimate();
+    }
+
+    // the last stage of a first-same-as-last scheme is the first stage
+    // of the next step:
+    if( kFSALvalid == BT_TRUE ){
+        if( isFSAL == BT_TRUE ){
+            for( run1 = 0; run1 < m; run1++ )
+                kFSAL[run1] = k[dim-1][run1];
+        }
+        else kFSALvalid = BT_FALSE;
     }
 
     // PROCEED IF THE STEP IS ACCEPTED:
     // --------------------------------
 
+       if( recomputeSegment( number_ ) != SUCCESSFUL_RETURN )
+           return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45);
+
        double *etaG_  = new double[m];
        double *etaG3_ = new double[m];
 
@@ -1287,7 +1450,8 @@ returnValue IntegratorRK::step(int number_){
          }
 
          if( soa == SOA_FREEZING_ALL || soa == SOA_EVERYTHING_FROZEN ){
-             determineEtaGForward(dim*number_);
+             storeSensitivityCheckpoint( number_ );
+             determineEtaGForward( getStorageIndex(number_) );
          }
          else{
              determineEtaGForward(0);
@@ -1301,7 +1465,7 @@ returnValue IntegratorRK::step(int number_){
          if( nFDirs != 0 || nBDirs2 != 0 || nFDirs2 != 0 ){
              return ACADOERROR(RET_WRONG_DEFINITION_OF_SEEDS);
          }
-         determineEtaHBackward(dim*number_);
+         determineEtaHBackward( getStorageIndex(number_) );
      }
      if( nFDirs2 > 0 ){
 
@@ -1314,7 +1478,7 @@ returnValue IntegratorRK::step(int number_){
          if( nBDirs != 0 || nBDirs2 != 0 || nFDirs != 1 ){
              return ACADOERROR(RET_WRONG_DEFINITION_OF_SEEDS);
          }
-         determineEtaGForward2(dim*number_);
+         determineEtaGForward2( getStorageIndex(number_) );
      }
      if( nBDirs2 > 0 ){
 
@@ -1325,7 +1489,7 @@ returnValue IntegratorRK::step(int number_){
              return ACADOERROR(RET_WRONG_DEFINITION_OF_SEEDS);
          }
 
-         determineEtaHBackward2(dim*number_);
+         determineEtaHBackward2( getStorageIndex(number_) );
      }
 
 
@@ -1436,6 +1600,9 @@ returnValue IntegratorRK::step(int number_){
           h[0] = hmin;
         }
 
+        if( number_ == 1 )
+            hWarm = h[0]/( timeInterval.getLastTime() - timeInterval.getFirstTime() );
+
         if( t + h[0] >= timeInterval.getLastTime() ){
           h[0] = timeInterval.getLastTime()-t;
         }
@@ -1600,6 +1767,19 @@ int IntegratorRK::getNumberOfRejectedSteps() const{
 }
 
 
+int IntegratorRK::getNumberOfStiffSteps() const{
+
+    return maxStiffSteps;
+}
+
+
+returnValue IntegratorRK::setMaxNumStiffSteps( int maxNumStiffSteps_ ){
+
+    maxNumStiffSteps = maxNumStiffSteps_;
+    return SUCCESSFUL_RETURN;
+}
+
+
 double IntegratorRK::getStepSize() const{
 
     return h[0];
@@ -1624,14 +1804,29 @@ double IntegratorRK::determineEta45(){
     // determine k:
     // -----------------------------------------------
        for( run1 = 0; run1 < dim; run1++ ){
-           x[time_index] = t + c[run1]*h[0];
-           for( run2 = 0; run2 < m; run2++ ){
-               x[diff_index[run2]] = eta4[run2];
-               for( run3 = 0; run3 < run1; run3++ ){
-                   x[diff_index[run2]] = x[diff_index[run2]] +
-                                         A[run1][run3]*h[0]*k[run3][run2];
-               }
+
+           // the first stage is known if it has been evaluated at the same
+           // point before (rejected step or first-same-as-last scheme):
+           if( run1 == 0 && kFSALvalid == BT_TRUE ){
+               for( run2 = 0; run2 < m; run2++ )
+                   k[0][run2] = kFSAL[run2];
+               continue;
            }
+
+           for( run2 = 0; run2 < m; run2++ )
+               eta5_[run2] = eta4[run2];
+
+           for( run3 = 0; run3 < run1; run3++ ){
+               const double a = A[run1][run3]*h[0];
+               if( a != 0.0 )
+                   for( run2 = 0; run2 < m; run2++ )
+                       eta5_[run2] += a*k[run3][run2];
+           }
+
+           x[time_index] = t + c[run1]*h[0];
+           for( run2 = 0; run2 < m; run2++ )
+               x[diff_index[run2]] = eta5_[run2];
+
            functionEvaluation.start();
 
            if( rhs[0].evaluate( 0, x, k[run1] ) != SUCCESSFUL_RETURN ){
@@ -1641,6 +1836,12 @@ double IntegratorRK::determineEta45(){
 
            functionEvaluation.stop();
            nFcnEvaluations++;
+
+           if( run1 == 0 && canReuseStages() == BT_TRUE ){
+               for( run2 = 0; run2 < m; run2++ )
+                   kFSAL[run2] = k[0][run2];
+               kFSALvalid = BT_TRUE;
+           }
        }
 
     // save previous eta4:
@@ -1688,14 +1889,29 @@ double IntegratorRK::determineEta45( int number_ ){
     // determine k:
     // -----------------------------------------------
        for( run1 = 0; run1 < dim; run1++ ){
-           x[time_index] = t + c[run1]*h[0];
-           for( run2 = 0; run2 < m; run2++ ){
-               x[diff_index[run2]] = eta4[run2];
-               for( run3 = 0; run3 < run1; run3++ ){
-                   x[diff_index[run2]] = x[diff_index[run2]] +
-                                         A[run1][run3]*h[0]*k[run3][run2];
-               }
+
+           // the first stage is known if it has been evaluated at the same
+           // point before (rejected step or first-same-as-last scheme):
+           if( run1 == 0 && kFSALvalid == BT_TRUE ){
+               for( run2 = 0; run2 < m; run2++ )
+                   k[0][run2] = kFSAL[run2];
+               continue;
            }
+
+           for( run2 = 0; run2 < m; run2++ )
+               eta5_[run2] = eta4[run2];
+
+           for( run3 = 0; run3 < run1; run3++ ){
+               const double a = A[run1][run3]*h[0];
+               if( a != 0.0 )
+                   for( run2 = 0; run2 < m; run2++ )
+                       eta5_[run2] += a*k[run3][run2];
+           }
+
+           x[time_index] = t + c[run1]*h[0];
+           for( run2 = 0; run2 < m; run2++ )
+               x[diff_index[run2]] = eta5_[run2];
+
            functionEvaluation.start();
 
            if( rhs[0].evaluate( number_+run1, x, k[run1] ) != SUCCESSFUL_RETURN ){
@@ -1705,6 +1921,12 @@ double IntegratorRK::determineEta45( int number_ ){
 
            functionEvaluation.stop();
            nFcnEvaluations++;
+
+           if( run1 == 0 && canReuseStages() == BT_TRUE ){
+               for( run2 = 0; run2 < m; run2++ )
+                   kFSAL[run2] = k[0][run2];
+               kFSALvalid = BT_TRUE;
+           }
        }
 
     // save previous eta4:
@@ -1746,13 +1968,29 @@ void IntegratorRK::determineEtaGForward( int number_ ){
     // determine k:
     // -----------------------------------------------
        for( run1 = 0; run1 < dim; run1++ ){
-           for( run2 = 0; run2 < m; run2++ ){
-               G[diff_index[run2]] = etaG[run2];
-               for( run3 = 0; run3 < run1; run3++ ){
-                   G[diff_index[run2]] = G[diff_index[run2]] +
-                                               A[run1][run3]*h[0]*k[run3][run2];
-               }
+
+           // the first stage of a first-same-as-last scheme is the last
+           // stage of the previous step (the nominal stage has not been
+           // re-evaluated in this case):
+           if( run1 == 0 && number_ == 0 && gFSALvalid == BT_TRUE ){
+               for( run2 = 0; run2 < m; run2++ )
+                   k[0][run2] = gFSAL[run2];
+               continue;
            }
+
+           for( run2 = 0; run2 < m; run2++ )
+               eta5_[run2] = etaG[run2];
+
+           for( run3 = 0; run3 < run1; run3++ ){
+               const double a = A[run1][run3]*h[0];
+               if( a != 0.0 )
+                   for( run2 = 0; run2 < m; run2++ )
+                       eta5_[run2] += a*k[run3][run2];
+           }
+
+           for( run2 = 0; run2 < m; run2++ )
+               G[diff_index[run2]] = eta5_[run2];
+
            if( rhs[0].AD_forward( number_+run1, G, k[run1] ) != SUCCESSFUL_RETURN ){
                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45);
                return;
@@ -1766,6 +2004,12 @@ void IntegratorRK::determineEtaGForward( int number_ ){
                etaG[run2] = etaG[run2] + b4[run1]*h[0]*k[run1][run2];
            }
        }
+
+       if( number_ == 0 && isFSAL == BT_TRUE && kFSALvalid == BT_TRUE ){
+           for( run2 = 0; run2 < m; run2++ )
+               gFSAL[run2] = k[dim-1][run2];
+           gFSALvalid = BT_TRUE;
+       }
 }
 
 
@@ -2033,6 +2277,218 @@ void IntegratorRK::printIntermediateResults(){
      }
 }
 
+int IntegratorRK::getStorageIndex( int number_ ) const{
+
+    if( maxNumStoredSteps <= 0 )
+        return dim*number_;
+
+    return dim*( 1 + (number_-1)%maxNumStoredSteps );
+}
+
+
+void IntegratorRK::storeCheckpoint( int number_ ){
+
+    int run1;
+
+    if( maxNumStoredSteps <= 0 ) return;
+
+    activeSegment = (number_-1)/maxNumStoredSteps;
+
+    if( (number_-1)%maxNumStoredSteps != 0 ) return;
+
+    if( activeSegment >= maxCheckpoints ){
+
+        int maxOld = maxCheckpoints;
+        maxCheckpoints = 2*activeSegment + 1;
+
+        double *tTmp = new double[maxCheckpoints  ];
+        double *xTmp = new double[maxCheckpoints*m];
+        double *gTmp = new double[maxCheckpoints*m];
+
+        for( run1 = 0; run1 < maxOld; run1++ )
+            tTmp[run1] = tCheckpoint[run1];
+
+        for( run1 = 0; run1 < maxOld*m; run1++ ){
+            xTmp[run1] = xCheckpoint[run1];
+            gTmp[run1] = gCheckpoint[run1];
+        }
+
+        if( tCheckpoint != NULL ) delete[] tCheckpoint;
+        if( xCheckpoint != NULL ) delete[] xCheckpoint;
+        if( gCheckpoint != NULL ) delete[] gCheckpoint;
+
+        tCheckpoint = tTmp;
+        xCheckpoint = xTmp;
+        gCheckpoint = gTmp;
+    }
+
+    tCheckpoint[activeSegment] = t;
+    for( run1 = 0; run1 < m; run1++ )
+        xCheckpoint[activeSegment*m+run1] = eta4[run1];
+
+    nCheckpoints = activeSegment+1;
+}
+
+
+void IntegratorRK::storeSensitivityCheckpoint( int number_ ){
+
+    int run1;
+
+    if( maxNumStoredSteps <= 0 || (number_-1)%maxNumStoredSteps != 0 ) return;
+
+    const int segment = (number_-1)/maxNumStoredSteps;
+    if( segment >= nCheckpoints ) return;
+
+    for( run1 = 0; run1 < m; run1++ )
+        gCheckpoint[segment*m+run1] = etaG[run1];
+}
+
+
+returnValue IntegratorRK::recomputeSegment( int number_ ){
+
+    int run1, run2;
+
+    if( maxNumStoredSteps <= 0 || soa != SOA_EVERYTHING_FROZEN )
+        return SUCCESSFUL_RETURN;
+
+    if( nFDirs == 0 && nBDirs == 0 && nFDirs2 == 0 && nBDirs2 == 0 )
+        return SUCCESSFUL_RETURN;
+
+    const int segment = (number_-1)/maxNumStoredSteps;
+
+    if( segment == activeSegment )
+        return SUCCESSFUL_RETURN;
+
+    if( segment >= nCheckpoints )
+        return ACADOERROR(RET_INPUT_OUT_OF_RANGE);
+
+    const int first = segment*maxNumStoredSteps + 1;
+    const int last  = acadoMin( first + maxNumStoredSteps - 1, count2 );
+
+
+    // save the current state of the sweep:
+    // ------------------------------------
+    double  tOld    = t;
+    double  hOld    = h[0];
+    double *eta4Old = new double[m];
+    double *etaGOld = new double[m];
+
+    for( run1 = 0; run1 < m; run1++ ){
+        eta4Old[run1] = eta4[run1];
+        if( nBDirs2 > 0 ) etaGOld[run1] = etaG[run1];
+    }
+
+
+    // replay the nominal (and if required the forward) trajectory:
+    // -------------------------------------------------------------
+    t = tCheckpoint[segment];
+    for( run1 = 0; run1 < m; run1++ ){
+        eta4[run1] = xCheckpoint[segment*m+run1];
+        if( nBDirs2 > 0 ) etaG[run1] = gCheckpoint[segment*m+run1];
+    }
+
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    for( run2 = first; run2 <= last; run2++ ){
+
+        h[0] = h[run2];
+
+        if( determineEta45( getStorageIndex(run2) ) < 0.0 ){
+            returnvalue = RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45;
+            break;
+        }
+        if( nBDirs2 > 0 )
+            determineEtaGForward( getStorageIndex(run2) );
+
+        t = t + h[0];
+    }
+    nRecomputedSteps += last-first+1;
+
+
+    // restore the state of the sweep:
+    // -------------------------------
+    t    = tOld;
+    h[0] = hOld;
+
+    for( run1 = 0; run1 < m; run1++ ){
+        eta4[run1] = eta4Old[run1];
+        if( nBDirs2 > 0 ) etaG[run1] = etaGOld[run1];
+    }
+
+    delete[] eta4Old;
+    delete[] etaGOld;
+
+    if( returnvalue != SUCCESSFUL_RETURN )
+        return ACADOERROR(returnvalue);
+
+    activeSegment = segment;
+    return SUCCESSFUL_RETURN;
+}
+
+
+BooleanType IntegratorRK::hasFSALproperty() const{
+
+    int run1;
+
+    if( dim < 2 || fabs( c[dim-1] - 1.0 ) > EPS || b4[dim-1] != 0.0 )
+        return BT_FALSE;
+
+    for( run1 = 0; run1 < dim-1; run1++ )
+        if( fabs( A[dim-1][run1] - b4[run1] ) > EPS )
+            return BT_FALSE;
+
+    return BT_TRUE;
+}
+
+
+BooleanType IntegratorRK::canReuseStages() const{
+
+    if( soa == SOA_UNFROZEN || soa == SOA_FREEZING_MESH || soa == SOA_MESH_FROZEN )
+        return BT_TRUE;
+
+    return BT_FALSE;
+}
+
+
+void IntegratorRK::updateStiffnessEstimate(){
+
+    int run1, run2;
+
+    if( dim < 2 ) return;
+
+    // ESTIMATE h*|lambda| BY THE LAST TWO STAGES OF THE ACCEPTED STEP:
+    // -----------------------------------------------------------------
+    double dk = 0.0;
+    double dy = 0.0;
+
+    for( run2 = 0; run2 < m; run2++ ){
+
+        double tmp = A[dim-1][dim-2]*k[dim-2][run2];
+        for( run1 = 0; run1 < dim-2; run1++ )
+            tmp += ( A[dim-1][run1] - A[dim-2][run1] )*k[run1][run2];
+
+        dy += tmp*tmp;
+        dk += ( k[dim-1][run2] - k[dim-2][run2] )*( k[dim-1][run2] - k[dim-2][run2] );
+    }
+
+    if( dy <= EPS*EPS*dk || dy <= 0.0 ) return;
+
+    const double hLambda = sqrt( dk/dy );
+
+    // the boundary of the stability domain is approximately 3.3 for the
+    // explicit schemes; steps close to it are limited by stability:
+    if( hLambda > 3.25 ){
+        nNonStiffSteps = 0;
+        nStiffSteps++;
+        if( nStiffSteps > maxStiffSteps ) maxStiffSteps = nStiffSteps;
+    }
+    else{
+        nNonStiffSteps++;
+        if( nNonStiffSteps == 6 ) nStiffSteps = 0;
+    }
+}
+
+
 void IntegratorRK::interpolate( int jj, double *e1, double *d1, double *e2, VariablesGrid &poly ){
 
     int run1;
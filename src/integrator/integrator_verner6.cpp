@@ -0,0 +1,189 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/integrator/integrator_verner6.cpp
+ *    \author agent
+ *    \date   2026
+ */
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/matrix_vector/matrix_vector.hpp>
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/function_.hpp>
+#include <acado/function/differential_equation.hpp>
+#include <acado/integrator/integrator.hpp>
+#include <acado/integrator/integrator_runge_kutta.hpp>
+#include <acado/integrator/integrator_verner6.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+IntegratorVERNER6::IntegratorVERNER6( )
+               :IntegratorRK(8,0.1666666666666666667){
+
+    if( A != 0 ) initializeButcherTableau();
+}
+
+IntegratorVERNER6::IntegratorVERNER6( const DifferentialEquation &rhs_ )
+               :IntegratorRK(rhs_,8,0.1666666666666666667){
+
+    if( A != 0 ) initializeButcherTableau();
+}
+
+IntegratorVERNER6::IntegratorVERNER6( const IntegratorVERNER6& arg )
+               :IntegratorRK(arg){ }
+
+IntegratorVERNER6::~IntegratorVERNER6( ){ }
+
+IntegratorVERNER6& IntegratorVERNER6::operator=( const IntegratorVERNER6& arg ){
+
+    if( this != &arg ){
+        IntegratorRK::operator=(arg);
+    }
+    return *this;
+}
+
+Integrator* IntegratorVERNER6::clone() const{
+
+    return new IntegratorVERNER6(*this);
+}
+
+
+void IntegratorVERNER6::initializeButcherTableau(){
+
+    A[0][0] = 0.0;
+    A[0][1] = 0.0;
+    A[0][2] = 0.0;
+    A[0][3] = 0.0;
+    A[0][4] = 0.0;
+    A[0][5] = 0.0;
+    A[0][6] = 0.0;
+    A[0][7] = 0.0;
+
+    A[1][0] = 1.0/6.0;
+    A[1][1] = 0.0;
+    A[1][2] = 0.0;
+    A[1][3] = 0.0;
+    A[1][4] = 0.0;
+    A[1][5] = 0.0;
+    A[1][6] = 0.0;
+    A[1][7] = 0.0;
+
+    A[2][0] = 4.0/75.0;
+    A[2][1] = 16.0/75.0;
+    A[2][2] = 0.0;
+    A[2][3] = 0.0;
+    A[2][4] = 0.0;
+    A[2][5] = 0.0;
+    A[2][6] = 0.0;
+    A[2][7] = 0.0;
+
+    A[3][0] = 5.0/6.0;
+    A[3][1] = -8.0/3.0;
+    A[3][2] = 5.0/2.0;
+    A[3][3] = 0.0;
+    A[3][4] = 0.0;
+    A[3][5] = 0.0;
+    A[3][6] = 0.0;
+    A[3][7] = 0.0;
+
+    A[4][0] = -165.0/64.0;
+    A[4][1] = 55.0/6.0;
+    A[4][2] = -425.0/64.0;
+    A[4][3] = 85.0/96.0;
+    A[4][4] = 0.0;
+    A[4][5] = 0.0;
+    A[4][6] = 0.0;
+    A[4][7] = 0.0;
+
+    A[5][0] = 12.0/5.0;
+    A[5][1] = -8.0;
+    A[5][2] = 4015.0/612.0;
+    A[5][3] = -11.0/36.0;
+    A[5][4] = 88.0/255.0;
+    A[5][5] = 0.0;
+    A[5][6] = 0.0;
+    A[5][7] = 0.0;
+
+    A[6][0] = -8263.0/15000.0;
+    A[6][1] = 124.0/75.0;
+    A[6][2] = -643.0/680.0;
+    A[6][3] = -81.0/250.0;
+    A[6][4] = 2484.0/10625.0;
+    A[6][5] = 0.0;
+    A[6][6] = 0.0;
+    A[6][7] = 0.0;
+
+    A[7][0] = 3501.0/1720.0;
+    A[7][1] = -300.0/43.0;
+    A[7][2] = 297275.0/52632.0;
+    A[7][3] = -319.0/2322.0;
+    A[7][4] = 24068.0/84065.0;
+    A[7][5] = 0.0;
+    A[7][6] = 3850.0/26703.0;
+    A[7][7] = 0.0;
+
+    // 6th order weights (propagated):
+    b4[0] = 3.0/40.0;
+    b4[1] = 0.0;
+    b4[2] = 875.0/2244.0;
+    b4[3] = 23.0/72.0;
+    b4[4] = 264.0/1955.0;
+    b4[5] = 0.0;
+    b4[6] = 125.0/11592.0;
+    b4[7] = 43.0/616.0;
+
+    // embedded 5th order weights (error estimate only):
+    b5[0] = 13.0/160.0;
+    b5[1] = 0.0;
+    b5[2] = 2375.0/5984.0;
+    b5[3] = 5.0/16.0;
+    b5[4] = 12.0/85.0;
+    b5[5] = 3.0/44.0;
+    b5[6] = 0.0;
+    b5[7] = 0.0;
+
+    c[0] = 0.0;
+    c[1] = 1.0/6.0;
+    c[2] = 4.0/15.0;
+    c[3] = 2.0/3.0;
+    c[4] = 5.0/6.0;
+    c[5] = 1.0;
+    c[6] = 1.0/15.0;
+    c[7] = 1.0;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
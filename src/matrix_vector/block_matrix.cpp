@@ -645,6 +645,45 @@ returnValue BlockMatrix::setDense( uint rowIdx, uint colIdx, const Matrix& value
 }
 
 
+returnValue BlockMatrix::setDenseProduct( uint rowIdx, uint colIdx, const Matrix& factor,
+                                          uint argRowIdx, uint argColIdx ){
+
+    uint run1, run2, run3;
+
+	ASSERT( rowIdx < getNumRows( ) );
+	ASSERT( colIdx < getNumCols( ) );
+	ASSERT( argRowIdx < getNumRows( ) );
+	ASSERT( argColIdx < getNumCols( ) );
+	ASSERT( ( rowIdx != argRowIdx ) || ( colIdx != argColIdx ) );
+
+    if( types[argRowIdx][argColIdx] == SBMT_ZERO )
+        return setZero( rowIdx, colIdx );
+
+    const Matrix &arg    = elements[argRowIdx][argColIdx];
+          Matrix &result = elements[rowIdx   ][colIdx   ];
+
+    ASSERT( factor.getNumCols() == arg.getNumRows() );
+
+    if( result.getNumRows() != factor.getNumRows() || result.getNumCols() != arg.getNumCols() )
+        result.init( factor.getNumRows(), arg.getNumCols() );
+
+    for( run1 = 0; run1 < factor.getNumRows(); run1++ ){
+        for( run2 = 0; run2 < arg.getNumCols(); run2++ ){
+
+            double sum = 0.0;
+            for( run3 = 0; run3 < arg.getNumRows(); run3++ )
+                sum += factor(run1,run3)*arg(run3,run2);
+
+            result(run1,run2) = sum;
+        }
+    }
+
+    types[rowIdx][colIdx] = SBMT_DENSE;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue BlockMatrix::addDense( uint rowIdx, uint colIdx, const Matrix& value ){
 
 	ASSERT( rowIdx < getNumRows( ) );
@@ -106,11 +106,15 @@ VectorspaceElement& VectorspaceElement::operator=( const VectorspaceElement& rhs
 
     if ( this != &rhs )
     {
-		if ( element != 0 )
-			delete[] element;
+		// (the memory is only reallocated if the dimension changes)
+		if ( ( element == 0 ) || ( dim != rhs.dim ) )
+		{
+			if ( element != 0 )
+				delete[] element;
 
-		dim = rhs.dim;
-		element = new double[ dim ];
+			dim = rhs.dim;
+			element = new double[ dim ];
+		}
 
 		for( i=0; i<dim; ++i )
 			element[i] = rhs.element[i];
@@ -0,0 +1,552 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file src/nlp_derivative_approximation/limited_memory_bfgs_update.cpp
+ *    \author agent
+ *    \date 2026
+ */
+
+
+#include <acado/nlp_derivative_approximation/limited_memory_bfgs_update.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+LimitedMemoryBFGSupdate::LimitedMemoryBFGSupdate( ) : ConstantHessian( )
+{
+	modification = MOD_POWELLS_MODIFICATION;
+	nBlocks    = 0;
+	nGroups    = 0;
+	memorySize = defaultBFGSmemorySize;
+
+	groupDims = 0;
+	S         = 0;
+	Y         = 0;
+	nPairs    = 0;
+	delta     = 0;
+}
+
+
+LimitedMemoryBFGSupdate::LimitedMemoryBFGSupdate(	UserInteraction* _userInteraction,
+													uint _nBlocks
+													) : ConstantHessian( _userInteraction )
+{
+	modification = MOD_POWELLS_MODIFICATION;
+	nBlocks    = _nBlocks;
+	nGroups    = 0;
+	memorySize = defaultBFGSmemorySize;
+
+	groupDims = 0;
+	S         = 0;
+	Y         = 0;
+	nPairs    = 0;
+	delta     = 0;
+}
+
+
+LimitedMemoryBFGSupdate::LimitedMemoryBFGSupdate( const LimitedMemoryBFGSupdate& rhs ) : ConstantHessian( rhs )
+{
+	copy( rhs );
+}
+
+
+LimitedMemoryBFGSupdate::~LimitedMemoryBFGSupdate( )
+{
+	clear( );
+}
+
+
+LimitedMemoryBFGSupdate& LimitedMemoryBFGSupdate::operator=( const LimitedMemoryBFGSupdate& rhs )
+{
+	if ( this != &rhs )
+	{
+		clear( );
+
+		ConstantHessian::operator=( rhs );
+
+		copy( rhs );
+	}
+
+	return *this;
+}
+
+
+NLPderivativeApproximation* LimitedMemoryBFGSupdate::clone( ) const
+{
+	return new LimitedMemoryBFGSupdate( *this );
+}
+
+
+
+returnValue LimitedMemoryBFGSupdate::initHessian(	BlockMatrix& B,
+													uint N,
+													const OCPiterate& iter
+													)
+{
+	uint run1;
+
+	returnValue returnvalue = ConstantHessian::initHessian( B,N,iter );
+	if ( returnvalue != SUCCESSFUL_RETURN )
+		return returnvalue;
+
+	int memorySize_;
+	get( BFGS_MEMORY_SIZE,memorySize_ );
+
+	if ( memorySize_ <= 0 )
+		return ACADOERROR( RET_INVALID_OPTION );
+
+	clear( );
+
+	memorySize = (uint)memorySize_;
+
+	if ( nBlocks == 0 )
+		nGroups = 1;
+	else
+		nGroups = nBlocks;
+
+
+	// DETERMINE THE BLOCK AND GROUP DIMENSIONS:
+	// -----------------------------------------
+	blockDims.init( B.getNumRows() );
+	groupDims = new uint[nGroups];
+
+	for( run1 = 0; run1 < nGroups; run1++ )
+		groupDims[run1] = 0;
+
+	for( run1 = 0; run1 < B.getNumRows(); run1++ )
+	{
+		blockDims(run1) = (double)B.getNumRows( run1,run1 );
+		groupDims[getGroup(run1)] += B.getNumRows( run1,run1 );
+	}
+
+
+	// ALLOCATE THE MEMORY FOR THE PAIRS:
+	// ----------------------------------
+	S      = new Matrix[nGroups];
+	Y      = new Matrix[nGroups];
+	nPairs = new uint  [nGroups];
+	delta  = new double[nGroups];
+
+	for( run1 = 0; run1 < nGroups; run1++ )
+	{
+		S[run1].init( groupDims[run1],memorySize );
+		Y[run1].init( groupDims[run1],memorySize );
+		S[run1].setZero( );
+		Y[run1].setZero( );
+
+		nPairs[run1] = 0;
+		delta [run1] = 1.0;
+	}
+
+	lowRankFactor.init( 0,0 );
+	lowRankWeight.init( 0,0 );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue LimitedMemoryBFGSupdate::initScaling(	BlockMatrix& B,
+													const BlockMatrix& x,
+													const BlockMatrix& y
+													)
+{
+	returnValue returnvalue = ConstantHessian::initScaling( B,x,y );
+	if ( returnvalue != SUCCESSFUL_RETURN )
+		return returnvalue;
+
+	for( uint run1 = 0; run1 < nGroups; run1++ )
+		delta[run1] = hessianScaling;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue LimitedMemoryBFGSupdate::apply(	BlockMatrix &B,
+											const BlockMatrix &x,
+											const BlockMatrix &y
+											)
+{
+	if ( nGroups == 0 )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	Vector s, z;
+
+	for( uint run1 = 0; run1 < nGroups; run1++ )
+	{
+		if ( groupDims[run1] == 0 )
+			continue;
+
+		getGroupVector( run1,x,s );
+		getGroupVector( run1,y,z );
+
+		applyUpdate( run1,s,z );
+	}
+
+	return setupHessian( B );
+}
+
+
+returnValue LimitedMemoryBFGSupdate::getLowRankHessian(	BlockMatrix& W,
+														BlockMatrix& M
+														) const
+{
+	W = lowRankFactor;
+	M = lowRankWeight;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue LimitedMemoryBFGSupdate::applyUpdate(	uint groupIdx,
+													const Vector &s,
+													const Vector &y
+													)
+{
+    // CONSTANTS FOR POWELL'S STRATEGY:
+    // --------------------------------
+    const double epsilon = 0.2;   // constant epsilon for a positive curvature
+                                  // check of the form s^T y > epsilon s^T B s
+    double       theta   = 1.0;   // constant theta for Powell's strategy.
+
+
+    // OTHER CONSTANTS:
+    // ----------------
+    const double regularisation = 100.0*EPS; // safe-guard constant for devisions
+                                             // (to avoid numerical devision by 0).
+
+    uint run1, run2;
+    uint n = groupDims[groupIdx];
+
+
+    // COMPUTATION OF Bs = delta*s + W*M*W^T*s:
+    // ---------------------------------------
+    Vector Bs( s );
+    Bs *= delta[groupIdx];
+
+    if ( nPairs[groupIdx] > 0 )
+    {
+        Matrix W, M;
+        getCompactForm( groupIdx,W,M );
+        Bs += W*( M*(W^s) );
+    }
+
+    double sBs = s^Bs;
+    double sy  = s^y;
+
+
+    // CURVATURE CHECK:
+    // -------------------------------------
+    Vector z( y );
+    double sz = sy;
+
+    if( sy <= epsilon*sBs ){
+
+        switch( modification ){
+
+            case MOD_NO_MODIFICATION : // the compact form requires s^T y > 0, so
+                                       // only pairs of negative curvature are skipped
+                 if( sy <= regularisation )
+                     return SUCCESSFUL_RETURN;
+                 break;
+
+
+            case MOD_NOCEDALS_MODIFICATION:  // just skip the update
+
+                 return SUCCESSFUL_RETURN;
+
+
+            case MOD_POWELLS_MODIFICATION:  // apply Powell's modification of y
+
+                 theta = (1.0-epsilon)*sBs/(sBs-sy+regularisation);
+
+                 for( run1 = 0; run1 < n; run1++ )
+                     z(run1) = theta*y(run1) + (1.0-theta)*Bs(run1);
+
+                 sz = epsilon*sBs;
+                 break;
+        }
+    }
+
+    if( sz <= regularisation )
+        return SUCCESSFUL_RETURN;
+
+
+    // STORE THE PAIR (DROP THE OLDEST ONE IF THE MEMORY IS FULL):
+    // ----------------------------------------------------------
+    if( nPairs[groupIdx] == memorySize ){
+
+        for( run2 = 1; run2 < memorySize; run2++ ){
+            for( run1 = 0; run1 < n; run1++ ){
+                S[groupIdx](run1,run2-1) = S[groupIdx](run1,run2);
+                Y[groupIdx](run1,run2-1) = Y[groupIdx](run1,run2);
+            }
+        }
+        nPairs[groupIdx]--;
+    }
+
+    for( run1 = 0; run1 < n; run1++ ){
+        S[groupIdx](run1,nPairs[groupIdx]) = s(run1);
+        Y[groupIdx](run1,nPairs[groupIdx]) = z(run1);
+    }
+    nPairs[groupIdx]++;
+
+    delta[groupIdx] = (z^z)/sz;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue LimitedMemoryBFGSupdate::getCompactForm(	uint groupIdx,
+														Matrix &W,
+														Matrix &M
+														) const
+{
+    uint run1, run2, run3;
+
+    uint n = groupDims[groupIdx];
+    uint k = nPairs[groupIdx];
+    double d = delta[groupIdx];
+
+    const Matrix& Sg = S[groupIdx];
+    const Matrix& Yg = Y[groupIdx];
+
+
+    // SETUP W = [ delta*S  Y ]:
+    // -------------------------
+    W.init( n,2*k );
+    for( run1 = 0; run1 < n; run1++ ){
+        for( run2 = 0; run2 < k; run2++ ){
+            W(run1,run2  ) = d*Sg(run1,run2);
+            W(run1,k+run2) =   Yg(run1,run2);
+        }
+    }
+
+
+    // SETUP THE MIDDLE MATRIX [ delta*S^T*S  L ; L^T  -D ]:
+    // -----------------------------------------------------
+    Matrix middle( 2*k,2*k );
+    middle.setZero( );
+
+    double sTs, sTy;
+
+    for( run1 = 0; run1 < k; run1++ ){
+        for( run2 = 0; run2 < k; run2++ ){
+
+            sTs = 0.0;
+            sTy = 0.0;
+            for( run3 = 0; run3 < n; run3++ ){
+                sTs += Sg(run3,run1)*Sg(run3,run2);
+                sTy += Sg(run3,run1)*Yg(run3,run2);
+            }
+
+            middle(run1,run2) = d*sTs;
+
+            if( run1 > run2 ){
+                middle(run1,k+run2) = sTy;
+                middle(k+run2,run1) = sTy;
+            }
+            if( run1 == run2 )
+                middle(k+run1,k+run1) = -sTy;
+        }
+    }
+
+    M = middle.getInverse( );
+    M *= -1.0;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue LimitedMemoryBFGSupdate::setupHessian( BlockMatrix &B )
+{
+    uint run1, run2, run3, run4;
+    uint nRows = blockDims.getDim( );
+
+    Matrix tmp, W, M;
+
+
+    // DIAGONAL PART:
+    // --------------
+    B.setZero( );
+
+    for( run1 = 0; run1 < nRows; run1++ ){
+
+        if( (uint)blockDims(run1) == 0 )
+            continue;
+
+        tmp.init( (uint)blockDims(run1),(uint)blockDims(run1) );
+        tmp.setIdentity( );
+        tmp *= delta[getGroup(run1)];
+        B.setDense( run1,run1,tmp );
+    }
+
+
+    // LOW-RANK PART:
+    // --------------
+    BooleanType hasPairs = BT_FALSE;
+    for( run1 = 0; run1 < nGroups; run1++ )
+        if( nPairs[run1] > 0 )
+            hasPairs = BT_TRUE;
+
+    if( hasPairs == BT_FALSE ){
+        lowRankFactor.init( 0,0 );
+        lowRankWeight.init( 0,0 );
+        return SUCCESSFUL_RETURN;
+    }
+
+    lowRankFactor.init( nRows,nGroups );
+    lowRankWeight.init( nGroups,nGroups );
+
+    for( run1 = 0; run1 < nGroups; run1++ ){
+
+        if( nPairs[run1] == 0 )
+            continue;
+
+        getCompactForm( run1,W,M );
+        lowRankWeight.setDense( run1,run1,M );
+
+        uint offset = 0;
+        for( run2 = 0; run2 < nRows; run2++ ){
+
+            uint dim = (uint)blockDims(run2);
+            if( ( getGroup(run2) != run1 ) || ( dim == 0 ) )
+                continue;
+
+            tmp.init( dim,W.getNumCols() );
+            for( run3 = 0; run3 < dim; run3++ )
+                for( run4 = 0; run4 < W.getNumCols(); run4++ )
+                    tmp(run3,run4) = W(offset+run3,run4);
+
+            lowRankFactor.setDense( run2,run1,tmp );
+            offset += dim;
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue LimitedMemoryBFGSupdate::getGroupVector(	uint groupIdx,
+														const BlockMatrix &x,
+														Vector &v
+														) const
+{
+    uint run1, run2;
+    Matrix tmp;
+
+    v.init( groupDims[groupIdx] );
+
+    uint offset = 0;
+    for( run1 = 0; run1 < blockDims.getDim(); run1++ ){
+
+        uint dim = (uint)blockDims(run1);
+        if( ( getGroup(run1) != groupIdx ) || ( dim == 0 ) )
+            continue;
+
+        x.getSubBlock( run1,0,tmp,dim,1 );
+        for( run2 = 0; run2 < dim; run2++ )
+            v(offset+run2) = tmp(run2,0);
+
+        offset += dim;
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+void LimitedMemoryBFGSupdate::clear( )
+{
+	if ( groupDims != 0 ) delete[] groupDims;
+	if ( S         != 0 ) delete[] S;
+	if ( Y         != 0 ) delete[] Y;
+	if ( nPairs    != 0 ) delete[] nPairs;
+	if ( delta     != 0 ) delete[] delta;
+
+	groupDims = 0;
+	S         = 0;
+	Y         = 0;
+	nPairs    = 0;
+	delta     = 0;
+	nGroups   = 0;
+}
+
+
+void LimitedMemoryBFGSupdate::copy( const LimitedMemoryBFGSupdate& rhs )
+{
+	uint run1;
+
+	modification = rhs.modification;
+	nBlocks    = rhs.nBlocks;
+	nGroups    = rhs.nGroups;
+	memorySize = rhs.memorySize;
+	blockDims  = rhs.blockDims;
+
+	lowRankFactor = rhs.lowRankFactor;
+	lowRankWeight = rhs.lowRankWeight;
+
+	if ( rhs.nGroups > 0 )
+	{
+		groupDims = new uint  [nGroups];
+		S         = new Matrix[nGroups];
+		Y         = new Matrix[nGroups];
+		nPairs    = new uint  [nGroups];
+		delta     = new double[nGroups];
+
+		for( run1 = 0; run1 < nGroups; run1++ )
+		{
+			groupDims[run1] = rhs.groupDims[run1];
+			S        [run1] = rhs.S        [run1];
+			Y        [run1] = rhs.Y        [run1];
+			nPairs   [run1] = rhs.nPairs   [run1];
+			delta    [run1] = rhs.delta    [run1];
+		}
+	}
+	else
+	{
+		groupDims = 0;
+		S         = 0;
+		Y         = 0;
+		nPairs    = 0;
+		delta     = 0;
+	}
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -89,6 +89,18 @@ NLPderivativeApproximation& NLPderivativeApproximation::operator=( const NLPderi
 
 
 
+returnValue NLPderivativeApproximation::getLowRankHessian(	BlockMatrix& W,
+															BlockMatrix& M
+															) const
+{
+	W.init( 0,0 );
+	M.init( 0,0 );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
 
 //
 // PROTECTED MEMBER FUNCTIONS:
@@ -96,6 +108,8 @@ NLPderivativeApproximation& NLPderivativeApproximation::operator=( const NLPderi
 
 returnValue NLPderivativeApproximation::setupOptions( )
 {
+	addOption( BFGS_MEMORY_SIZE, defaultBFGSmemorySize );
+
 	return SUCCESSFUL_RETURN;
 }
 
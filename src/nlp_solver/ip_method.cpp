@@ -0,0 +1,233 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file src/nlp_solver/ip_method.cpp
+ *    \author agent
+ *
+ */
+
+
+
+#include <acado/nlp_solver/ip_method.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+IPmethod::IPmethod( ) : SCPmethod( )
+{
+	barrierParameter = defaultBarrierParameter;
+}
+
+
+IPmethod::IPmethod(	UserInteraction* _userInteraction,
+					const Objective             *objective_          ,
+					const DynamicDiscretization *dynamic_discretization_,
+					const Constraint            *constraint_,
+					BooleanType _isCP
+					) : SCPmethod( _userInteraction,objective_,dynamic_discretization_,constraint_,_isCP )
+{
+	barrierParameter = defaultBarrierParameter;
+}
+
+
+IPmethod::IPmethod( const IPmethod& rhs ) : SCPmethod( rhs )
+{
+	barrierParameter = rhs.barrierParameter;
+}
+
+
+IPmethod::~IPmethod( )
+{
+}
+
+
+IPmethod& IPmethod::operator=( const IPmethod& rhs )
+{
+	if ( this != &rhs )
+	{
+		SCPmethod::operator=( rhs );
+
+		barrierParameter = rhs.barrierParameter;
+    }
+	return *this;
+}
+
+
+NLPsolver* IPmethod::clone( ) const
+{
+	return new IPmethod( *this );
+}
+
+
+
+returnValue IPmethod::performCurrentStep( )
+{
+	returnValue returnvalue = SCPmethod::performCurrentStep( );
+
+	if ( returnvalue == CONVERGENCE_NOT_YET_ACHIEVED )
+	{
+		if ( updateBarrierParameter( ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_NLP_STEP_FAILED );
+	}
+
+	return returnvalue;
+}
+
+
+
+returnValue IPmethod::getVarianceCovariance( Matrix &var )
+{
+	if( eval->hasLSQobjective( ) == BT_FALSE )
+		return ACADOERROR( RET_NOT_YET_IMPLEMENTED );
+
+	if( bandedCPsolver == 0 )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	// the barrier steps are not condensed, thus the CP at the
+	// solution is condensed once in order to obtain the estimate
+	BandedCP cp = bandedCP;
+
+	CondensingBasedCPsolver condensingSolver( userInteraction,eval->getNumConstraints(),eval->getConstraintBlockDims() );
+
+	if ( condensingSolver.init( iter ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	if ( condensingSolver.solve( cp ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_QP_SOLUTION_FAILED );
+
+	return condensingSolver.getVarianceCovariance( var );
+}
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+
+returnValue IPmethod::setup( )
+{
+	returnValue returnvalue = SCPmethod::setup( );
+	if ( returnvalue != SUCCESSFUL_RETURN )
+		return returnvalue;
+
+	get( BARRIER_PARAMETER,barrierParameter );
+
+	if ( barrierParameter < getMinBarrierParameter( ) )
+		barrierParameter = getMinBarrierParameter( );
+
+	if ( passBarrierParameter( ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_NLP_INIT_FAILED );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue IPmethod::allocateBandedCPsolver( )
+{
+	// the Newton steps on the barrier problem are computed in multi-stage
+	// form, independently of the option USE_CONDENSING
+	bandedCPsolver = new RiccatiBasedCPsolver( userInteraction,eval->getNumConstraints(),eval->getConstraintBlockDims() );
+	bandedCPsolver->init( iter );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue IPmethod::checkForConvergence( )
+{
+	if ( barrierParameter > getMinBarrierParameter( ) )
+		return CONVERGENCE_NOT_YET_ACHIEVED;
+
+	return SCPmethod::checkForConvergence( );
+}
+
+
+returnValue IPmethod::updateBarrierParameter( )
+{
+	double KKTmultiplierRegularisation;
+	get( KKT_TOLERANCE_SAFEGUARD,KKTmultiplierRegularisation );
+
+	const double minBarrierParameter = getMinBarrierParameter( );
+
+	if ( barrierParameter <= minBarrierParameter )
+		return SUCCESSFUL_RETURN;
+
+	// decrease the barrier parameter superlinearly once the current
+	// barrier problem is solved up to a multiple of its parameter
+	if ( eval->getKKTtolerance( iter,bandedCP,KKTmultiplierRegularisation ) <= 100.0*barrierParameter )
+	{
+		double newBarrierParameter = 0.2*barrierParameter;
+
+		if ( pow( barrierParameter,1.5 ) < newBarrierParameter )
+			newBarrierParameter = pow( barrierParameter,1.5 );
+
+		if ( newBarrierParameter < minBarrierParameter )
+			newBarrierParameter = minBarrierParameter;
+
+		barrierParameter = newBarrierParameter;
+	}
+
+	// (also detects a switch of the CP solver to condensing during the last step)
+	return passBarrierParameter( );
+}
+
+
+returnValue IPmethod::passBarrierParameter( )
+{
+	returnValue returnvalue = bandedCPsolver->setBarrierParameter( barrierParameter );
+
+	// the CP solver has switched to condensing (e.g. due to algebraic states) and
+	// solves the CPs to optimality, thus the method continues as SQP method
+	if ( returnvalue == RET_BARRIER_STEP_NOT_AVAILABLE )
+	{
+		barrierParameter = getMinBarrierParameter( );
+		ACADOWARNING( RET_BARRIER_STEP_NOT_AVAILABLE );
+		return SUCCESSFUL_RETURN;
+	}
+
+	return returnvalue;
+}
+
+
+double IPmethod::getMinBarrierParameter( ) const
+{
+	double tol;
+	get( KKT_TOLERANCE,tol );
+
+	return 0.1*tol;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -48,6 +48,10 @@ NLPsolver::NLPsolver( ) : AlgorithmicBase( )
 	setupLogging( );
 	
     numberOfSteps = 0;
+
+    timeBudgetExceeded    = BT_FALSE;
+    iterateFeasible       = BT_FALSE;
+    iterationTimeEstimate = 0.0;
 }
 
 
@@ -61,12 +65,20 @@ NLPsolver::NLPsolver( UserInteraction* _userInteraction ) : AlgorithmicBase( _us
 	}
 	
     numberOfSteps = 0;
+
+    timeBudgetExceeded    = BT_FALSE;
+    iterateFeasible       = BT_FALSE;
+    iterationTimeEstimate = 0.0;
 }
 
 
 NLPsolver::NLPsolver( const NLPsolver& rhs ) : AlgorithmicBase( rhs )
 {
     numberOfSteps = rhs.numberOfSteps;
+
+    timeBudgetExceeded    = rhs.timeBudgetExceeded;
+    iterateFeasible       = rhs.iterateFeasible;
+    iterationTimeEstimate = rhs.iterationTimeEstimate;
 }
 
 
@@ -82,6 +94,10 @@ NLPsolver& NLPsolver::operator=( const NLPsolver& rhs )
 		AlgorithmicBase::operator=( rhs );
 
 		numberOfSteps = rhs.numberOfSteps;
+
+		timeBudgetExceeded    = rhs.timeBudgetExceeded;
+		iterateFeasible       = rhs.iterateFeasible;
+		iterationTimeEstimate = rhs.iterationTimeEstimate;
     }
 
     return *this;
@@ -194,20 +210,30 @@ returnValue NLPsolver::setupOptions( )
 	addOption( PRINT_COPYRIGHT             , defaultPrintCopyright          );
 	addOption( HESSIAN_APPROXIMATION       , defaultHessianApproximation    );
 	addOption( DYNAMIC_HESSIAN_APPROXIMATION, defaultDynamicHessianApproximation );
+	addOption( BFGS_MEMORY_SIZE            , defaultBFGSmemorySize          );
 	addOption( DYNAMIC_SENSITIVITY         , defaultDynamicSensitivity      );
+	addOption( NUM_LIFTED_NODES            , defaultNumLiftedNodes          );
 	addOption( OBJECTIVE_SENSITIVITY       , defaultObjectiveSensitivity    );
 	addOption( CONSTRAINT_SENSITIVITY      , defaultConstraintSensitivity   );
 	addOption( DISCRETIZATION_TYPE         , defaultDiscretizationType      );
 	addOption( LINESEARCH_TOLERANCE        , defaultLinesearchTolerance     );
 	addOption( MIN_LINESEARCH_PARAMETER    , defaultMinLinesearchParameter  );
+	addOption( QP_SOLVER                   , defaultQPsolver                );
 	addOption( MAX_NUM_QP_ITERATIONS       , defaultMaxNumQPiterations      );
+	addOption( QP_SOLVER_TOLERANCE         , defaultQPsolverTolerance       );
+	addOption( MAX_QP_SOLVER_TIME          , defaultMaxQPsolverTime         );
+	addOption( MAX_NLP_SOLVER_TIME         , defaultMaxNLPsolverTime        );
 	addOption( HOTSTART_QP                 , defaultHotstartQP              );
 	addOption( INFEASIBLE_QP_RELAXATION    , defaultInfeasibleQPrelaxation  );
 	addOption( INFEASIBLE_QP_HANDLING      , defaultInfeasibleQPhandling    );
 	addOption( USE_REALTIME_ITERATIONS     , defaultUseRealtimeIterations   );
+	addOption( USE_TANGENTIAL_PREDICTOR    , defaultUseTangentialPredictor  );
+	addOption( USE_AUTOMATIC_SCALING       , defaultUseAutomaticScaling     );
 	addOption( TERMINATE_AT_CONVERGENCE    , defaultTerminateAtConvergence  );
 	addOption( USE_CONDENSING              , defaultUseCondensing           );
+	addOption( CONDENSING_BLOCK_SIZE       , defaultCondensingBlockSize     );
 	addOption( GLOBALIZATION_STRATEGY      , defaultGlobalizationStrategy   );
+	addOption( BARRIER_PARAMETER           , defaultBarrierParameter        );
 	addOption( PRINT_SCP_METHOD_PROFILE    , defaultprintSCPmethodProfile   );
 
 	return SUCCESSFUL_RETURN;
@@ -224,6 +250,18 @@ returnValue NLPsolver::setupLogging( )
 }
 
 
+returnValue NLPsolver::updateIterationTimeEstimate(	double iterationTime
+													)
+{
+	if ( iterationTime > iterationTimeEstimate )
+		iterationTimeEstimate = iterationTime;
+	else
+		iterationTimeEstimate = 0.75*iterationTimeEstimate + 0.25*iterationTime;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
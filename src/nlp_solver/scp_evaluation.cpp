@@ -54,6 +54,12 @@ SCPevaluation::SCPevaluation( ) : AlgorithmicBase( )
 	
 	isCP = BT_FALSE;
 	areSensitivitiesFrozen = BT_FALSE;
+
+	isCacheValid          = BT_FALSE;
+	isObjectiveCacheValid = BT_FALSE;
+	isUnfreezePending     = BT_FALSE;
+
+	objectiveScaling = 1.0;
 }
 
 
@@ -84,6 +90,12 @@ SCPevaluation::SCPevaluation(	UserInteraction* _userInteraction,
 	
 	isCP = _isCP;
 	areSensitivitiesFrozen = BT_FALSE;
+
+	isCacheValid          = BT_FALSE;
+	isObjectiveCacheValid = BT_FALSE;
+	isUnfreezePending     = BT_FALSE;
+
+	objectiveScaling = 1.0;
 }
 
 
@@ -102,6 +114,16 @@ SCPevaluation::SCPevaluation( const SCPevaluation& rhs ) : AlgorithmicBase( rhs
 	
 	isCP = rhs.isCP;
 	areSensitivitiesFrozen = rhs.areSensitivitiesFrozen;
+
+	isCacheValid          = rhs.isCacheValid;
+	isObjectiveCacheValid = rhs.isObjectiveCacheValid;
+	isUnfreezePending     = rhs.isUnfreezePending;
+
+	cachedIterate = rhs.cachedIterate;
+
+	variableScaling   = rhs.variableScaling;
+	constraintScaling = rhs.constraintScaling;
+	objectiveScaling  = rhs.objectiveScaling;
 }
 
 
@@ -136,6 +158,16 @@ SCPevaluation& SCPevaluation::operator=( const SCPevaluation& rhs )
 
 		isCP = rhs.isCP;
 		areSensitivitiesFrozen = rhs.areSensitivitiesFrozen;
+
+		isCacheValid          = rhs.isCacheValid;
+		isObjectiveCacheValid = rhs.isObjectiveCacheValid;
+		isUnfreezePending     = rhs.isUnfreezePending;
+
+		cachedIterate = rhs.cachedIterate;
+
+		variableScaling   = rhs.variableScaling;
+		constraintScaling = rhs.constraintScaling;
+		objectiveScaling  = rhs.objectiveScaling;
 	}
 
     return *this;
@@ -152,6 +184,24 @@ SCPevaluation* SCPevaluation::clone( ) const
 returnValue SCPevaluation::init(	const OCPiterate& iter
 									){
 
+	isCacheValid          = BT_FALSE;
+	isObjectiveCacheValid = BT_FALSE;
+
+	variableScaling.init( 0,0 );
+	constraintScaling.init( 0,0 );
+	objectiveScaling = 1.0;
+
+	int useAutomaticScaling;
+	get( USE_AUTOMATIC_SCALING,useAutomaticScaling );
+
+	int useRealtimeIterations;
+	get( USE_REALTIME_ITERATIONS,useRealtimeIterations );
+
+	// real-time iterations prepare the conic program ahead of the feedback,
+	// thus it is not scaled in this case
+	if ( ( (BooleanType)useAutomaticScaling == BT_TRUE ) && ( (BooleanType)useRealtimeIterations == BT_FALSE ) )
+		return setupVariableScaling( iter );
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -159,6 +209,18 @@ returnValue SCPevaluation::init(	const OCPiterate& iter
 
 returnValue SCPevaluation::evaluate( OCPiterate& iter, BandedCP& cp ){
 
+    // REUSE THE LAST EVALUATION IF THE ITERATE DID NOT CHANGE:
+    // --------------------------------------------------------
+    if( ( isCacheValid == BT_TRUE ) && ( isCachedIterate( iter ) == BT_TRUE ) )
+        return restoreEvaluation( iter,cp );
+
+    isCacheValid = BT_FALSE;
+
+    if( ( isUnfreezePending == BT_TRUE ) && ( dynamicDiscretization != 0 ) )
+        dynamicDiscretization->unfreeze( );
+    isUnfreezePending = BT_FALSE;
+
+
     // EVALUATE THE OBJECTIVE AND CONSTRAINTS:
     // ---------------------------------------
     if( dynamicDiscretization != 0 )
@@ -172,27 +234,9 @@ returnValue SCPevaluation::evaluate( OCPiterate& iter, BandedCP& cp ){
 
     objective->getObjectiveValue( objectiveValue );
 
-    if( dynamicDiscretization != 0 )
-        dynamicDiscretization->getResiduum( cp.dynResiduum );
-
-    if( constraint != 0 )
-    {
-        constraint->getBoundResiduum     ( cp.lowerBoundResiduum     , cp.upperBoundResiduum      );
-        constraint->getConstraintResiduum( cp.lowerConstraintResiduum, cp.upperConstraintResiduum );
-    }
-
-    if( dynamicDiscretization == 0 ){
-        cp.lowerBoundResiduum.setZero(0,0);
-        cp.lowerBoundResiduum.setZero(1,0);
-        cp.lowerBoundResiduum.setZero(3,0);
-        cp.lowerBoundResiduum.setZero(4,0);
-        cp.upperBoundResiduum.setZero(0,0);
-        cp.upperBoundResiduum.setZero(1,0);
-        cp.upperBoundResiduum.setZero(3,0);
-        cp.upperBoundResiduum.setZero(4,0);
-    }
+    getResidua( cp );
 
-    return SUCCESSFUL_RETURN;
+    return storeEvaluation( iter );
 }
 
 
@@ -272,6 +316,12 @@ returnValue SCPevaluation::evaluateSensitivities(	const OCPiterate& iter,
                 ACADO_TRY( dynamicDiscretization->setUnitForwardSeed()                      );
                 ACADO_TRY( dynamicDiscretization->evaluateSensitivitiesLifted()             );
                 ACADO_TRY( dynamicDiscretization->getForwardSensitivities( cp.dynGradient ) );
+
+                // the lifted nodes have been updated, i.e. the cache is outdated:
+                isCacheValid = BT_FALSE;
+
+                // the condensed defects of the lifted nodes enter the residuum:
+                dynamicDiscretization->getResiduum( cp.dynResiduum );
             }
         }
     }
@@ -495,6 +545,252 @@ double SCPevaluation::getObjectiveValue( ) const
 }
 
 
+returnValue SCPevaluation::computeScaling(	const BandedCP& cp
+											)
+{
+	if ( hasScaling( ) == BT_FALSE )
+		return SUCCESSFUL_RETURN;
+
+	uint run1, run2, run3, run4;
+
+	Vector scaling;
+	Matrix norms;
+
+
+	// SCALE THE OBJECTIVE BY ITS LARGEST GRADIENT ENTRY:
+	// --------------------------------------------------
+	double norm = 0.0;
+
+	for( run2 = 0; run2 < cp.objectiveGradient.getNumCols( ); run2++ )
+	{
+		const Matrix& gradient = cp.objectiveGradient.getSubBlock( 0,run2 );
+		scaling = getVariableScaling( run2 );
+
+		if ( gradient.getNumCols( ) != scaling.getDim( ) )
+			continue;
+
+		for( run3 = 0; run3 < gradient.getNumCols( ); run3++ )
+			if ( fabs( gradient( 0,run3 ) )*scaling( run3 ) > norm )
+				norm = fabs( gradient( 0,run3 ) )*scaling( run3 );
+	}
+
+	objectiveScaling = getScalingFactor( norm );
+
+
+	// SCALE EACH CONSTRAINT ROW BY ITS LARGEST GRADIENT ENTRY:
+	// --------------------------------------------------------
+	Vector blockDims = getConstraintBlockDims( );
+
+	constraintScaling.init( cp.constraintGradient.getNumRows( ),1 );
+
+	for( run1 = 0; run1 < cp.constraintGradient.getNumRows( ); run1++ )
+	{
+		if ( run1 >= blockDims.getDim( ) )
+			break;
+
+		norms.init( (uint)blockDims( run1 ),1 );
+		norms.setZero( );
+
+		for( run2 = 0; run2 < cp.constraintGradient.getNumCols( ); run2++ )
+		{
+			const Matrix& gradient = cp.constraintGradient.getSubBlock( run1,run2 );
+			scaling = getVariableScaling( run2 );
+
+			if ( ( gradient.getNumRows( ) != norms.getNumRows( ) ) || ( gradient.getNumCols( ) != scaling.getDim( ) ) )
+				continue;
+
+			for( run3 = 0; run3 < gradient.getNumRows( ); run3++ )
+				for( run4 = 0; run4 < gradient.getNumCols( ); run4++ )
+					if ( fabs( gradient( run3,run4 ) )*scaling( run4 ) > norms( run3,0 ) )
+						norms( run3,0 ) = fabs( gradient( run3,run4 ) )*scaling( run4 );
+		}
+
+		for( run3 = 0; run3 < norms.getNumRows( ); run3++ )
+			norms( run3,0 ) = getScalingFactor( norms( run3,0 ) );
+
+		if ( norms.getNumRows( ) > 0 )
+			constraintScaling.setDense( run1,0,norms );
+	}
+
+
+	// DROP THE SCALING IF IT TURNS OUT TO BE THE IDENTITY:
+	// ----------------------------------------------------
+	if ( ( objectiveScaling == 1.0 ) && ( isUnitScaling( variableScaling ) == BT_TRUE ) && ( isUnitScaling( constraintScaling ) == BT_TRUE ) )
+	{
+		variableScaling.init( 0,0 );
+		constraintScaling.init( 0,0 );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SCPevaluation::scaleCP(	const BandedCP& cp,
+									BandedCP& scaledCP
+									) const
+{
+	scaledCP = cp;
+
+	if ( hasScaling( ) == BT_FALSE )
+		return SUCCESSFUL_RETURN;
+
+	uint run1, run2;
+
+	const uint N  = variableScaling.getNumRows( )/5;
+	const uint nV = variableScaling.getNumRows( );
+
+	Vector* scaling = new Vector[nV];
+	for( run1 = 0; run1 < nV; run1++ )
+		scaling[run1] = getVariableScaling( run1 );
+
+	Vector rowScaling;
+
+
+	// OBJECTIVE: H = s*D*H*D,  g = s*D*g
+	// ----------------------------------
+	for( run1 = 0; run1 < scaledCP.hessian.getNumRows( ); run1++ )
+		for( run2 = 0; run2 < scaledCP.hessian.getNumCols( ); run2++ )
+			if ( ( run1 < nV ) && ( run2 < nV ) )
+				scaleBlock( scaledCP.hessian,run1,run2,scaling[run1],scaling[run2] );
+
+	for( run1 = 0; run1 < scaledCP.hessianLowRankFactor.getNumRows( ); run1++ )
+		for( run2 = 0; run2 < scaledCP.hessianLowRankFactor.getNumCols( ); run2++ )
+			if ( run1 < nV )
+				scaleBlock( scaledCP.hessianLowRankFactor,run1,run2,scaling[run1],emptyConstVector );
+
+	for( run2 = 0; run2 < scaledCP.objectiveGradient.getNumCols( ); run2++ )
+		if ( run2 < nV )
+			scaleBlock( scaledCP.objectiveGradient,0,run2,emptyConstVector,scaling[run2] );
+
+	scaledCP.hessian              *= objectiveScaling;
+	scaledCP.hessianLowRankWeight *= objectiveScaling;
+	scaledCP.objectiveGradient    *= objectiveScaling;
+
+
+	// BOUNDS: D^{-1}*lb <= dx <= D^{-1}*ub
+	// ------------------------------------
+	for( run1 = 0; run1 < scaledCP.lowerBoundResiduum.getNumRows( ); run1++ )
+	{
+		rowScaling = getVariableScaling( getVariableBlockIdx( run1 ),BT_TRUE );
+
+		scaleBlock( scaledCP.lowerBoundResiduum,run1,0,rowScaling,emptyConstVector );
+		scaleBlock( scaledCP.upperBoundResiduum,run1,0,rowScaling,emptyConstVector );
+	}
+
+
+	// DYNAMICS: rows are scaled by the inverse scaling of the next state
+	// ------------------------------------------------------------------
+	for( run1 = 0; run1 < scaledCP.dynGradient.getNumRows( ); run1++ )
+	{
+		rowScaling = getVariableScaling( run1+1,BT_TRUE );
+
+		for( run2 = 0; run2 < scaledCP.dynGradient.getNumCols( ); run2++ )
+		{
+			if ( run2 == 2 )
+				scaleBlock( scaledCP.dynGradient,run1,run2,rowScaling,scaling[2*N] );
+			else
+				scaleBlock( scaledCP.dynGradient,run1,run2,rowScaling,scaling[run2*N+run1] );
+		}
+
+		scaleBlock( scaledCP.dynResiduum,run1,0,rowScaling,emptyConstVector );
+	}
+
+
+	// CONSTRAINTS: rows are scaled by the constraint scaling
+	// ------------------------------------------------------
+	for( run1 = 0; run1 < scaledCP.constraintGradient.getNumRows( ); run1++ )
+	{
+		if ( run1 >= constraintScaling.getNumRows( ) )
+			break;
+
+		rowScaling = constraintScaling.getSubBlock( run1,0 ).getCol( 0 );
+
+		for( run2 = 0; run2 < scaledCP.constraintGradient.getNumCols( ); run2++ )
+			if ( run2 < nV )
+				scaleBlock( scaledCP.constraintGradient,run1,run2,rowScaling,scaling[run2] );
+
+		scaleBlock( scaledCP.lowerConstraintResiduum,run1,0,rowScaling,emptyConstVector );
+		scaleBlock( scaledCP.upperConstraintResiduum,run1,0,rowScaling,emptyConstVector );
+	}
+
+	delete[] scaling;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SCPevaluation::unscaleSolution(	const BandedCP& scaledCP,
+											BandedCP& cp
+											) const
+{
+	cp.deltaX           = scaledCP.deltaX;
+	cp.lambdaBound      = scaledCP.lambdaBound;
+	cp.lambdaDynamic    = scaledCP.lambdaDynamic;
+	cp.lambdaConstraint = scaledCP.lambdaConstraint;
+
+	if ( hasScaling( ) == BT_FALSE )
+		return SUCCESSFUL_RETURN;
+
+	uint run1;
+	Vector rowScaling;
+
+	// primal solution: dx = D*dx_scaled
+	scaleVariables( cp.deltaX );
+
+	// multipliers are divided by the objective scaling and scaled like their constraint rows
+	for( run1 = 0; run1 < cp.lambdaBound.getNumRows( ); run1++ )
+		scaleBlock( cp.lambdaBound,run1,0,getVariableScaling( getVariableBlockIdx( run1 ),BT_TRUE ),emptyConstVector );
+
+	for( run1 = 0; run1 < cp.lambdaDynamic.getNumRows( ); run1++ )
+		scaleBlock( cp.lambdaDynamic,run1,0,getVariableScaling( run1+1,BT_TRUE ),emptyConstVector );
+
+	for( run1 = 0; run1 < cp.lambdaConstraint.getNumRows( ); run1++ )
+	{
+		if ( run1 >= constraintScaling.getNumRows( ) )
+			break;
+
+		rowScaling = constraintScaling.getSubBlock( run1,0 ).getCol( 0 );
+		scaleBlock( cp.lambdaConstraint,run1,0,rowScaling,emptyConstVector );
+	}
+
+	cp.lambdaBound      *= 1.0/objectiveScaling;
+	cp.lambdaDynamic    *= 1.0/objectiveScaling;
+	cp.lambdaConstraint *= 1.0/objectiveScaling;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SCPevaluation::scaleVariables(	BlockMatrix& x,
+											BooleanType inverse
+											) const
+{
+	if ( hasScaling( ) == BT_FALSE )
+		return SUCCESSFUL_RETURN;
+
+	for( uint run1 = 0; run1 < x.getNumRows( ); run1++ )
+		scaleBlock( x,run1,0,getVariableScaling( run1,inverse ),emptyConstVector );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SCPevaluation::unscaleHessian(	BlockMatrix& H
+											) const
+{
+	if ( hasScaling( ) == BT_FALSE )
+		return SUCCESSFUL_RETURN;
+
+	uint run1, run2;
+
+	for( run1 = 0; run1 < H.getNumRows( ); run1++ )
+		for( run2 = 0; run2 < H.getNumCols( ); run2++ )
+			scaleBlock( H,run1,run2,getVariableScaling( run1,BT_TRUE ),getVariableScaling( run2,BT_TRUE ) );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 returnValue SCPevaluation::freezeSensitivities( )
 {
@@ -521,6 +817,9 @@ returnValue SCPevaluation::setReference( const VariablesGrid &ref )
     if( objective->setReference( ref ) != SUCCESSFUL_RETURN )
     	return ACADOERROR( RET_UNKNOWN_BUG );
 
+	// simulation results remain valid, only the objective needs to be re-evaluated
+	isObjectiveCacheValid = BT_FALSE;
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -530,7 +829,14 @@ returnValue SCPevaluation::clearDynamicDiscretization( )
 {
 	if( dynamicDiscretization != 0 )
 	{
-		dynamicDiscretization->unfreeze( );
+		// while the cache is valid, the frozen integrators are still needed for
+		// the sensitivities at the cached point, so unfreezing them is deferred
+		// to the next evaluation that is not served from the cache:
+		if ( isCacheValid == BT_TRUE )
+			isUnfreezePending = BT_TRUE;
+		else
+			dynamicDiscretization->unfreeze( );
+
 		dynamicDiscretization->deleteAllSeeds( );
 	}
 
@@ -538,6 +844,26 @@ returnValue SCPevaluation::clearDynamicDiscretization( )
 }
 
 
+returnValue SCPevaluation::shiftDynamicDiscretization( )
+{
+	isCacheValid = BT_FALSE;
+
+	if( dynamicDiscretization != 0 )
+		return dynamicDiscretization->shiftMesh( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SCPevaluation::setDeadline( double deadline_ )
+{
+	if( dynamicDiscretization != 0 )
+		return dynamicDiscretization->setDeadline( deadline_ );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 
 
 //
@@ -557,6 +883,286 @@ returnValue SCPevaluation::setupLogging( )
 
 
 
+returnValue SCPevaluation::getResidua( BandedCP& cp ) const
+{
+    if( dynamicDiscretization != 0 )
+        dynamicDiscretization->getResiduum( cp.dynResiduum );
+
+    if( constraint != 0 )
+    {
+        constraint->getBoundResiduum     ( cp.lowerBoundResiduum     , cp.upperBoundResiduum      );
+        constraint->getConstraintResiduum( cp.lowerConstraintResiduum, cp.upperConstraintResiduum );
+    }
+
+    if( dynamicDiscretization == 0 ){
+        cp.lowerBoundResiduum.setZero(0,0);
+        cp.lowerBoundResiduum.setZero(1,0);
+        cp.lowerBoundResiduum.setZero(3,0);
+        cp.lowerBoundResiduum.setZero(4,0);
+        cp.upperBoundResiduum.setZero(0,0);
+        cp.upperBoundResiduum.setZero(1,0);
+        cp.upperBoundResiduum.setZero(3,0);
+        cp.upperBoundResiduum.setZero(4,0);
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SCPevaluation::storeEvaluation( const OCPiterate& iter )
+{
+	cachedIterate = iter;
+
+	isCacheValid          = BT_TRUE;
+	isObjectiveCacheValid = BT_TRUE;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SCPevaluation::restoreEvaluation(	const OCPiterate& iter,
+												BandedCP& cp
+												)
+{
+	// the iterate coincides with the cached one and the internal states of the
+	// dynamic discretization and the constraints still correspond to it, so the
+	// residua are only read out again
+	getResidua( cp );
+
+	if ( isObjectiveCacheValid == BT_FALSE )
+	{
+		ACADO_TRY( objective->evaluate(iter) ).changeType( RET_UNABLE_TO_EVALUATE_OBJECTIVE );
+		objective->getObjectiveValue( objectiveValue );
+
+		isObjectiveCacheValid = BT_TRUE;
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+BooleanType SCPevaluation::isCachedIterate( const OCPiterate& iter ) const
+{
+	if ( isEqualGrid( iter.x,cachedIterate.x ) == BT_FALSE )
+		return BT_FALSE;
+
+	if ( isEqualGrid( iter.xa,cachedIterate.xa ) == BT_FALSE )
+		return BT_FALSE;
+
+	if ( isEqualGrid( iter.p,cachedIterate.p ) == BT_FALSE )
+		return BT_FALSE;
+
+	if ( isEqualGrid( iter.u,cachedIterate.u ) == BT_FALSE )
+		return BT_FALSE;
+
+	if ( isEqualGrid( iter.w,cachedIterate.w ) == BT_FALSE )
+		return BT_FALSE;
+
+	return BT_TRUE;
+}
+
+
+BooleanType SCPevaluation::isEqualGrid(	const VariablesGrid* const arg1,
+										const VariablesGrid* const arg2
+										) const
+{
+	uint run1, run2;
+
+	if ( ( arg1 == 0 ) || ( arg2 == 0 ) )
+	{
+		if ( arg1 == arg2 )
+			return BT_TRUE;
+		else
+			return BT_FALSE;
+	}
+
+	if ( ( arg1->getNumPoints( ) != arg2->getNumPoints( ) ) || ( arg1->getNumValues( ) != arg2->getNumValues( ) ) )
+		return BT_FALSE;
+
+	// exact comparison on purpose, any change of the iterate requires a new evaluation
+	for( run1 = 0; run1 < arg1->getNumPoints( ); run1++ )
+	{
+		if ( arg1->getTime( run1 ) != arg2->getTime( run1 ) )
+			return BT_FALSE;
+
+		for( run2 = 0; run2 < arg1->getNumValues( ); run2++ )
+			if ( (*arg1)( run1,run2 ) != (*arg2)( run1,run2 ) )
+				return BT_FALSE;
+	}
+
+	return BT_TRUE;
+}
+
+
+returnValue SCPevaluation::setupVariableScaling(	const OCPiterate& iter
+												)
+{
+	uint run1, run2;
+	const uint N = iter.getNumPoints( );
+
+	variableScaling.init( 5*N,1 );
+
+	Matrix tmp;
+	const VariablesGrid* grids[5] = { iter.x,iter.xa,iter.p,iter.u,iter.w };
+
+	for( uint type = 0; type < 5; type++ )
+	{
+		if ( ( grids[type] == 0 ) || ( grids[type]->getNumValues( ) == 0 ) )
+			continue;
+
+		for( run1 = 0; run1 < N; run1++ )
+		{
+			// parameters are time-constant and only stored once
+			if ( ( type == 2 ) && ( run1 > 0 ) )
+				break;
+
+			tmp.init( grids[type]->getNumValues( ),1 );
+
+			for( run2 = 0; run2 < grids[type]->getNumValues( ); run2++ )
+			{
+				tmp( run2,0 ) = grids[type]->getScaling( run1,run2 );
+
+				if ( tmp( run2,0 ) <= 0.0 )
+					tmp( run2,0 ) = 1.0;
+			}
+
+			variableScaling.setDense( type*N+run1,0,tmp );
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+Vector SCPevaluation::getVariableScaling(	uint blockIdx,
+											BooleanType inverse
+											) const
+{
+	Vector scaling;
+
+	if ( blockIdx >= variableScaling.getNumRows( ) )
+		return scaling;
+
+	const Matrix& block = variableScaling.getSubBlock( blockIdx,0 );
+	scaling.init( block.getNumRows( ) );
+
+	for( uint run1 = 0; run1 < block.getNumRows( ); run1++ )
+	{
+		if ( inverse == BT_TRUE )
+			scaling( run1 ) = 1.0/block( run1,0 );
+		else
+			scaling( run1 ) = block( run1,0 );
+	}
+
+	return scaling;
+}
+
+
+uint SCPevaluation::getVariableBlockIdx(	uint boundBlockIdx
+										) const
+{
+	// the bounds of the parameters are stored once, i.e. the bounds of
+	// controls and disturbances are shifted by N-1 blocks
+	const uint N = variableScaling.getNumRows( )/5;
+
+	if ( boundBlockIdx <= 2*N )
+		return boundBlockIdx;
+	else
+		return boundBlockIdx + N-1;
+}
+
+
+returnValue SCPevaluation::scaleBlock(	BlockMatrix& bm,
+										uint rowIdx,
+										uint colIdx,
+										const Vector& rowScaling,
+										const Vector& colScaling
+										) const
+{
+	if ( ( rowIdx >= bm.getNumRows( ) ) || ( colIdx >= bm.getNumCols( ) ) )
+		return SUCCESSFUL_RETURN;
+
+	Matrix block = bm.getSubBlock( rowIdx,colIdx );
+
+	if ( block.getDim( ) == 0 )
+		return SUCCESSFUL_RETURN;
+
+	uint run1, run2;
+
+	BooleanType scaleRows = BT_FALSE;
+	BooleanType scaleCols = BT_FALSE;
+
+	if ( ( rowScaling.getDim( ) == block.getNumRows( ) ) && ( isUnitScaling( rowScaling ) == BT_FALSE ) )
+		scaleRows = BT_TRUE;
+
+	if ( ( colScaling.getDim( ) == block.getNumCols( ) ) && ( isUnitScaling( colScaling ) == BT_FALSE ) )
+		scaleCols = BT_TRUE;
+
+	if ( ( scaleRows == BT_FALSE ) && ( scaleCols == BT_FALSE ) )
+		return SUCCESSFUL_RETURN;
+
+	for( run1 = 0; run1 < block.getNumRows( ); run1++ )
+		for( run2 = 0; run2 < block.getNumCols( ); run2++ )
+		{
+			if ( scaleRows == BT_TRUE )
+				block( run1,run2 ) *= rowScaling( run1 );
+
+			if ( scaleCols == BT_TRUE )
+				block( run1,run2 ) *= colScaling( run2 );
+		}
+
+	return bm.setDense( rowIdx,colIdx,block );
+}
+
+
+BooleanType SCPevaluation::isUnitScaling(	const Vector& scaling
+											) const
+{
+	for( uint run1 = 0; run1 < scaling.getDim( ); run1++ )
+		if ( scaling( run1 ) != 1.0 )
+			return BT_FALSE;
+
+	return BT_TRUE;
+}
+
+
+BooleanType SCPevaluation::isUnitScaling(	const BlockMatrix& scaling
+											) const
+{
+	uint run1, run2;
+
+	for( run1 = 0; run1 < scaling.getNumRows( ); run1++ )
+	{
+		const Matrix& block = scaling.getSubBlock( run1,0 );
+
+		for( run2 = 0; run2 < block.getNumRows( ); run2++ )
+			if ( block( run2,0 ) != 1.0 )
+				return BT_FALSE;
+	}
+
+	return BT_TRUE;
+}
+
+
+double SCPevaluation::getScalingFactor(	double norm
+										) const
+{
+	// functions are only scaled down if their gradient exceeds maxGradient, and all
+	// factors are powers of two in order not to introduce rounding errors
+	const double maxGradient = 1.0e2;
+	const double minScaling  = 1.0e-8;
+
+	if ( norm <= maxGradient )
+		return 1.0;
+
+	if ( norm >= maxGradient/minScaling )
+		return pow( 2.0, floor( log( minScaling )/log( 2.0 ) ) );
+
+	return pow( 2.0, floor( log( maxGradient/norm )/log( 2.0 ) + 0.5 ) );
+}
+
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
@@ -56,6 +56,9 @@ SCPmethod::SCPmethod( ) : NLPsolver( )
 	hasPerformedStep = BT_FALSE;
 	isInRealTimeMode = BT_FALSE;
 	needToReevaluate = BT_FALSE;
+	needToRelinearize = BT_FALSE;
+
+	deadline = -1.0;
 }
 
 
@@ -78,6 +81,9 @@ SCPmethod::SCPmethod(	UserInteraction* _userInteraction,
 	hasPerformedStep = BT_FALSE;
 	isInRealTimeMode = BT_FALSE;
 	needToReevaluate = BT_FALSE;
+	needToRelinearize = BT_FALSE;
+
+	deadline = -1.0;
 
 	setupLogging( );
 }
@@ -102,6 +108,8 @@ SCPmethod::SCPmethod( const SCPmethod& rhs ) : NLPsolver( rhs )
     if( rhs.derivativeApproximation != 0 ) derivativeApproximation = (rhs.derivativeApproximation)->clone( );
     else                                   derivativeApproximation = 0;
 
+    bandedCP = rhs.bandedCP;
+
     if( rhs.bandedCPsolver != 0 ) bandedCPsolver = (rhs.bandedCPsolver)->clone( );
     else                          bandedCPsolver = 0;
 
@@ -111,6 +119,9 @@ SCPmethod::SCPmethod( const SCPmethod& rhs ) : NLPsolver( rhs )
 	hasPerformedStep = rhs.hasPerformedStep;
 	isInRealTimeMode = rhs.isInRealTimeMode;
 	needToReevaluate = rhs.needToReevaluate;
+	needToRelinearize = rhs.needToRelinearize;
+
+	deadline = rhs.deadline;
 }
 
 
@@ -166,6 +177,8 @@ SCPmethod& SCPmethod::operator=( const SCPmethod& rhs ){
 		if( rhs.derivativeApproximation != 0 ) derivativeApproximation = (rhs.derivativeApproximation)->clone( );
 		else                                   derivativeApproximation = 0;
 
+		bandedCP = rhs.bandedCP;
+
         if( rhs.bandedCPsolver != 0 ) bandedCPsolver = (rhs.bandedCPsolver)->clone( );
         else                          bandedCPsolver = 0;
 
@@ -175,6 +188,9 @@ SCPmethod& SCPmethod::operator=( const SCPmethod& rhs ){
 		hasPerformedStep = rhs.hasPerformedStep;
 		isInRealTimeMode = rhs.isInRealTimeMode;
 		needToReevaluate = rhs.needToReevaluate;
+		needToRelinearize = rhs.needToRelinearize;
+
+		deadline = rhs.deadline;
 	}
 
     return *this;
@@ -204,6 +220,9 @@ returnValue SCPmethod::init(	VariablesGrid* x_init ,
 	// ---------------------------
     ACADO_TRY( eval->evaluateSensitivities( iter,bandedCP ) ).changeType( RET_NLP_INIT_FAILED );
 
+	// scaling of objective and constraints is based on the first linearization
+	ACADO_TRY( eval->computeScaling( bandedCP ) ).changeType( RET_NLP_INIT_FAILED );
+
 
 	int useRealtimeIterations;
 	get( USE_REALTIME_ITERATIONS,useRealtimeIterations );
@@ -237,6 +256,13 @@ returnValue SCPmethod::solve(	const Vector &x0_,
 
 	returnValue returnvalue = SUCCESSFUL_RETURN;
 	numberOfSteps = 0;
+	timeBudgetExceeded = BT_FALSE;
+
+	double maxTime;
+	get( MAX_NLP_SOLVER_TIME, maxTime );
+
+	if ( maxTime > 0.0 )
+		return solveWithinTimeBudget( x0_,p_,maxTime );
 
 	int maxNumberOfSteps;
 	get( MAX_NUM_ITERATIONS, maxNumberOfSteps );
@@ -253,6 +279,14 @@ returnValue SCPmethod::solve(	const Vector &x0_,
 			return ACADOERROR( RET_NLP_SOLUTION_FAILED );
 	}
 
+	double tol;
+	get( KKT_TOLERANCE,tol );
+
+	if ( getInfeasibility( ) <= tol )
+		iterateFeasible = BT_TRUE;
+	else
+		iterateFeasible = BT_FALSE;
+
 	replot( PLOT_AT_END );
 
     if( numberOfSteps == maxNumberOfSteps )
@@ -303,6 +337,17 @@ returnValue SCPmethod::feedbackStep(	const Vector& x0_,
 	if ( checkForRealTimeMode( x0_,p_ ) != SUCCESSFUL_RETURN )
 		return ACADOERROR( RET_NLP_STEP_FAILED );
 
+	if ( needToRelinearize == BT_TRUE )
+	{
+		if ( ( relinearize( ) != SUCCESSFUL_RETURN ) || ( isDeadlineReached( ) == BT_TRUE ) )
+		{
+			if ( isDeadlineReached( ) == BT_TRUE )
+				return RET_NLP_TIME_BUDGET_EXCEEDED;
+
+			return ACADOERROR( RET_NLP_STEP_FAILED );
+		}
+	}
+
     int hessianMode;
     get( HESSIAN_APPROXIMATION,hessianMode );
 
@@ -322,8 +367,38 @@ returnValue SCPmethod::feedbackStep(	const Vector& x0_,
 			return ACADOERROR( RET_NLP_STEP_FAILED );
 	}
 
-	if ( bandedCPsolver->solve( bandedCP ) != SUCCESSFUL_RETURN )
+	// the QP solution must not overrun the deadline of the current solve
+	double maxQPsolverTime = -1.0;
+
+	if ( deadline > 0.0 )
+	{
+		get( MAX_QP_SOLVER_TIME,maxQPsolverTime );
+
+		double remainingTime = deadline - acadoGetTime( );
+		if ( remainingTime <= 0.0 )
+			return RET_NLP_TIME_BUDGET_EXCEEDED;
+
+		if ( ( maxQPsolverTime > 0.0 ) && ( maxQPsolverTime < remainingTime ) )
+			remainingTime = maxQPsolverTime;
+
+		bandedCPsolver->set( MAX_QP_SOLVER_TIME,remainingTime );
+	}
+
+	if ( ( isInRealTimeMode == BT_FALSE ) && ( eval->hasScaling( ) == BT_TRUE ) )
+		returnvalue = solveScaledCP( );
+	else
+		returnvalue = bandedCPsolver->solve( bandedCP );
+
+	if ( deadline > 0.0 )
+		bandedCPsolver->set( MAX_QP_SOLVER_TIME,maxQPsolverTime );
+
+	if ( returnvalue != SUCCESSFUL_RETURN )
+	{
+		if ( isDeadlineReached( ) == BT_TRUE )
+			return RET_NLP_TIME_BUDGET_EXCEEDED;
+
 		return ACADOERROR( RET_NLP_STEP_FAILED );
+	}
 
 	++numberOfSteps;
 
@@ -430,6 +505,7 @@ returnValue SCPmethod::prepareNextStep( )
 
 	clock.stop( );
 	setLast( LOG_TIME_SENSITIVITIES,clock.getTime() );
+	setLast( LOG_TIME_LIFTING,eval->getLiftingTime() );
 
 	//bandedCP.objectiveGradient.print();
 	
@@ -504,7 +580,15 @@ returnValue SCPmethod::shiftVariables(	double timeShift
 
 // 	printf("shifted!\n");
 // 	needToReevaluate = BT_TRUE;
-	return iter.shift( timeShift );
+	if ( eval != 0 )
+		eval->shiftDynamicDiscretization( );
+
+	returnValue returnvalue = iter.shift( timeShift );
+
+	if ( ( returnvalue == SUCCESSFUL_RETURN ) && ( bandedCPsolver != 0 ) )
+		bandedCPsolver->shiftWorkingSet( bandedCP );
+
+	return returnvalue;
 }
 
 
@@ -517,6 +601,10 @@ returnValue SCPmethod::getVarianceCovariance( Matrix &var )
 	if( bandedCPsolver == 0 )
 		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
 
+	// the CP solver only knows the scaled problem
+	if( eval->hasScaling( ) == BT_TRUE )
+		return ACADOERROR( RET_NOT_YET_IMPLEMENTED );
+
 	return bandedCPsolver->getVarianceCovariance( var );
 }
 
@@ -544,6 +632,7 @@ returnValue SCPmethod::setupLogging( )
 // 	tmp.addItem( LOG_TIME_EVALUATION,            "",     "TIME FOR FUNCTION EVALUATIONS        :  "," sec.\n", 9, 3 );
 	tmp.addItem( LOG_TIME_GLOBALIZATION,         "",     "TIME FOR GLOBALIZATION               :  "," sec.\n", 9, 3 );
 	tmp.addItem( LOG_TIME_SENSITIVITIES,         "",     "TIME FOR SENSITIVITY GENERATION      :  "," sec.\n", 9, 3 );
+	tmp.addItem( LOG_TIME_LIFTING,               "",     "TIME FOR LIFTING (EXPAND + CONDENSE) :  "," sec.\n", 9, 3 );
 // 	tmp.addItem( LOG_TIME_LAGRANGE_GRADIENT,     "",     "TIME FOR COMPUTING LAGRANGE GRADIENT :  "," sec.\n", 9, 3 );
 // 	tmp.addItem( LOG_TIME_HESSIAN_COMPUTATION,   "",     "TIME FOR HESSIAN EVALUATION          :  "," sec.\n", 9, 3 );
 
@@ -606,21 +695,11 @@ returnValue SCPmethod::setup( )
 	if ( bandedCPsolver != 0 )
 		delete bandedCPsolver;
 
-	int useCondensing;
-	get( USE_CONDENSING,useCondensing );
-
-	if ( (BooleanType)useCondensing == BT_TRUE )
-	{
-    	bandedCP.lambdaConstraint.init( eval->getNumConstraintBlocks(), 1 );
-    	bandedCP.lambdaDynamic.init( getNumPoints()-1, 1 );
+	bandedCP.lambdaConstraint.init( eval->getNumConstraintBlocks(), 1 );
+	bandedCP.lambdaDynamic.init( getNumPoints()-1, 1 );
 
-		bandedCPsolver = new CondensingBasedCPsolver( userInteraction,eval->getNumConstraints(),eval->getConstraintBlockDims() );
-		bandedCPsolver->init( iter );
-	}
-	else
-	{
-		return ACADOERROR( RET_NOT_YET_IMPLEMENTED );
-	}
+	if ( allocateBandedCPsolver( ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_NLP_INIT_FAILED );
 
 
     // INITIALIZE GLOBALIZATION STRATEGY (SCPstep):
@@ -695,6 +774,14 @@ returnValue SCPmethod::setup( )
 			derivativeApproximation = new GaussNewtonApproximationWithBFGS( userInteraction,getNumPoints() );
 			break;
 
+		case LIMITED_MEMORY_BFGS_UPDATE:
+			derivativeApproximation = new LimitedMemoryBFGSupdate( userInteraction );
+			break;
+
+		case BLOCK_LIMITED_MEMORY_BFGS_UPDATE:
+			derivativeApproximation = new LimitedMemoryBFGSupdate( userInteraction,getNumPoints() );
+			break;
+
 		default:
 			return ACADOERROR( RET_UNKNOWN_BUG );
 	}
@@ -703,6 +790,10 @@ returnValue SCPmethod::setup( )
 
 	ACADO_TRY( derivativeApproximation->initHessian( bandedCP.hessian,getNumPoints(),iter ) );
 
+	// the initial approximation is meant for the scaled variables
+	ACADO_TRY( eval->unscaleHessian( bandedCP.hessian ) );
+	ACADO_TRY( derivativeApproximation->getLowRankHessian( bandedCP.hessianLowRankFactor,bandedCP.hessianLowRankWeight ) );
+
 
 	// SWITCH BETWEEN SINGLE- AND MULTIPLE SHOOTING:
 	// ---------------------------------------------
@@ -718,6 +809,22 @@ returnValue SCPmethod::setup( )
 }
 
 
+returnValue SCPmethod::allocateBandedCPsolver( )
+{
+	int useCondensing;
+	get( USE_CONDENSING,useCondensing );
+
+	if ( (BooleanType)useCondensing == BT_TRUE )
+		bandedCPsolver = new CondensingBasedCPsolver( userInteraction,eval->getNumConstraints(),eval->getConstraintBlockDims() );
+	else
+		bandedCPsolver = new RiccatiBasedCPsolver( userInteraction,eval->getNumConstraints(),eval->getConstraintBlockDims() );
+
+	bandedCPsolver->init( iter );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue SCPmethod::printIterate( ) const
 {
 	return iter.print( );
@@ -788,7 +895,14 @@ returnValue SCPmethod::computeHessianMatrix(	const BlockMatrix& oldLagrangeGradi
 
 	if ( numberOfSteps == 1 )
 	{
-		returnvalue = derivativeApproximation->initScaling( bandedCP.hessian, bandedCP.deltaX, newLagrangeGradient-oldLagrangeGradient );
+		// the initial scaling is determined in the scaled variables, if any
+		BlockMatrix scaledStep( bandedCP.deltaX );
+		BlockMatrix scaledGradientDifference( newLagrangeGradient-oldLagrangeGradient );
+
+		eval->scaleVariables( scaledStep,BT_TRUE );
+		eval->scaleVariables( scaledGradientDifference );
+
+		returnvalue = derivativeApproximation->initScaling( bandedCP.hessian, scaledStep, scaledGradientDifference );
 		if( returnvalue != SUCCESSFUL_RETURN )
 			ACADOERROR( returnvalue );
 	}
@@ -797,6 +911,11 @@ returnValue SCPmethod::computeHessianMatrix(	const BlockMatrix& oldLagrangeGradi
 	if( returnvalue != SUCCESSFUL_RETURN )
 		ACADOERROR( returnvalue );
 
+	// limited-memory updates keep a low-rank part that is not stored in the Hessian
+	returnvalue = derivativeApproximation->getLowRankHessian( bandedCP.hessianLowRankFactor,bandedCP.hessianLowRankWeight );
+	if( returnvalue != SUCCESSFUL_RETURN )
+		ACADOERROR( returnvalue );
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -819,6 +938,25 @@ returnValue SCPmethod::initializeHessianProjection( )
 
 
 
+returnValue SCPmethod::solveScaledCP( )
+{
+	BandedCP scaledCP;
+
+	if ( eval->scaleCP( bandedCP,scaledCP ) != SUCCESSFUL_RETURN )
+		return RET_NLP_STEP_FAILED;
+
+	returnValue returnvalue = bandedCPsolver->solve( scaledCP );
+	if ( returnvalue != SUCCESSFUL_RETURN )
+		return returnvalue;
+
+	if ( eval->unscaleSolution( scaledCP,bandedCP ) != SUCCESSFUL_RETURN )
+		return RET_NLP_STEP_FAILED;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
 returnValue SCPmethod::checkForRealTimeMode(	const Vector &x0_,
 												const Vector &p_
 												)
@@ -856,6 +994,7 @@ returnValue SCPmethod::stopClockAndPrintRuntimeProfile( )
 {
 	clockTotalTime.stop( );
 	setLast( LOG_TIME_SQP_ITERATION,clockTotalTime.getTime() );
+	updateIterationTimeEstimate( clockTotalTime.getTime() );
 	
 	int printProfile;
 	get( PRINT_SCP_METHOD_PROFILE, printProfile );
@@ -867,6 +1006,230 @@ returnValue SCPmethod::stopClockAndPrintRuntimeProfile( )
 }
 
 
+returnValue SCPmethod::solveWithinTimeBudget(	const Vector &x0_,
+												const Vector &p_,
+												double maxTime
+												)
+{
+	returnValue returnvalue = CONVERGENCE_NOT_YET_ACHIEVED;
+
+	int maxNumberOfSteps;
+	get( MAX_NUM_ITERATIONS, maxNumberOfSteps );
+
+	double tol;
+	get( KKT_TOLERANCE,tol );
+
+	double startTime = acadoGetTime( );
+	setDeadline( startTime + maxTime );
+
+
+	// START FROM A CONSISTENT LINEARIZATION:
+	// --------------------------------------
+	if ( needToRelinearize == BT_TRUE )
+	{
+		if ( ( relinearize( ) != SUCCESSFUL_RETURN ) || ( isDeadlineReached( ) == BT_TRUE ) )
+		{
+			if ( isDeadlineReached( ) == BT_FALSE )
+			{
+				setDeadline( -1.0 );
+				return ACADOERROR( RET_NLP_SOLUTION_FAILED );
+			}
+
+			setDeadline( -1.0 );
+			needToRelinearize  = BT_TRUE;
+			timeBudgetExceeded = BT_TRUE;
+			iterateFeasible    = BT_FALSE;
+			return RET_NLP_TIME_BUDGET_EXCEEDED;
+		}
+	}
+
+	OCPiterate bestIter = iter;
+	double bestInfeasibility  = getInfeasibility( );
+	double bestObjectiveValue = getObjectiveValue( );
+	double infeasibility      = bestInfeasibility;
+
+	BooleanType isBestIterate = BT_TRUE;
+
+
+	// ITERATE AS LONG AS THE TIME BUDGET ALLOWS:
+	// ------------------------------------------
+	while( numberOfSteps < maxNumberOfSteps )
+	{
+		// the first iteration is always tried, later ones only if they are expected to finish in time
+		if ( ( numberOfSteps > 0 ) && ( acadoGetTime( ) - startTime + iterationTimeEstimate > maxTime ) )
+		{
+			timeBudgetExceeded = BT_TRUE;
+			break;
+		}
+
+		returnvalue = step( x0_,p_ );
+		// also increases numberOfSteps by one
+
+		if ( isDeadlineReached( ) == BT_TRUE )
+		{
+			// the iteration may have been cancelled, thus its result is not reliable
+			timeBudgetExceeded = BT_TRUE;
+			isBestIterate      = BT_FALSE;
+			break;
+		}
+
+		if( ( returnvalue != CONVERGENCE_ACHIEVED ) && ( returnvalue != CONVERGENCE_NOT_YET_ACHIEVED ) )
+		{
+			setDeadline( -1.0 );
+			return ACADOERROR( RET_NLP_SOLUTION_FAILED );
+		}
+
+		infeasibility = getInfeasibility( );
+
+		if ( isBetterIterate( infeasibility,getObjectiveValue( ),bestInfeasibility,bestObjectiveValue ) == BT_TRUE )
+		{
+			bestIter           = iter;
+			bestInfeasibility  = infeasibility;
+			bestObjectiveValue = getObjectiveValue( );
+			isBestIterate      = BT_TRUE;
+		}
+		else
+			isBestIterate = BT_FALSE;
+
+		if( returnvalue == CONVERGENCE_ACHIEVED )
+			break;
+	}
+
+	setDeadline( -1.0 );
+
+
+	// RETURN THE BEST ITERATE ON EARLY EXIT:
+	// --------------------------------------
+	if ( ( timeBudgetExceeded == BT_TRUE ) && ( isBestIterate == BT_FALSE ) )
+	{
+		iter = bestIter;
+		infeasibility = bestInfeasibility;
+
+		// objective value and residua have to match the returned iterate, while
+		// the derivatives are only renewed at the next feedback step
+		eval->clearDynamicDiscretization( );
+		if ( eval->evaluate( iter,bandedCP ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_NLP_SOLUTION_FAILED );
+
+		needToRelinearize = BT_TRUE;
+	}
+
+	if ( infeasibility <= tol )
+		iterateFeasible = BT_TRUE;
+	else
+		iterateFeasible = BT_FALSE;
+
+	replot( PLOT_AT_END );
+
+	if ( timeBudgetExceeded == BT_TRUE )
+		return RET_NLP_TIME_BUDGET_EXCEEDED;
+
+	if( numberOfSteps == maxNumberOfSteps )
+		return RET_MAX_NUMBER_OF_STEPS_EXCEEDED;
+
+	return returnvalue;
+}
+
+
+returnValue SCPmethod::relinearize( )
+{
+	eval->clearDynamicDiscretization( );
+
+	if ( eval->evaluate( iter,bandedCP ) != SUCCESSFUL_RETURN )
+		return RET_NLP_STEP_FAILED;
+
+	if ( eval->evaluateSensitivities( iter,bandedCP ) != SUCCESSFUL_RETURN )
+		return RET_NLP_STEP_FAILED;
+
+	int useRealtimeIterations;
+	get( USE_REALTIME_ITERATIONS,useRealtimeIterations );
+
+	if ( (BooleanType)useRealtimeIterations == BT_TRUE )
+	{
+		if ( bandedCPsolver->prepareSolve( bandedCP ) != SUCCESSFUL_RETURN )
+			return RET_NLP_STEP_FAILED;
+	}
+
+	needToReevaluate  = BT_FALSE;
+	needToRelinearize = BT_FALSE;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SCPmethod::setDeadline(	double deadline_
+									)
+{
+	deadline = deadline_;
+	return eval->setDeadline( deadline_ );
+}
+
+
+BooleanType SCPmethod::isDeadlineReached( ) const
+{
+	if ( ( deadline > 0.0 ) && ( acadoGetTime( ) >= deadline ) )
+		return BT_TRUE;
+
+	return BT_FALSE;
+}
+
+
+double SCPmethod::getInfeasibility( ) const
+{
+	uint run1, run2, run3;
+	double infeasibility = 0.0;
+
+	BlockMatrix violation[5];
+
+	violation[0] = bandedCP.dynResiduum.getAbsolute( );
+	violation[1] = bandedCP.lowerBoundResiduum.getPositive( );
+	violation[2] = bandedCP.upperBoundResiduum.getNegative( ).getAbsolute( );
+	violation[3] = bandedCP.lowerConstraintResiduum.getPositive( );
+	violation[4] = bandedCP.upperConstraintResiduum.getNegative( ).getAbsolute( );
+
+	for( run1 = 0; run1 < 5; run1++ )
+		for( run2 = 0; run2 < violation[run1].getNumRows( ); run2++ )
+			for( run3 = 0; run3 < violation[run1].getNumCols( ); run3++ )
+			{
+				const Matrix& block = violation[run1].getSubBlock( run2,run3 );
+
+				if ( ( block.getDim( ) > 0 ) && ( block.getMax( ) > infeasibility ) )
+					infeasibility = block.getMax( );
+			}
+
+	return infeasibility;
+}
+
+
+BooleanType SCPmethod::isBetterIterate(	double infeasibility,
+										double objectiveValue,
+										double bestInfeasibility,
+										double bestObjectiveValue
+										) const
+{
+	double tol;
+	get( KKT_TOLERANCE,tol );
+
+	// feasible iterates are compared by their objective, infeasible ones by their violation
+	if ( infeasibility <= tol )
+	{
+		if ( bestInfeasibility > tol )
+			return BT_TRUE;
+
+		if ( objectiveValue < bestObjectiveValue )
+			return BT_TRUE;
+
+		return BT_FALSE;
+	}
+
+	if ( ( bestInfeasibility > tol ) && ( infeasibility < bestInfeasibility ) )
+		return BT_TRUE;
+
+	return BT_FALSE;
+}
+
+
+
 returnValue SCPmethod::getDifferentialStates( VariablesGrid &xd_ ) const{
 
     if( iter.x == 0 ) return RET_MEMBER_NOT_INITIALISED;
@@ -200,65 +200,93 @@ LSQTerm& LSQTerm::operator=( const LSQTerm& rhs ){
 
 returnValue LSQTerm::evaluate( const OCPiterate &x ){
 
-    uint run1, run2, run3;
-
-    Vector h_res;
+    int run1;
 
     const uint nh = fcn.getDim();
-    const uint N  = grid.getNumPoints();
+    const int  N  = grid.getNumPoints();
 
     ObjectiveElement::init( x );
 
     obj = 0.0;
 
-	double currentValue;
+    if( S != NULL ){
+        for( run1 = 0; run1 < N; run1++ )
+            ASSERT_RETURN( S[run1].getNumCols() == nh && S[run1].getNumRows() == nh ).addMessage("\n >>>  The weighting matrix in the LSQ objective has a wrong dimension.  <<< \n\n");
+    }
+
 	VariablesGrid allValues( 1,grid );
 
-    for( run1 = 0; run1 < N; run1++ ){
+    // THE LAST GRID POINT IS EVALUATED FIRST, SUCH THAT THE BUFFERS OF THE FUNCTION
+    // ALREADY HAVE THEIR FINAL SIZE WHEN THE OTHER POINTS ARE EVALUATED IN PARALLEL:
+    // ------------------------------------------------------------------------------
+    if( N > 0 )
+        allValues( N-1,0 ) = evaluatePoint( N-1, x, z );
+
+#ifdef _OPENMP
+    #pragma omp parallel num_threads( acadoGetNumThreads( ) ) if( ( fcn.isSymbolic() == BT_TRUE ) && ( fcn.getN() == 0 ) )
+#endif
+    {
+        EvaluationPoint zThread( z );
+
+#ifdef _OPENMP
+        #pragma omp for schedule(static)
+#endif
+        for( run1 = 0; run1 < N-1; run1++ )
+            allValues( run1,0 ) = evaluatePoint( run1, x, zThread );
+    }
 
-		currentValue = 0.0;
+	Vector tmp(1);
+	allValues.getIntegral( IM_CONSTANT,tmp );
+	obj = tmp(0);
 
-        // EVALUATE THE LSQ-FUCNTION:
-        // --------------------------
-        z.setZ( run1, x );
-        h_res = fcn.evaluate( z, (int) run1 );
+    return SUCCESSFUL_RETURN;
+}
 
 
-        // EVALUATE THE OBJECTIVE:
-        // -----------------------
+double LSQTerm::evaluatePoint( int idx, const OCPiterate &x, EvaluationPoint &zThread ){
 
-        if( r != NULL )
-            h_res -= r[run1];
+    uint run2, run3;
 
-        if( S != NULL ){
+    const uint nh = fcn.getDim();
 
-            ASSERT_RETURN( S[run1].getNumCols() == nh && S[run1].getNumRows() == nh ).addMessage("\n >>>  The weighting matrix in the LSQ objective has a wrong dimension.  <<< \n\n");
+    double currentValue = 0.0;
+    double *h_res = new double[nh];
 
-            for( run2 = 0; run2 < nh; run2++ ){
-                S_h_res[run1][run2] = 0.0;
-                for( run3 = 0; run3 < nh; run3++ )
-                    S_h_res[run1][run2] += S[run1].operator()(run2,run3)*h_res(run3);
-            }
+    // EVALUATE THE LSQ-FUCNTION:
+    // --------------------------
+    zThread.setZ( idx, x );
+    fcn.evaluate( idx, zThread, h_res );
 
-            for( run2 = 0; run2 < nh; run2++ ){
-                 currentValue += 0.5*h_res(run2)*S_h_res[run1][run2];
-            }
-        }
-        else{
-            for( run2 = 0; run2 < nh; run2++ ){
-                S_h_res[run1][run2] = h_res(run2);
-                currentValue += 0.5*h_res(run2)*h_res(run2);
-            }
+
+    // EVALUATE THE OBJECTIVE:
+    // -----------------------
+
+    if( r != NULL )
+        for( run2 = 0; run2 < nh; run2++ )
+            h_res[run2] -= r[idx](run2);
+
+    if( S != NULL ){
+
+        for( run2 = 0; run2 < nh; run2++ ){
+            S_h_res[idx][run2] = 0.0;
+            for( run3 = 0; run3 < nh; run3++ )
+                S_h_res[idx][run2] += S[idx].operator()(run2,run3)*h_res[run3];
         }
 
-		allValues( run1,0 ) = currentValue;
+        for( run2 = 0; run2 < nh; run2++ ){
+             currentValue += 0.5*h_res[run2]*S_h_res[idx][run2];
+        }
+    }
+    else{
+        for( run2 = 0; run2 < nh; run2++ ){
+            S_h_res[idx][run2] = h_res[run2];
+            currentValue += 0.5*h_res[run2]*h_res[run2];
+        }
     }
 
-	Vector tmp(1);
-	allValues.getIntegral( IM_CONSTANT,tmp );
-	obj = tmp(0);
+    delete[] h_res;
 
-    return SUCCESSFUL_RETURN;
+    return currentValue;
 }
 
 
@@ -404,7 +432,6 @@ returnValue LSQTerm::evaluateSensitivities( BlockMatrix *hessian ){
 
 returnValue LSQTerm::evaluateSensitivitiesGN( BlockMatrix *GNhessian ){
 
-    int run1, run2, run3, run4;
     const int N = grid.getNumPoints();
     const int nh = fcn.getDim();
 
@@ -414,12 +441,6 @@ returnValue LSQTerm::evaluateSensitivitiesGN( BlockMatrix *GNhessian ){
             xSeed2 != 0 || pSeed2 != 0 || uSeed2 != 0 || wSeed2 != 0 )
             return ACADOERROR( RET_WRONG_DEFINITION_OF_SEEDS );
 
-        double *bseed   = new double [nh];
-        double **J      = new double*[nh];
-
-        for( run2 = 0; run2 < nh; run2++ )
-             J[run2] = new double[fcn.getNumberOfVariables() +1];
-
         if( bSeed->getNumRows( 0, 0 ) != 1 ) return ACADOWARNING( RET_WRONG_DEFINITION_OF_SEEDS );
 
         Matrix bseed_;
@@ -427,132 +448,153 @@ returnValue LSQTerm::evaluateSensitivitiesGN( BlockMatrix *GNhessian ){
 
         dBackward.init( 1, 5*N );
 
-        Matrix Dx ( 1, nx );
-        Matrix Dxa( 1, na );
-        Matrix Dp ( 1, np );
-        Matrix Du ( 1, nu );
-        Matrix Dw ( 1, nw );
-
-        for( run1 = 0; run1 < N; run1++ ){
-
-            Dx .setZero();
-            Dxa.setZero();
-            Dp .setZero();
-            Du .setZero();
-            Dw .setZero();
-
-            for( run2 = 0; run2 < nh; run2++ ) bseed[run2] = 0;
-
-            if( fcn.ADisSupported() == BT_FALSE ){
-
-                double *fseed = new double[fcn.getNumberOfVariables()+1];
-                for( run3 = 0; (int) run3 < fcn.getNumberOfVariables()+1; run3++ )
-                     fseed[run3] = 0.0;
-
-                for( run3 = 0; (int) run3 < fcn.getNumberOfVariables()+1; run3++ ){
-                     fseed[run3] = 1.0;
-                     fcn.AD_forward( run1, fseed, bseed );
-                     fseed[run3] = 0.0;
-                     for( run2 = 0; run2 < nh; run2++ )
-                         J[run2][run3] = bseed[run2];
+        // EVERY GRID POINT WRITES ITS OWN BLOCKS, HENCE THE GRID POINTS
+        // CAN BE PROCESSED CONCURRENTLY IF THE FUNCTION IS SYMBOLIC:
+        // -------------------------------------------------------------
+
+#ifdef _OPENMP
+        #pragma omp parallel num_threads( acadoGetNumThreads( ) ) if( ( fcn.isSymbolic() == BT_TRUE ) && ( fcn.getN() == 0 ) )
+#endif
+        {
+            double *bseed   = new double [nh];
+            double **J      = new double*[nh];
+
+            for( int run2 = 0; run2 < nh; run2++ )
+                 J[run2] = new double[fcn.getNumberOfVariables() +1];
+
+            Matrix Dx ( 1, nx );
+            Matrix Dxa( 1, na );
+            Matrix Dp ( 1, np );
+            Matrix Du ( 1, nu );
+            Matrix Dw ( 1, nw );
+
+#ifdef _OPENMP
+            #pragma omp for schedule(static)
+#endif
+            for( int run1 = 0; run1 < N; run1++ ){
+
+                int run2, run3, run4;
+
+                Dx .setZero();
+                Dxa.setZero();
+                Dp .setZero();
+                Du .setZero();
+                Dw .setZero();
+
+                for( run2 = 0; run2 < nh; run2++ ) bseed[run2] = 0;
+
+                if( fcn.ADisSupported() == BT_FALSE ){
+
+                    double *fseed = new double[fcn.getNumberOfVariables()+1];
+                    for( run3 = 0; (int) run3 < fcn.getNumberOfVariables()+1; run3++ )
+                         fseed[run3] = 0.0;
+
+                    for( run3 = 0; (int) run3 < fcn.getNumberOfVariables()+1; run3++ ){
+                         fseed[run3] = 1.0;
+                         fcn.AD_forward( run1, fseed, bseed );
+                         fseed[run3] = 0.0;
+                         for( run2 = 0; run2 < nh; run2++ )
+                             J[run2][run3] = bseed[run2];
+                    }
+                    delete[] fseed;
                 }
-                delete[] fseed;
-            }
-
-            for( run2 = 0; run2 < nh; run2++ ){
-
-                 if( fcn.ADisSupported() == BT_TRUE ){
-                     for(run3 = 0; (int) run3 < fcn.getNumberOfVariables() +1; run3++ )
-                         J[run2][run3] = 0.0;
-                     bseed[run2] = 1.0;
-                     fcn.AD_backward( run1, bseed, J[run2] );
-                     bseed[run2] = 0.0;
-                 }
-
-                 for( run3 = 0; run3 < nx; run3++ ){
-                      Dx( 0, run3 ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx; run3 < nx+na; run3++ ){
-                      Dxa( 0, run3-nx ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx+na; run3 < nx+na+np; run3++ ){
-                      Dp( 0, run3-nx-na ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx+na+np; run3 < nx+na+np+nu; run3++ ){
-                      Du( 0, run3-nx-na-np ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx+na+np+nu; run3 < nx+na+np+nu+nw; run3++ ){
-                      Dw( 0, run3-nx-na-np-nu ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-            }
-            if( nx > 0 ) dBackward.setDense( 0,     run1, Dx  );
-            if( na > 0 ) dBackward.setDense( 0,   N+run1, Dxa );
-            if( np > 0 ) dBackward.setDense( 0, 2*N+run1, Dp  );
-            if( nu > 0 ) dBackward.setDense( 0, 3*N+run1, Du  );
-            if( nw > 0 ) dBackward.setDense( 0, 4*N+run1, Dw  );
-
-            // COMPUTE GAUSS-NEWTON HESSIAN APPROXIMATION IF REQUESTED:
-            // --------------------------------------------------------
 
-            if( GNhessian != 0 ){
-
-                const int nnn = nx+na+np+nu+nw;
-                Matrix tmp( nh, nnn );
+                for( run2 = 0; run2 < nh; run2++ ){
 
-                for( run3 = 0; run3 < nnn; run3++ ){
-                    for( run2 = 0; run2 < nh; run2++ ){
-                        if( S != 0 ){
-                            tmp( run2, run3 ) = 0.0;
-                            for( run4 = 0; run4 < nh; run4++ ){
-                                tmp( run2, run3 ) += S[run1].operator()(run2,run4)*J[run4][y_index[run3]];
+                     if( fcn.ADisSupported() == BT_TRUE ){
+                         for(run3 = 0; (int) run3 < fcn.getNumberOfVariables() +1; run3++ )
+                             J[run2][run3] = 0.0;
+                         bseed[run2] = 1.0;
+                         fcn.AD_backward( run1, bseed, J[run2] );
+                         bseed[run2] = 0.0;
+                     }
+
+                     for( run3 = 0; run3 < nx; run3++ ){
+                          Dx( 0, run3 ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
+                     }
+                     for( run3 = nx; run3 < nx+na; run3++ ){
+                          Dxa( 0, run3-nx ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
+                     }
+                     for( run3 = nx+na; run3 < nx+na+np; run3++ ){
+                          Dp( 0, run3-nx-na ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
+                     }
+                     for( run3 = nx+na+np; run3 < nx+na+np+nu; run3++ ){
+                          Du( 0, run3-nx-na-np ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
+                     }
+                     for( run3 = nx+na+np+nu; run3 < nx+na+np+nu+nw; run3++ ){
+                          Dw( 0, run3-nx-na-np-nu ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
+                     }
+                }
+                if( nx > 0 ) dBackward.setDense( 0,     run1, Dx  );
+                if( na > 0 ) dBackward.setDense( 0,   N+run1, Dxa );
+                if( np > 0 ) dBackward.setDense( 0, 2*N+run1, Dp  );
+                if( nu > 0 ) dBackward.setDense( 0, 3*N+run1, Du  );
+                if( nw > 0 ) dBackward.setDense( 0, 4*N+run1, Dw  );
+
+                // COMPUTE GAUSS-NEWTON HESSIAN APPROXIMATION IF REQUESTED:
+                // --------------------------------------------------------
+
+                if( GNhessian != 0 ){
+
+                    const int nnn = nx+na+np+nu+nw;
+                    Matrix tmp( nh, nnn );
+
+                    for( run3 = 0; run3 < nnn; run3++ ){
+                        for( run2 = 0; run2 < nh; run2++ ){
+                            if( S != 0 ){
+                                tmp( run2, run3 ) = 0.0;
+                                for( run4 = 0; run4 < nh; run4++ ){
+                                    tmp( run2, run3 ) += S[run1].operator()(run2,run4)*J[run4][y_index[run3]];
+                                }
+                            }
+                            else{
+                                tmp( run2, run3 ) = J[run2][y_index[run3]];
                             }
-                        }
-                        else{
-                            tmp( run2, run3 ) = J[run2][y_index[run3]];
                         }
                     }
-                }
-                Matrix tmp2;
-                int i,j;
-                int *Sidx = new int[6];
-                int *Hidx = new int[5];
-
-                Sidx[0] = 0;
-                Sidx[1] = nx;
-                Sidx[2] = nx+na;
-                Sidx[3] = nx+na+np;
-                Sidx[4] = nx+na+np+nu;
-                Sidx[5] = nx+na+np+nu+nw;
-
-                Hidx[0] =     run1;
-                Hidx[1] =   N+run1;
-                Hidx[2] = 2*N+run1;
-                Hidx[3] = 3*N+run1;
-                Hidx[4] = 4*N+run1;
-
-                for( i = 0; i < 5; i++ ){
-                    for( j = 0; j < 5; j++ ){
-
-                        tmp2.init(Sidx[i+1]-Sidx[i],Sidx[j+1]-Sidx[j]);
-                        tmp2.setZero();
-
-                        for( run3 = Sidx[i]; run3 < Sidx[i+1]; run3++ )
-                            for( run4 = Sidx[j]; run4 < Sidx[j+1]; run4++ )
-                                for( run2 = 0; run2 < nh; run2++ )
-                                    tmp2(run3-Sidx[i],run4-Sidx[j]) += J[run2][y_index[run3]]*tmp(run2,run4);
-
-                        if( tmp2.getDim() != 0 ) GNhessian->addDense(Hidx[i],Hidx[j],tmp2);
+                    Matrix tmp2;
+                    int i,j;
+                    int *Sidx = new int[6];
+                    int *Hidx = new int[5];
+
+                    Sidx[0] = 0;
+                    Sidx[1] = nx;
+                    Sidx[2] = nx+na;
+                    Sidx[3] = nx+na+np;
+                    Sidx[4] = nx+na+np+nu;
+                    Sidx[5] = nx+na+np+nu+nw;
+
+                    Hidx[0] =     run1;
+                    Hidx[1] =   N+run1;
+                    Hidx[2] = 2*N+run1;
+                    Hidx[3] = 3*N+run1;
+                    Hidx[4] = 4*N+run1;
+
+                    for( i = 0; i < 5; i++ ){
+                        for( j = 0; j < 5; j++ ){
+
+                            tmp2.init(Sidx[i+1]-Sidx[i],Sidx[j+1]-Sidx[j]);
+                            tmp2.setZero();
+
+                            for( run3 = Sidx[i]; run3 < Sidx[i+1]; run3++ )
+                                for( run4 = Sidx[j]; run4 < Sidx[j+1]; run4++ )
+                                    for( run2 = 0; run2 < nh; run2++ )
+                                        tmp2(run3-Sidx[i],run4-Sidx[j]) += J[run2][y_index[run3]]*tmp(run2,run4);
+
+                            if( tmp2.getDim() != 0 ) GNhessian->addDense(Hidx[i],Hidx[j],tmp2);
+                        }
                     }
+                    delete[] Sidx;
+                    delete[] Hidx;
                 }
-                delete[] Sidx;
-                delete[] Hidx;
             }
+
+            for( int run2 = 0; run2 < nh; run2++ )
+                delete[] J[run2];
+            delete[] J;
+            delete[] bseed;
         }
 
-        for( run2 = 0; run2 < nh; run2++ )
-            delete[] J[run2];
-        delete[] J;
-        delete[] bseed;
         return SUCCESSFUL_RETURN;
     }
 
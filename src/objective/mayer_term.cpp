@@ -114,289 +114,41 @@ returnValue MayerTerm::evaluateSensitivities( BlockMatrix *hessian ){
 
     if( hessian != 0 ){
 
-        double  bseed1 = 1.0;
-        double  bseed2 = 0.0;
-        double *J      = new double[fcn.getNumberOfVariables() +1];
-        double *H      = new double[fcn.getNumberOfVariables() +1];
-        double *fseed  = new double[fcn.getNumberOfVariables() +1];
-
-        for( run1 = 0; run1 < fcn.getNumberOfVariables()+1; run1++ )
-            fseed[run1] = 0.0;
+        double bseed1 = 1.0;
 
         dBackward.init( 1, 5*N );
 
-        Matrix Dx ( 1, nx );
-        Matrix Dxa( 1, na );
-        Matrix Dp ( 1, np );
-        Matrix Du ( 1, nu );
-        Matrix Dw ( 1, nw );
-
-        Matrix Hx ( nx, nx );
-        Matrix Hxa( nx, na );
-        Matrix Hp ( nx, np );
-        Matrix Hu ( nx, nu );
-        Matrix Hw ( nx, nw );
-
-        for( run2 = 0; run2 < nx; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[run2]] = 1.0;
-            fcn.AD_forward( 0, fseed, J );
-            Dx( 0, run2 ) = J[0];
-            fseed[y_index[run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn.getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn.AD_backward2( 0, &bseed1, &bseed2, J, H );
-
-            for( run1 = 0; run1 < nx; run1++ ){
-                 Hx( run2, run1 ) = H[y_index[run1]];
-            }
-            for( run1 = nx; run1 < nx+na; run1++ ){
-                 Hxa( run2, run1-nx ) = H[y_index[run1]];
-            }
-            for( run1 = nx+na; run1 < nx+na+np; run1++ ){
-                 Hp( run2, run1-nx-na ) = H[y_index[run1]];
-            }
-            for( run1 = nx+na+np; run1 < nx+na+np+nu; run1++ ){
-                 Hu( run2, run1-nx-na-np ) = H[y_index[run1]];
-            }
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ){
-                 Hw( run2, run1-nx-na-np-nu ) = H[y_index[run1]];
-            }
-        }
-
-        if( nx > 0 ){
-
-            dBackward.setDense( 0, N-1, Dx );
-
-            if( nx > 0 ) hessian->setDense( N-1,   N-1, Hx  );
-            if( na > 0 ) hessian->setDense( N-1, 2*N-1, Hxa );
-            if( np > 0 ) hessian->setDense( N-1, 3*N-1, Hp  );
-            if( nu > 0 ) hessian->setDense( N-1, 4*N-1, Hu  );
-            if( nw > 0 ) hessian->setDense( N-1, 5*N-1, Hw  );
-        }
-
-        Hx.init ( na, nx );
-        Hxa.init( na, na );
-        Hp.init ( na, np );
-        Hu.init ( na, nu );
-        Hw.init ( na, nw );
-
-        for( run2 = nx; run2 < nx+na; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[run2]] = 1.0;
-            fcn.AD_forward( 0, fseed, J );
-            Dxa( 0, run2-nx ) = J[0];
-            fseed[y_index[run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn.getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn.AD_backward2( 0, &bseed1, &bseed2, J, H );
-
-            for( run1 = 0; run1 < nx; run1++ ){
-                 Hx( run2-nx, run1 ) = H[y_index[run1]];
-            }
-            for( run1 = nx; run1 < nx+na; run1++ ){
-                 Hxa( run2-nx, run1-nx ) = H[y_index[run1]];
-            }
-            for( run1 = nx+na; run1 < nx+na+np; run1++ ){
-                 Hp( run2-nx, run1-nx-na ) = H[y_index[run1]];
-            }
-            for( run1 = nx+na+np; run1 < nx+na+np+nu; run1++ ){
-                 Hu( run2-nx, run1-nx-na-np ) = H[y_index[run1]];
-            }
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ){
-                 Hw( run2-nx, run1-nx-na-np-nu ) = H[y_index[run1]];
-            }
-        }
+        if( hessianColoring.isInitialized() == BT_FALSE )
+            if( hessianColoring.init( fcn, nx, na, np, nu, nw, y_index ) != SUCCESSFUL_RETURN )
+                return ACADOERROR(RET_UNABLE_TO_EVALUATE_OBJECTIVE);
 
-        if( na > 0 ){
+        Matrix D, H;
 
-            dBackward.setDense( 0, 2*N-1, Dxa );
+        if( hessianColoring.evaluate( fcn, 0, &bseed1, D, H ) != SUCCESSFUL_RETURN )
+            return ACADOERROR(RET_UNABLE_TO_EVALUATE_OBJECTIVE);
 
-            if( nx > 0 ) hessian->setDense( 2*N-1,   N-1, Hx  );
-            if( na > 0 ) hessian->setDense( 2*N-1, 2*N-1, Hxa );
-            if( np > 0 ) hessian->setDense( 2*N-1, 3*N-1, Hp  );
-            if( nu > 0 ) hessian->setDense( 2*N-1, 4*N-1, Hu  );
-            if( nw > 0 ) hessian->setDense( 2*N-1, 5*N-1, Hw  );
-        }
+        int offset[6];
 
-        Hx.init ( np, nx );
-        Hxa.init( np, na );
-        Hp.init ( np, np );
-        Hu.init ( np, nu );
-        Hw.init ( np, nw );
-
-        for( run2 = nx+na; run2 < nx+na+np; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[run2]] = 1.0;
-            fcn.AD_forward( 0, fseed, J );
-            Dp( 0, run2-nx-na ) = J[0];
-            fseed[y_index[run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn.getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn.AD_backward2( 0, &bseed1, &bseed2, J, H );
-
-            for( run1 = 0; run1 < nx; run1++ ){
-                 Hx( run2-nx-na, run1 ) = H[y_index[run1]];
-            }
-            for( run1 = nx; run1 < nx+na; run1++ ){
-                 Hxa( run2-nx-na, run1-nx ) = H[y_index[run1]];
-            }
-            for( run1 = nx+na; run1 < nx+na+np; run1++ ){
-                 Hp( run2-nx-na, run1-nx-na ) = H[y_index[run1]];
-            }
-            for( run1 = nx+na+np; run1 < nx+na+np+nu; run1++ ){
-                 Hu( run2-nx-na, run1-nx-na-np ) = H[y_index[run1]];
-            }
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ){
-                 Hw( run2-nx-na, run1-nx-na-np-nu ) = H[y_index[run1]];
-            }
-        }
+        offset[0] = 0;
+        offset[1] = nx;
+        offset[2] = nx+na;
+        offset[3] = nx+na+np;
+        offset[4] = nx+na+np+nu;
+        offset[5] = nx+na+np+nu+nw;
 
-        if( np > 0 ){
+        for( run1 = 0; run1 < 5; run1++ ){
 
-            dBackward.setDense( 0, 3*N-1, Dp );
+            if( offset[run1+1] == offset[run1] ) continue;
 
-            if( nx > 0 ) hessian->setDense( 3*N-1,   N-1, Hx  );
-            if( na > 0 ) hessian->setDense( 3*N-1, 2*N-1, Hxa );
-            if( np > 0 ) hessian->setDense( 3*N-1, 3*N-1, Hp  );
-            if( nu > 0 ) hessian->setDense( 3*N-1, 4*N-1, Hu  );
-            if( nw > 0 ) hessian->setDense( 3*N-1, 5*N-1, Hw  );
-        }
+            dBackward.setDense( 0, (run1+1)*N-1, D.getCols( offset[run1], offset[run1+1]-1 ) );
 
+            Matrix Hrow = H.getRows( offset[run1], offset[run1+1]-1 );
 
-        Hx.init ( nu, nx );
-        Hxa.init( nu, na );
-        Hp.init ( nu, np );
-        Hu.init ( nu, nu );
-        Hw.init ( nu, nw );
-
-        for( run2 = nx+na+np; run2 < nx+na+np+nu; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[run2]] = 1.0;
-            fcn.AD_forward( 0, fseed, J );
-            Du( 0, run2-nx-na-np ) = J[0];
-            fseed[y_index[run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn.getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn.AD_backward2( 0, &bseed1, &bseed2, J, H );
-
-            for( run1 = 0; run1 < nx; run1++ ){
-                 Hx( run2-nx-na-np, run1 ) = H[y_index[run1]];
-            }
-            for( run1 = nx; run1 < nx+na; run1++ ){
-                 Hxa( run2-nx-na-np, run1-nx ) = H[y_index[run1]];
-            }
-            for( run1 = nx+na; run1 < nx+na+np; run1++ ){
-                 Hp( run2-nx-na-np, run1-nx-na ) = H[y_index[run1]];
-            }
-            for( run1 = nx+na+np; run1 < nx+na+np+nu; run1++ ){
-                 Hu( run2-nx-na-np, run1-nx-na-np ) = H[y_index[run1]];
-            }
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ){
-                 Hw( run2-nx-na-np, run1-nx-na-np-nu ) = H[y_index[run1]];
-            }
+            for( run2 = 0; run2 < 5; run2++ )
+                if( offset[run2+1] > offset[run2] )
+                    hessian->setDense( (run1+1)*N-1, (run2+1)*N-1, Hrow.getCols( offset[run2], offset[run2+1]-1 ) );
         }
 
-        if( nu > 0 ){
-
-            dBackward.setDense( 0, 4*N-1, Du );
-
-            if( nx > 0 ) hessian->setDense( 4*N-1,   N-1, Hx  );
-            if( na > 0 ) hessian->setDense( 4*N-1, 2*N-1, Hxa );
-            if( np > 0 ) hessian->setDense( 4*N-1, 3*N-1, Hp  );
-            if( nu > 0 ) hessian->setDense( 4*N-1, 4*N-1, Hu  );
-            if( nw > 0 ) hessian->setDense( 4*N-1, 5*N-1, Hw  );
-        }
-
-
-        Hx.init ( nw, nx );
-        Hxa.init( nw, na );
-        Hp.init ( nw, np );
-        Hu.init ( nw, nu );
-        Hw.init ( nw, nw );
-
-        for( run2 = nx+na+np+nu; run2 < nx+na+np+nu+nw; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[run2]] = 1.0;
-            fcn.AD_forward( 0, fseed, J );
-            Dw( 0, run2-nx-na-np-nu ) = J[0];
-            fseed[y_index[run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn.getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn.AD_backward2( 0, &bseed1, &bseed2, J, H );
-
-            for( run1 = 0; run1 < nx; run1++ ){
-                 Hx( run2-nx-na-np-nu, run1 ) = H[y_index[run1]];
-            }
-            for( run1 = nx; run1 < nx+na; run1++ ){
-                 Hxa( run2-nx-na-np-nu, run1-nx ) = H[y_index[run1]];
-            }
-            for( run1 = nx+na; run1 < nx+na+np; run1++ ){
-                 Hp( run2-nx-na-np-nu, run1-nx-na ) = H[y_index[run1]];
-            }
-            for( run1 = nx+na+np; run1 < nx+na+np+nu; run1++ ){
-                 Hu( run2-nx-na-np-nu, run1-nx-na-np ) = H[y_index[run1]];
-            }
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ){
-                 Hw( run2-nx-na-np-nu, run1-nx-na-np-nu ) = H[y_index[run1]];
-            }
-        }
-
-        if( nw > 0 ){
-
-            dBackward.setDense( 0, 5*N-1, Dw );
-
-            if( nx > 0 ) hessian->setDense( 5*N-1,   N-1, Hx  );
-            if( na > 0 ) hessian->setDense( 5*N-1, 2*N-1, Hxa );
-            if( np > 0 ) hessian->setDense( 5*N-1, 3*N-1, Hp  );
-            if( nu > 0 ) hessian->setDense( 5*N-1, 4*N-1, Hu  );
-            if( nw > 0 ) hessian->setDense( 5*N-1, 5*N-1, Hw  );
-        }
-
-        delete[] J;
-        delete[] H;
-        delete[] fseed;
-
         return SUCCESSFUL_RETURN;
     }
 
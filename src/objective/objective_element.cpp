@@ -112,6 +112,8 @@ ObjectiveElement::ObjectiveElement( const ObjectiveElement& rhs ){
 
     t_index = rhs.t_index;
 
+    hessianColoring = rhs.hessianColoring;
+
     nx = rhs.nx;
     na = rhs.na;
     nu = rhs.nu;
@@ -214,6 +216,8 @@ ObjectiveElement& ObjectiveElement::operator=( const ObjectiveElement& rhs ){
 
         t_index = rhs.t_index;
 
+        hessianColoring = rhs.hessianColoring;
+
         nx = rhs.nx;
         na = rhs.na;
         nu = rhs.nu;
@@ -304,6 +308,8 @@ returnValue ObjectiveElement::init( const OCPiterate &x ){
 
     t_index = fcn.index( VT_TIME, 0 );
 
+    hessianColoring = HessianColoring();
+
     return SUCCESSFUL_RETURN;
 }
 
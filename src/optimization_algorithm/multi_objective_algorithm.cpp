@@ -352,6 +352,11 @@ returnValue MultiObjectiveAlgorithm::solve( ){
 
             formulateOCP( idx, ocp, arg );
             setStatus( BS_NOT_INITIALIZED );
+
+            // the weights identify the problem instance in the solution cache
+            if( solutionCache != 0 )
+                setSolutionCacheKey( Weights.getCol( run1 ) );
+
             returnvalue = OptimizationAlgorithm::solve();
 
             if( nlpSolver != 0 )
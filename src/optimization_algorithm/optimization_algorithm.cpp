@@ -100,6 +100,10 @@ returnValue OptimizationAlgorithm::solve( ){
 
     returnValue returnvalue = SUCCESSFUL_RETURN;
 
+	// a cached solution for a nearby problem instance replaces the initialization
+	if ( initializeFromSolutionCache( ) == BT_TRUE )
+		setStatus( BS_NOT_INITIALIZED );
+
 	if ( ( getStatus( ) != BS_READY ) || ( haveOptionsChanged( ) == BT_TRUE ) )
     	returnvalue = init( );
 
@@ -107,9 +111,16 @@ returnValue OptimizationAlgorithm::solve( ){
 
     returnvalue = nlpSolver->solve( );
 
+    // the best iterate found within the time budget is available anyway
+    if( returnvalue == RET_NLP_TIME_BUDGET_EXCEEDED ) return returnvalue;
+
     if( returnvalue != SUCCESSFUL_RETURN &&
         returnvalue != CONVERGENCE_ACHIEVED ) return ACADOERROR( RET_OPTALG_SOLVE_FAILED );
 
+    // the problem is solved, but a failed cache update is reported as warning
+    if( addToSolutionCache( ) != SUCCESSFUL_RETURN )
+        return ACADOWARNING( RET_SOLUTION_CACHE_UPDATE_FAILED );
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -132,20 +143,31 @@ returnValue OptimizationAlgorithm::setupOptions( )
 	addOption( PRINT_COPYRIGHT             , defaultPrintCopyright          );
 	addOption( HESSIAN_APPROXIMATION       , defaultHessianApproximation    );
 	addOption( DYNAMIC_HESSIAN_APPROXIMATION, defaultDynamicHessianApproximation );
+	addOption( BFGS_MEMORY_SIZE            , defaultBFGSmemorySize          );
 	addOption( DYNAMIC_SENSITIVITY         , defaultDynamicSensitivity      );
+	addOption( NUM_LIFTED_NODES            , defaultNumLiftedNodes          );
 	addOption( OBJECTIVE_SENSITIVITY       , defaultObjectiveSensitivity    );
 	addOption( CONSTRAINT_SENSITIVITY      , defaultConstraintSensitivity   );
 	addOption( DISCRETIZATION_TYPE         , defaultDiscretizationType      );
 	addOption( LINESEARCH_TOLERANCE        , defaultLinesearchTolerance     );
 	addOption( MIN_LINESEARCH_PARAMETER    , defaultMinLinesearchParameter  );
+	addOption( QP_SOLVER                   , defaultQPsolver                );
 	addOption( MAX_NUM_QP_ITERATIONS       , defaultMaxNumQPiterations      );
+	addOption( QP_SOLVER_TOLERANCE         , defaultQPsolverTolerance       );
+	addOption( MAX_QP_SOLVER_TIME          , defaultMaxQPsolverTime         );
+	addOption( MAX_NLP_SOLVER_TIME         , defaultMaxNLPsolverTime        );
 	addOption( HOTSTART_QP                 , defaultHotstartQP              );
 	addOption( INFEASIBLE_QP_RELAXATION    , defaultInfeasibleQPrelaxation  );
 	addOption( INFEASIBLE_QP_HANDLING      , defaultInfeasibleQPhandling    );
 	addOption( USE_REALTIME_ITERATIONS     , defaultUseRealtimeIterations   );
+	addOption( USE_TANGENTIAL_PREDICTOR    , defaultUseTangentialPredictor  );
+	addOption( USE_AUTOMATIC_SCALING       , defaultUseAutomaticScaling     );
 	addOption( TERMINATE_AT_CONVERGENCE    , defaultTerminateAtConvergence  );
 	addOption( USE_CONDENSING              , defaultUseCondensing           );
+	addOption( CONDENSING_BLOCK_SIZE       , defaultCondensingBlockSize     );
 	addOption( GLOBALIZATION_STRATEGY      , defaultGlobalizationStrategy   );
+	addOption( NLP_SOLVER                  , defaultNLPsolver               );
+	addOption( BARRIER_PARAMETER           , defaultBarrierParameter        );
 	addOption( PRINT_SCP_METHOD_PROFILE    , defaultprintSCPmethodProfile   );
 
 	// add integration options
@@ -168,6 +190,10 @@ returnValue OptimizationAlgorithm::setupOptions( )
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
+	addOption( MAX_NUM_STORED_INTEGRATOR_STEPS, defaultMaxNumStoredSteps   );
+	addOption( WARM_START_INTEGRATOR       , defaultWarmStartIntegrator     );
+	addOption( MAX_NUM_STIFF_INTEGRATOR_STEPS , defaultMaxNumStiffSteps        );
+	addOption( AUTO_INTEGRATOR_SWITCH_TOLERANCE, defaultAutoIntegratorSwitchTolerance );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -190,7 +216,23 @@ returnValue OptimizationAlgorithm::allocateNlpSolver( Objective *F, DynamicDiscr
 	if( nlpSolver != 0 )
 		delete nlpSolver;
 
-	nlpSolver = new SCPmethod( this, F,G,H, isLinearQuadratic( F,G,H ) );
+	int nlpSolverName;
+	get( NLP_SOLVER,nlpSolverName );
+
+	switch( (NLPsolverName)nlpSolverName )
+	{
+		case NLP_SCP_METHOD:
+			nlpSolver = new SCPmethod( this, F,G,H, isLinearQuadratic( F,G,H ) );
+			break;
+
+		case NLP_IP_METHOD:
+			nlpSolver = new IPmethod( this, F,G,H, isLinearQuadratic( F,G,H ) );
+			break;
+
+		default:
+			nlpSolver = 0;
+			return ACADOERROR( RET_INVALID_OPTION );
+	}
 
 	return SUCCESSFUL_RETURN;
 }
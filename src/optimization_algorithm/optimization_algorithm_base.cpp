@@ -49,6 +49,9 @@ OptimizationAlgorithmBase::OptimizationAlgorithmBase( )
     nlpSolver = 0;
 
 	userInit.allocateAll( );
+
+	solutionCache           = 0;
+	solutionCacheIterations = -1.0;
 }
 
 
@@ -58,6 +61,9 @@ OptimizationAlgorithmBase::OptimizationAlgorithmBase( const OCP& ocp_ )
     nlpSolver = 0;
 
 	userInit.allocateAll( );
+
+	solutionCache           = 0;
+	solutionCacheIterations = -1.0;
 }
 
 
@@ -71,6 +77,10 @@ OptimizationAlgorithmBase::OptimizationAlgorithmBase( const OptimizationAlgorith
 
 	iter     = arg.iter;
 	userInit = arg.userInit;
+
+	solutionCache           = arg.solutionCache;
+	solutionCacheKey        = arg.solutionCacheKey;
+	solutionCacheIterations = arg.solutionCacheIterations;
 }
 
 
@@ -95,6 +105,10 @@ OptimizationAlgorithmBase& OptimizationAlgorithmBase::operator=( const Optimizat
 
 		iter    = arg.iter;
 		userInit = arg.userInit;
+
+		solutionCache           = arg.solutionCache;
+		solutionCacheKey        = arg.solutionCacheKey;
+		solutionCacheIterations = arg.solutionCacheIterations;
     }
     return *this;
 }
@@ -396,6 +410,30 @@ double OptimizationAlgorithmBase::getEndTime( ) const
 
 
 
+returnValue OptimizationAlgorithmBase::setSolutionCache(	SolutionCache* const _solutionCache
+														)
+{
+	solutionCache           = _solutionCache;
+	solutionCacheIterations = -1.0;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OptimizationAlgorithmBase::setSolutionCacheKey(	const Vector& x0_,
+															const Vector& p_
+															)
+{
+	solutionCacheKey = x0_;
+
+	if ( p_.isEmpty( ) == BT_FALSE )
+		solutionCacheKey.append( p_ );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
@@ -423,6 +461,136 @@ returnValue OptimizationAlgorithmBase::clear( )
 }
 
 
+BooleanType OptimizationAlgorithmBase::initializeFromSolutionCache( )
+{
+	solutionCacheIterations = -1.0;
+
+	if ( ( solutionCache == 0 ) || ( solutionCacheKey.isEmpty( ) == BT_TRUE ) )
+		return BT_FALSE;
+
+	OCPiterate cachedSolution;
+
+	if ( solutionCache->lookup( solutionCacheKey,cachedSolution,solutionCacheIterations ) != SUCCESSFUL_RETURN )
+	{
+		solutionCacheIterations = -1.0;
+		return BT_FALSE;
+	}
+
+	if ( cachedSolution.x  != 0 ) initializeDifferentialStates( *cachedSolution.x  );
+	if ( cachedSolution.xa != 0 ) initializeAlgebraicStates   ( *cachedSolution.xa );
+	if ( cachedSolution.p  != 0 ) initializeParameters        ( *cachedSolution.p  );
+	if ( cachedSolution.u  != 0 ) initializeControls          ( *cachedSolution.u  );
+	if ( cachedSolution.w  != 0 ) initializeDisturbances      ( *cachedSolution.w  );
+
+	return BT_TRUE;
+}
+
+
+returnValue OptimizationAlgorithmBase::addToSolutionCache( )
+{
+	if ( ( solutionCache == 0 ) || ( solutionCacheKey.isEmpty( ) == BT_TRUE ) )
+		return SUCCESSFUL_RETURN;
+
+	if ( nlpSolver == 0 )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	VariablesGrid xd_, xa_, p_, u_, w_;
+
+	nlpSolver->getDifferentialStates( xd_ );
+	nlpSolver->getAlgebraicStates   ( xa_ );
+	nlpSolver->getParameters        ( p_  );
+	nlpSolver->getControls          ( u_  );
+	nlpSolver->getDisturbances      ( w_  );
+
+	OCPiterate solution( &xd_,&xa_,&p_,&u_,&w_ );
+
+	returnValue returnvalue = solutionCache->store(	solutionCacheKey,solution,
+													nlpSolver->getNumberOfSteps( ),
+													solutionCacheIterations
+													);
+	solutionCacheIterations = -1.0;
+
+	return returnvalue;
+}
+
+
+returnValue OptimizationAlgorithmBase::computeVariableScaling( )
+{
+	computeVariableScaling( iter.x  );
+	computeVariableScaling( iter.xa );
+	computeVariableScaling( iter.p  );
+	computeVariableScaling( iter.u  );
+	computeVariableScaling( iter.w  );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OptimizationAlgorithmBase::computeVariableScaling(	VariablesGrid* const grid
+																) const
+{
+	if ( grid == 0 )
+		return SUCCESSFUL_RETURN;
+
+	uint run1, run2;
+
+	for( run2 = 0; run2 < grid->getNumValues( ); run2++ )
+	{
+		double magnitude = 0.0;
+
+		for( run1 = 0; run1 < grid->getNumPoints( ); run1++ )
+		{
+			double value = grid->operator()( run1,run2 );
+			double lb    = grid->getLowerBound( run1,run2 );
+			double ub    = grid->getUpperBound( run1,run2 );
+
+			BooleanType hasLowerBound = BT_FALSE;
+			BooleanType hasUpperBound = BT_FALSE;
+
+			if ( fabs( lb ) < 0.999*INFTY ) hasLowerBound = BT_TRUE;
+			if ( fabs( ub ) < 0.999*INFTY ) hasUpperBound = BT_TRUE;
+
+			// an initialization by a one-sided bound says little about the magnitude
+			if ( ( hasLowerBound != hasUpperBound ) && ( ( value == lb ) || ( value == ub ) ) )
+				continue;
+
+			if ( fabs( value ) > magnitude )
+				magnitude = fabs( value );
+		}
+
+		// without a meaningful initial guess, the magnitude is taken from the bounds
+		if ( magnitude <= EPS )
+		{
+			for( run1 = 0; run1 < grid->getNumPoints( ); run1++ )
+			{
+				double lb = grid->getLowerBound( run1,run2 );
+				double ub = grid->getUpperBound( run1,run2 );
+
+				if ( ( fabs( lb ) < 0.999*INFTY ) && ( fabs( ub ) < 0.999*INFTY ) )
+				{
+					if ( fabs( lb ) > magnitude )
+						magnitude = fabs( lb );
+
+					if ( fabs( ub ) > magnitude )
+						magnitude = fabs( ub );
+				}
+			}
+		}
+
+		// variables of moderate magnitude are left unscaled
+		double scaling = 1.0;
+
+		if ( ( magnitude > EPS ) && ( ( magnitude < 1.0e-2 ) || ( magnitude > 1.0e2 ) ) )
+			scaling = pow( 2.0, floor( log( magnitude )/log( 2.0 ) + 0.5 ) );
+
+		for( run1 = 0; run1 < grid->getNumPoints( ); run1++ )
+			grid->setScaling( run1,run2,scaling );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
 returnValue OptimizationAlgorithmBase::init(	UserInteraction* _userIteraction
 												)
 {
@@ -528,6 +696,15 @@ returnValue OptimizationAlgorithmBase::init(	UserInteraction* _userIteraction
        if( iter.w  != 0 ) iter.w ->disableAutoInit();
 
 
+    // COMPUTE SCALING FACTORS OF THE OPTIMIZATION VARIABLES IF REQUESTED:
+    // -------------------------------------------------------------------
+	int useAutomaticScaling = BT_FALSE;
+	_userIteraction->get( USE_AUTOMATIC_SCALING,useAutomaticScaling );
+
+	if ( (BooleanType)useAutomaticScaling == BT_TRUE )
+		computeVariableScaling( );
+
+
     // (COLLOCATION NOT IMPLEMENTED YET)
 
 
@@ -664,6 +841,13 @@ returnValue OptimizationAlgorithmBase::setupDynamicDiscretization(	UserInteracti
 
     if( differentialEquation != 0 ){
 
+        // (COLLOCATION NOT IMPLEMENTED YET, THE SHOOTING METHOD IS USED INSTEAD)
+        int discretizationType;
+        _userIteraction->get( DISCRETIZATION_TYPE, discretizationType );
+
+        if( (StateDiscretizationType)discretizationType == COLLOCATION )
+            ACADOWARNING( RET_NOT_IMPLEMENTED_YET );
+
         *dynamicDiscretization = new ShootingMethod( _userIteraction );
 
         int intType;
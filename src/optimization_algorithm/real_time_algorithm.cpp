@@ -53,6 +53,8 @@ RealTimeAlgorithm::RealTimeAlgorithm() : OptimizationAlgorithmBase( ), ControlLa
 	p0        = 0;
     reference = 0;
 
+	setupPreparation( );
+
 	set( HESSIAN_APPROXIMATION, GAUSS_NEWTON );
 	set( USE_REALTIME_ITERATIONS,BT_TRUE );
 	set( MAX_NUM_ITERATIONS,1 );
@@ -74,6 +76,8 @@ RealTimeAlgorithm::RealTimeAlgorithm(	const OCP& ocp_,
 	p0 = 0;
     reference = 0;
 
+	setupPreparation( );
+
 	set( HESSIAN_APPROXIMATION, GAUSS_NEWTON );
 	set( USE_REALTIME_ITERATIONS,BT_TRUE );
 	set( MAX_NUM_ITERATIONS,1 );
@@ -95,12 +99,44 @@ RealTimeAlgorithm::RealTimeAlgorithm( const RealTimeAlgorithm& rhs ) : Optimizat
 
     if( rhs.reference != 0 ) reference = new VariablesGrid(*rhs.reference);
     else                     reference = 0                         ;
+
+	setupPreparation( );
+
+	preparationWaitingTime = rhs.preparationWaitingTime;
+	numMissedDeadlines     = rhs.numMissedDeadlines;
+
+	// the copied NLP solver would log into the private user interaction of rhs
+	if ( rhs.preparationInteraction != 0 )
+	{
+		if ( nlpSolver != 0 )
+		{
+			delete nlpSolver;
+			nlpSolver = 0;
+		}
+
+		setStatus( BS_NOT_INITIALIZED );
+	}
 }
 
 
 RealTimeAlgorithm::~RealTimeAlgorithm( )
 {
+	waitForPreparation( );
 	clear( );
+
+	// the NLP solver has to be deleted before the user interaction it refers to
+	if ( nlpSolver != 0 )
+	{
+		delete nlpSolver;
+		nlpSolver = 0;
+	}
+
+	if ( preparationInteraction != 0 )
+		delete preparationInteraction;
+
+	#if defined(LINUX)
+	pthread_mutex_destroy( &preparationMutex );
+	#endif
 }
 
 
@@ -109,6 +145,7 @@ RealTimeAlgorithm& RealTimeAlgorithm::operator=( const RealTimeAlgorithm& rhs ){
 
     if( this != &rhs ){
 
+		waitForPreparation( );
 		clear( );
 
 		OptimizationAlgorithmBase::operator=( rhs );
@@ -122,6 +159,27 @@ RealTimeAlgorithm& RealTimeAlgorithm::operator=( const RealTimeAlgorithm& rhs ){
 
         if( rhs.reference != 0 ) reference = new VariablesGrid(*rhs.reference);
         else                     reference = 0                         ;
+
+		if ( preparationInteraction != 0 )
+		{
+			delete preparationInteraction;
+			preparationInteraction = 0;
+		}
+
+		preparationWaitingTime = rhs.preparationWaitingTime;
+		numMissedDeadlines     = rhs.numMissedDeadlines;
+
+		// the copied NLP solver would log into the private user interaction of rhs
+		if ( rhs.preparationInteraction != 0 )
+		{
+			if ( nlpSolver != 0 )
+			{
+				delete nlpSolver;
+				nlpSolver = 0;
+			}
+
+			setStatus( BS_NOT_INITIALIZED );
+		}
     }
     return *this;
 }
@@ -154,11 +212,68 @@ returnValue RealTimeAlgorithm::init( )
 	if ( ( getStatus( ) == BS_READY ) && ( haveOptionsChanged( ) == BT_FALSE ) )
 		return SUCCESSFUL_RETURN;
 
-	returnValue returnvalue = OptimizationAlgorithmBase::init( this );
+	// the NLP solver of an algorithm with asynchronous preparation steps works
+	// on a private user interaction, such that the background thread never
+	// accesses the options and logs of the algorithm itself
+	if ( preparationInteraction != 0 )
+	{
+		mergeLogValues( *preparationInteraction );
+
+		if ( nlpSolver != 0 )
+		{
+			delete nlpSolver;
+			nlpSolver = 0;
+		}
+
+		delete preparationInteraction;
+		preparationInteraction = 0;
+	}
+
+	uint nLogRecords = getNumLogRecords( );
+
+	#if defined(LINUX)
+	if ( usesAsyncPreparation( ) == BT_TRUE )
+	{
+		preparationInteraction = new UserInteraction;
+		preparationInteraction->Options::operator=( *this );
+		preparationInteraction->Logging::operator=( *this );
+		preparationInteraction->clearLogValues( );
+	}
+	#endif
+
+	returnValue returnvalue;
+
+	if ( preparationInteraction != 0 )
+		returnvalue = OptimizationAlgorithmBase::init( preparationInteraction );
+	else
+		returnvalue = OptimizationAlgorithmBase::init( this );
+
+	if ( preparationInteraction != 0 )
+	{
+		// make the records and options added by the NLP solver available to the user
+		LogRecord record;
+		MatrixVariablesGrid emptyValues;
+
+		for( uint i=nLogRecords; i<preparationInteraction->getNumLogRecords( ); ++i )
+		{
+			preparationInteraction->getLogRecord( i,record );
+
+			for( uint j=0; j<record.getNumItems( ); ++j )
+				record( j ).setAllValues( record.getLogFrequency( ),emptyValues );
+
+			addLogRecord( record );
+		}
+
+		mergeLogValues( *preparationInteraction );
+		Options::operator=( *preparationInteraction );
+	}
 
 	setStatus( BS_READY );
 	declareOptionsUnchanged( );
 
+	if ( preparationInteraction != 0 )
+		preparationInteraction->Options::operator=( *this );
+
 	return returnvalue;
 }
 
@@ -170,6 +285,9 @@ returnValue RealTimeAlgorithm::init(	double startTime,
 										)
 {
 	/* 0) Consistency checks */
+	if ( waitForPreparation( ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_CONTROLLAW_INIT_FAILED );
+
 	int useImmediateFeedback = 0;
 	get( USE_IMMEDIATE_FEEDBACK,useImmediateFeedback );
 
@@ -256,6 +374,10 @@ returnValue RealTimeAlgorithm::feedbackStep(	double currentTime,
 	if ( isInRealTimeMode( ) == BT_FALSE )
 		return ACADOERROR( RET_NEED_TO_ACTIVATE_RTI );
 
+	// wait for the remaining work of an asynchronous preparation step
+	if ( waitForPreparation( ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_CONTROLLAW_STEP_FAILED );
+
 	if ( getStatus( ) != BS_READY )
 		return ACADOERROR( RET_BLOCK_NOT_READY );
 
@@ -303,6 +425,86 @@ returnValue RealTimeAlgorithm::preparationStep(	double nextTime,
 	if ( isInRealTimeMode( ) == BT_FALSE )
 		return ACADOERROR( RET_NEED_TO_ACTIVATE_RTI );
 
+	if ( waitForPreparation( ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_CONTROLLAW_STEP_FAILED );
+
+	if ( ( usesAsyncPreparation( ) == BT_TRUE ) && ( preparationInteraction != 0 ) )
+		return startPreparationStep( nextTime,_yRef );
+	else
+		return runPreparationStep( nextTime,_yRef );
+}
+
+
+returnValue RealTimeAlgorithm::waitForPreparation( )
+{
+	if ( isPreparationPending == BT_FALSE )
+	{
+		// pass options set by the user on to the NLP solver and collect its logged values
+		if ( preparationInteraction != 0 )
+		{
+			preparationInteraction->Options::operator=( *this );
+			return mergeLogValues( *preparationInteraction );
+		}
+
+		return SUCCESSFUL_RETURN;
+	}
+
+	double startTime = acadoGetTime( );
+	double endTime   = startTime;
+
+	returnValue returnvalue = SUCCESSFUL_RETURN;
+
+	#if defined(LINUX)
+	pthread_join( preparationThread,0 );
+
+	pthread_mutex_lock( &preparationMutex );
+
+	returnvalue = preparationStatus;
+	endTime     = preparationEndTime;
+
+	pthread_mutex_unlock( &preparationMutex );
+	#endif
+
+	isPreparationPending = BT_FALSE;
+
+	// hand the NLP solver back to the caller's thread, together with the options
+	// and logged values it has changed on the private user interaction
+	nlpSolver = preparationSolver;
+	preparationSolver = 0;
+
+	Options::operator=( *preparationInteraction );
+	mergeLogValues( *preparationInteraction );
+
+	if ( returnvalue == SUCCESSFUL_RETURN )
+		setStatus( BS_READY );
+
+	if ( preparationReference != 0 )
+	{
+		delete preparationReference;
+		preparationReference = 0;
+	}
+
+	// the deadline is missed if the preparation step was not finished when waiting started
+	if ( endTime > startTime )
+	{
+		preparationWaitingTime = acadoGetTime( ) - startTime;
+		++numMissedDeadlines;
+	}
+	else
+		preparationWaitingTime = 0.0;
+
+	if ( returnvalue != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_CONTROLLAW_STEP_FAILED );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue RealTimeAlgorithm::runPreparationStep(	double nextTime,
+													const VariablesGrid& _yRef
+													)
+{
 	int useImmediateFeedback = 0;
 	get( USE_IMMEDIATE_FEEDBACK,useImmediateFeedback );
 
@@ -345,6 +547,9 @@ returnValue RealTimeAlgorithm::solve(	double startTime,
 										const VariablesGrid& _yRef
 										)
 {
+	if ( waitForPreparation( ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_NLP_SOLUTION_FAILED );
+
 	if ( getStatus( ) == BS_NOT_INITIALIZED )
 	{
 		if ( init( startTime,_x ) != SUCCESSFUL_RETURN )
@@ -363,6 +568,11 @@ returnValue RealTimeAlgorithm::solve(	double startTime,
 	int terminateAtConvergence = 0;
 	get( TERMINATE_AT_CONVERGENCE,terminateAtConvergence );
 		
+	double maxTime;
+	get( MAX_NLP_SOLVER_TIME,maxTime );
+
+	double solveStartTime = acadoGetTime( );
+
 	BooleanType isLastIteration = BT_FALSE;
 
 	while( nlpSolver->getNumberOfSteps( ) < maxNumberOfSteps )
@@ -370,6 +580,11 @@ returnValue RealTimeAlgorithm::solve(	double startTime,
 		if ( nlpSolver->getNumberOfSteps( ) == maxNumberOfSteps-1 )
 			isLastIteration = BT_TRUE;
 
+		// the last iteration (including shift) has to start before the time budget is used up
+		if ( ( maxTime > 0.0 ) &&
+			 ( acadoGetTime( ) - solveStartTime + 2.0*nlpSolver->getIterationTimeEstimate( ) > maxTime ) )
+			isLastIteration = BT_TRUE;
+
 		if ( performFeedbackStep( startTime,_x,_p ) != SUCCESSFUL_RETURN )
 			return ACADOERROR( RET_NLP_SOLUTION_FAILED );
 
@@ -379,6 +594,9 @@ returnValue RealTimeAlgorithm::solve(	double startTime,
 
 		if ( ((BooleanType)terminateAtConvergence == BT_TRUE ) && ( returnvalue == CONVERGENCE_ACHIEVED ) )
 			break;
+
+		if ( isLastIteration == BT_TRUE )
+			break;
 	}
 
 	replot( PLOT_AT_END );
@@ -391,6 +609,9 @@ returnValue RealTimeAlgorithm::solve(	double startTime,
 returnValue RealTimeAlgorithm::shift(	double timeShift
 										)
 {
+	if ( waitForPreparation( ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_CONTROLLAW_STEP_FAILED );
+
 	if ( acadoIsNegative( timeShift ) == BT_TRUE )
 		timeShift = getSamplingTime( );
 
@@ -400,6 +621,9 @@ returnValue RealTimeAlgorithm::shift(	double timeShift
 
 returnValue RealTimeAlgorithm::setReference( const VariablesGrid &ref )
 {
+	if ( waitForPreparation( ) != SUCCESSFUL_RETURN )
+		return ACADOERROR( RET_CONTROLLAW_STEP_FAILED );
+
     if ( ( getStatus() != BS_READY ) && ( getStatus() != BS_RUNNING ) )
 		return ACADOERROR( RET_OPTALG_INIT_FAILED );
 
@@ -496,21 +720,31 @@ returnValue RealTimeAlgorithm::setupOptions( )
 	addOption( PRINT_COPYRIGHT             , defaultPrintCopyright          );
 	addOption( HESSIAN_APPROXIMATION       , defaultHessianApproximation    );
 	addOption( DYNAMIC_HESSIAN_APPROXIMATION, defaultDynamicHessianApproximation );
+	addOption( BFGS_MEMORY_SIZE            , defaultBFGSmemorySize          );
 	addOption( DYNAMIC_SENSITIVITY         , defaultDynamicSensitivity      );
+	addOption( NUM_LIFTED_NODES            , defaultNumLiftedNodes          );
 	addOption( OBJECTIVE_SENSITIVITY       , defaultObjectiveSensitivity    );
 	addOption( CONSTRAINT_SENSITIVITY      , defaultConstraintSensitivity   );
 	addOption( DISCRETIZATION_TYPE         , defaultDiscretizationType      );
 	addOption( LINESEARCH_TOLERANCE        , defaultLinesearchTolerance     );
 	addOption( MIN_LINESEARCH_PARAMETER    , defaultMinLinesearchParameter  );
+	addOption( QP_SOLVER                   , defaultQPsolver                );
 	addOption( MAX_NUM_QP_ITERATIONS       , defaultMaxNumQPiterations      );
+	addOption( QP_SOLVER_TOLERANCE         , defaultQPsolverTolerance       );
+	addOption( MAX_QP_SOLVER_TIME          , defaultMaxQPsolverTime         );
+	addOption( MAX_NLP_SOLVER_TIME         , defaultMaxNLPsolverTime        );
 	addOption( HOTSTART_QP                 , defaultHotstartQP              );
 	addOption( INFEASIBLE_QP_RELAXATION    , defaultInfeasibleQPrelaxation  );
 	addOption( INFEASIBLE_QP_HANDLING      , defaultInfeasibleQPhandling    );
 	addOption( USE_REALTIME_ITERATIONS     , defaultUseRealtimeIterations   );
 	addOption( USE_REALTIME_SHIFTS         , defaultUseRealtimeShifts       );
 	addOption( USE_IMMEDIATE_FEEDBACK      , defaultUseImmediateFeedback    );
+	addOption( USE_ASYNC_PREPARATION       , defaultUseAsyncPreparation     );
+	addOption( USE_TANGENTIAL_PREDICTOR    , defaultUseTangentialPredictor  );
+	addOption( USE_AUTOMATIC_SCALING       , defaultUseAutomaticScaling     );
 	addOption( TERMINATE_AT_CONVERGENCE    , defaultTerminateAtConvergence  );
 	addOption( USE_CONDENSING              , defaultUseCondensing           );
+	addOption( CONDENSING_BLOCK_SIZE       , defaultCondensingBlockSize     );
 	addOption( GLOBALIZATION_STRATEGY      , defaultGlobalizationStrategy   );
 	addOption( PRINT_SCP_METHOD_PROFILE    , defaultprintSCPmethodProfile   );
 
@@ -534,6 +768,10 @@ returnValue RealTimeAlgorithm::setupOptions( )
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
+	addOption( MAX_NUM_STORED_INTEGRATOR_STEPS, defaultMaxNumStoredSteps   );
+	addOption( WARM_START_INTEGRATOR       , defaultWarmStartIntegrator     );
+	addOption( MAX_NUM_STIFF_INTEGRATOR_STEPS , defaultMaxNumStiffSteps        );
+	addOption( AUTO_INTEGRATOR_SWITCH_TOLERANCE, defaultAutoIntegratorSwitchTolerance );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -650,43 +888,190 @@ returnValue RealTimeAlgorithm::performPreparationStep(	const VariablesGrid& _yRe
 	int useRealTimeShifts = 0;
 	get( USE_REALTIME_SHIFTS,useRealTimeShifts );
 
+	int terminateAtConvergence = 0;
+	get( TERMINATE_AT_CONVERGENCE,terminateAtConvergence );
+
+	returnValue returnvalue = prepareNLPsolver(	nlpSolver,_yRef,isLastIteration,
+												(BooleanType)useRealTimeShifts,getSamplingTime( ),
+												(BooleanType)terminateAtConvergence
+												);
+	if ( ( returnvalue != CONVERGENCE_ACHIEVED ) && ( returnvalue != CONVERGENCE_NOT_YET_ACHIEVED ) )
+		return ACADOERROR( returnvalue );
+
+	setStatus( BS_READY );
+
+	return returnvalue;
+}
+
+
+returnValue RealTimeAlgorithm::prepareNLPsolver(	NLPsolver* const solver,
+													const VariablesGrid& _yRef,
+													BooleanType isLastIteration,
+													BooleanType useRealTimeShifts,
+													double timeShift,
+													BooleanType terminateAtConvergence
+													)
+{
 	// perform current step and check for convergence if desired
-	returnValue returnvalueStep = nlpSolver->performCurrentStep( );
+	returnValue returnvalueStep = solver->performCurrentStep( );
 	if ( ( returnvalueStep != CONVERGENCE_ACHIEVED ) && ( returnvalueStep != CONVERGENCE_NOT_YET_ACHIEVED ) )
-		return ACADOERROR( returnvalueStep );
+		return returnvalueStep;
 
 	if ( isLastIteration == BT_TRUE )
 	{
 		if ( _yRef.isEmpty() == BT_FALSE )
-			setReference( _yRef );
+			solver->setReference( _yRef );
 
-		if ( (BooleanType)useRealTimeShifts == BT_TRUE )
-			shift( );
+		if ( useRealTimeShifts == BT_TRUE )
+			solver->shiftVariables( timeShift );
 	}
 
 	// prepare next step
-	int terminateAtConvergence = 0;
-	get( TERMINATE_AT_CONVERGENCE,terminateAtConvergence );
-
-	if ( ((BooleanType)terminateAtConvergence == BT_TRUE ) && ( returnvalueStep == CONVERGENCE_ACHIEVED ) )
+	if ( ( terminateAtConvergence == BT_TRUE ) && ( returnvalueStep == CONVERGENCE_ACHIEVED ) )
 	{
 		if ( _yRef.isEmpty() == BT_FALSE )
-			setReference( _yRef );
+			solver->setReference( _yRef );
 	}
 
-	returnValue returnvalue = nlpSolver->prepareNextStep( );
+	returnValue returnvalue = solver->prepareNextStep( );
 	if ( ( returnvalue != CONVERGENCE_ACHIEVED ) && ( returnvalue != CONVERGENCE_NOT_YET_ACHIEVED ) )
-		return ACADOERROR( returnvalue );
+		return returnvalue;
 
-	if ( ((BooleanType)terminateAtConvergence == BT_TRUE ) && ( returnvalueStep == CONVERGENCE_ACHIEVED ) )
+	if ( ( terminateAtConvergence == BT_TRUE ) && ( returnvalueStep == CONVERGENCE_ACHIEVED ) )
 		returnvalue = CONVERGENCE_ACHIEVED;
 
-	setStatus( BS_READY );
-
 	return returnvalue;
 }
 
 
+returnValue RealTimeAlgorithm::startPreparationStep(	double nextTime,
+														const VariablesGrid& _yRef
+														)
+{
+	#if defined(LINUX)
+	if ( getStatus( ) != BS_RUNNING )
+    	return ACADOERROR( RET_OPTALG_INIT_FAILED );
+
+	// all options are read here as the background thread only works on its own data
+	int useRealTimeShifts = 0;
+	get( USE_REALTIME_SHIFTS,useRealTimeShifts );
+
+	int terminateAtConvergence = 0;
+	get( TERMINATE_AT_CONVERGENCE,terminateAtConvergence );
+
+	preparationNextTime              = nextTime;
+	preparationUsesShifts            = (BooleanType)useRealTimeShifts;
+	preparationTimeShift             = getSamplingTime( );
+	preparationTerminatesConvergence = (BooleanType)terminateAtConvergence;
+
+	if ( _yRef.isEmpty( ) == BT_FALSE )
+		preparationReference = new VariablesGrid( _yRef );
+
+	// the NLP solver is handed over to the background thread until waitForPreparation(),
+	// it only accesses its private user interaction meanwhile
+	preparationSolver  = nlpSolver;
+	nlpSolver          = 0;
+	preparationStatus  = SUCCESSFUL_RETURN;
+	preparationEndTime = acadoGetTime( );
+
+	if ( pthread_create( &preparationThread,0,&RealTimeAlgorithm::preparationWorker,this ) == 0 )
+	{
+		isPreparationPending = BT_TRUE;
+		return SUCCESSFUL_RETURN;
+	}
+
+	nlpSolver = preparationSolver;
+	preparationSolver = 0;
+
+	if ( preparationReference != 0 )
+	{
+		delete preparationReference;
+		preparationReference = 0;
+	}
+	#endif
+
+	// no background thread available, prepare on the caller's thread
+	return runPreparationStep( nextTime,_yRef );
+}
+
+
+void* RealTimeAlgorithm::preparationWorker(	void* rtAlgorithm
+											)
+{
+	RealTimeAlgorithm* alg = (RealTimeAlgorithm*)rtAlgorithm;
+
+	// only data that is not accessed by the caller's thread until the thread has been joined is used here
+	returnValue returnvalue;
+
+	if ( alg->preparationReference != 0 )
+		returnvalue = alg->prepareNLPsolver(	alg->preparationSolver,*(alg->preparationReference),BT_TRUE,
+												alg->preparationUsesShifts,alg->preparationTimeShift,
+												alg->preparationTerminatesConvergence
+												);
+	else
+		returnvalue = alg->prepareNLPsolver(	alg->preparationSolver,emptyConstVariablesGrid,BT_TRUE,
+												alg->preparationUsesShifts,alg->preparationTimeShift,
+												alg->preparationTerminatesConvergence
+												);
+
+	#if defined(LINUX)
+	pthread_mutex_lock( &(alg->preparationMutex) );
+	#endif
+
+	if ( ( returnvalue == CONVERGENCE_ACHIEVED ) || ( returnvalue == CONVERGENCE_NOT_YET_ACHIEVED ) )
+		alg->preparationStatus = SUCCESSFUL_RETURN;
+	else
+		alg->preparationStatus = RET_CONTROLLAW_STEP_FAILED;
+
+	alg->preparationEndTime = acadoGetTime( );
+
+	#if defined(LINUX)
+	pthread_mutex_unlock( &(alg->preparationMutex) );
+	#endif
+
+	return 0;
+}
+
+
+returnValue RealTimeAlgorithm::setupPreparation( )
+{
+	preparationInteraction           = 0;
+	isPreparationPending             = BT_FALSE;
+	preparationSolver                = 0;
+	preparationNextTime              = 0.0;
+	preparationReference             = 0;
+	preparationUsesShifts            = BT_FALSE;
+	preparationTimeShift             = 0.0;
+	preparationTerminatesConvergence = BT_FALSE;
+	preparationStatus                = SUCCESSFUL_RETURN;
+	preparationEndTime               = 0.0;
+	preparationWaitingTime           = 0.0;
+	numMissedDeadlines               = 0;
+
+	#if defined(LINUX)
+	pthread_mutex_init( &preparationMutex,0 );
+	#endif
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+BooleanType RealTimeAlgorithm::usesAsyncPreparation( ) const
+{
+	int useAsyncPreparation = 0;
+	get( USE_ASYNC_PREPARATION,useAsyncPreparation );
+
+	int useImmediateFeedback = 0;
+	get( USE_IMMEDIATE_FEEDBACK,useImmediateFeedback );
+
+	// without immediate feedback, the control is computed in the preparation step
+	if ( ( (BooleanType)useAsyncPreparation == BT_TRUE ) && ( (BooleanType)useImmediateFeedback == BT_TRUE ) )
+		return BT_TRUE;
+	else
+		return BT_FALSE;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
@@ -0,0 +1,639 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/optimization_algorithm/solution_cache.cpp
+ *    \author agent
+ *    \date 2026
+ */
+
+
+
+#if defined(LINUX)
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+#endif
+
+#include <string.h>
+
+#include <acado/optimization_algorithm/solution_cache.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+static const char SC_TAG_STRING[] = "ACADOSC1";
+static const uint SC_INITIAL_CAPACITY = 16;
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+SolutionCache::SolutionCache( )
+{
+	fileDescriptor = -1;
+	data           = 0;
+	dataSize       = 0;
+	numNeighbors   = 1;
+}
+
+
+SolutionCache::SolutionCache(	const char* const _fileName,
+								uint _numNeighbors
+								)
+{
+	fileDescriptor = -1;
+	data           = 0;
+	dataSize       = 0;
+	numNeighbors   = 1;
+
+	setNumNeighbors( _numNeighbors );
+	open( _fileName );
+}
+
+
+SolutionCache::~SolutionCache( )
+{
+	close( );
+}
+
+
+
+returnValue SolutionCache::open(	const char* const _fileName
+									)
+{
+	close( );
+
+	// CACHE KEPT IN MEMORY:
+	// ---------------------
+	if ( _fileName == 0 )
+	{
+		if ( resize( SC_TIMES ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_FILE_CAN_NOT_BE_OPENED );
+
+		for( uint run1 = 0; run1 < SC_TIMES; run1++ )
+			data[run1] = 0.0;
+
+		memcpy( data,SC_TAG_STRING,sizeof(double) );
+
+		return SUCCESSFUL_RETURN;
+	}
+
+
+	// CACHE KEPT IN A MEMORY-MAPPED FILE:
+	// -----------------------------------
+	#if defined(LINUX)
+
+	fileDescriptor = ::open( _fileName,O_RDWR | O_CREAT,0644 );
+
+	if ( fileDescriptor < 0 )
+		return ACADOERROR( RET_FILE_CAN_NOT_BE_OPENED );
+
+	struct stat fileStatus;
+
+	if ( fstat( fileDescriptor,&fileStatus ) != 0 )
+	{
+		::close( fileDescriptor );
+		fileDescriptor = -1;
+		return ACADOERROR( RET_FILE_CAN_NOT_BE_OPENED );
+	}
+
+	// a new file is initialized with an empty header
+	BooleanType isNewFile = BT_FALSE;
+	uint fileSize = (uint)( fileStatus.st_size / sizeof(double) );
+
+	if ( fileSize == 0 )
+	{
+		isNewFile = BT_TRUE;
+		fileSize  = SC_TIMES;
+	}
+
+	if ( ( fileSize < SC_TIMES ) || ( resize( fileSize ) != SUCCESSFUL_RETURN ) )
+	{
+		close( );
+		return ACADOERROR( RET_FILE_CAN_NOT_BE_OPENED );
+	}
+
+	if ( isNewFile == BT_TRUE )
+	{
+		for( uint run1 = 0; run1 < SC_TIMES; run1++ )
+			data[run1] = 0.0;
+
+		memcpy( data,SC_TAG_STRING,sizeof(double) );
+	}
+
+	// the file needs to be a cache that is large enough for its entries
+	if ( ( memcmp( data,SC_TAG_STRING,sizeof(double) ) != 0 ) ||
+		 ( dataSize < getHeaderSize( ) + (uint)data[SC_CAPACITY]*getEntrySize( ) ) )
+	{
+		close( );
+		return ACADOERROR( RET_FILE_CAN_NOT_BE_OPENED );
+	}
+
+	return SUCCESSFUL_RETURN;
+
+	#else
+
+	return ACADOERROR( RET_NOT_YET_IMPLEMENTED );
+
+	#endif
+}
+
+
+returnValue SolutionCache::close( )
+{
+	if ( data == 0 )
+		return SUCCESSFUL_RETURN;
+
+	returnValue returnvalue = SUCCESSFUL_RETURN;
+
+	#if defined(LINUX)
+
+	if ( fileDescriptor >= 0 )
+	{
+		if ( msync( data,dataSize*sizeof(double),MS_SYNC ) != 0 )
+			returnvalue = RET_FILE_CAN_NOT_BE_CLOSED;
+
+		munmap( data,dataSize*sizeof(double) );
+
+		if ( ::close( fileDescriptor ) != 0 )
+			returnvalue = RET_FILE_CAN_NOT_BE_CLOSED;
+
+		fileDescriptor = -1;
+		data           = 0;
+		dataSize       = 0;
+
+		if ( returnvalue != SUCCESSFUL_RETURN )
+			return ACADOERROR( returnvalue );
+
+		return SUCCESSFUL_RETURN;
+	}
+
+	#endif
+
+	delete[] data;
+
+	data     = 0;
+	dataSize = 0;
+
+	return returnvalue;
+}
+
+
+
+returnValue SolutionCache::setNumNeighbors(	uint _numNeighbors
+											)
+{
+	if ( _numNeighbors == 0 )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	numNeighbors = _numNeighbors;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue SolutionCache::store(	const Vector& key,
+									const OCPiterate& _iter,
+									uint nIterations,
+									double nColdIterations
+									)
+{
+	uint run1, run2, run3;
+
+	if ( data == 0 )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	if ( key.getDim( ) == 0 )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+
+	// FIX THE LAYOUT WITH THE FIRST ENTRY:
+	// ------------------------------------
+	if ( (uint)data[SC_KEY_DIM] == 0 )
+	{
+		if ( setupLayout( key,_iter ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+	}
+
+	if ( hasLayout( key,_iter ) == BT_FALSE )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+
+	// FIND THE ENTRY TO BE WRITTEN (AN ENTRY WITH THE SAME KEY IS REPLACED):
+	// ----------------------------------------------------------------------
+	uint nEntries = getNumEntries( );
+	uint entryIdx = nEntries;
+
+	for( run1 = 0; run1 < nEntries; run1++ )
+	{
+		if ( getSquaredDistance( key,run1 ) <= EPS*EPS )
+		{
+			entryIdx = run1;
+			break;
+		}
+	}
+
+	if ( entryIdx == nEntries )
+	{
+		if ( nEntries >= (uint)data[SC_CAPACITY] )
+		{
+			if ( reserve( 2*nEntries ) != SUCCESSFUL_RETURN )
+				return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+		}
+
+		data[SC_NUM_ENTRIES] = (double)( nEntries+1 );
+	}
+
+
+	// WRITE KEY, ESTIMATED ITERATIONS OF A COLD START AND THE SOLUTION:
+	// -----------------------------------------------------------------
+	const uint keyDim = key.getDim( );
+	double* entry = getEntry( entryIdx );
+
+	for( run1 = 0; run1 < keyDim; run1++ )
+		entry[run1] = key( run1 );
+
+	if ( nColdIterations > 0.0 )
+	{
+		if ( nColdIterations < (double)nIterations )
+			nColdIterations = (double)nIterations;
+
+		data[SC_NUM_WARM_STARTS]  += 1.0;
+		data[SC_SAVED_ITERATIONS] += floor( nColdIterations - (double)nIterations + 0.5 );
+
+		entry[keyDim] = nColdIterations;
+	}
+	else
+		entry[keyDim] = (double)nIterations;
+
+	const VariablesGrid* grids[5];
+	getGrids( _iter,grids );
+
+	uint offset = keyDim+1;
+
+	for( run1 = 0; run1 < 5; run1++ )
+	{
+		const uint nPoints = (uint) data[SC_NUM_POINTS+run1];
+		const uint dim     = (uint) data[SC_DIMS+run1];
+
+		for( run2 = 0; run2 < nPoints; run2++ )
+			for( run3 = 0; run3 < dim; run3++ )
+				entry[offset++] = grids[run1]->operator()( run2,run3 );
+	}
+
+	#if defined(LINUX)
+	if ( fileDescriptor >= 0 )
+		msync( data,dataSize*sizeof(double),MS_ASYNC );
+	#endif
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue SolutionCache::lookup(	const Vector& key,
+									OCPiterate& _iter,
+									double& nColdIterations
+									) const
+{
+	uint run1, run2, run3, run4;
+
+	if ( data == 0 )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	const uint nEntries = getNumEntries( );
+
+	if ( nEntries == 0 )
+		return RET_FILE_HAS_NO_VALID_ENTRIES;
+
+	const uint keyDim = (uint) data[SC_KEY_DIM];
+
+	if ( key.getDim( ) != keyDim )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+
+	// FIND THE ENTRIES WITH NEAREST KEYS (SORTED BY THEIR DISTANCE):
+	// --------------------------------------------------------------
+	uint nNeighbors = numNeighbors;
+	if ( nNeighbors > nEntries )
+		nNeighbors = nEntries;
+
+	uint*   neighborIdx      = new uint  [nNeighbors];
+	double* neighborDistance = new double[nNeighbors];
+	uint    nFound = 0;
+
+	for( run1 = 0; run1 < nEntries; run1++ )
+	{
+		double distance = getSquaredDistance( key,run1 );
+
+		if ( ( nFound == nNeighbors ) && ( distance >= neighborDistance[nFound-1] ) )
+			continue;
+
+		if ( nFound < nNeighbors )
+			nFound++;
+
+		for( run2 = nFound-1; ( run2 > 0 ) && ( neighborDistance[run2-1] > distance ); run2-- )
+		{
+			neighborIdx     [run2] = neighborIdx     [run2-1];
+			neighborDistance[run2] = neighborDistance[run2-1];
+		}
+
+		neighborIdx     [run2] = run1;
+		neighborDistance[run2] = distance;
+	}
+
+
+	// DETERMINE INVERSE-DISTANCE WEIGHTS (AN EXACT MATCH IS TAKEN AS IT IS):
+	// ----------------------------------------------------------------------
+	double* weights = new double[nNeighbors];
+	double sumOfWeights = 0.0;
+
+	if ( neighborDistance[0] <= EPS*EPS )
+	{
+		for( run1 = 0; run1 < nNeighbors; run1++ )
+			weights[run1] = 0.0;
+
+		weights[0]   = 1.0;
+		sumOfWeights = 1.0;
+	}
+	else
+	{
+		for( run1 = 0; run1 < nNeighbors; run1++ )
+		{
+			weights[run1] = 1.0 / sqrt( neighborDistance[run1] );
+			sumOfWeights += weights[run1];
+		}
+	}
+
+	for( run1 = 0; run1 < nNeighbors; run1++ )
+		weights[run1] /= sumOfWeights;
+
+
+	// INTERPOLATE THE SOLUTIONS ON THE STORED GRIDS:
+	// ----------------------------------------------
+	VariablesGrid* grids[5] = { 0,0,0,0,0 };
+	const VariableType types[5] = { VT_DIFFERENTIAL_STATE, VT_ALGEBRAIC_STATE, VT_PARAMETER, VT_CONTROL, VT_DISTURBANCE };
+
+	uint timesOffset = SC_TIMES;
+	uint offset      = keyDim+1;
+
+	for( run1 = 0; run1 < 5; run1++ )
+	{
+		const uint nPoints = (uint) data[SC_NUM_POINTS+run1];
+		const uint dim     = (uint) data[SC_DIMS+run1];
+
+		if ( ( nPoints > 0 ) && ( dim > 0 ) )
+		{
+			Grid grid( nPoints,&(data[timesOffset]) );
+			grids[run1] = new VariablesGrid( dim,grid,types[run1] );
+
+			for( run2 = 0; run2 < nPoints; run2++ )
+				for( run3 = 0; run3 < dim; run3++ )
+				{
+					double value = 0.0;
+
+					for( run4 = 0; run4 < nNeighbors; run4++ )
+						value += weights[run4] * getEntry( neighborIdx[run4] )[offset+run2*dim+run3];
+
+					grids[run1]->operator()( run2,run3 ) = value;
+				}
+		}
+
+		timesOffset += nPoints;
+		offset      += nPoints*dim;
+	}
+
+	_iter.init( grids[0],grids[1],grids[2],grids[3],grids[4] );
+
+	nColdIterations = 0.0;
+	for( run1 = 0; run1 < nNeighbors; run1++ )
+		nColdIterations += weights[run1] * getEntry( neighborIdx[run1] )[keyDim];
+
+	for( run1 = 0; run1 < 5; run1++ )
+		if ( grids[run1] != 0 )
+			delete grids[run1];
+
+	delete[] weights;
+	delete[] neighborDistance;
+	delete[] neighborIdx;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue SolutionCache::setupLayout(	const Vector& key,
+										const OCPiterate& _iter
+										)
+{
+	uint run1, run2;
+
+	const VariablesGrid* grids[5];
+	getGrids( _iter,grids );
+
+	uint timesSize = 0;
+
+	for( run1 = 0; run1 < 5; run1++ )
+		if ( grids[run1] != 0 )
+			timesSize += grids[run1]->getNumPoints( );
+
+	if ( resize( SC_TIMES + timesSize ) != SUCCESSFUL_RETURN )
+		return RET_MEMBER_NOT_INITIALISED;
+
+	data[SC_KEY_DIM]     = (double) key.getDim( );
+	data[SC_CAPACITY]    = 0.0;
+	data[SC_NUM_ENTRIES] = 0.0;
+
+	uint timesOffset = SC_TIMES;
+
+	for( run1 = 0; run1 < 5; run1++ )
+	{
+		data[SC_NUM_POINTS+run1] = 0.0;
+		data[SC_DIMS+run1]       = 0.0;
+
+		if ( grids[run1] == 0 )
+			continue;
+
+		data[SC_NUM_POINTS+run1] = (double) grids[run1]->getNumPoints( );
+		data[SC_DIMS+run1]       = (double) grids[run1]->getNumValues( );
+
+		for( run2 = 0; run2 < grids[run1]->getNumPoints( ); run2++ )
+			data[timesOffset++] = grids[run1]->getTime( run2 );
+	}
+
+	return reserve( SC_INITIAL_CAPACITY );
+}
+
+
+BooleanType SolutionCache::hasLayout(	const Vector& key,
+										const OCPiterate& _iter
+										) const
+{
+	uint run1, run2;
+
+	if ( key.getDim( ) != (uint) data[SC_KEY_DIM] )
+		return BT_FALSE;
+
+	const VariablesGrid* grids[5];
+	getGrids( _iter,grids );
+
+	uint timesOffset = SC_TIMES;
+
+	for( run1 = 0; run1 < 5; run1++ )
+	{
+		const uint nPoints = (uint) data[SC_NUM_POINTS+run1];
+
+		if ( grids[run1] == 0 )
+		{
+			if ( nPoints > 0 )
+				return BT_FALSE;
+
+			continue;
+		}
+
+		if ( ( grids[run1]->getNumPoints( ) != nPoints ) ||
+			 ( grids[run1]->getNumValues( ) != (uint) data[SC_DIMS+run1] ) )
+			return BT_FALSE;
+
+		for( run2 = 0; run2 < nPoints; run2++ )
+			if ( fabs( grids[run1]->getTime( run2 ) - data[timesOffset+run2] ) > 1.0e3*EPS*( 1.0 + fabs( data[timesOffset+run2] ) ) )
+				return BT_FALSE;
+
+		timesOffset += nPoints;
+	}
+
+	return BT_TRUE;
+}
+
+
+returnValue SolutionCache::reserve(	uint capacity
+									)
+{
+	if ( capacity <= (uint) data[SC_CAPACITY] )
+		return SUCCESSFUL_RETURN;
+
+	if ( resize( getHeaderSize( ) + capacity*getEntrySize( ) ) != SUCCESSFUL_RETURN )
+		return RET_MEMBER_NOT_INITIALISED;
+
+	data[SC_CAPACITY] = (double) capacity;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SolutionCache::resize(	uint _dataSize
+									)
+{
+	if ( _dataSize == dataSize )
+		return SUCCESSFUL_RETURN;
+
+	#if defined(LINUX)
+
+	if ( fileDescriptor >= 0 )
+	{
+		if ( data != 0 )
+			munmap( data,dataSize*sizeof(double) );
+
+		data     = 0;
+		dataSize = 0;
+
+		if ( ftruncate( fileDescriptor,_dataSize*sizeof(double) ) != 0 )
+			return RET_FILE_CAN_NOT_BE_OPENED;
+
+		void* mapping = mmap( 0,_dataSize*sizeof(double),PROT_READ | PROT_WRITE,MAP_SHARED,fileDescriptor,0 );
+
+		if ( mapping == MAP_FAILED )
+			return RET_FILE_CAN_NOT_BE_OPENED;
+
+		data     = (double*) mapping;
+		dataSize = _dataSize;
+
+		return SUCCESSFUL_RETURN;
+	}
+
+	#endif
+
+	double* newData = new double[_dataSize];
+
+	if ( data != 0 )
+	{
+		memcpy( newData,data,( dataSize < _dataSize ? dataSize : _dataSize )*sizeof(double) );
+		delete[] data;
+	}
+
+	data     = newData;
+	dataSize = _dataSize;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+double SolutionCache::getSquaredDistance(	const Vector& key,
+											uint entryIdx
+											) const
+{
+	const double* entry = getEntry( entryIdx );
+	double distance = 0.0;
+
+	for( uint run1 = 0; run1 < key.getDim( ); run1++ )
+		distance += ( key( run1 )-entry[run1] ) * ( key( run1 )-entry[run1] );
+
+	return distance;
+}
+
+
+void SolutionCache::getGrids(	const OCPiterate& _iter,
+								const VariablesGrid* grids[5]
+								) const
+{
+	grids[0] = _iter.x;
+	grids[1] = _iter.xa;
+	grids[2] = _iter.p;
+	grids[3] = _iter.u;
+	grids[4] = _iter.w;
+
+	// empty grids are treated as missing ones
+	for( uint run1 = 0; run1 < 5; run1++ )
+		if ( ( grids[run1] != 0 ) && ( ( grids[run1]->getNumPoints( ) == 0 ) || ( grids[run1]->getNumValues( ) == 0 ) ) )
+			grids[run1] = 0;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -710,6 +710,7 @@ returnValue Process::setupOptions( )
 	addOption( INTEGRATOR_TYPE             , INT_BDF                        );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
+	addOption( NUM_LIFTED_NODES            , defaultNumLiftedNodes          );
 	
 	// add integrator options
 	addOption( MAX_NUM_INTEGRATOR_STEPS    , defaultMaxNumSteps             );
@@ -725,6 +726,10 @@ returnValue Process::setupOptions( )
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
+	addOption( MAX_NUM_STORED_INTEGRATOR_STEPS, defaultMaxNumStoredSteps   );
+	addOption( WARM_START_INTEGRATOR       , defaultWarmStartIntegrator     );
+	addOption( MAX_NUM_STIFF_INTEGRATOR_STEPS , defaultMaxNumStiffSteps        );
+	addOption( AUTO_INTEGRATOR_SWITCH_TOLERANCE, defaultAutoIntegratorSwitchTolerance );
 
 	return SUCCESSFUL_RETURN;
 }
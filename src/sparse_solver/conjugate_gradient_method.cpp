@@ -56,6 +56,9 @@ ConjugateGradientMethod::ConjugateGradientMethod( ){
     printLevel = LOW;
     pCounter   = 0     ;
     condScale  = 0     ;
+
+    preconditioner = PT_DIAGONAL;
+    blockSize      = 1          ;
 }
 
 
@@ -95,9 +98,12 @@ ConjugateGradientMethod::ConjugateGradientMethod( const ConjugateGradientMethod
     else{
         p = new double*[2*dim+1];
         for( run1 = 0; run1 < 2*dim+1; run1++ ){
-            p[run1] = new double[dim];
-            for( run2 = 0; run2 < dim; run2++ ){
-                p[run1][run2] = arg.p[run1][run2];
+            if( arg.p[run1] == 0 ) p[run1] = 0;
+            else{
+                p[run1] = new double[dim];
+                for( run2 = 0; run2 < dim; run2++ ){
+                    p[run1][run2] = arg.p[run1][run2];
+                }
             }
         }
     }
@@ -112,6 +118,9 @@ ConjugateGradientMethod::ConjugateGradientMethod( const ConjugateGradientMethod
     TOL = arg.TOL;
     printLevel = arg.printLevel;
 
+    preconditioner = arg.preconditioner;
+    blockSize      = arg.blockSize;
+
     if( arg.condScale == 0 ) condScale = 0;
     else{
         condScale = new double[dim];
@@ -132,7 +141,7 @@ ConjugateGradientMethod::~ConjugateGradientMethod( ){
 
     if( p != 0 ){
         for( run1 = 0; run1 < 2*dim+1; run1++ )
-            delete[] p[run1];
+            if( p[run1] != 0 ) delete[] p[run1];
         delete[] p;
     }
 
@@ -148,9 +157,8 @@ returnValue ConjugateGradientMethod::solve( double *b ){
 
     // CONSISTENCY CHECKS:
     // -------------------
-    if( dim    <= 0 )  return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
-    if( nDense <= 0 )  return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
-    if( A      == 0 )  return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+    if( dim    <= 0 )               return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+    if( isMatrixDefined() == BT_FALSE ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
 
     int run1, run2;
@@ -197,6 +205,8 @@ returnValue ConjugateGradientMethod::solve( double *b ){
         r[run1] -= aux[run1];
 
 
+    if( p[pCounter] == 0 ) p[pCounter] = new double[dim];
+
     for( run1 = 0; run1 < dim; run1++ )
         p[pCounter][run1] = r[run1];
 
@@ -228,6 +238,8 @@ returnValue ConjugateGradientMethod::solve( double *b ){
         auxR2 = scalarProduct( r,r );
         beta  = auxR2/auxR;
 
+        if( p[pCounter+1] == 0 ) p[pCounter+1] = new double[dim];
+
         for( run1 = 0; run1 < dim; run1++ )
             p[pCounter+1][run1] = r[run1] + beta*p[pCounter][run1];
 
@@ -250,8 +262,19 @@ returnValue ConjugateGradientMethod::setDimension( const int &n ){
 
     int run1;
 
+    // the basis vectors are only allocated when needed by solve:
+    if( p != 0 ){
+        for( run1 = 0; run1 < 2*dim+1; run1++ )
+            if( p[run1] != 0 ) delete[] p[run1];
+        delete[] p;
+    }
+
     dim = n;
 
+    p = new double*[2*dim+1];
+    for( run1 = 0; run1 < 2*dim+1; run1++ )
+        p[run1] = 0;
+
     if( x != 0 ){
         delete[] x;
         x = 0;
@@ -264,16 +287,6 @@ returnValue ConjugateGradientMethod::setDimension( const int &n ){
     }
     norm2 = new double[2*dim+1];
 
-    if( p != 0 ){
-        for( run1 = 0; run1 < 2*dim+1; run1++ )
-            delete[] p[run1];
-        delete[] p;
-    }
-    p = new double*[2*dim+1];
-    for( run1 = 0; run1 < 2*dim+1; run1++ ){
-        p[run1] = new double[dim];
-    }
-
 
     if( r != 0 ){
         delete[] r;
@@ -316,7 +329,7 @@ returnValue ConjugateGradientMethod::setMatrix( double *A_ ){
 
     pCounter = 0;
 
-    A = new double[nDense];
+    if( A == 0 ) A = new double[nDense];
     return computePreconditioner( A_ );
 }
 
@@ -343,6 +356,19 @@ returnValue ConjugateGradientMethod::setPrintLevel( PrintLevel printLevel_ ){
 }
 
 
+returnValue ConjugateGradientMethod::setPreconditioner( PreconditionerType preconditioner_,
+                                                        int                blockSize_       ){
+
+    if( preconditioner_ != PT_DIAGONAL )
+        return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+
+    preconditioner = preconditioner_;
+    blockSize      = blockSize_;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 //
 // PROTECTED MEMBER FUNCTIONS:
 //
@@ -361,6 +387,13 @@ double ConjugateGradientMethod::scalarProduct( double *aa, double *bb ){
 }
 
 
+BooleanType ConjugateGradientMethod::isMatrixDefined( ) const{
+
+    if( nDense <= 0 || A == 0 ) return BT_FALSE;
+    return BT_TRUE;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
@@ -0,0 +1,203 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file src/sparse_solver/matrix_free_conjugate_gradient_method.cpp
+ *    \author agent
+ *    \date   2026
+ */
+
+
+#include <acado/sparse_solver/sparse_solver.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+
+MatrixFreeConjugateGradientMethod::MatrixFreeConjugateGradientMethod( )
+                                  :ConjugateGradientMethod( ){
+
+    applyOperator = 0;
+    userData      = 0;
+    work          = 0;
+}
+
+
+MatrixFreeConjugateGradientMethod::MatrixFreeConjugateGradientMethod( const MatrixFreeConjugateGradientMethod &arg )
+                                  :ConjugateGradientMethod(arg){
+
+    int run1;
+
+    applyOperator = arg.applyOperator;
+    userData      = arg.userData;
+
+    if( arg.work != 0 ){
+        work = new double[dim];
+        for( run1 = 0; run1 < dim; run1++ )
+             work[run1] = arg.work[run1];
+    }
+    else  work = 0;
+}
+
+
+MatrixFreeConjugateGradientMethod::~MatrixFreeConjugateGradientMethod( ){
+
+    if( work != 0 )  delete[] work;
+}
+
+
+
+SparseSolver* MatrixFreeConjugateGradientMethod::clone() const{
+
+    return new MatrixFreeConjugateGradientMethod(*this);
+}
+
+
+returnValue MatrixFreeConjugateGradientMethod::setDimension( const int &n ){
+
+    int run1;
+
+    ConjugateGradientMethod::setDimension( n );
+
+    if( work != 0 )  delete[] work;
+    work = new double[dim];
+
+    // no scaling until the diagonal of A is known:
+    for( run1 = 0; run1 < dim; run1++ )
+        condScale[run1] = 1.0;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue MatrixFreeConjugateGradientMethod::setOperator( cFcnPtr  applyOperator_,
+                                                            void    *userData_       ){
+
+    applyOperator = applyOperator_;
+    userData      = userData_;
+    pCounter      = 0;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue MatrixFreeConjugateGradientMethod::setIndices( const int *rowIdx_, const int *colIdx_  ){
+
+     return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+}
+
+
+returnValue MatrixFreeConjugateGradientMethod::setMatrix( double *A_ ){
+
+    if( dim <= 0 )  return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+    pCounter = 0;
+
+    return computePreconditioner( A_ );
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+
+
+void MatrixFreeConjugateGradientMethod::multiply( double *xx , double *result ){
+
+    int run1;
+
+    for( run1 = 0; run1 < dim; run1++ )
+        work[run1] = xx[run1]/condScale[run1];
+
+    applyOperator( work, result, userData );
+
+    for( run1 = 0; run1 < dim; run1++ )
+        result[run1] /= condScale[run1];
+}
+
+
+
+returnValue MatrixFreeConjugateGradientMethod::computePreconditioner( double* A_ ){
+
+    int run1;
+
+    for( run1 = 0; run1 < dim; run1++ )
+        if( A_[run1] <= 0.0 )
+            return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+    for( run1 = 0; run1 < dim; run1++ )
+        condScale[run1] = sqrt(A_[run1]);
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue MatrixFreeConjugateGradientMethod::applyPreconditioner( double *b ){
+
+    int run1;
+
+    for( run1 = 0; run1 < dim; run1++ )
+        r[run1] = b[run1]/condScale[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue MatrixFreeConjugateGradientMethod::applyInversePreconditioner( double *x_ ){
+
+    int run1;
+
+    for( run1 = 0; run1 < dim; run1++ )
+        x_[run1] = x[run1]/condScale[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+BooleanType MatrixFreeConjugateGradientMethod::isMatrixDefined( ) const{
+
+    if( applyOperator == 0 ) return BT_FALSE;
+    return BT_TRUE;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+/*
+ *   end of file
+ */
@@ -32,6 +32,10 @@
 
 #include <acado/sparse_solver/sparse_solver.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 
 BEGIN_NAMESPACE_ACADO
 
@@ -48,6 +52,13 @@ SymmetricConjugateGradientMethod::SymmetricConjugateGradientMethod( )
     index     = 0;
     nIndex    = 0;
     diag      = 0;
+    rowStart  = 0;
+    perm      = 0;
+
+    lRowStart = 0;
+    lCol      = 0;
+    lVal      = 0;
+    work      = 0;
 }
 
 
@@ -81,6 +92,45 @@ SymmetricConjugateGradientMethod::SymmetricConjugateGradientMethod( const Symmet
         }
     }
     else  diag = 0;
+
+    if( arg.rowStart != 0 ){
+        rowStart = new int[dim+1];
+        for( run1 = 0; run1 < dim+1; run1++ )
+             rowStart[run1] = arg.rowStart[run1];
+    }
+    else  rowStart = 0;
+
+    if( arg.perm != 0 ){
+        perm = new int[nDense];
+        for( run1 = 0; run1 < nDense; run1++ )
+             perm[run1] = arg.perm[run1];
+    }
+    else  perm = 0;
+
+    if( arg.work != 0 ){
+        work = new double[dim];
+        for( run1 = 0; run1 < dim; run1++ )
+             work[run1] = arg.work[run1];
+    }
+    else  work = 0;
+
+    if( arg.lRowStart != 0 ){
+        lRowStart = new int[dim+1];
+        for( run1 = 0; run1 < dim+1; run1++ )
+             lRowStart[run1] = arg.lRowStart[run1];
+
+        lCol = new int   [lRowStart[dim]];
+        lVal = new double[lRowStart[dim]];
+        for( run1 = 0; run1 < lRowStart[dim]; run1++ ){
+             lCol[run1] = arg.lCol[run1];
+             lVal[run1] = arg.lVal[run1];
+        }
+    }
+    else{
+        lRowStart = 0;
+        lCol      = 0;
+        lVal      = 0;
+    }
 }
 
 
@@ -92,6 +142,12 @@ SymmetricConjugateGradientMethod::~SymmetricConjugateGradientMethod( ){
 
     if( diag != 0 )  delete[] diag;
 
+    if( rowStart != 0 )  delete[] rowStart;
+    if( perm     != 0 )  delete[] perm;
+    if( work     != 0 )  delete[] work;
+
+    clearFactor();
+
     if( index != 0 ){
         for( run1 = 0; run1 < dim; run1++ )
             delete[] index[run1];
@@ -123,6 +179,26 @@ returnValue SymmetricConjugateGradientMethod::setIndices( const int *indices ){
     if( nDense <= 0 )  return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
 
+    // LOCAL AUXILIARY VARIABLE:
+    // -------------------------
+    int run1,  run2;
+    int counter    ;
+    int row        ;
+
+
+    // FREE THE OLD INDEX LISTS:
+    // -------------------------
+
+    if( index != 0 ){
+        for( run1 = 0; run1 < dim; run1++ )
+            delete[] index[run1];
+        delete[] index;
+        index = 0;
+    }
+
+    clearFactor();
+
+
     // ALLOCATE MEMORY:
     // ------------------
 
@@ -132,65 +208,112 @@ returnValue SymmetricConjugateGradientMethod::setIndices( const int *indices ){
     if( diag != 0 )  delete[] diag;
     diag = new int[dim];
 
+    if( rowStart != 0 )  delete[] rowStart;
+    rowStart = new int[dim+1];
 
-    // LOCAL AUXILIARY VARIABLE:
-    // -------------------------
-    int run1,  run2;
-    int counter0   ;
-    int bound      ;
-    int bound2     ;
-    int counter = 0;
+    if( perm != 0 )  delete[] perm;
+    perm = new int[nDense];
 
-    BooleanType diagFound;
+    if( work != 0 )  delete[] work;
+    work = new double[dim];
 
 
     // DETERMINE THE INDEX LENGHTS:
     // ----------------------------
 
+    for( run1 = 0; run1 < dim; run1++ )
+        nIndex[run1] = 0;
+
+    for( counter = 0; counter < nDense; counter++ ){
+
+        if( indices[counter] < 0 || indices[counter] >= dim*dim )
+            return ACADOERROR(RET_INVALID_ARGUMENTS);
+
+        nIndex[indices[counter]/dim]++;
+    }
+
+    rowStart[0] = 0;
+    for( run1 = 0; run1 < dim; run1++ )
+        rowStart[run1+1] = rowStart[run1] + nIndex[run1];
+
+
+    // SORT THE ENTRIES BY THEIR POSITION (ROW-WISE, THEN BY COLUMN), AS
+    // THE INCOMPLETE CHOLESKY FACTORIZATION MERGES SORTED ROWS. THE
+    // PERMUTATION IS APPLIED TO THE VALUES IN computePreconditioner:
+    // -----------------------------------------------------------------
+
+    for( run1 = 0; run1 < dim; run1++ )
+        nIndex[run1] = 0;
+
+    for( counter = 0; counter < nDense; counter++ ){
+        row = indices[counter]/dim;
+        perm[rowStart[row]+nIndex[row]] = counter;
+        nIndex[row]++;
+    }
 
     for( run1 = 0; run1 < dim; run1++ ){
 
-        counter0 = counter;
-        bound    = dim*(run1+1);
-        bound2   = run1*(dim+1);
+        int *rowPerm = &perm[rowStart[run1]];
 
-        diagFound = BT_FALSE;
+        for( run2 = 1; run2 < nIndex[run1]; run2++ ){
 
-        while( counter < nDense ){
+            int entry = rowPerm[run2];
+            int pos   = run2;
 
-            if( diagFound == BT_FALSE && indices[counter] >= bound2 ){
-                 diag[run1] = counter;
-                 diagFound  = BT_TRUE;
+            while( pos > 0 && indices[rowPerm[pos-1]] > indices[entry] ){
+                rowPerm[pos] = rowPerm[pos-1];
+                pos--;
             }
-
-            if( indices[counter] >= bound ) break;
-            counter++;
+            rowPerm[pos] = entry;
         }
-
-        nIndex[run1] = counter - counter0;
     }
 
-    if( index != 0 ){
-        for( run1 = 0; run1 < dim; run1++ )
-            delete[] index[run1];
-        delete[] index;
+    index = new int*[dim];
+
+    for( run1 = 0; run1 < dim; run1++ ){
+        index[run1] = new int[nIndex[run1]];
+        for( run2 = 0; run2 < nIndex[run1]; run2++ )
+            index[run1][run2] = indices[perm[rowStart[run1]+run2]];
     }
-    index     = new int*[dim];
 
-    counter = 0;
+
+    // EACH ROW NEEDS A DIAGONAL ENTRY AND NO POSITION MAY OCCUR TWICE:
+    // ----------------------------------------------------------------
 
     for( run1 = 0; run1 < dim; run1++ ){
-        index[run1]     = new int[nIndex[run1]];
+
+        diag[run1] = -1;
+
         for( run2 = 0; run2 < nIndex[run1]; run2++ ){
-            index    [run1][run2] = indices[counter];
-            counter++;
+
+            if( run2 > 0 && index[run1][run2] == index[run1][run2-1] )
+                return ACADOERROR(RET_INVALID_ARGUMENTS);
+
+            if( index[run1][run2] == run1*(dim+1) )
+                diag[run1] = perm[rowStart[run1]+run2];
         }
+
+        if( diag[run1] < 0 )
+            return ACADOERROR(RET_INVALID_ARGUMENTS);
     }
 
     return SUCCESSFUL_RETURN;
 }
 
 
+returnValue SymmetricConjugateGradientMethod::setPreconditioner( PreconditionerType preconditioner_,
+                                                                 int                blockSize_       ){
+
+    if( preconditioner_ == PT_BLOCK_JACOBI && blockSize_ < 1 )
+        return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+    preconditioner = preconditioner_;
+    blockSize      = blockSize_;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 
 
 
@@ -205,18 +328,41 @@ returnValue SymmetricConjugateGradientMethod::setIndices( const int *indices ){
 
 void SymmetricConjugateGradientMethod::multiply( double *xx , double *result ){
 
+    int i;
 
-    int i,j,counter, offset;
+    if( lRowStart == 0 ){
+        multiplyScaledMatrix( xx, result );
+        return;
+    }
 
-    counter = 0;
+    // split preconditioning:  result = L^{-1} * A * L^{-T} * xx
+    for( i = 0; i < dim; i++ )
+        work[i] = xx[i];
+
+    solveTransposedFactor( work );
+    multiplyScaledMatrix( work, result );
+    solveFactor( result );
+}
+
+
+void SymmetricConjugateGradientMethod::multiplyScaledMatrix( double *xx , double *result ){
 
+    int i;
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static) num_threads( acadoGetNumThreads( ) )
+#endif
     for( i = 0; i < dim; i++ ){
-        result[i] = 0.0;
-        offset    = dim*i;
-        for( j = 0; j < nIndex[i]; j++ ){
-            result[i] += A[counter]*xx[index[i][j]-offset];
-            counter++;
-        }
+
+        int     j;
+        int     offset  = dim*i;
+        double *rowA    = &A[rowStart[i]];
+        double  aux     = 0.0;
+
+        for( j = 0; j < nIndex[i]; j++ )
+            aux += rowA[j]*xx[index[i][j]-offset];
+
+        result[i] = aux;
     }
 }
 
@@ -236,11 +382,37 @@ returnValue SymmetricConjugateGradientMethod::computePreconditioner( double* A_
     for( i = 0; i < dim; i++ ){
         offset = dim*i;
         for( j = 0; j < nIndex[i]; j++ ){
-            A[counter] = A_[counter]/(condScale[i]*condScale[index[i][j]-offset]);
+            A[counter] = A_[perm[counter]]/(condScale[i]*condScale[index[i][j]-offset]);
             counter++;
         }
     }
 
+
+    // COMPUTE THE TRIANGULAR FACTOR OF THE SCALED MATRIX:
+    // (shifting its diagonal if the factorization breaks down)
+    // ---------------------------------------------------------
+    clearFactor();
+
+    if( preconditioner == PT_DIAGONAL )
+        return SUCCESSFUL_RETURN;
+
+    setupFactorPattern();
+
+    double shift = 0.0;
+
+    while( computeFactor( shift ) != SUCCESSFUL_RETURN ){
+
+        if( shift >= 1.0 ){
+            clearFactor();
+            if( printLevel == MEDIUM || printLevel == HIGH )
+                return ACADOWARNING( RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR );
+            return SUCCESSFUL_RETURN;
+        }
+
+        if( shift == 0.0 ) shift  = 1.0e-3;
+        else               shift *= 10.0  ;
+    }
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -253,6 +425,9 @@ returnValue SymmetricConjugateGradientMethod::applyPreconditioner( double *b ){
     for( run1 = 0; run1 < dim; run1++ )
         r[run1] = b[run1]/condScale[run1];
 
+    if( lRowStart != 0 )
+        solveFactor( r );
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -264,13 +439,168 @@ returnValue SymmetricConjugateGradientMethod::applyInversePreconditioner( double
     int run1;
 
     for( run1 = 0; run1 < dim; run1++ )
-        x_[run1] = x[run1]/condScale[run1];
+        x_[run1] = x[run1];
+
+    if( lRowStart != 0 )
+        solveTransposedFactor( x_ );
+
+    for( run1 = 0; run1 < dim; run1++ )
+        x_[run1] /= condScale[run1];
 
     return SUCCESSFUL_RETURN;
 }
 
 
 
+void SymmetricConjugateGradientMethod::setupFactorPattern( ){
+
+    int i, j, col, first;
+
+    // the incomplete Cholesky factor has the pattern of the lower triangle
+    // of A, the block-Jacobi factor the (dense) lower triangle of each block
+    lRowStart    = new int[dim+1];
+    lRowStart[0] = 0;
+
+    for( i = 0; i < dim; i++ ){
+
+        lRowStart[i+1] = lRowStart[i];
+
+        if( preconditioner == PT_BLOCK_JACOBI ){
+            first = (i/blockSize)*blockSize;
+            lRowStart[i+1] += i-first+1;
+        }
+        else{
+            for( j = 0; j < nIndex[i]; j++ )
+                if( index[i][j]-dim*i < i ) lRowStart[i+1]++;
+            lRowStart[i+1]++;
+        }
+    }
+
+    lCol = new int   [lRowStart[dim]];
+    lVal = new double[lRowStart[dim]];
+
+    for( i = 0; i < dim; i++ ){
+
+        if( preconditioner == PT_BLOCK_JACOBI ){
+            first = (i/blockSize)*blockSize;
+            for( col = first; col <= i; col++ )
+                lCol[lRowStart[i]+col-first] = col;
+        }
+        else{
+            int counter = lRowStart[i];
+            for( j = 0; j < nIndex[i]; j++ ){
+                col = index[i][j]-dim*i;
+                if( col < i ) lCol[counter++] = col;
+            }
+            lCol[counter] = i;
+        }
+    }
+}
+
+
+
+returnValue SymmetricConjugateGradientMethod::computeFactor( double shift ){
+
+    int i, k, a, b, kk, col, last;
+    double sum;
+
+    // COPY THE SCALED MATRIX INTO THE PATTERN OF THE FACTOR:
+    // -------------------------------------------------------
+    for( i = 0; i < dim; i++ ){
+
+        a = lRowStart[i];
+
+        for( kk = lRowStart[i]; kk < lRowStart[i+1]; kk++ )
+            lVal[kk] = 0.0;
+
+        for( k = 0; k < nIndex[i]; k++ ){
+            col = index[i][k]-dim*i;
+            while( a < lRowStart[i+1] && lCol[a] < col ) a++;
+            if( a < lRowStart[i+1] && lCol[a] == col ) lVal[a] = A[rowStart[i]+k];
+        }
+
+        lVal[lRowStart[i+1]-1] += shift;
+    }
+
+
+    // INCOMPLETE CHOLESKY FACTORIZATION (ROW-WISE):
+    // ----------------------------------------------
+    for( i = 0; i < dim; i++ ){
+
+        for( kk = lRowStart[i]; kk < lRowStart[i+1]; kk++ ){
+
+            k    = lCol[kk];
+            last = lRowStart[k+1]-1;
+            sum  = lVal[kk];
+
+            // subtract the product of the rows i and k (columns < k)
+            a = lRowStart[i];
+            b = lRowStart[k];
+            while( a < kk && b < last ){
+                if     ( lCol[a] == lCol[b] ) sum -= lVal[a++]*lVal[b++];
+                else if( lCol[a] <  lCol[b] ) a++;
+                else                          b++;
+            }
+
+            if( k < i ){
+                lVal[kk] = sum/lVal[last];
+            }
+            else{
+                if( sum <= 0.0 || lCol[kk] != i )
+                    return RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR;
+                lVal[kk] = sqrt( sum );
+            }
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+void SymmetricConjugateGradientMethod::solveFactor( double *b ){
+
+    int i, kk, last;
+    double sum;
+
+    for( i = 0; i < dim; i++ ){
+        last = lRowStart[i+1]-1;
+        sum  = b[i];
+        for( kk = lRowStart[i]; kk < last; kk++ )
+            sum -= lVal[kk]*b[lCol[kk]];
+        b[i] = sum/lVal[last];
+    }
+}
+
+
+
+void SymmetricConjugateGradientMethod::solveTransposedFactor( double *b ){
+
+    int i, kk, last;
+
+    for( i = dim-1; i >= 0; i-- ){
+        last  = lRowStart[i+1]-1;
+        b[i] /= lVal[last];
+        for( kk = lRowStart[i]; kk < last; kk++ )
+            b[lCol[kk]] -= lVal[kk]*b[i];
+    }
+}
+
+
+
+void SymmetricConjugateGradientMethod::clearFactor( ){
+
+    if( lRowStart != 0 ) delete[] lRowStart;
+    if( lCol      != 0 ) delete[] lCol;
+    if( lVal      != 0 ) delete[] lVal;
+
+    lRowStart = 0;
+    lCol      = 0;
+    lVal      = 0;
+}
+
+
+
 
 CLOSE_NAMESPACE_ACADO
 
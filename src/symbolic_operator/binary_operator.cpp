@@ -40,6 +40,9 @@ BEGIN_NAMESPACE_ACADO
 
 BinaryOperator::BinaryOperator( ) : SmoothOperator( )
 {
+    argument2_batch = NULL;
+    batchSize       = 0   ;
+
     nCount = 0;
 }
 
@@ -54,6 +57,8 @@ BinaryOperator::BinaryOperator( Operator *_argument1, Operator *_argument2 ) : S
     dargument1_result = (double*)calloc(1,sizeof(double));
     dargument2_result = (double*)calloc(1,sizeof(double));
     bufferSize        = 1                                ;
+    argument2_batch   = (double*)calloc(1,sizeof(double));
+    batchSize         = 1                                ;
     curvature         = CT_UNKNOWN                       ;
     monotonicity      = MT_UNKNOWN                       ;
 
@@ -131,6 +136,11 @@ returnValue BinaryOperator::clearBuffer(){
         dargument2_result = (double*)realloc(dargument2_result,bufferSize*sizeof(double));
     }
 
+    if( batchSize > 1 ){
+        batchSize = 1;
+        argument2_batch = (double*)realloc(argument2_batch,batchSize*sizeof(double));
+    }
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -218,6 +228,11 @@ void BinaryOperator::copy( const BinaryOperator &arg ){
        dargument2_result[run1] = arg.dargument2_result[run1];
 
     }
+
+    // (the lane buffer is a scratch buffer, its content is not copied)
+    batchSize         = arg.batchSize;
+    argument2_batch   = (double*)calloc(acadoMax(batchSize,1),sizeof(double));
+
     curvature         = arg.curvature   ;
     monotonicity      = arg.monotonicity;
 
@@ -241,6 +256,7 @@ void BinaryOperator::deleteAll(){
     free(  argument2_result );
     free( dargument1_result );
     free( dargument2_result );
+    free( argument2_batch   );
 }
 
 
@@ -93,6 +93,17 @@ returnValue DoubleConstant::evaluate( int number, double *x, double *result ){
 }
 
 
+returnValue DoubleConstant::evaluateBatch( int nLanes, int ldx, double *x, double *result ){
+
+    int run1;
+
+    for( run1 = 0; run1 < nLanes; run1++ )
+        result[run1] = value;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 
 Operator* DoubleConstant::differentiate( int index ){
 
@@ -177,6 +177,12 @@ returnValue NonsmoothOperator::evaluate( int number, double *x, double *result )
 }
 
 
+returnValue NonsmoothOperator::evaluateBatch( int nLanes, int ldx, double *x, double *result ){
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 
 Operator* NonsmoothOperator::differentiate( int index ){
 
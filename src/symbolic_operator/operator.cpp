@@ -51,6 +51,12 @@ Operator::Operator(){
 Operator::~Operator(){ }
 
 
+returnValue Operator::evaluateBatch( int nLanes, int ldx, double *x, double *result ){
+
+    return RET_NOT_IMPLEMENTED_YET;
+}
+
+
 TreeProjection& Operator::operator=( const double &arg ){
 
     ACADOERROR( RET_UNKNOWN_BUG );
@@ -83,6 +83,28 @@ returnValue Power::evaluate( int number, double *x, double *result ){
 }
 
 
+returnValue Power::evaluateBatch( int nLanes, int ldx, double *x, double *result ){
+
+    int run1;
+
+    returnValue returnvalue = argument1->evaluateBatch( nLanes, ldx, x, result );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    if( nLanes > batchSize ){
+        batchSize = nLanes;
+        argument2_batch = (double*)realloc(argument2_batch,batchSize*sizeof(double));
+    }
+
+    returnvalue = argument2->evaluateBatch( nLanes, ldx, x, argument2_batch );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    for( run1 = 0; run1 < nLanes; run1++ )
+        result[run1] = pow( result[run1], argument2_batch[run1] );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 
 Operator* Power::differentiate( int index ){
 
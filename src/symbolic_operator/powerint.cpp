@@ -150,6 +150,20 @@ returnValue Power_Int::evaluate( int number, double *x, double *result ){
 }
 
 
+returnValue Power_Int::evaluateBatch( int nLanes, int ldx, double *x, double *result ){
+
+    int run1;
+
+    returnValue returnvalue = argument->evaluateBatch( nLanes, ldx, x, result );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    for( run1 = 0; run1 < nLanes; run1++ )
+        result[run1] = pow( result[run1], exponent );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 
 Operator* Power_Int::differentiate( int index ){
 
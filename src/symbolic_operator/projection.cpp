@@ -164,6 +164,18 @@ returnValue Projection::evaluate( int number, double *x, double *result ){
 }
 
 
+returnValue Projection::evaluateBatch( int nLanes, int ldx, double *x, double *result ){
+
+    int run1;
+    const double *xVar = &x[variableIndex*ldx];
+
+    for( run1 = 0; run1 < nLanes; run1++ )
+        result[run1] = xVar[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 
 Operator* Projection::differentiate( int index ){
 
@@ -145,6 +145,20 @@ returnValue UnaryOperator::evaluate( int number, double *x, double *result ){
 }
 
 
+returnValue UnaryOperator::evaluateBatch( int nLanes, int ldx, double *x, double *result ){
+
+    int run1;
+
+    returnValue returnvalue = argument->evaluateBatch( nLanes, ldx, x, result );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    for( run1 = 0; run1 < nLanes; run1++ )
+        result[run1] = (*fcn)( result[run1] );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 Operator* UnaryOperator::AD_forward( int                dim      ,
                                        VariableType      *varType  ,
                                        int               *component,
@@ -156,6 +156,91 @@ returnValue LogCollection::clearAllRecords( )
 }
 
 
+returnValue LogCollection::clearAllValues( )
+{
+	MatrixVariablesGrid emptyValues;
+
+	LogRecord* record = first;
+
+	while ( record != 0 )
+	{
+		for( uint i=0; i<record->getNumItems( ); ++i )
+			(*record)( i ).setAllValues( record->getLogFrequency( ),emptyValues );
+
+		record = record->getNext( );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue LogCollection::mergeValues(	LogCollection& rhs
+										)
+{
+	uint name;
+	LogRecordItemType type;
+
+	MatrixVariablesGrid newValues;
+	MatrixVariablesGrid otherValues;
+
+	for( uint i=0; i<rhs.getNumLogRecords( ); ++i )
+	{
+		LogRecord& currentRecord = rhs( i );
+
+		for( uint j=0; j<currentRecord.getNumItems( ); ++j )
+		{
+			if ( currentRecord( j ).isWriteProtected( ) == BT_TRUE )
+				continue;
+
+			name = currentRecord( j ).getName();
+			type = currentRecord( j ).getType();
+
+			currentRecord.getAll( name,type,newValues );
+
+			// items contained in several records are merged only once
+			BooleanType isSource = BT_TRUE;
+
+			for( uint k=0; k<rhs.getNumLogRecords( ); ++k )
+			{
+				if ( ( k == i ) || ( rhs( k ).hasItem( name,type ) == BT_FALSE ) )
+					continue;
+
+				rhs( k ).getAll( name,type,otherValues );
+
+				if ( ( otherValues.getNumPoints( ) > newValues.getNumPoints( ) ) ||
+					 ( ( otherValues.getNumPoints( ) == newValues.getNumPoints( ) ) && ( k < i ) ) )
+					isSource = BT_FALSE;
+			}
+
+			if ( isSource == BT_FALSE )
+				continue;
+
+			for( uint k=0; k<newValues.getNumPoints( ); ++k )
+			{
+				// time labels that have been generated automatically are generated anew
+				double time = newValues.getTime( k );
+
+				if ( currentRecord.getLogFrequency( ) == LOG_AT_EACH_ITERATION )
+				{
+					if ( acadoIsEqual( time,(double)k + 1.0 ) == BT_TRUE )
+						time = -INFTY;
+				}
+				else
+				{
+					if ( acadoIsEqual( time,0.0 ) == BT_TRUE )
+						time = -INFTY;
+				}
+
+				if ( setLast( name,type,newValues.getMatrix( k ),time ) != SUCCESSFUL_RETURN )
+					return ACADOERROR( RET_LOG_COLLECTION_CORRUPTED );
+			}
+		}
+	}
+
+	return rhs.clearAllValues( );
+}
+
+
 returnValue LogCollection::print(	LogPrintMode _mode
 									) const
 {
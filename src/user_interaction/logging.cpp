@@ -119,6 +119,20 @@ returnValue Logging::updateLogRecord(	LogRecord& _record
 
 
 
+returnValue Logging::mergeLogValues(	Logging& rhs
+										)
+{
+	return logCollection.mergeValues( rhs.logCollection );
+}
+
+
+returnValue Logging::clearLogValues( )
+{
+	return logCollection.clearAllValues( );
+}
+
+
+
 uint Logging::getNumLogRecords( ) const
 {
 	return logCollection.getNumLogRecords( );
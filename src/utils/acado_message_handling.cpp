@@ -227,6 +227,8 @@ ReturnValueList returnValueList[] =
 { RET_FINAL_STEP_NOT_PERFORMED_YET,				"The integration routine is not ready", VS_VISIBLE },
 { RET_ALREADY_FROZEN,							"The integrator is already freezing or frozen", VS_VISIBLE },
 { RET_MAX_NUMBER_OF_STEPS_EXCEEDED,				"The maximum number of steps has been exceeded", VS_VISIBLE },
+{ RET_INTEGRATOR_DEADLINE_REACHED,				"The integration routine stopped as its deadline has been reached", VS_VISIBLE },
+{ RET_STIFFNESS_DETECTED,						"The explicit integrator stopped as the problem appears to be stiff", VS_VISIBLE },
 { RET_WRONG_DEFINITION_OF_SEEDS,				"The seeds are not set correctly", VS_VISIBLE },
 { RET_NOT_FROZEN,								"The mesh is not frozen and/or forward results not stored", VS_VISIBLE },
 { RET_TO_MANY_DIFFERENTIAL_STATES,				"There are to many differential states", VS_VISIBLE },
@@ -259,6 +261,7 @@ ReturnValueList returnValueList[] =
 { RET_OPTALG_PREPARE_FAILED,					"Preparation step of optimization algorithm failed", VS_VISIBLE },
 { RET_OPTALG_SOLVE_FAILED,						"Problem could not be solved with given optimization algorithm", VS_VISIBLE },
 { RET_REALTIME_NO_INITIAL_VALUE,				"No initial value has been specified", VS_VISIBLE },
+{ RET_SOLUTION_CACHE_UPDATE_FAILED,			"The solution could not be added to the solution cache", VS_VISIBLE },
 
 /* INTEGRATION_ALGORITHM: */
 { RET_INTALG_INIT_FAILED, 						"Initialization of integration algorithm failed", VS_VISIBLE },
@@ -274,6 +277,7 @@ ReturnValueList returnValueList[] =
 { RET_NLP_INIT_FAILED,							"Initialization of NLP solver failed", VS_VISIBLE },
 { RET_NLP_STEP_FAILED,							"Step of NLP solver failed", VS_VISIBLE },
 { RET_NLP_SOLUTION_FAILED,						"NLP solution failed", VS_VISIBLE },
+{ RET_NLP_TIME_BUDGET_EXCEEDED,					"NLP solver stopped as its time budget has been used up", VS_VISIBLE },
 { RET_INITIALIZE_FIRST,							"Object needs to be initialized first", VS_VISIBLE },
 { RET_SOLVER_NOT_SUTIABLE_FOR_REAL_TIME_MODE,	"The specified NLP solver is not designed for a real-time mode", VS_VISIBLE },
 { RET_ILLFORMED_HESSIAN_MATRIX,					"Hessian matrix is too ill-posed to continue", VS_VISIBLE },
@@ -286,6 +290,7 @@ ReturnValueList returnValueList[] =
 { RET_CONIC_PROGRAM_INFEASIBLE,					"The optimization problem is infeasible", VS_VISIBLE },
 { RET_CONIC_PROGRAM_SOLUTION_FAILED,			"Conic Program solution failed. The optimization problem might be infeasible", VS_VISIBLE },
 { RET_CONIC_PROGRAM_NOT_SOLVED,					"The Conic Program has not been solved successfully", VS_VISIBLE },
+{ RET_BARRIER_STEP_NOT_AVAILABLE,				"Barrier steps are not available as the Conic Program is condensed, it is solved to optimality instead", VS_VISIBLE },
 
 /* CP SOLVER */
 { RET_UNABLE_TO_CONDENSE,						"Unable to condense banded CP", VS_VISIBLE },
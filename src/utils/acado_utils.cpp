@@ -38,6 +38,11 @@
 #endif
 
 
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
+
+
 #include <acado/utils/acado_utils.hpp>
 
 
@@ -45,6 +50,10 @@
 BEGIN_NAMESPACE_ACADO
 
 
+/* number of threads of the shared thread pool (0: OpenMP default) */
+static int acadoNumThreads = 0;
+
+
 /*
  *	p r i n t C o p y r i g h t N o t i c e
  */
@@ -107,6 +116,50 @@ double acadoGetTime( )
 }
 
 
+/*
+ *	s e t N u m T h r e a d s
+ */
+returnValue acadoSetNumThreads(	int nThreads
+								)
+{
+	if ( nThreads < 0 )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	acadoNumThreads = nThreads;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+/*
+ *	g e t N u m T h r e a d s
+ */
+int acadoGetNumThreads( )
+{
+	#ifdef _OPENMP
+	if ( acadoNumThreads > 0 )
+		return acadoNumThreads;
+
+	return omp_get_max_threads( );
+	#else
+	return 1;
+	#endif
+}
+
+
+/*
+ *	g e t T h r e a d N u m
+ */
+int acadoGetThreadNum( )
+{
+	#ifdef _OPENMP
+	return omp_get_thread_num( );
+	#else
+	return 0;
+	#endif
+}
+
+
 BooleanType acadoIsInteger( double x )
 {
 	//if ( fabs( x - floor( x + 0.5) ) < 10000.0*EPS )